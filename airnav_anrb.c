@@ -8,36 +8,46 @@
  */
 #include "airnav_anrb.h"
 
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/epoll.h>
+
 
 char txend[2] = {'~','*'};
 
-pthread_mutex_t m_anrb_list;
-pthread_t t_anrb;
-pthread_t t_anrb_send;
 pthread_mutex_t m_copy2; // Mutex copy
 
+static struct evloop *anrb_loop; // ANRB loop; all ANRB I/O runs on it
+static int anrb_listen_socket = -1;
+static int anrb_listen_id = -1;
+
+static void anrb_acceptClients(void *arg);
+static void anrb_clientReady(void *arg);
+
 /*
- * Thread that wait for servers to connect
+ * Open the ANRB listening socket and watch it from loop.
+ * Clients are accepted, fed and dropped from that loop's thread.
  */
-void *anrb_threadWaitNewANRB(void *arg) {
+int anrb_init(struct evloop *loop) {
+    struct sockaddr_in server;
+
+    anrb_loop = loop;
+
+    for (int i = 0; i < MAX_ANRB; i++) {
+        anrbList[i].active = 0;
+        anrbList[i].socket = -1;
+        anrbList[i].ev_id = -1;
+    }
 
-    MODES_NOTUSED(arg);
-    signal(SIGCHLD, SIG_IGN);
-    signal(SIGPIPE, net_sigpipe_handler);
-    signal(SIGINT, rbfeederSigintHandler);
-    signal(SIGTERM, rbfeederSigtermHandler);
-
-    int socket_desc, client_sock, c, slot;
-    struct sockaddr_in server, client;
-    
     //Create socket
-    socket_desc = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
-    if (socket_desc == -1) {
-        printf("Could not create socket");
+    anrb_listen_socket = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (anrb_listen_socket == -1) {
+        airnav_log("Could not create socket for ANRB channel: %s\n", strerror(errno));
+        return 0;
     }
     // Set reusable option
     int iSetOption = 1;
-    setsockopt(socket_desc, SOL_SOCKET, SO_REUSEADDR, (char*) &iSetOption, sizeof (iSetOption));
+    setsockopt(anrb_listen_socket, SOL_SOCKET, SO_REUSEADDR, (char*) &iSetOption, sizeof (iSetOption));
 
     //Prepare the sockaddr_in structure
     server.sin_family = AF_INET;
@@ -45,75 +55,46 @@ void *anrb_threadWaitNewANRB(void *arg) {
     server.sin_port = htons(anrb_port);
 
     //Bind
-    if (bind(socket_desc, (struct sockaddr *) &server, sizeof (server)) < 0) {
+    if (bind(anrb_listen_socket, (struct sockaddr *) &server, sizeof (server)) < 0) {
         airnav_log("Bind failed on ANRB channel. Port: %d\n", anrb_port);
-        return NULL;
-        //  exit(EXIT_FAILURE);
+        close(anrb_listen_socket);
+        anrb_listen_socket = -1;
+        return 0;
     }
 
     //Listen
-    listen(socket_desc, MAX_ANRB);
-
-    if (fcntl(socket_desc, F_GETFL) & O_NONBLOCK) {
-        // socket is non-blocking
-        airnav_log_level(2, "Socket is in non-blocking mode!\n");
-    } else {
-        airnav_log_level(2, "Socket is in blocking mode!\n");
+    if (listen(anrb_listen_socket, MAX_ANRB) < 0
+            || (anrb_listen_id = evloop_addFd(loop, anrb_listen_socket, EPOLLIN, anrb_acceptClients, NULL)) < 0) {
+        airnav_log("Could not listen on ANRB channel: %s\n", strerror(errno));
+        close(anrb_listen_socket);
+        anrb_listen_socket = -1;
+        return 0;
     }
 
-    //Accept and incoming connection
     airnav_log("Socket for ANRB created. Waiting for connections on port %d\n", anrb_port);
-    c = sizeof (struct sockaddr_in);
-
-    fd_set readSockSet;
-    struct timeval timeout;
-    int retval = -1;
-
-    while (!Modes.exit) {
-
-
-        FD_ZERO(&readSockSet);
-        FD_SET(socket_desc, &readSockSet);
-        timeout.tv_sec = 5;
-        timeout.tv_usec = 0;
-
-
-        retval = select(socket_desc + 1, &readSockSet, NULL, NULL, &timeout);
-        if (retval > 0) {
-            if (FD_ISSET(socket_desc, &readSockSet)) {
-                airnav_log("TCP Client (ANRB) requesting to connect...\n");
-
-                client_sock = accept(socket_desc, (struct sockaddr *) &client, (socklen_t*) & c);
-                slot = anrb_getNextFreeANRBSlot();
-
-                if (slot > -1) {
-                    pthread_mutex_lock(&m_anrb_list);
-                    *anrbList[slot].socket = client_sock;
-                    anrbList[slot].active = 1;
-                    pthread_mutex_unlock(&m_anrb_list);
-                    airnav_log("[Slot %d] New ANRB connection from IP %s, remote port %d, socket: %d\n", slot, inet_ntoa(client.sin_addr), ntohs(client.sin_port), client_sock);
-                    net_enable_keepalive(client_sock);
-
-                    if (pthread_create(&anrbList[slot].s_thread, NULL, anrb_threadhandlerANRBData, (void*) anrbList[slot].socket) < 0) {
-                        perror("could not create [anrb] thread");
-                    }
-
-                } else {
-                    airnav_log("No more slot for anrb connection.\n");
-                }
-
-
-            }
+    return 1;
+}
 
-        } else if (retval < 0) {
-            airnav_log("Unknow error while waiting for connection...\n");
+/*
+ * Drop every client and stop listening. Runs on the ANRB thread once its
+ * loop has stopped.
+ */
+void anrb_close(void) {
+    for (int i = 0; i < MAX_ANRB; i++) {
+        if (anrbList[i].active == 1) {
+            evloop_removeFd(anrb_loop, anrbList[i].ev_id);
+            close(anrbList[i].socket);
+            anrbList[i].socket = -1;
+            anrbList[i].active = 0;
         }
-        usleep(1000);
+        outq_destroy(&anrbList[i].outq);
     }
 
-    airnav_log_level(1, "Exited WaitNewANRB Successfull!\n");
-    pthread_exit(EXIT_SUCCESS);
-
+    if (anrb_listen_socket != -1) {
+        evloop_removeFd(anrb_loop, anrb_listen_id);
+        close(anrb_listen_socket);
+        anrb_listen_socket = -1;
+    }
 }
 
 
@@ -128,181 +109,228 @@ short anrb_getNextFreeANRBSlot(void) {
     return -1;
 }
 
+static void anrb_disconnect(struct s_anrb *client, const char *reason) {
+    int slot = client - anrbList;
 
-/*
- * This will handle server connections
- * */
-void *anrb_threadhandlerANRBData(void *socket_desc) {
-
-    //Get the socket descriptor
-    int *sock = NULL;
-    sock = socket_desc;
-    int read_size = 0;
-    //char temp_char[4096];
-    char *temp_char = malloc(4097);
-    int slot = -1;
-    int abort = 0;
-    signal(SIGCHLD, SIG_IGN);
-    signal(SIGPIPE, net_sigpipe_handler);
-
-    
-    // Find which slot we are!
-    airnav_log_level(2, "Sock no data handler: %d\n", *sock);
-    pthread_mutex_lock(&m_anrb_list);
-    for (int j = 0; j < MAX_ANRB; j++) {
-        if (anrbList[j].socket != NULL) {
-            if (*anrbList[j].socket == *sock) {
-                slot = j;
-                break;
-            }
-        }
-    }
-    pthread_mutex_unlock(&m_anrb_list);
+    evloop_removeFd(anrb_loop, client->ev_id);
+    close(client->socket);
+    client->socket = -1;
+    client->ev_id = -1;
+    client->active = 0;
+    client->port = 0;
+    outq_reset(&client->outq);
 
-    if (slot > -1) {
+    airnav_log("ANRB at slot %d disconnected (%s).\n", slot, reason);
+}
 
-        airnav_log_level(5, "Slot for this anrb connection is: %d\n", slot);
+/*
+ * Queue one encoded message for a client. A client whose queue is full
+ * has fallen too far behind; it is dropped rather than allowed to hold
+ * up the others or be fed a stream with holes in it.
+ */
+static void anrb_queueMessage(struct s_anrb *client, const char *msg, size_t len) {
+    int ret = outq_send(&client->outq, client->socket, msg, len);
 
-        // Send initial info
+    if (ret < 0) {
+        anrb_disconnect(client, "send error");
+        return;
+    }
 
-        char *tmp_vers = calloc(70, sizeof (char));
-        sprintf(tmp_vers, "$VER,%s", BDTIME);
-        char *ver = anrb_xorencrypt(tmp_vers, xorkey);
-        gchar *base = g_base64_encode((const guchar*) ver, strlen(ver));
-        airnav_log_level(2, "Base64: %s\n", base);
-        int tamanho = strlen(base);
+    if (ret == 0) {
+        airnav_log_level(2, "ANRB at slot %d is not keeping up, %zu bytes queued.\n", (int) (client - anrbList), client->outq.len);
+        anrb_disconnect(client, "too slow");
+        return;
+    }
 
-        send(*sock, base, tamanho, 0);
-        //send(*sock,(char*)"\n",1,0);
-        send(*sock, &txend[0], 1, 0);
-        send(*sock, &txend[1], strlen((char*) "*"), 0);
-        free(tmp_vers);
-        free(ver);
-        g_free(base);
+    // Wait for room in the socket to send the rest
+    if (client->outq.len > 0 && !client->want_write) {
+        evloop_modifyFd(anrb_loop, client->ev_id, EPOLLIN | EPOLLOUT);
+        client->want_write = 1;
+    }
+}
 
+/*
+ * XOR with xorkey, base64, then the end of TX marker. out must have room
+ * for ANRB_ENCODED_SIZE(len) bytes. Returns the encoded length.
+ */
+static size_t anrb_encode(const char *message, size_t len, char *out) {
+    size_t keylen = strlen(xorkey);
+    guchar encrypted[ANRB_LINE_SIZE];
+    gint state = 0, save = 0;
+    size_t n;
+
+    if (len > sizeof (encrypted)) {
+        len = sizeof (encrypted);
+    }
+    for (size_t i = 0; i < len; i++) {
+        encrypted[i] = message[i] ^ xorkey[i % keylen];
+    }
 
-        // Initial com
-        while (abort != 1) {
+    n = g_base64_encode_step(encrypted, len, FALSE, out, &state, &save);
+    n += g_base64_encode_close(FALSE, out + n, &state, &save);
+    out[n++] = txend[0];
+    out[n++] = txend[1];
+    return n;
+}
 
-            if (Modes.exit) {
-                abort = 1;
-            }
+/*
+ * The listening socket is readable: accept whoever is waiting
+ */
+static void anrb_acceptClients(void *arg) {
+    MODES_NOTUSED(arg);
 
-            // Let's clear the incoming buffer, if exists
-            read_size = recv(*sock, temp_char, 4096, MSG_DONTWAIT);
-            if (read_size != 0) { // Connection still active
-                usleep(10000);
-            } else {
-                abort = 1;
-                break;
-            }
+    struct sockaddr_in client;
+    socklen_t c = sizeof (client);
+    int client_sock, slot;
 
+    while ((client_sock = accept(anrb_listen_socket, (struct sockaddr *) &client, &c)) >= 0) {
+        airnav_log("TCP Client (ANRB) requesting to connect...\n");
+        fcntl(client_sock, F_SETFL, fcntl(client_sock, F_GETFL) | O_NONBLOCK);
+        fcntl(client_sock, F_SETFD, FD_CLOEXEC);
 
+        slot = anrb_getNextFreeANRBSlot();
+        if (slot < 0) {
+            airnav_log("No more slot for anrb connection.\n");
+            close(client_sock);
+            continue;
         }
-    } else {
-        airnav_log("[anrb_handle] Invalid slot for this anrb (%d)\n", slot);
-    }
-
-    airnav_log_level(3, "ANRB [%d] disconnected. Cleaning lists...\n", slot);
-    pthread_mutex_lock(&m_anrb_list);
-    close(*anrbList[slot].socket);
-    *anrbList[slot].socket = -1;
-    // Let's clear some info and free memory
-    anrbList[slot].active = 0;
-    anrbList[slot].port = 0;
 
-    airnav_log("ANRB at slot %d disconnected.\n", slot);
-    pthread_mutex_unlock(&m_anrb_list);
-    free(temp_char);
-    pthread_exit(EXIT_SUCCESS);
+        struct s_anrb *a = &anrbList[slot];
+        if (a->outq.buf == NULL && !outq_init(&a->outq, ANRB_OUTQ_SIZE)) {
+            airnav_log("Could not allocate memory for ANRB output queue.\n");
+            close(client_sock);
+            continue;
+        }
 
-}
+        net_enable_keepalive(client_sock);
+        a->ev_id = evloop_addFd(anrb_loop, client_sock, EPOLLIN, anrb_clientReady, a);
+        if (a->ev_id < 0) {
+            airnav_log("Could not watch ANRB connection: %s\n", strerror(errno));
+            close(client_sock);
+            continue;
+        }
 
+        a->socket = client_sock;
+        a->port = ntohs(client.sin_port);
+        a->want_write = 0;
+        a->active = 1;
+        airnav_log("[Slot %d] New ANRB connection from IP %s, remote port %d, socket: %d\n", slot, inet_ntoa(client.sin_addr), ntohs(client.sin_port), client_sock);
 
-char *anrb_xorencrypt(char * message, char * key) {
-    size_t messagelen = strlen(message);
-    size_t keylen = strlen(key);
+        // Send initial info
+        char ver[70];
+        char encoded[ANRB_ENCODED_SIZE(sizeof (ver))];
+        snprintf(ver, sizeof (ver), "$VER,%s", BDTIME);
+        size_t len = anrb_encode(ver, strlen(ver), encoded);
+        airnav_log_level(2, "Base64: %.*s\n", (int) len - 2, encoded);
+        anrb_queueMessage(a, encoded, len);
+
+        c = sizeof (client);
+    }
 
-    char * encrypted = malloc(messagelen + 1);
+    if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+        airnav_log("Unknow error while waiting for connection: %s\n", strerror(errno));
+    }
+}
 
-    unsigned int i;
-    for (i = 0; i < messagelen; i++) {
-        encrypted[i] = message[i] ^ key[i % keylen];
+/*
+ * A client socket is readable (anything it sends is ignored, but EOF
+ * means it went away) or has room for queued output
+ */
+static void anrb_clientReady(void *arg) {
+    struct s_anrb *client = arg;
+    char discard[4096];
+    ssize_t n;
+
+    while ((n = recv(client->socket, discard, sizeof (discard), MSG_DONTWAIT)) > 0)
+        ;
+    if (n == 0) {
+        anrb_disconnect(client, "closed by peer");
+        return;
+    }
+    if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+        anrb_disconnect(client, "receive error");
+        return;
     }
-    encrypted[messagelen] = '\0';
 
-    return encrypted;
+    if (client->outq.len > 0) {
+        int ret = outq_flush(&client->outq, client->socket);
+        if (ret < 0) {
+            anrb_disconnect(client, "send error");
+            return;
+        }
+        if (ret == 1 && client->want_write) {
+            evloop_modifyFd(anrb_loop, client->ev_id, EPOLLIN);
+            client->want_write = 0;
+        }
+    }
 }
 
 
 /*
- * Thread to send data
+ * Send whatever prepareData queued for the ANRB clients.
+ * Runs on the ANRB event loop when flist2 is filled. Each packet is
+ * formatted and encoded once and the same bytes are queued for every
+ * client; a client that cannot take them right away only affects itself.
  */
-void *anrb_threadSendDataANRB(void *argv) {
-    MODES_NOTUSED(argv);
-    
-    signal(SIGCHLD, SIG_IGN);
-    signal(SIGPIPE, net_sigpipe_handler);
-    signal(SIGINT, rbfeederSigintHandler);
-    signal(SIGTERM, rbfeederSigtermHandler);
-    
-    struct packet_list *tmp1, *local_list;
-    uint64_t now = mstime();
+void anrb_sendData(void *arg) {
+    MODES_NOTUSED(arg);
 
+    struct packet_list *tmp1, *local_list;
+    uint64_t now;
+    char p_timestamp[20];
+    char line[ANRB_LINE_SIZE];
+    char encoded[ANRB_ENCODED_SIZE(ANRB_LINE_SIZE)];
+    int clients = 0;
+
+    pthread_mutex_lock(&m_copy2);
+    local_list = flist2;
+    flist2 = NULL;
+    pthread_mutex_unlock(&m_copy2);
+    now = mstime();
 
-    while (!Modes.exit) {
+    for (int i = 0; i < MAX_ANRB; i++) {
+        clients += anrbList[i].active;
+    }
 
-        pthread_mutex_lock(&m_copy2);
-        local_list = flist2;
-        flist2 = NULL;
-        pthread_mutex_unlock(&m_copy2);
-        now = mstime();
+    // Timestamp packets
+    time_t timer;
+    time(&timer);
+    strftime(p_timestamp, sizeof (p_timestamp), "%Y%m%d%H%M%S", localtime(&timer));
 
-        while (local_list != NULL) {
-            if (local_list->packet != NULL) {
-                if ((now - local_list->packet->timestp) > 60000) {
-                    airnav_log("Address %06X invalid (more than 60 seconds timestamp). Now: $llu, packet timestamp: %llu\n", local_list->packet->modes_addr,
-                            now, local_list->packet->timestp);
-                }
+    while (local_list != NULL) {
+        if (local_list->packet != NULL) {
+            if ((now - local_list->packet->timestp) > 60000) {
+                airnav_log("Address %06X invalid (more than 60 seconds timestamp). Now: $llu, packet timestamp: %llu\n", local_list->packet->modes_addr,
+                        now, local_list->packet->timestp);
             }
 
-            pthread_mutex_lock(&m_anrb_list);
-            for (int i = 0; i < MAX_ANRB; i++) {
-                if (anrbList[i].active == 1) {
-                    if (local_list->packet != NULL) {
-                        anrb_sendANRBPacket(anrbList[i].socket, local_list->packet);
+            size_t len;
+            if (clients > 0 && (len = anrb_formatPacket(local_list->packet, p_timestamp, line, sizeof (line))) > 0) {
+                len = anrb_encode(line, len, encoded);
+                airnav_log_level(2, "Sent: %.*s\n", (int) len - 2, encoded);
+
+                for (int i = 0; i < MAX_ANRB; i++) {
+                    if (anrbList[i].active == 1) {
+                        anrb_queueMessage(&anrbList[i], encoded, len);
                     }
                 }
             }
-            pthread_mutex_unlock(&m_anrb_list);
-
-            if (local_list->packet != NULL) {
-                free(local_list->packet);
-            }
-
-            tmp1 = local_list;
-            local_list = local_list->next;
-            FREE(tmp1);
         }
 
-        sleep(1);
-    }
+        pool_putPData(local_list->packet);
 
-    airnav_log_level(1, "Exited SendDataANRB Successfull!\n");
-    pthread_exit(EXIT_SUCCESS);
- 
+        tmp1 = local_list;
+        local_list = local_list->next;
+        pool_putPacketListNode(tmp1);
+    }
 }
 
 
 /*
- * Send a packet to server socket (PIT/PTA format)
+ * Format a packet as a PTA line (not yet encoded) into buf. Returns its
+ * length, or 0 if the packet has nothing worth sending.
  */
-int anrb_sendANRBPacket(void *socket_, struct p_data *pac) {
-
-#define SP_BUF_SUZE 4096
-    int sock = *(int*) socket_;
-    char *buf_local = malloc(SP_BUF_SUZE);
-    memset(buf_local, 0, SP_BUF_SUZE);
+size_t anrb_formatPacket(const struct p_data *pac, const char *p_timestamp, char *buf, size_t size) {
 
     char callsign[12] = {0};
     char altitude[20] = {0};
@@ -313,77 +341,56 @@ int anrb_sendANRBPacket(void *socket_, struct p_data *pac) {
     char lon[30] = {0};
     char ias[10] = {0};
     char squawk[10] = {0};
-    char prefix[10] = {0};
-    char modes[30] = {0};
     int sendd = 0;
     char p_airborne[2] = {""};
-    if (pac->callsign_set == 1) {
+    if (pac->fields & PDATA_CALLSIGN) {
         memcpy(&callsign, &pac->callsign, 9);
         sendd = 1;
     }
 
-    if (pac->altitude_set == 1) {
+    if (pac->fields & PDATA_ALTITUDE) {
         sprintf(altitude, "%d", pac->altitude);
         sendd = 1;
     }
-    if (pac->gnd_speed_set == 1) {
+    if (pac->fields & PDATA_GND_SPEED) {
         sprintf(gnd_spd, "%d", pac->gnd_speed * 10);
         sendd = 1;
     }
 
-    if (pac->heading_set == 1) {
+    if (pac->fields & PDATA_HEADING) {
         sprintf(heading, "%d", pac->heading * 10);
         sendd = 1;
     }
 
-    if (pac->vert_rate_set == 1) {
+    if (pac->fields & PDATA_VERT_RATE) {
         sprintf(vrate, "%d", pac->vert_rate * 10);
         sendd = 1;
     }
 
-    if (pac->position_set == 1) {
+    if (pac->fields & PDATA_POSITION) {
         sprintf(lat, "%.13f", pac->lat);
         sprintf(lon, "%.13f", pac->lon);
         sendd = 1;
     }
 
-    if (pac->ias_set == 1) {
+    if (pac->fields & PDATA_IAS) {
         sprintf(ias, "%d", pac->ias * 10);
         sendd = 1;
     }
 
-    if (pac->squawk_set == 1) {
+    if (pac->fields & PDATA_SQUAWK) {
         sprintf(squawk, "%04x", pac->squawk);
         sendd = 1;
     }
 
-#ifdef RBCS
-    sprintf(prefix, "RBCS");
-#elif RBLC
-    sprintf(prefix, "RBLC");
-#else
-    sprintf(prefix, "RPI");
-#endif
-
-
-    if (pac->modes_addr_set == 1) {
-
+    if (pac->fields & PDATA_MODES_ADDR) {
         sendd = 1;
         if (pac->modes_addr & MODES_NON_ICAO_ADDRESS) {
             airnav_log_level(3, "Invalid ICAO code.\n");
-        } else {
-            sprintf(modes, "%06X", (pac->modes_addr & 0xffffff));
-
-            if (strlen(modes) > 6) {
-                airnav_log_level(3, "HEX bigger than 6. Size: %d, value: '%s'\n", strlen(modes), modes);
-                memset(&modes, 0, 30);
-            }
         }
-
-
     }
 
-    if (pac->airborne_set == 1) {
+    if (pac->fields & PDATA_AIRBORNE) {
         if (pac->airborne == 1) {
             sprintf(p_airborne, "1");
         } else {
@@ -391,16 +398,11 @@ int anrb_sendANRBPacket(void *socket_, struct p_data *pac) {
         }
     }
 
-    // Timestamp packet
-    time_t timer;
-    //char buffer[26];
-    struct tm* tm_info;
-    time(&timer);
-    tm_info = localtime(&timer);
-    strftime(pac->p_timestamp, 20, "%Y%m%d%H%M%S", tm_info);
-    pac->p_timestamp[20] = '\0';
+    if (sendd != 1) {
+        return 0;
+    }
 
-    sprintf(buf_local,
+    int len = snprintf(buf, size,
             "$PTA,%06X,%s," //
             "%-s," // Callsign
             "%s," // Altitude
@@ -414,7 +416,7 @@ int anrb_sendANRBPacket(void *socket_, struct p_data *pac) {
             "%s,," // Airborne
             ""
             ,
-            pac->modes_addr, pac->p_timestamp,
+            pac->modes_addr, p_timestamp,
             callsign,
             altitude,
             gnd_spd,
@@ -427,26 +429,8 @@ int anrb_sendANRBPacket(void *socket_, struct p_data *pac) {
             p_airborne
             );
 
-
-
-    if (sendd == 1) {
-        // airnav_log("Sending.....\n");
-        int tamanho = strlen(buf_local);
-        char *abc = anrb_xorencrypt(buf_local, xorkey);
-        gchar *base = g_base64_encode((const guchar*) abc, tamanho);
-
-        send(sock, base, strlen(base), 0);
-
-        send(sock, &txend[0], 1, 0);
-        send(sock, &txend[1], strlen((char*) "*"), 0);
-        //send(sock,(char*)"\n",1,0);
-
-        airnav_log_level(2, "Sent: %s\n", base);
-        free(abc);
-
-        g_free(base);
-
+    if (len < 0 || (size_t) len >= size) {
+        return 0;
     }
-    free(buf_local);
-    return 1;
+    return len;
 }
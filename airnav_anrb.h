@@ -10,6 +10,7 @@
 #define AIRNAV_ANRB_H
 
 #include "rbfeeder.h"
+#include "airnav_evloop.h"
 
 
 
@@ -17,19 +18,18 @@
 extern "C" {
 #endif
 
+#define ANRB_OUTQ_SIZE (256 * 1024) // Bytes buffered per ANRB client before it is dropped as too slow
+#define ANRB_LINE_SIZE 512 // Longest PTA line
+#define ANRB_ENCODED_SIZE(n) (((n) / 3 + 1) * 4 + 4 + 2) // base64 of n bytes + end of TX
 
-    extern pthread_mutex_t m_anrb_list;
-    extern pthread_t t_anrb;
-    extern pthread_t t_anrb_send;
     extern char txend[2];
     extern pthread_mutex_t m_copy2; // Mutex copy
     
-    void *anrb_threadWaitNewANRB(void *arg);
+    int anrb_init(struct evloop *loop);
+    void anrb_close(void);
     short anrb_getNextFreeANRBSlot(void);
-    void *anrb_threadhandlerANRBData(void *socket_desc);
-    char *anrb_xorencrypt(char * message, char * key);
-    void *anrb_threadSendDataANRB(void *argv);
-    int anrb_sendANRBPacket(void *socket_, struct p_data *pac);
+    void anrb_sendData(void *arg);
+    size_t anrb_formatPacket(const struct p_data *pac, const char *p_timestamp, char *buf, size_t size);
 
 
 #ifdef __cplusplus
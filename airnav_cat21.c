@@ -0,0 +1,827 @@
+/*
+ * Copyright (c) 2020 - AirNav Systems
+ *
+ * https://www.radarbox.com
+ *
+ * More info: https://github.com/AirNav-Systems/rbfeeder
+ *
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "airnav_cat21.h"
+
+/*
+ * ASTERIX CAT021 (ADS-B target reports) encoder.
+ *
+ * The spec file is looked at once: loadCat21Specs() hands every item to
+ * cat21_uapAddItem() and cat21_uapCompile() gives each item the encoder
+ * knows a slot, in FRN order, with a fixed offset in cat21_record.data.
+ * The cat021_set* functions write an item's bytes at its offset and set
+ * its bit; cat21_blockAdd() then writes FSPEC and the items straight into
+ * the datagram, several records per data block.
+ */
+
+static const struct {
+    const char *id;
+    uint8_t size;
+} cat21_items[CAT21_ITEM_COUNT] = {
+    [CAT21_I008] = {"I021/008", 1},
+    [CAT21_I010] = {"I021/010", 2},
+    [CAT21_I015] = {"I021/015", 1},
+    [CAT21_I016] = {"I021/016", 1},
+    [CAT21_I020] = {"I021/020", 1},
+    [CAT21_I070] = {"I021/070", 2},
+    [CAT21_I071] = {"I021/071", 3},
+    [CAT21_I072] = {"I021/072", 3},
+    [CAT21_I073] = {"I021/073", 3},
+    [CAT21_I074] = {"I021/074", 4},
+    [CAT21_I075] = {"I021/075", 3},
+    [CAT21_I076] = {"I021/076", 4},
+    [CAT21_I077] = {"I021/077", 3},
+    [CAT21_I080] = {"I021/080", 3},
+    [CAT21_I130] = {"I021/130", 6},
+    [CAT21_I131] = {"I021/131", 8},
+    [CAT21_I132] = {"I021/132", 1},
+    [CAT21_I140] = {"I021/140", 2},
+    [CAT21_I145] = {"I021/145", 2},
+    [CAT21_I146] = {"I021/146", 2},
+    [CAT21_I148] = {"I021/148", 2},
+    [CAT21_I150] = {"I021/150", 2},
+    [CAT21_I151] = {"I021/151", 2},
+    [CAT21_I152] = {"I021/152", 2},
+    [CAT21_I155] = {"I021/155", 2},
+    [CAT21_I157] = {"I021/157", 2},
+    [CAT21_I160] = {"I021/160", 4},
+    [CAT21_I161] = {"I021/161", 2},
+    [CAT21_I165] = {"I021/165", 2},
+    [CAT21_I170] = {"I021/170", 6},
+    [CAT21_I200] = {"I021/200", 1},
+    [CAT21_I210] = {"I021/210", 1},
+    [CAT21_I230] = {"I021/230", 2},
+    [CAT21_I400] = {"I021/400", 1},
+};
+
+void cat21_uapReset(struct cat21_uap *uap) {
+    memset(uap, 0, sizeof (*uap));
+    memset(uap->slot, -1, sizeof (uap->slot));
+}
+
+/*
+ * Record the FRN of one item of the spec.
+ * Returns 1 if the encoder will use it, 0 for items it does not write
+ * (variable length items, spares, FX), -1 for a bad FRN or an item whose
+ * length is not the one the encoder writes.
+ */
+int cat21_uapAddItem(struct cat21_uap *uap, const char *id, unsigned frn, unsigned length) {
+
+    if (frn < 1 || frn > CAT21_MAX_FRN) {
+        return -1;
+    }
+
+    for (int i = 0; i < CAT21_ITEM_COUNT; i++) {
+        if (strcmp(id, cat21_items[i].id) == 0) {
+            if (length != cat21_items[i].size) {
+                return -1;
+            }
+            uap->frn[i] = frn;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * Lay the items out in FRN order. Call after the last cat21_uapAddItem().
+ */
+void cat21_uapCompile(struct cat21_uap *uap) {
+    unsigned offset = 0;
+
+    uap->count = 0;
+    for (int i = 0; i < CAT21_ITEM_COUNT; i++) {
+        uap->slot[i] = -1;
+        if (uap->frn[i] == 0) {
+            continue;
+        }
+
+        // Insertion sort by FRN; there are a few dozen items
+        unsigned s = uap->count++;
+        while (s > 0 && uap->slots[s - 1].frn > uap->frn[i]) {
+            uap->slots[s] = uap->slots[s - 1];
+            s--;
+        }
+        uap->slots[s].item = i;
+        uap->slots[s].frn = uap->frn[i];
+        uap->slots[s].size = cat21_items[i].size;
+    }
+
+    for (unsigned s = 0; s < uap->count; s++) {
+        uap->slots[s].offset = offset;
+        offset += uap->slots[s].size;
+        uap->slot[uap->slots[s].item] = s;
+    }
+}
+
+void cat21_recordInit(struct cat21_record *rec, const struct cat21_uap *uap) {
+    rec->uap = uap;
+    rec->present = 0;
+}
+
+/*
+ * Where to write an item, or NULL if the spec does not have it
+ */
+static uint8_t *cat21_item(struct cat21_record *rec, enum cat21_item item) {
+    if (rec == NULL || rec->uap == NULL || rec->uap->slot[item] < 0) {
+        return NULL;
+    }
+
+    const struct cat21_slot *slot = &rec->uap->slots[rec->uap->slot[item]];
+    rec->present |= (uint64_t) 1 << rec->uap->slot[item];
+    return rec->data + slot->offset;
+}
+
+static inline void put16(uint8_t *p, uint16_t v) {
+    p[0] = v >> 8;
+    p[1] = v;
+}
+
+static inline void put24(uint8_t *p, uint32_t v) {
+    p[0] = v >> 16;
+    p[1] = v >> 8;
+    p[2] = v;
+}
+
+static inline void put32(uint8_t *p, uint32_t v) {
+    p[0] = v >> 24;
+    p[1] = v >> 16;
+    p[2] = v >> 8;
+    p[3] = v;
+}
+
+/*
+ * Write FSPEC and the items that were set to out, which needs room for
+ * CAT21_MAX_RECORD_SIZE bytes. Returns the record length (0 if empty).
+ */
+size_t cat21_recordEncode(const struct cat21_record *rec, uint8_t *out) {
+    const struct cat21_slot *slots = rec->uap->slots;
+    uint64_t present = rec->present;
+    uint8_t *p = out;
+
+    if (present == 0) {
+        return 0;
+    }
+
+    // Slots are in FRN order, so the highest one sets the FSPEC length
+    unsigned fspec_len = (slots[63 - __builtin_clzll(present)].frn - 1) / 7 + 1;
+    memset(p, 0, fspec_len);
+    for (uint64_t bits = present; bits; bits &= bits - 1) {
+        unsigned frn = slots[__builtin_ctzll(bits)].frn - 1;
+        p[frn / 7] |= 0x80 >> (frn % 7);
+    }
+    for (unsigned i = 0; i + 1 < fspec_len; i++) {
+        p[i] |= 1; // FX
+    }
+    p += fspec_len;
+
+    for (uint64_t bits = present; bits; bits &= bits - 1) {
+        const struct cat21_slot *slot = &slots[__builtin_ctzll(bits)];
+        memcpy(p, rec->data + slot->offset, slot->size);
+        p += slot->size;
+    }
+
+    return p - out;
+}
+
+/*
+ * size is the datagram size to stay under; a record that is bigger on its
+ * own still goes out alone.
+ */
+int cat21_blockInit(struct cat21_block *blk, size_t size) {
+    memset(blk, 0, sizeof (*blk));
+
+    if (size < CAT21_BLOCK_HEADER_SIZE) {
+        size = CAT21_BLOCK_HEADER_SIZE;
+    }
+    if (size > CAT21_BLOCK_MAX_SIZE - CAT21_MAX_RECORD_SIZE) {
+        size = CAT21_BLOCK_MAX_SIZE - CAT21_MAX_RECORD_SIZE;
+    }
+
+    blk->buf = malloc(size + CAT21_MAX_RECORD_SIZE);
+    if (blk->buf == NULL) {
+        return 0;
+    }
+    blk->size = size;
+    cat21_blockReset(blk);
+
+    return 1;
+}
+
+void cat21_blockDestroy(struct cat21_block *blk) {
+    free(blk->buf);
+    memset(blk, 0, sizeof (*blk));
+}
+
+void cat21_blockReset(struct cat21_block *blk) {
+    blk->len = CAT21_BLOCK_HEADER_SIZE;
+    blk->records = 0;
+}
+
+/*
+ * Append a record. Returns 0 if it would take the block over its size:
+ * send the block, reset it and add the record again.
+ */
+int cat21_blockAdd(struct cat21_block *blk, const struct cat21_record *rec) {
+    // Encoded in place, into the room past size; a record that went out
+    // alone may already have used that up
+    if (blk->records > 0 && blk->len >= blk->size) {
+        return 0;
+    }
+
+    size_t n = cat21_recordEncode(rec, blk->buf + blk->len);
+
+    if (n == 0) {
+        return 1;
+    }
+    if (blk->records > 0 && blk->len + n > blk->size) {
+        return 0;
+    }
+
+    blk->len += n;
+    blk->records++;
+    return 1;
+}
+
+/*
+ * Fill in the block header. Returns the datagram length, 0 if there are
+ * no records to send.
+ */
+size_t cat21_blockFinish(struct cat21_block *blk) {
+    if (blk->records == 0) {
+        return 0;
+    }
+
+    blk->buf[0] = CAT21_CATEGORY;
+    put16(blk->buf + 1, blk->len);
+    return blk->len;
+}
+
+/*
+ * Set Aircraft Operational Status
+ * ID: I021/008
+ * Length: 1
+ */
+int cat021_setAircraftOperStatus(struct cat21_record *rec, char ra, char tc, char ts, char arv, char cdtia, char ntcas, char sa) {
+    uint8_t *data = cat21_item(rec, CAT21_I008);
+    if (data == NULL) {
+        return -1;
+    }
+
+    data[0] = (ra == 1) << 7 | (tc & 3) << 5 | (ts == 1) << 4 | (arv == 1) << 3 | (cdtia == 1) << 2 | (ntcas == 1) << 1 | (sa == 1);
+
+    return 1;
+}
+
+/*
+ * Set data SAC and SIC
+ * ID: I021/010
+ * Length: 2
+ */
+int cat021_setDataSourceSACSIC(struct cat21_record *rec, unsigned int SAC, unsigned int SIC) {
+    if (SAC == 0 || SIC == 0) {
+        return -1;
+    }
+    uint8_t *data = cat21_item(rec, CAT21_I010);
+    if (data == NULL) {
+        return -1;
+    }
+
+    data[0] = SAC;
+    data[1] = SIC;
+
+    return 1;
+}
+
+/*
+ * Set Service Identification
+ * ID: I021/015
+ * Length: 1
+ */
+int cat021_setServiceId(struct cat21_record *rec, unsigned int SID) {
+    if (SID == 0) {
+        return -1;
+    }
+    uint8_t *data = cat21_item(rec, CAT21_I015);
+    if (data == NULL) {
+        return -1;
+    }
+
+    data[0] = SID;
+
+    return 1;
+}
+
+/*
+ * Set Service Management
+ * ID: I021/016
+ * Length: 1
+ */
+int cat021_setServiveManagement(struct cat21_record *rec, char sid) {
+    uint8_t *data = cat21_item(rec, CAT21_I016);
+    if (data == NULL) {
+        return -1;
+    }
+
+    data[0] = sid;
+
+    return 1;
+}
+
+/*
+ * Set Emitter Category
+ * ID: I021/020
+ * Length: 1
+ */
+int cat021_setEmitterCat(struct cat21_record *rec, char cat) {
+    uint8_t *data = cat21_item(rec, CAT21_I020);
+    if (data == NULL) {
+        return -1;
+    }
+
+    data[0] = cat;
+
+    return 1;
+}
+
+/*
+ * Set Mode3A
+ * ID: I021/070
+ * Length: 2
+ */
+int cat021_setMode3A(struct cat21_record *rec, const unsigned char mode3a[2]) {
+    uint8_t *data = cat21_item(rec, CAT21_I070);
+    if (data == NULL) {
+        return -1;
+    }
+
+    data[0] = mode3a[0];
+    data[1] = mode3a[1];
+
+    return 1;
+}
+
+/*
+ * Times of day in 1/128 s, 3 bytes
+ */
+static int cat021_setTime(struct cat21_record *rec, enum cat21_item item, uint32_t time) {
+    uint8_t *data = cat21_item(rec, item);
+    if (data == NULL) {
+        return -1;
+    }
+
+    put24(data, time * 128);
+
+    return 1;
+}
+
+/*
+ * High-precision times: fraction of a second in units of 2^-30 s (about
+ * 0.9313 ns), with the FSI (full second indication) in the top two bits
+ */
+static int cat021_setTimePrecision(struct cat21_record *rec, enum cat21_item item, char fsi, uint32_t time) {
+    uint8_t *data = cat21_item(rec, item);
+    if (data == NULL) {
+        return -1;
+    }
+
+    float r = (float) time / 0.9313;
+    put32(data, (uint32_t) r);
+    data[0] = (data[0] & 0x3f) | (fsi & 3) << 6;
+
+    return 1;
+}
+
+/*
+ * Set Time of Aplicability for Position
+ * ID: I021/071
+ * Length: 3
+ */
+int cat021_setTimeAplicabilityPosition(struct cat21_record *rec, uint32_t time) {
+    return cat021_setTime(rec, CAT21_I071, time);
+}
+
+/*
+ * Set Time of Aplicability for Velocity
+ * ID: I021/072
+ * Length: 3
+ */
+int cat021_setTimeAplicabilityVelocity(struct cat21_record *rec, uint32_t time) {
+    return cat021_setTime(rec, CAT21_I072, time);
+}
+
+/*
+ * Set Time of Message Reception for Position
+ * ID: I021/073
+ * Length: 3
+ */
+int cat021_setTimeMsgRcptPos(struct cat21_record *rec, uint32_t time) {
+    return cat021_setTime(rec, CAT21_I073, time);
+}
+
+/*
+ * Set Time of Message Reception for Position High-precision
+ * ID: I021/074
+ * Length: 4
+ */
+int cat021_setTimeMsgRcptPosPrecision(struct cat21_record *rec, char fsi, uint32_t time) {
+    return cat021_setTimePrecision(rec, CAT21_I074, fsi, time);
+}
+
+/*
+ * Set Time of Message Reception for Velocity
+ * ID: I021/075
+ * Length: 3
+ */
+int cat021_setTimeMsgRcptVel(struct cat21_record *rec, uint32_t time) {
+    return cat021_setTime(rec, CAT21_I075, time);
+}
+
+/*
+ * Set Time of Message Reception for Velocity High-precision
+ * ID: I021/076
+ * Length: 4
+ */
+int cat021_setTimeMsgRcptVelPrecision(struct cat21_record *rec, char fsi, uint32_t time) {
+    return cat021_setTimePrecision(rec, CAT21_I076, fsi, time);
+}
+
+/*
+ * Set Time of ASTERIX Report Tx
+ * ID: I021/077
+ * Length: 3
+ */
+int cat021_setTimeASTERIXReport(struct cat21_record *rec, uint32_t time) {
+    return cat021_setTime(rec, CAT21_I077, time);
+}
+
+/*
+ * Set Target Address
+ * ID: I021/080
+ * Length: 3
+ */
+int cat021_setTargetAddress(struct cat21_record *rec, const unsigned char address[3]) {
+    uint8_t *data = cat21_item(rec, CAT21_I080);
+    if (data == NULL) {
+        return -1;
+    }
+
+    data[0] = address[0];
+    data[1] = address[1];
+    data[2] = address[2];
+
+    return 1;
+}
+
+/*
+ * Set Position in WGS-84 co-ordinates
+ * ID: I021/130
+ * Length: 6
+ */
+int cat021_setPosWGS84(struct cat21_record *rec, double lat, double lon) {
+    uint8_t *data = cat21_item(rec, CAT21_I130);
+    if (data == NULL) {
+        return -1;
+    }
+
+    const float weight = 180. / (1 << 23);
+    int fp_lat = (int) (0.5f + lat / weight);
+    int fp_lon = (int) (0.5f + lon / weight);
+
+    put24(data, fp_lat);
+    put24(data + 3, fp_lon);
+
+    return 1;
+}
+
+/*
+ * Set Position in WGS-84 co-ordinates High-Precision
+ * ID: I021/131
+ * Length: 8
+ */
+int cat021_setPosWGS84Precision(struct cat21_record *rec, double lat, double lon) {
+    uint8_t *data = cat21_item(rec, CAT21_I131);
+    if (data == NULL) {
+        return -1;
+    }
+
+    const float weight = 180. / (1 << 30);
+    int fp_lat = (int) (0.5f + lat / weight);
+    int fp_lon = (int) (0.5f + lon / weight);
+
+    put32(data, fp_lat);
+    put32(data + 4, fp_lon);
+
+    return 1;
+}
+
+/*
+ * Set Message Amplitude
+ * ID: I021/132
+ * Length: 1
+ */
+int cat021_setMessageAmplitude(struct cat21_record *rec, char msg_amp) {
+    uint8_t *data = cat21_item(rec, CAT21_I132);
+    if (data == NULL) {
+        return -1;
+    }
+
+    data[0] = msg_amp;
+
+    return 1;
+}
+
+/*
+ * Set Geometric Height
+ * ID: I021/140
+ * Length: 2
+ */
+int cat021_setGeometricHeight(struct cat21_record *rec, short height) {
+    uint8_t *data = cat21_item(rec, CAT21_I140);
+    if (data == NULL) {
+        return -1;
+    }
+
+    short temp = (height / 6.25);
+    put16(data, temp);
+
+    return 1;
+}
+
+/*
+ * Set Flight Level
+ * ID: I021/145
+ * Length: 2
+ */
+int cat021_setFlightLevel(struct cat21_record *rec, int flevel) {
+    if (flevel <= 0) {
+        return -1;
+    }
+    uint8_t *data = cat21_item(rec, CAT21_I145);
+    if (data == NULL) {
+        return -1;
+    }
+
+    short temp2 = (short) ((float) flevel / 0.25);
+    put16(data, temp2);
+
+    return 1;
+}
+
+/*
+ * Set Selected Altitude
+ * ID: I021/146
+ * Length: 2
+ */
+int cat021_setSelectedAltitude(struct cat21_record *rec, char sas, char source, short level) {
+    uint8_t *data = cat21_item(rec, CAT21_I146);
+    if (data == NULL) {
+        return -1;
+    }
+
+    float tmp = (float) level / (float) 25;
+    put16(data, (short) tmp);
+    data[0] |= (sas == 1) << 7 | (source & 3) << 5;
+
+    return 1;
+}
+
+/*
+ * Set Final State Selected Altitude
+ * ID: I021/148
+ * Length: 2
+ */
+int cat021_setFinalStateSelectedAltitude(struct cat21_record *rec, char mv, char ah, char am, short altitude) {
+    uint8_t *data = cat21_item(rec, CAT21_I148);
+    if (data == NULL) {
+        return -1;
+    }
+
+    float tmp = (float) altitude / (float) 25;
+    put16(data, (short) tmp);
+    data[0] |= (mv == 1) << 7 | (ah == 1) << 6 | (am == 1) << 5;
+
+    return 1;
+}
+
+/*
+ * Two bytes with a flag (IM, RE) in the top bit
+ */
+static int cat021_setFlagged16(struct cat21_record *rec, enum cat21_item item, unsigned int flag, short value) {
+    uint8_t *data = cat21_item(rec, item);
+    if (data == NULL) {
+        return -1;
+    }
+
+    put16(data, value);
+    data[0] = (data[0] & 0x7f) | (flag == 1) << 7;
+
+    return 1;
+}
+
+/*
+ * Set Air Speed
+ * ID: I021/150
+ * Length: 2
+ */
+int cat021_setAirSpeed(struct cat21_record *rec, unsigned int type, short speed) {
+    return cat021_setFlagged16(rec, CAT21_I150, type, speed);
+}
+
+/*
+ * Set True Air Speed
+ * ID: I021/151
+ * Length: 2
+ * RE = Range Exceeded Indicator (1 for exceed)
+ */
+int cat021_setTrueAirSpeed(struct cat21_record *rec, unsigned int re, short speed) {
+    return cat021_setFlagged16(rec, CAT21_I151, re, speed);
+}
+
+/*
+ * Set Magnetic Heading
+ * ID: I021/152
+ * Length: 2
+ */
+int cat021_setMagneticHeading(struct cat21_record *rec, float heading) {
+    uint8_t *data = cat21_item(rec, CAT21_I152);
+    if (data == NULL) {
+        return -1;
+    }
+
+    // Through int: headings over 180 do not fit a short
+    int temp = (heading * (float) 65536.0) / (float) 360.0;
+    put16(data, temp);
+
+    return 1;
+}
+
+/*
+ * Set Barometric Vertical Rate
+ * ID: I021/155
+ * Length: 2
+ * RE = Range Exceeded Indicator (1 for exceed)
+ * INCOMPLETE
+ */
+int cat021_setBaroVertRate(struct cat21_record *rec, unsigned int re, short rate) {
+    return cat021_setFlagged16(rec, CAT21_I155, re, rate);
+}
+
+/*
+ * Set Geometric Vertical Rate
+ * ID: I021/157
+ * Length: 2
+ * RE = Range Exceeded Indicator (1 for exceed)
+ * INCOMPLETE
+ */
+int cat021_setGeoVertRate(struct cat21_record *rec, unsigned int re, short rate) {
+    return cat021_setFlagged16(rec, CAT21_I157, re, rate);
+}
+
+/*
+ * Set Airborne Ground Vector
+ * ID: I021/160
+ * Length: 4
+ */
+int cat021_setAirborneVector(struct cat21_record *rec, char re, short gspeed, short track_angle) {
+    uint8_t *data = cat21_item(rec, CAT21_I160);
+    if (data == NULL) {
+        return -1;
+    }
+
+    short temp = (track_angle * 65536) / 360;
+    short gspeed_t = gspeed / .22;
+
+    put16(data, gspeed_t);
+    put16(data + 2, temp);
+    data[0] = (data[0] & 0x7f) | (re == 1) << 7;
+
+    return 1;
+}
+
+/*
+ * Set Track Number
+ * ID: I021/161
+ * Length: 2
+ */
+int cat021_setTrackNumber(struct cat21_record *rec, short track) {
+    uint8_t *data = cat21_item(rec, CAT21_I161);
+    if (data == NULL) {
+        return -1;
+    }
+
+    put16(data, track);
+
+    return 1;
+}
+
+/*
+ * Set Track Angle Rate
+ * ID: I021/165
+ * Length: 2
+ * NEED TO VALIDATE!!!!!
+ */
+int cat021_setTrackAngleRate(struct cat21_record *rec, float rate) {
+    uint8_t *data = cat21_item(rec, CAT21_I165);
+    if (data == NULL) {
+        return -1;
+    }
+
+    put16(data, (short) (rate * 32));
+
+    return 1;
+}
+
+/*
+ * Set Target Identification
+ * ID: I021/170
+ * Length: 6
+ * Eight characters, the low 6 bits of each (IA-5 for A-Z, 0-9, space)
+ */
+int cat021_setTargetId(struct cat21_record *rec, const char tid[8]) {
+    uint8_t *data = cat21_item(rec, CAT21_I170);
+    if (data == NULL) {
+        return -1;
+    }
+
+    uint64_t bits = 0;
+    for (int i = 0; i < 8; i++) {
+        bits = bits << 6 | (tid[i] & 0x3f);
+    }
+    put16(data, bits >> 32);
+    put32(data + 2, bits);
+
+    return 1;
+}
+
+/*
+ * Set Target Status
+ * ID: I021/200
+ * Length: 1
+ */
+int cat021_setTargetStatus(struct cat21_record *rec, char icf, char lnav, char me, char ps, char ss) {
+    uint8_t *data = cat21_item(rec, CAT21_I200);
+    if (data == NULL) {
+        return -1;
+    }
+
+    data[0] = (icf == 1) << 7 | (lnav == 1) << 6 | (me == 1) << 5 | (ps & 7) << 2 | (ss & 3);
+
+    return 1;
+}
+
+/*
+ * Set MOPS Version
+ * ID: I021/210
+ * Length: 1
+ */
+int cat021_setMOPSVersion(struct cat21_record *rec, char vns, char vn, char ltt) {
+    uint8_t *data = cat21_item(rec, CAT21_I210);
+    if (data == NULL) {
+        return -1;
+    }
+
+    data[0] = (vns == 1) << 6 | (vn & 7) << 3 | (ltt & 7);
+
+    return 1;
+}
+
+/*
+ * Set Roll Angle
+ * ID: I021/230
+ * Length: 2
+ */
+int cat021_setRollAngle(struct cat21_record *rec, float angle) {
+    uint8_t *data = cat21_item(rec, CAT21_I230);
+    if (data == NULL) {
+        return -1;
+    }
+
+    put16(data, (short) (angle * 100));
+
+    return 1;
+}
+
+/*
+ * Set ReceiverID
+ * ID: I021/400
+ * Length: 1
+ */
+int cat021_setReceiverID(struct cat21_record *rec, char rec_id) {
+    uint8_t *data = cat21_item(rec, CAT21_I400);
+    if (data == NULL) {
+        return -1;
+    }
+
+    data[0] = rec_id;
+
+    return 1;
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2020 - AirNav Systems
+ *
+ * https://www.radarbox.com
+ *
+ * More info: https://github.com/AirNav-Systems/rbfeeder
+ *
+ */
+#ifndef AIRNAV_CAT21_H
+#define AIRNAV_CAT21_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CAT21_CATEGORY 21
+#define CAT21_MAX_FSPEC_BYTES 7 // 49 FRNs, enough for every CAT021 edition
+#define CAT21_MAX_FRN (CAT21_MAX_FSPEC_BYTES * 7)
+#define CAT21_RECORD_DATA_SIZE 96 // Every item the encoder knows, at once (86 bytes)
+#define CAT21_MAX_RECORD_SIZE (CAT21_MAX_FSPEC_BYTES + CAT21_RECORD_DATA_SIZE)
+#define CAT21_BLOCK_HEADER_SIZE 3 // CAT, LEN
+#define CAT21_BLOCK_MAX_SIZE 65535 // LEN is 16 bits
+
+    // Data items the encoder can write
+    enum cat21_item {
+        CAT21_I008, CAT21_I010, CAT21_I015, CAT21_I016, CAT21_I020,
+        CAT21_I070, CAT21_I071, CAT21_I072, CAT21_I073, CAT21_I074,
+        CAT21_I075, CAT21_I076, CAT21_I077, CAT21_I080, CAT21_I130,
+        CAT21_I131, CAT21_I132, CAT21_I140, CAT21_I145, CAT21_I146,
+        CAT21_I148, CAT21_I150, CAT21_I151, CAT21_I152, CAT21_I155,
+        CAT21_I157, CAT21_I160, CAT21_I161, CAT21_I165, CAT21_I170,
+        CAT21_I200, CAT21_I210, CAT21_I230, CAT21_I400,
+        CAT21_ITEM_COUNT
+    };
+
+    struct cat21_slot {
+        uint8_t item; // enum cat21_item
+        uint8_t frn;
+        uint8_t size;
+        uint8_t offset; // Into cat21_record.data
+    };
+
+    // User Application Profile of the loaded spec, compiled for the encoder:
+    // the items it has, in FRN order, each with a fixed place in the record.
+    // Built by loadCat21Specs() at startup and, on [asterix] force_reload,
+    // by the airnav_prepareData() thread between sweeps; never changes
+    // while a record is being encoded from it.
+    struct cat21_uap {
+        uint8_t frn[CAT21_ITEM_COUNT]; // 0 if the item is not in the spec
+        int8_t slot[CAT21_ITEM_COUNT]; // Index into slots, -1 if not in the spec
+        struct cat21_slot slots[CAT21_ITEM_COUNT];
+        unsigned count;
+    };
+
+    // One target report being filled in by the cat021_set* functions.
+    // Lives on the stack and is reused for every aircraft.
+    struct cat21_record {
+        const struct cat21_uap *uap;
+        uint64_t present; // Bit per slot
+        uint8_t data[CAT21_RECORD_DATA_SIZE];
+    };
+
+    // A CAT021 data block (one datagram): header, then records back to back.
+    struct cat21_block {
+        uint8_t *buf;
+        size_t size; // Flush threshold; buf has room for one record past it
+        size_t len;
+        unsigned records;
+    };
+
+
+    /****** Functions ******/
+    void cat21_uapReset(struct cat21_uap *uap);
+    int cat21_uapAddItem(struct cat21_uap *uap, const char *id, unsigned frn, unsigned length);
+    void cat21_uapCompile(struct cat21_uap *uap);
+
+    void cat21_recordInit(struct cat21_record *rec, const struct cat21_uap *uap);
+    size_t cat21_recordEncode(const struct cat21_record *rec, uint8_t *out);
+
+    int cat21_blockInit(struct cat21_block *blk, size_t size);
+    void cat21_blockDestroy(struct cat21_block *blk);
+    void cat21_blockReset(struct cat21_block *blk);
+    int cat21_blockAdd(struct cat21_block *blk, const struct cat21_record *rec);
+    size_t cat21_blockFinish(struct cat21_block *blk);
+
+    int cat021_setDataSourceSACSIC(struct cat21_record *rec, unsigned int SAC, unsigned int SIC);
+    int cat021_setServiceId(struct cat21_record *rec, unsigned int SID);
+    int cat021_setAirSpeed(struct cat21_record *rec, unsigned int type, short speed);
+    int cat021_setEmitterCat(struct cat21_record *rec, char cat);
+    int cat021_setServiveManagement(struct cat21_record *rec, char sid);
+    int cat021_setReceiverID(struct cat21_record *rec, char rec_id);
+    int cat021_setGeometricHeight(struct cat21_record *rec, short height);
+    int cat021_setMode3A(struct cat21_record *rec, const unsigned char mode3a[2]);
+    int cat021_setMessageAmplitude(struct cat21_record *rec, char msg_amp);
+    int cat021_setTrueAirSpeed(struct cat21_record *rec, unsigned int re, short speed);
+    int cat021_setMagneticHeading(struct cat21_record *rec, float heading);
+    int cat021_setBaroVertRate(struct cat21_record *rec, unsigned int re, short rate);
+    int cat021_setGeoVertRate(struct cat21_record *rec, unsigned int re, short rate);
+    int cat021_setFlightLevel(struct cat21_record *rec, int flevel);
+    int cat021_setTargetId(struct cat21_record *rec, const char tid[8]);
+    int cat021_setTargetAddress(struct cat21_record *rec, const unsigned char address[3]);
+    int cat021_setMOPSVersion(struct cat21_record *rec, char vns, char vn, char ltt);
+    int cat021_setTrackNumber(struct cat21_record *rec, short track);
+    int cat021_setTrackAngleRate(struct cat21_record *rec, float rate);
+    int cat021_setTargetStatus(struct cat21_record *rec, char icf, char lnav, char me, char ps, char ss);
+    int cat021_setSelectedAltitude(struct cat21_record *rec, char sas, char source, short level);
+    int cat021_setFinalStateSelectedAltitude(struct cat21_record *rec, char mv, char ah, char am, short altitude);
+    int cat021_setAircraftOperStatus(struct cat21_record *rec, char ra, char tc, char ts, char arv, char cdtia, char ntcas, char sa);
+    int cat021_setRollAngle(struct cat21_record *rec, float angle);
+    int cat021_setTimeAplicabilityPosition(struct cat21_record *rec, uint32_t time);
+    int cat021_setTimeAplicabilityVelocity(struct cat21_record *rec, uint32_t time);
+    int cat021_setTimeMsgRcptPos(struct cat21_record *rec, uint32_t time);
+    int cat021_setTimeMsgRcptPosPrecision(struct cat21_record *rec, char fsi, uint32_t time);
+    int cat021_setTimeMsgRcptVel(struct cat21_record *rec, uint32_t time);
+    int cat021_setTimeMsgRcptVelPrecision(struct cat21_record *rec, char fsi, uint32_t time);
+    int cat021_setTimeASTERIXReport(struct cat21_record *rec, uint32_t time);
+    int cat021_setPosWGS84(struct cat21_record *rec, double lat, double lon);
+    int cat021_setPosWGS84Precision(struct cat21_record *rec, double lat, double lon);
+    int cat021_setAirborneVector(struct cat21_record *rec, char re, short gspeed, short track_angle);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AIRNAV_CAT21_H */
@@ -13,14 +13,13 @@
 /*
  * Proccess server control packet
  */
-void cmd_proccess_ctr_cmd_packet(uint8_t *packet, unsigned p_size) {
+void cmd_proccess_ctr_cmd_packet(const uint8_t *packet, unsigned p_size) {
 
     ControlCommand *ctr_cmd = control_command__unpack(NULL, p_size, packet);
 
 
     if (ctr_cmd == NULL) {
         airnav_log("Invalid packet data for STR_CMD type.\n");
-        free(packet);
         return;
     }
 
@@ -288,6 +287,5 @@ void cmd_proccess_ctr_cmd_packet(uint8_t *packet, unsigned p_size) {
 
 
     control_command__free_unpacked(ctr_cmd, NULL);
-    free(packet);
 
 }
\ No newline at end of file
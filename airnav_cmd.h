@@ -21,7 +21,7 @@ extern "C" {
 
     
     /****** Functions ******/
-    void cmd_proccess_ctr_cmd_packet(uint8_t *packet, unsigned p_size);
+    void cmd_proccess_ctr_cmd_packet(const uint8_t *packet, unsigned p_size);
 
 
 #ifdef __cplusplus
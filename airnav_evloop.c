@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2020 - AirNav Systems
+ *
+ * https://www.radarbox.com
+ *
+ * More info: https://github.com/AirNav-Systems/rbfeeder
+ *
+ */
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include "airnav_evloop.h"
+
+// epoll data for the stop eventfd; sources use their index
+#define EVLOOP_STOP_ID ((uint64_t) -1)
+
+int evloop_init(struct evloop *loop) {
+    struct epoll_event ev;
+
+    memset(loop, 0, sizeof (*loop));
+    loop->stopfd = -1;
+
+    loop->epfd = epoll_create1(EPOLL_CLOEXEC);
+    if (loop->epfd < 0) {
+        return 0;
+    }
+
+    loop->stopfd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (loop->stopfd < 0) {
+        close(loop->epfd);
+        loop->epfd = -1;
+        return 0;
+    }
+
+    memset(&ev, 0, sizeof (ev));
+    ev.events = EPOLLIN;
+    ev.data.u64 = EVLOOP_STOP_ID;
+    if (epoll_ctl(loop->epfd, EPOLL_CTL_ADD, loop->stopfd, &ev) < 0) {
+        close(loop->stopfd);
+        close(loop->epfd);
+        loop->stopfd = -1;
+        loop->epfd = -1;
+        return 0;
+    }
+
+    return 1;
+}
+
+/*
+ * Closes the fds the loop created itself; EVLOOP_FD sources belong to
+ * the caller and are left open
+ */
+void evloop_destroy(struct evloop *loop) {
+    for (unsigned i = 0; i < loop->nsources; i++) {
+        if (loop->sources[i].type == EVLOOP_TIMER || loop->sources[i].type == EVLOOP_EVENT) {
+            close(loop->sources[i].fd);
+        }
+    }
+    if (loop->stopfd >= 0) {
+        close(loop->stopfd);
+    }
+    if (loop->epfd >= 0) {
+        close(loop->epfd);
+    }
+    memset(loop, 0, sizeof (*loop));
+    loop->epfd = -1;
+    loop->stopfd = -1;
+}
+
+static int evloop_addSource(struct evloop *loop, int fd, uint32_t events, enum evloop_source_type type, evloop_handler handler, void *arg) {
+    struct epoll_event ev;
+    struct evloop_source *src;
+    unsigned id;
+
+    // Reuse a removed slot before growing
+    for (id = 0; id < loop->nsources; id++) {
+        if (loop->sources[id].type == EVLOOP_FREE) {
+            break;
+        }
+    }
+    if (id >= EVLOOP_MAX_SOURCES) {
+        errno = ENOSPC;
+        return -1;
+    }
+
+    memset(&ev, 0, sizeof (ev));
+    ev.events = events;
+    ev.data.u64 = id;
+    if (epoll_ctl(loop->epfd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+        return -1;
+    }
+
+    src = &loop->sources[id];
+    src->fd = fd;
+    src->type = type;
+    src->handler = handler;
+    src->arg = arg;
+    src->runs = 0;
+
+    if (id == loop->nsources) {
+        loop->nsources++;
+    }
+    return (int) id;
+}
+
+/*
+ * Periodic timer; the first expiry is one interval from now. An interval
+ * of 0 creates a one-shot timer that stays idle until evloop_setTimer().
+ * Returns the source id, or -1 on error
+ */
+int evloop_addTimer(struct evloop *loop, unsigned interval_ms, evloop_handler handler, void *arg) {
+    struct itimerspec its;
+    int fd, id;
+
+    fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (fd < 0) {
+        return -1;
+    }
+
+    its.it_interval.tv_sec = interval_ms / 1000;
+    its.it_interval.tv_nsec = (interval_ms % 1000) * 1000000L;
+    its.it_value = its.it_interval;
+    if (timerfd_settime(fd, 0, &its, NULL) < 0) {
+        close(fd);
+        return -1;
+    }
+
+    id = evloop_addSource(loop, fd, EPOLLIN, EVLOOP_TIMER, handler, arg);
+    if (id < 0) {
+        close(fd);
+    }
+    return id;
+}
+
+/*
+ * (Re)arm a timer to fire once, delay_ms from now; 0 disarms it
+ */
+int evloop_setTimer(struct evloop *loop, int id, unsigned delay_ms) {
+    struct itimerspec its;
+
+    if (id < 0 || (unsigned) id >= loop->nsources || loop->sources[id].type != EVLOOP_TIMER) {
+        return 0;
+    }
+
+    memset(&its, 0, sizeof (its));
+    its.it_value.tv_sec = delay_ms / 1000;
+    its.it_value.tv_nsec = (delay_ms % 1000) * 1000000L;
+    return timerfd_settime(loop->sources[id].fd, 0, &its, NULL) == 0;
+}
+
+/*
+ * Wakeup that other threads raise with evloop_signal(). Signals raised
+ * while the handler is pending are coalesced into one call
+ */
+int evloop_addEvent(struct evloop *loop, evloop_handler handler, void *arg) {
+    int fd, id;
+
+    fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (fd < 0) {
+        return -1;
+    }
+
+    id = evloop_addSource(loop, fd, EPOLLIN, EVLOOP_EVENT, handler, arg);
+    if (id < 0) {
+        close(fd);
+    }
+    return id;
+}
+
+/*
+ * Caller-owned fd; the handler is called whenever epoll reports one of
+ * events on it and must consume whatever made it ready
+ */
+int evloop_addFd(struct evloop *loop, int fd, uint32_t events, evloop_handler handler, void *arg) {
+    return evloop_addSource(loop, fd, events, EVLOOP_FD, handler, arg);
+}
+
+/*
+ * Change the events watched on an EVLOOP_FD source, e.g. to add EPOLLOUT
+ * while there is output queued for it
+ */
+int evloop_modifyFd(struct evloop *loop, int id, uint32_t events) {
+    struct epoll_event ev;
+
+    if (id < 0 || (unsigned) id >= loop->nsources || loop->sources[id].type != EVLOOP_FD) {
+        return 0;
+    }
+
+    memset(&ev, 0, sizeof (ev));
+    ev.events = events;
+    ev.data.u64 = (unsigned) id;
+    return epoll_ctl(loop->epfd, EPOLL_CTL_MOD, loop->sources[id].fd, &ev) == 0;
+}
+
+/*
+ * Stop watching an EVLOOP_FD source. The fd may already have been
+ * closed (which drops it from epoll by itself); it is not closed here
+ */
+void evloop_removeFd(struct evloop *loop, int id) {
+    if (id < 0 || (unsigned) id >= loop->nsources || loop->sources[id].type != EVLOOP_FD) {
+        return;
+    }
+
+    epoll_ctl(loop->epfd, EPOLL_CTL_DEL, loop->sources[id].fd, NULL);
+    memset(&loop->sources[id], 0, sizeof (loop->sources[id]));
+    loop->sources[id].fd = -1;
+}
+
+void evloop_signal(struct evloop *loop, int id) {
+    uint64_t one = 1;
+
+    if (id < 0 || (unsigned) id >= loop->nsources || loop->sources[id].type != EVLOOP_EVENT) {
+        return;
+    }
+    // Only fails with EAGAIN when the counter is about to overflow, in
+    // which case a wakeup is already pending
+    if (write(loop->sources[id].fd, &one, sizeof (one)) < 0) {
+        return;
+    }
+}
+
+/*
+ * Waits up to timeout_ms (-1 for ever) and runs the handlers of every
+ * source that became ready. Returns the number of handlers run, or -1
+ * once the loop has been stopped
+ */
+int evloop_runOnce(struct evloop *loop, int timeout_ms) {
+    struct epoll_event events[EVLOOP_MAX_EVENTS];
+    uint64_t count;
+    int n, ran = 0;
+
+    if (loop->stopping) {
+        return -1;
+    }
+
+    n = epoll_wait(loop->epfd, events, EVLOOP_MAX_EVENTS, timeout_ms);
+    if (n < 0) {
+        return (errno == EINTR) ? 0 : -1;
+    }
+    if (n > 0) {
+        loop->wakeups++;
+    }
+
+    for (int i = 0; i < n && !loop->stopping; i++) {
+        struct evloop_source *src;
+
+        if (events[i].data.u64 == EVLOOP_STOP_ID) {
+            loop->stopping = 1;
+            break;
+        }
+
+        src = &loop->sources[events[i].data.u64];
+
+        // Removed by an earlier handler in this batch
+        if (src->type == EVLOOP_FREE) {
+            continue;
+        }
+
+        // Timers and events are drained here, so a handler that runs
+        // late still sees a single expiry instead of a backlog
+        if (src->type != EVLOOP_FD) {
+            if (read(src->fd, &count, sizeof (count)) != sizeof (count)) {
+                continue;
+            }
+        }
+
+        src->handler(src->arg);
+        src->runs++;
+        ran++;
+    }
+
+    return loop->stopping ? -1 : ran;
+}
+
+void evloop_run(struct evloop *loop) {
+    while (evloop_runOnce(loop, -1) >= 0)
+        ;
+}
+
+void evloop_stop(struct evloop *loop) {
+    uint64_t one = 1;
+
+    loop->stopping = 1;
+    if (loop->stopfd >= 0 && write(loop->stopfd, &one, sizeof (one)) < 0) {
+        return;
+    }
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2020 - AirNav Systems
+ *
+ * https://www.radarbox.com
+ *
+ * More info: https://github.com/AirNav-Systems/rbfeeder
+ *
+ */
+#ifndef AIRNAV_EVLOOP_H
+#define AIRNAV_EVLOOP_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define EVLOOP_MAX_SOURCES 64
+#define EVLOOP_MAX_EVENTS 16
+
+    typedef void (*evloop_handler)(void *arg);
+
+    enum evloop_source_type {
+        EVLOOP_FREE = 0, // Unused slot
+        EVLOOP_TIMER, // timerfd, periodic or one-shot
+        EVLOOP_EVENT, // eventfd, raised with evloop_signal()
+        EVLOOP_FD // Caller's own fd, handler does the reading
+    };
+
+    struct evloop_source {
+        int fd;
+        enum evloop_source_type type;
+        evloop_handler handler;
+        void *arg;
+        unsigned long runs; // Times the handler was called
+    };
+
+    // One epoll set driving timers, cross-thread wakeups and plain fds
+    // from a single thread. Sources are added and removed by the thread
+    // that runs the loop; only evloop_signal() and evloop_stop() may be
+    // called from other threads (both are a single write() and are also
+    // safe from a signal handler).
+    struct evloop {
+        int epfd;
+        int stopfd; // eventfd that ends evloop_run()
+        volatile int stopping;
+        unsigned nsources; // Slots in use or freed, never shrinks
+        struct evloop_source sources[EVLOOP_MAX_SOURCES];
+        unsigned long wakeups; // epoll_wait() returns with work to do
+    };
+
+
+    /****** Functions ******/
+    int evloop_init(struct evloop *loop);
+    void evloop_destroy(struct evloop *loop);
+    int evloop_addTimer(struct evloop *loop, unsigned interval_ms, evloop_handler handler, void *arg);
+    int evloop_addEvent(struct evloop *loop, evloop_handler handler, void *arg);
+    int evloop_setTimer(struct evloop *loop, int id, unsigned delay_ms);
+    int evloop_addFd(struct evloop *loop, int fd, uint32_t events, evloop_handler handler, void *arg);
+    int evloop_modifyFd(struct evloop *loop, int id, uint32_t events);
+    void evloop_removeFd(struct evloop *loop, int id);
+    void evloop_signal(struct evloop *loop, int id);
+    int evloop_runOnce(struct evloop *loop, int timeout_ms);
+    void evloop_run(struct evloop *loop);
+    void evloop_stop(struct evloop *loop);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AIRNAV_EVLOOP_H */
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2020 - AirNav Systems
+ * 
+ * https://www.radarbox.com
+ * 
+ * More info: https://github.com/AirNav-Systems/rbfeeder
+ * 
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "airnav_flightenc.h"
+
+/*
+ * Hand-rolled protobuf encoder for the fixed FlightData schema, writing
+ * straight from p_data into a reusable buffer. This replaces building a
+ * FlightData tree (one malloc per flight, plus strdup'd callsigns) and
+ * running protobuf-c's get_packed_size/pack over it for every batch.
+ *
+ * Field numbers and types must follow FlightData in rbfeeder.proto;
+ * fields are written in field-number order, as protobuf-c does, so the
+ * output is byte-for-byte what flight_packet__pack() would produce.
+ */
+
+// Wire types
+#define WT_VARINT 0
+#define WT_FIXED64 1
+#define WT_LEN 2
+
+#define KEY(field, wt) (((uint32_t) (field) << 3) | (wt))
+
+static uint8_t *put_varint(uint8_t *p, uint64_t v) {
+    while (v >= 0x80) {
+        *p++ = (uint8_t) (v | 0x80);
+        v >>= 7;
+    }
+    *p++ = (uint8_t) v;
+    return p;
+}
+
+static uint8_t *put_key(uint8_t *p, unsigned field, unsigned wt) {
+    return put_varint(p, KEY(field, wt));
+}
+
+// int32: negative values are sign-extended to 64 bits (10 bytes)
+static uint8_t *put_int32(uint8_t *p, unsigned field, int32_t v) {
+    p = put_key(p, field, WT_VARINT);
+    return put_varint(p, (uint64_t) (int64_t) v);
+}
+
+static uint8_t *put_uint32(uint8_t *p, unsigned field, uint32_t v) {
+    p = put_key(p, field, WT_VARINT);
+    return put_varint(p, v);
+}
+
+static uint8_t *put_sint32(uint8_t *p, unsigned field, int32_t v) {
+    p = put_key(p, field, WT_VARINT);
+    return put_varint(p, ((uint32_t) v << 1) ^ (uint32_t) (v >> 31));
+}
+
+static uint8_t *put_bool(uint8_t *p, unsigned field, int v) {
+    p = put_key(p, field, WT_VARINT);
+    *p++ = v ? 1 : 0;
+    return p;
+}
+
+static uint8_t *put_double(uint8_t *p, unsigned field, double v) {
+    uint64_t bits;
+
+    memcpy(&bits, &v, sizeof (bits));
+    p = put_key(p, field, WT_FIXED64);
+    for (int i = 0; i < 8; i++) {
+        *p++ = (uint8_t) (bits >> (8 * i));
+    }
+    return p;
+}
+
+static uint8_t *put_string(uint8_t *p, unsigned field, const char *s, size_t max) {
+    size_t len = strnlen(s, max);
+
+    p = put_key(p, field, WT_LEN);
+    p = put_varint(p, len);
+    memcpy(p, s, len);
+    return p + len;
+}
+
+/*
+ * Encode one FlightData body at p, return the end
+ */
+static uint8_t *encode_flight(uint8_t *p, const struct p_data *pac) {
+    uint32_t f = pac->fields;
+
+    p = put_int32(p, 1, pac->modes_addr);
+    if (f & PDATA_CALLSIGN)
+        p = put_string(p, 3, pac->callsign, sizeof (pac->callsign) - 1);
+    if (f & PDATA_ALTITUDE)
+        p = put_int32(p, 4, pac->altitude);
+    if (f & PDATA_POSITION) {
+        p = put_double(p, 6, pac->lat);
+        p = put_double(p, 7, pac->lon);
+    }
+    if (f & PDATA_HEADING)
+        p = put_int32(p, 8, pac->heading);
+    if (f & PDATA_GND_SPEED)
+        p = put_int32(p, 9, pac->gnd_speed);
+    if (f & PDATA_IAS)
+        p = put_int32(p, 10, pac->ias);
+    if (f & PDATA_VERT_RATE)
+        p = put_sint32(p, 11, pac->vert_rate);
+    if (f & PDATA_SQUAWK)
+        p = put_int32(p, 12, pac->squawk);
+    if (f & PDATA_AIRBORNE)
+        p = put_bool(p, 13, pac->airborne);
+    if (f & PDATA_IS_MLAT)
+        p = put_bool(p, 14, 1);
+    if (f & PDATA_IS_978)
+        p = put_bool(p, 15, 1);
+    if (f & PDATA_NAV_ALTITUDE_FMS)
+        p = put_int32(p, 16, (int32_t) pac->nav_altitude_fms);
+    if (f & PDATA_NAV_ALTITUDE_MCP)
+        p = put_int32(p, 17, (int32_t) pac->nav_altitude_mcp);
+    if (f & PDATA_NAV_QNH)
+        p = put_int32(p, 18, pac->nav_qnh);
+    if (f & PDATA_WIND_DIR)
+        p = put_int32(p, 27, pac->wind_dir);
+    if (f & PDATA_WIND_SPEED)
+        p = put_int32(p, 28, pac->wind_speed);
+    if (f & PDATA_TEMPERATURE)
+        p = put_sint32(p, 29, pac->temperature);
+    if (f & PDATA_POS_NIC)
+        p = put_uint32(p, 35, pac->pos_nic);
+    if (f & PDATA_NIC_BARO)
+        p = put_bool(p, 36, pac->nic_baro);
+    if (f & PDATA_NAC_P)
+        p = put_uint32(p, 37, pac->nac_p);
+    if (f & PDATA_NAC_V)
+        p = put_uint32(p, 38, pac->nac_v);
+    if (f & PDATA_SIL)
+        p = put_uint32(p, 39, pac->sil);
+    if (f & PDATA_SIL_TYPE)
+        p = put_int32(p, 40, pac->sil_type);
+    if (f & PDATA_ALTITUDE_GEO)
+        p = put_int32(p, 41, pac->altitude_geo);
+
+    return p;
+}
+
+/*
+ * Start a new FlightPacket, keeping the buffer
+ */
+void flightenc_reset(struct flightenc *enc) {
+    enc->len = 0;
+    enc->flights = 0;
+}
+
+void flightenc_destroy(struct flightenc *enc) {
+    free(enc->buf);
+    memset(enc, 0, sizeof (*enc));
+}
+
+/*
+ * Append one FlightData to the packet. Returns 0 if the buffer could not
+ * be grown.
+ */
+int flightenc_addFlight(struct flightenc *enc, const struct p_data *pac) {
+    uint8_t *start, *end;
+    size_t body;
+
+    if (enc->size - enc->len < FLIGHTENC_MAX_FLIGHT_SIZE) {
+        size_t size = enc->size ? enc->size * 2 : 64 * FLIGHTENC_MAX_FLIGHT_SIZE;
+        uint8_t *buf = realloc(enc->buf, size);
+
+        if (buf == NULL) {
+            return 0;
+        }
+        enc->buf = buf;
+        enc->size = size;
+    }
+
+    // fdata = 1, length delimited. The body is written assuming a one
+    // byte length and moved up in the rare case it needs two.
+    start = enc->buf + enc->len;
+    *start = (uint8_t) KEY(1, WT_LEN);
+    end = encode_flight(start + 2, pac);
+    body = end - (start + 2);
+
+    if (body < 0x80) {
+        start[1] = (uint8_t) body;
+        enc->len += 2 + body;
+    } else {
+        memmove(start + 3, start + 2, body);
+        put_varint(start + 1, body);
+        enc->len += 3 + body;
+    }
+    enc->flights++;
+
+    return 1;
+}
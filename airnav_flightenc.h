@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2020 - AirNav Systems
+ * 
+ * https://www.radarbox.com
+ * 
+ * More info: https://github.com/AirNav-Systems/rbfeeder
+ * 
+ */
+#ifndef AIRNAV_FLIGHTENC_H
+#define AIRNAV_FLIGHTENC_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "airnav_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FLIGHTENC_MAX_FLIGHT_SIZE 320 // Upper bound of one encoded FlightData, with its key and length
+
+    // Encoder for FlightPacket messages (rbfeeder.proto). FlightPacket has a
+    // single repeated FlightData field, so the buffer is a complete
+    // FlightPacket after every flightenc_addFlight() and can be sent as is.
+    // The buffer grows as needed and is kept between batches.
+    struct flightenc {
+        uint8_t *buf;
+        size_t len; // Bytes encoded so far
+        size_t size; // Capacity of buf
+        unsigned flights; // FlightData entries in buf
+    };
+
+
+    /****** Functions ******/
+    void flightenc_reset(struct flightenc *enc);
+    void flightenc_destroy(struct flightenc *enc);
+    int flightenc_addFlight(struct flightenc *enc, const struct p_data *pac);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AIRNAV_FLIGHTENC_H */
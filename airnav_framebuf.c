@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2020 - AirNav Systems
+ * 
+ * https://www.radarbox.com
+ * 
+ * More info: https://github.com/AirNav-Systems/rbfeeder
+ * 
+ */
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "airnav_framebuf.h"
+
+static const char framebuf_txstart[2] = {'~', '#'};
+
+int framebuf_init(struct framebuf *fb, size_t size) {
+    memset(fb, 0, sizeof (*fb));
+
+    fb->buf = malloc(size);
+    if (fb->buf == NULL) {
+        return 0;
+    }
+    fb->size = size;
+
+    return 1;
+}
+
+void framebuf_destroy(struct framebuf *fb) {
+    free(fb->buf);
+    memset(fb, 0, sizeof (*fb));
+}
+
+/*
+ * Throw away any partial frame, e.g. after reconnecting
+ */
+void framebuf_reset(struct framebuf *fb) {
+    fb->start = 0;
+    fb->len = 0;
+    fb->discarding = 0;
+}
+
+/*
+ * Read whatever is available from fd into the buffer.
+ * Returns bytes read, 0 on EOF, -1 on error (check errno for EAGAIN).
+ */
+ssize_t framebuf_read(struct framebuf *fb, int fd) {
+    ssize_t n;
+
+    // Move the partial frame to the front to make room. framebuf_next()
+    // never leaves a full buffer behind, so there is always some room.
+    if (fb->start > 0) {
+        memmove(fb->buf, fb->buf + fb->start, fb->len);
+        fb->start = 0;
+    }
+
+    do {
+        n = read(fd, fb->buf + fb->len, fb->size - fb->len);
+    } while (n < 0 && errno == EINTR);
+
+    if (n > 0) {
+        fb->len += n;
+    }
+
+    return n;
+}
+
+/*
+ * Drop n unconsumed bytes
+ */
+static void framebuf_skip(struct framebuf *fb, size_t n) {
+    fb->start += n;
+    fb->len -= n;
+    if (fb->len == 0) {
+        fb->start = 0;
+    }
+}
+
+/*
+ * Next complete frame, starting at its start of TX, or NULL if there is
+ * none yet. *frame_len is set to the whole frame length, header
+ * included. The pointer is valid until the next framebuf_read().
+ */
+const char *framebuf_next(struct framebuf *fb, unsigned *frame_len) {
+    for (;;) {
+        if (fb->discarding) {
+            // Rest of an oversized frame
+            size_t n = fb->len < fb->discarding ? fb->len : fb->discarding;
+            framebuf_skip(fb, n);
+            fb->discarding -= n;
+            if (fb->discarding) {
+                return NULL;
+            }
+        }
+
+        const char *p = fb->buf + fb->start;
+        if (fb->len < 2) {
+            return NULL;
+        }
+
+        if (p[0] != framebuf_txstart[0] || p[1] != framebuf_txstart[1]) {
+            // Resync: skip to the next start of TX, keeping a trailing
+            // '~' in case its '#' is in the next read
+            size_t skip = 1;
+            while (skip + 1 < fb->len && (p[skip] != framebuf_txstart[0] || p[skip + 1] != framebuf_txstart[1])) {
+                skip++;
+            }
+            if (skip + 1 == fb->len && p[skip] != framebuf_txstart[0]) {
+                skip++;
+            }
+            fb->garbage += skip;
+            framebuf_skip(fb, skip);
+            continue;
+        }
+
+        if (fb->len < FRAMEBUF_HEADER_SIZE) {
+            return NULL;
+        }
+
+        size_t size = ((size_t) (unsigned char) p[2] << 8) | (unsigned char) p[3];
+
+        // At least a type byte and 2 bytes of data
+        if (size <= 2) {
+            fb->invalid++;
+            fb->garbage += FRAMEBUF_HEADER_SIZE;
+            framebuf_skip(fb, FRAMEBUF_HEADER_SIZE);
+            continue;
+        }
+
+        if (FRAMEBUF_HEADER_SIZE + size > fb->size) {
+            fb->oversized++;
+            fb->discarding = FRAMEBUF_HEADER_SIZE + size;
+            continue;
+        }
+
+        if (fb->len < FRAMEBUF_HEADER_SIZE + size) {
+            return NULL;
+        }
+
+        *frame_len = FRAMEBUF_HEADER_SIZE + size;
+        framebuf_skip(fb, *frame_len);
+        fb->frames++;
+        return p;
+    }
+}
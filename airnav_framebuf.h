@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2020 - AirNav Systems
+ * 
+ * https://www.radarbox.com
+ * 
+ * More info: https://github.com/AirNav-Systems/rbfeeder
+ * 
+ */
+#ifndef AIRNAV_FRAMEBUF_H
+#define AIRNAV_FRAMEBUF_H
+
+#include <stddef.h>
+#include <sys/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FRAMEBUF_HEADER_SIZE 4 // start of TX (2 bytes) + size (2 bytes)
+
+    // Reassembly buffer for frames from the AirNav server: start of TX
+    // "~#", 16-bit big-endian size, then size bytes (type + payload).
+    // Bytes are read in whatever chunks the socket returns and complete
+    // frames are handed back in place; anything before a start of TX is
+    // skipped, as are frames with an invalid size or too big to hold.
+    struct framebuf {
+        char *buf;
+        size_t size; // Capacity of buf; also the biggest frame accepted
+        size_t start; // Offset of first unconsumed byte
+        size_t len; // Unconsumed bytes
+        size_t discarding; // Bytes still to skip of an oversized frame
+        unsigned long frames; // Frames returned
+        unsigned long long garbage; // Bytes skipped looking for a start of TX
+        unsigned long invalid; // Frames dropped: size too small
+        unsigned long oversized; // Frames dropped: bigger than buf
+    };
+
+
+    /****** Functions ******/
+    int framebuf_init(struct framebuf *fb, size_t size);
+    void framebuf_destroy(struct framebuf *fb);
+    void framebuf_reset(struct framebuf *fb);
+    ssize_t framebuf_read(struct framebuf *fb, int fd);
+    const char *framebuf_next(struct framebuf *fb, unsigned *frame_len);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AIRNAV_FRAMEBUF_H */
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2020 - AirNav Systems
+ * 
+ * https://www.radarbox.com
+ * 
+ * More info: https://github.com/AirNav-Systems/rbfeeder
+ * 
+ */
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "airnav_linebuf.h"
+
+int linebuf_init(struct linebuf *lb, size_t size) {
+    memset(lb, 0, sizeof (*lb));
+
+    lb->buf = malloc(size);
+    if (lb->buf == NULL) {
+        return 0;
+    }
+    lb->size = size;
+
+    return 1;
+}
+
+void linebuf_destroy(struct linebuf *lb) {
+    free(lb->buf);
+    memset(lb, 0, sizeof (*lb));
+}
+
+/*
+ * Throw away any partial line, e.g. after reconnecting
+ */
+void linebuf_reset(struct linebuf *lb) {
+    lb->start = 0;
+    lb->len = 0;
+    lb->discarding = 0;
+}
+
+/*
+ * Read whatever is available from fd into the buffer.
+ * Returns bytes read, 0 on EOF, -1 on error (check errno for EAGAIN).
+ */
+ssize_t linebuf_read(struct linebuf *lb, int fd) {
+    ssize_t n;
+
+    // Move the partial line to the front to make room
+    if (lb->start > 0) {
+        memmove(lb->buf, lb->buf + lb->start, lb->len);
+        lb->start = 0;
+    }
+
+    // Full without a newline: the line is too long to keep
+    if (lb->len == lb->size) {
+        lb->len = 0;
+        lb->discarding = 1;
+        lb->overflows++;
+    }
+
+    do {
+        n = read(fd, lb->buf + lb->len, lb->size - lb->len);
+    } while (n < 0 && errno == EINTR);
+
+    if (n > 0) {
+        lb->len += n;
+    }
+
+    return n;
+}
+
+/*
+ * Next complete line, NUL-terminated and without its line ending, or
+ * NULL if there is none yet. The pointer is valid until the next
+ * linebuf_read(). Empty lines are skipped.
+ */
+char *linebuf_next(struct linebuf *lb) {
+    for (;;) {
+        char *line = lb->buf + lb->start;
+        char *nl = memchr(line, '\n', lb->len);
+        size_t n;
+
+        if (nl == NULL) {
+            return NULL;
+        }
+
+        *nl = 0;
+        n = nl - line;
+        lb->start += n + 1;
+        lb->len -= n + 1;
+
+        if (lb->discarding) {
+            // Tail end of an overlong line
+            lb->discarding = 0;
+            continue;
+        }
+
+        if (n > 0 && line[n - 1] == '\r') {
+            line[--n] = 0;
+        }
+        if (n == 0) {
+            continue;
+        }
+
+        lb->lines++;
+        return line;
+    }
+}
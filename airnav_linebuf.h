@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2020 - AirNav Systems
+ * 
+ * https://www.radarbox.com
+ * 
+ * More info: https://github.com/AirNav-Systems/rbfeeder
+ * 
+ */
+#ifndef AIRNAV_LINEBUF_H
+#define AIRNAV_LINEBUF_H
+
+#include <stddef.h>
+#include <sys/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // Reassembly buffer for newline-framed input (e.g. dump978 JSON).
+    // Bytes are read in whatever chunks the socket returns and handed
+    // back one complete line at a time; a line split across reads is
+    // kept until the rest arrives.
+    struct linebuf {
+        char *buf;
+        size_t size; // Capacity of buf; also the longest line accepted
+        size_t start; // Offset of first unconsumed byte
+        size_t len; // Unconsumed bytes
+        int discarding; // Skipping the rest of an overlong line
+        unsigned long lines; // Lines returned
+        unsigned long overflows; // Overlong lines thrown away
+    };
+
+
+    /****** Functions ******/
+    int linebuf_init(struct linebuf *lb, size_t size);
+    void linebuf_destroy(struct linebuf *lb);
+    void linebuf_reset(struct linebuf *lb);
+    ssize_t linebuf_read(struct linebuf *lb, int fd);
+    char *linebuf_next(struct linebuf *lb);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AIRNAV_LINEBUF_H */
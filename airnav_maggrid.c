@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2020 - AirNav Systems
+ *
+ * https://www.radarbox.com
+ *
+ * More info: https://github.com/AirNav-Systems/rbfeeder
+ *
+ */
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "airnav_geomag.h"
+#include "airnav_maggrid.h"
+
+#define MAGGRID_M_PER_DEG 110000.0 // Metres per degree of latitude, rounded down
+
+static double maggrid_wrap(double lon) {
+    while (lon >= 180.0) {
+        lon -= 360.0;
+    }
+    while (lon < -180.0) {
+        lon += 360.0;
+    }
+    return lon;
+}
+
+/*
+ * Build a grid covering range metres around lat/lon, at step degrees, for
+ * decimal year year. That is a full WMM evaluation per grid point and
+ * layer (about 10000 of them, a few ms, for a 360 NM range in mid
+ * latitudes), so it is meant to be done once a day, not per aircraft.
+ */
+int maggrid_init(struct maggrid *grid, double lat, double lon, double range, double step, double year) {
+    memset(grid, 0, sizeof (*grid));
+
+    // One extra step so a point at the edge of the range still has
+    // neighbours on all sides
+    double half = range / MAGGRID_M_PER_DEG + step;
+    double south = lat - half;
+    double north = lat + half;
+    if (south < -90.0) {
+        south = -90.0;
+    }
+    if (north > 90.0) {
+        north = 90.0;
+    }
+
+    // Longitude degrees shrink with latitude; near the poles the grid
+    // goes all the way round
+    double widest = fmax(fabs(south), fabs(north));
+    double coslat = cos(widest * M_PI / 180.0);
+    double west, width;
+    if (coslat * 180.0 <= half) {
+        west = -180.0;
+        width = 360.0;
+    } else {
+        west = lon - half / coslat;
+        width = 2.0 * half / coslat;
+    }
+
+    grid->lat0 = south;
+    grid->lon0 = maggrid_wrap(west);
+    grid->step = step;
+    grid->rows = (unsigned) ceil((north - south) / step) + 1;
+    grid->cols = (unsigned) ceil(width / step) + 1;
+    grid->year = year;
+
+    size_t points = (size_t) MAGGRID_LAYERS * grid->rows * grid->cols;
+    grid->dec = malloc(points * sizeof (float));
+    grid->dip = malloc(points * sizeof (float));
+    if (grid->dec == NULL || grid->dip == NULL) {
+        maggrid_destroy(grid);
+        return 0;
+    }
+
+    size_t idx = 0;
+    for (unsigned layer = 0; layer < MAGGRID_LAYERS; layer++) {
+        double alt = MAGGRID_TOP_ALT * layer / (MAGGRID_LAYERS - 1);
+        for (unsigned row = 0; row < grid->rows; row++) {
+            double plat = fmin(grid->lat0 + row * step, 90.0);
+            for (unsigned col = 0; col < grid->cols; col++, idx++) {
+                double dec, dip, ti, gv;
+                geomag_geomg1(alt, plat, maggrid_wrap(grid->lon0 + col * step), year, &dec, &dip, &ti, &gv);
+                grid->dec[idx] = (float) dec;
+                grid->dip[idx] = (float) dip;
+            }
+        }
+    }
+
+    return 1;
+}
+
+void maggrid_destroy(struct maggrid *grid) {
+    free(grid->dec);
+    free(grid->dip);
+    memset(grid, 0, sizeof (*grid));
+}
+
+/*
+ * Bilinear interpolation between the four grid points around a position.
+ * Declination is unwrapped first, so cells where it crosses +/-180
+ * (close to the magnetic poles) don't average to nonsense.
+ */
+static double maggrid_interp(const float *v, unsigned cols, double fx, double fy, int angle) {
+    double v00 = v[0], v01 = v[1], v10 = v[cols], v11 = v[cols + 1];
+
+    if (angle) {
+        v01 += v01 - v00 > 180.0 ? -360.0 : (v01 - v00 < -180.0 ? 360.0 : 0.0);
+        v10 += v10 - v00 > 180.0 ? -360.0 : (v10 - v00 < -180.0 ? 360.0 : 0.0);
+        v11 += v11 - v00 > 180.0 ? -360.0 : (v11 - v00 < -180.0 ? 360.0 : 0.0);
+    }
+
+    return (v00 * (1.0 - fx) + v01 * fx) * (1.0 - fy) + (v10 * (1.0 - fx) + v11 * fx) * fy;
+}
+
+/*
+ * Declination and dip in degrees at alt km, lat/lon degrees.
+ * Returns 0 if the position is outside the grid (or not a number); the
+ * caller then has to ask the full model.
+ */
+int maggrid_lookup(const struct maggrid *grid, double alt, double lat, double lon, double *dec, double *dip) {
+    if (grid->dec == NULL) {
+        return 0;
+    }
+
+    double y = (lat - grid->lat0) / grid->step;
+    double x = lon - grid->lon0;
+    if (x < 0.0) {
+        x += 360.0;
+    }
+    x /= grid->step;
+    if (!(y >= 0.0 && y <= grid->rows - 1 && x >= 0.0 && x <= grid->cols - 1)) {
+        return 0;
+    }
+
+    unsigned row = (unsigned) y;
+    unsigned col = (unsigned) x;
+    if (row == grid->rows - 1) {
+        row--;
+    }
+    if (col == grid->cols - 1) {
+        col--;
+    }
+    double fy = y - row;
+    double fx = x - col;
+
+    double t = alt / MAGGRID_TOP_ALT;
+    if (t < 0.0) {
+        t = 0.0;
+    } else if (t > 1.0) {
+        t = 1.0;
+    }
+
+    size_t layer = (size_t) grid->rows * grid->cols;
+    size_t idx = (size_t) row * grid->cols + col;
+    double dec0 = maggrid_interp(grid->dec + idx, grid->cols, fx, fy, 1);
+    double dec1 = maggrid_interp(grid->dec + layer + idx, grid->cols, fx, fy, 1);
+    double dip0 = maggrid_interp(grid->dip + idx, grid->cols, fx, fy, 0);
+    double dip1 = maggrid_interp(grid->dip + layer + idx, grid->cols, fx, fy, 0);
+
+    // The two layers can be unwrapped differently too
+    if (dec1 - dec0 > 180.0) {
+        dec1 -= 360.0;
+    } else if (dec1 - dec0 < -180.0) {
+        dec1 += 360.0;
+    }
+
+    double d = dec0 + (dec1 - dec0) * t;
+    if (d > 180.0) {
+        d -= 360.0;
+    } else if (d <= -180.0) {
+        d += 360.0;
+    }
+    *dec = d;
+    *dip = dip0 + (dip1 - dip0) * t;
+
+    return 1;
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2020 - AirNav Systems
+ *
+ * https://www.radarbox.com
+ *
+ * More info: https://github.com/AirNav-Systems/rbfeeder
+ *
+ */
+#ifndef AIRNAV_MAGGRID_H
+#define AIRNAV_MAGGRID_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MAGGRID_STEP 0.25 // Degrees between grid points
+#define MAGGRID_LAYERS 2 // Altitudes the grid is computed at...
+#define MAGGRID_TOP_ALT 15.0 // ...0 km and this many km; interpolated between, clamped outside
+
+    // Magnetic declination and dip from the World Magnetic Model
+    // (airnav_geomag.c), precomputed on a lat/lon grid covering the
+    // receiver's range for one date, and bilinearly interpolated.
+    struct maggrid {
+        double lat0; // South-west corner
+        double lon0;
+        double step;
+        unsigned rows;
+        unsigned cols;
+        double year; // Decimal year the model was evaluated for
+        float *dec; // [layer][row][col], degrees
+        float *dip;
+    };
+
+
+    /****** Functions ******/
+    int maggrid_init(struct maggrid *grid, double lat, double lon, double range, double step, double year);
+    void maggrid_destroy(struct maggrid *grid);
+    int maggrid_lookup(const struct maggrid *grid, double alt, double lat, double lon, double *dec, double *dip);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AIRNAV_MAGGRID_H */
@@ -608,6 +608,17 @@ void airnav_showHelp(void) {
     fprintf(stderr, "\n");
 }
 
+/*
+ * Called when an ini file changed on disk and was reloaded
+ */
+static void airnav_configReloaded(const char *ini_file) {
+    if (strcmp(ini_file, configuration_file) != 0) {
+        return;
+    }
+
+    debug_level = ini_getInteger(configuration_file, "client", "debug_level", 0);
+}
+
 /*
  * Main function for AirNav Feeder
  */
@@ -628,12 +639,6 @@ void airnav_main() {
 #endif
 
 
-    for (int ab = 0; ab < MAX_ANRB; ab++) {
-        anrbList[ab].active = 0;
-        anrbList[ab].socket = malloc(sizeof (int));
-        *anrbList[ab].socket = -1;
-    }
-
     flist = NULL;
 
     if (cat21_loaded == 1) {
@@ -691,6 +696,18 @@ void airnav_init_mutex(void) {
         exit(EXIT_FAILURE);
     }
 
+    /*
+     * Reply condition, timed against the monotonic clock
+     */
+    pthread_condattr_t cmd_attr;
+    pthread_condattr_init(&cmd_attr);
+    pthread_condattr_setclock(&cmd_attr, CLOCK_MONOTONIC);
+    if (pthread_cond_init(&c_cmd, &cmd_attr) != 0) {
+        printf("\n cond init failed\n");
+        exit(EXIT_FAILURE);
+    }
+    pthread_condattr_destroy(&cmd_attr);
+
     /*
      * Led ADSB Mutex
      */
@@ -702,12 +719,14 @@ void airnav_init_mutex(void) {
 
 
 
+    ini_setReloadCallback(airnav_configReloaded);
     airnav_create_thread();
 
 }
 
 void airnav_create_thread(void) {
 
+    airnav_initFeeder();
 
     // Thread to wait commands
     pthread_create(&t_waitcmd, NULL, net_thread_WaitCmds, NULL);
@@ -718,24 +737,16 @@ void airnav_create_thread(void) {
         pthread_create(&t_dump978, NULL, uat_airnav_ext978, NULL);
     }
 
-    // Thread to monitor connection with AirNav server
-    pthread_create(&t_monitor, NULL, airnav_monitorConnection, NULL);
+    // Thread that sends data and stats, and monitors the connection
+    // with AirNav server
+    pthread_create(&t_feeder, NULL, airnav_feederThread, NULL);
+
+    // Thread for ANRB clients
+    pthread_create(&t_anrb, NULL, airnav_anrbThread, NULL);
 
     // Start thread that prepare data and send
     pthread_create(&t_prepareData, NULL, airnav_prepareData, NULL);
 
-    // Thread to show statistics on screen
-    pthread_create(&t_statistics, NULL, airnav_statistics, NULL);
-
-    // Thread to send stats
-    pthread_create(&t_stats, NULL, airnav_send_stats_thread, NULL);
-
-    // Thread to send data
-    pthread_create(&t_send_data, NULL, airnav_threadSendData, NULL);
-
-    // Thread for ANRB
-    pthread_create(&t_anrb, NULL, anrb_threadWaitNewANRB, NULL);
-    pthread_create(&t_anrb_send, NULL, anrb_threadSendDataANRB, NULL);
 
 
     // Thread to updated ADS-B Led
@@ -786,248 +797,447 @@ void airnav_create_thread(void) {
 }
 
 /*
- * Function to monitor connection with AirNav
- * Server.
+ * One thread runs all of the periodic and wake-driven feeder work
+ * (uploads, ping/reconnect, stats) from a single epoll loop instead of a
+ * polling thread per task. ANRB clients have a loop and thread of their
+ * own, so nothing the feeder loop does can hold up local clients.
  */
-void *airnav_monitorConnection(void *arg) {
-    MODES_NOTUSED(arg);
-    signal(SIGCHLD, SIG_IGN);
-    signal(SIGPIPE, net_sigpipe_handler);
-    signal(SIGINT, rbfeederSigintHandler);
-    signal(SIGTERM, rbfeederSigtermHandler);
+static struct evloop feeder_loop;
+static struct evloop anrb_output_loop;
+static int ev_flights = -1; // Raised when flist has new packets
+static int ev_anrb = -1; // Raised when flist2 has new packets (anrb_output_loop)
+static int ev_connected = -1; // Raised when the connection thread finished an attempt
+
+void airnav_notifyFlights(void) {
+    evloop_signal(&feeder_loop, ev_flights);
+}
 
-    int local_counter = 0;
+void airnav_notifyANRB(void) {
+    evloop_signal(&anrb_output_loop, ev_anrb);
+}
 
-    sleep(1);
-    net_initial_com();
+/*
+ * Safe to call from a signal handler
+ */
+void airnav_stopFeeder(void) {
+    evloop_stop(&feeder_loop);
+    evloop_stop(&anrb_output_loop);
+}
 
+/*
+ * The handshake with the AirNav server (DNS, connect() and waiting up to
+ * AIRNAV_WAIT_PACKET_TIMEOUT for the key reply) blocks for as long as the
+ * server is slow or unreachable, so it runs on its own thread instead of
+ * the feeder loop. The loop asks for it and is signalled when it is done.
+ */
+static pthread_t t_connect;
+static pthread_mutex_t m_connect = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t c_connect = PTHREAD_COND_INITIALIZER;
+static int connect_requested; // Under m_connect: an attempt is waiting to start
+static int connect_busy; // Under m_connect: requested or in progress
+static int connect_stop; // Under m_connect
+
+static void airnav_requestConnect(void) {
+    pthread_mutex_lock(&m_connect);
+    if (!connect_busy) {
+        connect_busy = 1;
+        connect_requested = 1;
+        pthread_cond_signal(&c_connect);
+    }
+    pthread_mutex_unlock(&m_connect);
+}
 
-    while (!Modes.exit) {
+static void *airnav_connectThread(void *arg) {
+    MODES_NOTUSED(arg);
 
+    pthread_mutex_lock(&m_connect);
+    while (!connect_stop) {
+        if (!connect_requested) {
+            pthread_cond_wait(&c_connect, &m_connect);
+            continue;
+        }
+        connect_requested = 0;
+        pthread_mutex_unlock(&m_connect);
 
-        if (local_counter >= AIRNAV_MONITOR_SECONDS) {
-            local_counter = 0;
+        if (airnav_socket != -1) {
+            close(airnav_socket);
+            airnav_socket = -1;
+        }
+        net_initial_com();
+        evloop_signal(&feeder_loop, ev_connected);
 
-            // Check if we need to create VHF configuration
-            if (ini_getBoolean(configuration_file, "vhf", "force_create", 0) == 1) {
-                airnav_log_level(1, "VHF Configuration file creating requested. doing.....");
-                if (generateVHFConfig() == 1) {
-                    airnav_log_level(1, "done!\n");
+        pthread_mutex_lock(&m_connect);
+        connect_busy = 0;
+    }
+    pthread_mutex_unlock(&m_connect);
 
-                    // Restart VHF daemon, if is running
-                    if (checkVhfRunning() == 1) {
-                        restartVhf();
-                    }
+    return NULL;
+}
 
-                } else {
-                    airnav_log_level(1, "error creating vhf configuration.\n");
-                }
-                ini_saveGeneric(configuration_file, "vhf", "force_create", "false");
-            }
+/*
+ * A connection attempt finished. Stats otherwise only go out every
+ * AIRNAV_STATS_SEND_TIME; after a (re)connection send them straight away.
+ */
+static void airnav_connectDone(void *arg) {
+    MODES_NOTUSED(arg);
 
-            // Check if VHF auto start is enabled and if VHF is running
-            if (autostart_vhf) {
-                if (!checkVhfRunning()) {
-                    startVhf();
-                }
-            }
+    if (airnav_com_inited == 1) {
+        net_sendStats();
+    }
+}
 
-            // Check if we need to reload ASTERIX configuration
-            if (ini_getBoolean(configuration_file, "asterix", "force_reload", 0) == 1) {
-                airnav_log_level(1, "ASTERIX Reload requested. doing.....");
-                loadAsterixConfiguration();
-                ini_saveGeneric(configuration_file, "asterix", "force_reload", "false");
-                airnav_log_level(1, "Reload done!\n");
-            }
+/*
+ * Every second: cheap checks of the in-memory ini file
+ */
+static void airnav_monitorTick(void *arg) {
+    MODES_NOTUSED(arg);
 
+    if (Modes.exit) {
+        airnav_stopFeeder();
+        return;
+    }
 
-            if (airnav_com_inited == 0) {
-                airnav_log_level(5, "[MONITOR1] Connection not initialized. Trying init protocol.\n");
-                close(airnav_socket);
-                airnav_socket = -1;
-                net_initial_com();
-            } else {
-                airnav_log_level(5, "[MONITOR4] Connection OK. Sending Ping...\n");
-                sendPing();
-                //                sendMultipleFlights();
+    // These come from the in-memory copy of the ini file, which is
+    // reloaded as soon as it changes, so they are cheap to check often
+    // Check if we need to create VHF configuration
+    if (ini_getBoolean(configuration_file, "vhf", "force_create", 0) == 1) {
+        airnav_log_level(1, "VHF Configuration file creating requested. doing.....");
+        if (generateVHFConfig() == 1) {
+            airnav_log_level(1, "done!\n");
+
+            // Restart VHF daemon, if is running
+            if (checkVhfRunning() == 1) {
+                restartVhf();
             }
 
         } else {
-            local_counter++;
+            airnav_log_level(1, "error creating vhf configuration.\n");
         }
-
-        sleep(1);
+        ini_saveGeneric(configuration_file, "vhf", "force_create", "false");
     }
 
-    airnav_log_level(1, "Exited thread_monitorConnection Successfull!\n");
-    pthread_exit(EXIT_SUCCESS);
-
+    // Check if we need to reload ASTERIX configuration; airnav_prepareData()
+    // does it between sweeps, as it is the one encoding with it
+    if (ini_getBoolean(configuration_file, "asterix", "force_reload", 0) == 1) {
+        airnav_log_level(1, "ASTERIX Reload requested.\n");
+        asterix_requestReload();
+        ini_saveGeneric(configuration_file, "asterix", "force_reload", "false");
+    }
 }
 
 /*
- * Thread to show statistics on screen
+ * Monitor connection with AirNav Server: ping it, or
+ * reconnect if the connection was lost
  */
-void *airnav_statistics(void *arg) {
-
+static void airnav_monitorConnection(void *arg) {
     MODES_NOTUSED(arg);
 
-    signal(SIGCHLD, SIG_IGN);
-    signal(SIGPIPE, net_sigpipe_handler);
-    signal(SIGINT, rbfeederSigintHandler);
-    signal(SIGTERM, rbfeederSigtermHandler);
+    // Check if VHF auto start is enabled and if VHF is running
+    if (autostart_vhf) {
+        if (!checkVhfRunning()) {
+            startVhf();
+        }
+    }
 
-    int local_counter = 0;
+    if (airnav_com_inited == 0) {
+        airnav_log_level(5, "[MONITOR1] Connection not initialized. Trying init protocol.\n");
+        airnav_requestConnect();
+    } else {
+        airnav_log_level(5, "[MONITOR4] Connection OK. Sending Ping...\n");
+        sendPing();
+    }
+}
 
-    while (!Modes.exit) {
+static void airnav_statistics(void *arg) {
+    MODES_NOTUSED(arg);
 
-        if (local_counter == AIRNV_STATISTICS_INTERVAL) {
-            debug_level = ini_getInteger(configuration_file, "client", "debug_level", 0);
-            local_counter = 0;
-            airnav_log("******** Statistics updated every %d seconds ********\n", AIRNV_STATISTICS_INTERVAL);
-            pthread_mutex_lock(&m_packets_counter);
-            airnav_log("Packets sent in the last %d seconds: %ld, Total packets sent since startup: %d\n", AIRNV_STATISTICS_INTERVAL, packets_last, packets_total);
-            packets_last = 0;
-            double count = 0;
-
-            count = global_data_sent;
-            pthread_mutex_unlock(&m_packets_counter);
-
-            const char* suffixes[7];
-            suffixes[0] = "B";
-            suffixes[1] = "KB";
-            suffixes[2] = "MB";
-            suffixes[3] = "GB";
-            suffixes[4] = "TB";
-            suffixes[5] = "PB";
-            suffixes[6] = "EB";
-            uint s = 0; // which suffix to use
-
-            while (count >= 1024 && s < 7) {
-                s++;
-                count /= 1024;
-            }
+    debug_level = ini_getInteger(configuration_file, "client", "debug_level", 0);
+    airnav_log("******** Statistics updated every %d seconds ********\n", AIRNV_STATISTICS_INTERVAL);
+    pthread_mutex_lock(&m_packets_counter);
+    airnav_log("Packets sent in the last %d seconds: %ld, Total packets sent since startup: %d\n", AIRNV_STATISTICS_INTERVAL, packets_last, packets_total);
+    packets_last = 0;
+    double count = 0;
+
+    count = global_data_sent;
+    pthread_mutex_unlock(&m_packets_counter);
+
+    const char* suffixes[7];
+    suffixes[0] = "B";
+    suffixes[1] = "KB";
+    suffixes[2] = "MB";
+    suffixes[3] = "GB";
+    suffixes[4] = "TB";
+    suffixes[5] = "PB";
+    suffixes[6] = "EB";
+    uint s = 0; // which suffix to use
+
+    while (count >= 1024 && s < 7) {
+        s++;
+        count /= 1024;
+    }
 
-            if (count - floor(count) == 0.0) {
-                airnav_log("Data sent: %d %s\n", (int) count, suffixes[s]);
-            } else {
-                airnav_log("Data sent: %.1f %s\n", count, suffixes[s]);
-                airnav_log_level(1, "Data sent (bytes) %lu\n", (int) global_data_sent);
-            }
+    if (count - floor(count) == 0.0) {
+        airnav_log("Data sent: %d %s\n", (int) count, suffixes[s]);
+    } else {
+        airnav_log("Data sent: %.1f %s\n", count, suffixes[s]);
+        airnav_log_level(1, "Data sent (bytes) %lu\n", (int) global_data_sent);
+    }
 
-            s = 0;
-            count = data_received;
-            while (count >= 1024 && s < 7) {
-                s++;
-                count /= 1024;
-            }
+    s = 0;
+    count = data_received;
+    while (count >= 1024 && s < 7) {
+        s++;
+        count /= 1024;
+    }
 
-            if (count - floor(count) == 0.0) {
-                airnav_log("Data received: %d %s\n", (int) count, suffixes[s]);
-            } else {
-                airnav_log("Data received: %.1f %s\n", count, suffixes[s]);
-            }
+    if (count - floor(count) == 0.0) {
+        airnav_log("Data received: %d %s\n", (int) count, suffixes[s]);
+    } else {
+        airnav_log("Data received: %.1f %s\n", count, suffixes[s]);
+    }
 
-            //airnav_log("Currently tracked flights: %d\n", currently_tracked_flights);
+    //airnav_log("Currently tracked flights: %d\n", currently_tracked_flights);
 
-        } else {
-            local_counter++;
-        }
-        sleep(1);
+    struct pool_stats pdata_stats, plist_stats;
+    pool_getStats(&pdata_stats, &plist_stats);
+    airnav_log_level(1, "Packet pool: %lu in use (max %lu), %lu slabs, %lu allocs/%lu frees\n",
+            pdata_stats.in_use, pdata_stats.max_in_use, pdata_stats.slabs, pdata_stats.allocs, pdata_stats.frees);
+    airnav_log_level(1, "Packet list pool: %lu in use (max %lu), %lu slabs, %lu allocs/%lu frees\n",
+            plist_stats.in_use, plist_stats.max_in_use, plist_stats.slabs, plist_stats.allocs, plist_stats.frees);
+    airnav_log_level(1, "Feeder loop: %lu wakeups, %lu uploads; ANRB loop: %lu wakeups, %lu runs\n", feeder_loop.wakeups,
+            feeder_loop.sources[ev_flights].runs, anrb_output_loop.wakeups, anrb_output_loop.sources[ev_anrb].runs);
+    if (asterix_enabled == 1) {
+        struct asterix_stats ast_stats;
+        asterix_getStats(&ast_stats);
+        airnav_log_level(1, "ASTERIX: %lu records in %lu datagrams (%lu bytes), %lu sendmmsg calls, %lu dropped\n",
+                ast_stats.records, ast_stats.datagrams, ast_stats.bytes, ast_stats.syscalls, ast_stats.dropped);
+    }
+}
+
+static void airnav_checkMLAT(void *arg) {
+    MODES_NOTUSED(arg);
 
+    if (autostart_mlat) {
+        mlat_startMLAT();
     }
+}
 
-    airnav_log_level(1, "Exited airnav_statistics Successfull!\n");
-    pthread_exit(EXIT_SUCCESS);
+static void airnav_sendStats(void *arg) {
+    MODES_NOTUSED(arg);
 
+    net_sendStats();
 }
 
 /*
- * Send statistics to FW
+ * Upload whatever prepareData/dump978 queued since the last run
  */
-void *airnav_send_stats_thread(void *argv) {
-
-    MODES_NOTUSED(argv);
-
-    signal(SIGCHLD, SIG_IGN);
-    signal(SIGPIPE, net_sigpipe_handler);
-    signal(SIGINT, rbfeederSigintHandler);
-    signal(SIGTERM, rbfeederSigtermHandler);
+static void airnav_sendData(void *arg) {
+    MODES_NOTUSED(arg);
 
-    static uint64_t next_update;
-    static uint64_t next_mlat_check;
-    uint64_t now = mstime();
+    struct packet_list *local_list = NULL, *tmp_counter = NULL;
+    unsigned qtd = 0;
 
-    next_update = now + (AIRNAV_STATS_SEND_TIME * 1000);
-    next_mlat_check = now + 30 * 1000;
+    pthread_mutex_lock(&m_copy);
+    local_list = flist;
+    tmp_counter = flist;
+    flist = NULL;
+    packet_cache_count = 0;
+    pthread_mutex_unlock(&m_copy);
 
 
-    airnav_log_level(3, "Starting stats thread...\n");
-    while (Modes.exit == 0) {
+    // Count how many itens we have
+    qtd = 0;
+    while (tmp_counter != NULL) {
+        qtd++;
+        tmp_counter = tmp_counter->next;
+    }
 
-        now = mstime();
-        if (now >= next_mlat_check) {
-            next_mlat_check = now + 30 * 1000;
-            if (autostart_mlat) {
-                mlat_startMLAT();
-            }
-        }
-        if (now >= next_update) {
-            next_update = now + (AIRNAV_STATS_SEND_TIME * 1000);
-            net_sendStats();
-        }
+    // Create main packet structure
+    if (local_list != NULL) {
+        // Send packets
+        sendMultipleFlights(local_list, qtd);
+    }
+}
 
-        usleep(1000000);
+/*
+ * Register the feeder's timers and wakeups. Called before any producer
+ * thread is started, so evloop_signal() always finds a valid source
+ */
+void airnav_initFeeder(void) {
+    if (!evloop_init(&feeder_loop) || !evloop_init(&anrb_output_loop)) {
+        airnav_log("Could not create feeder event loop: %s\n", strerror(errno));
+        exit(EXIT_FAILURE);
     }
 
+    ev_flights = evloop_addEvent(&feeder_loop, airnav_sendData, NULL);
+    ev_anrb = evloop_addEvent(&anrb_output_loop, anrb_sendData, NULL);
+    ev_connected = evloop_addEvent(&feeder_loop, airnav_connectDone, NULL);
+    if (ev_flights < 0 || ev_anrb < 0 || ev_connected < 0
+            || evloop_addTimer(&feeder_loop, 1000, airnav_monitorTick, NULL) < 0
+            || evloop_addTimer(&feeder_loop, AIRNAV_MONITOR_SECONDS * 1000, airnav_monitorConnection, NULL) < 0
+            || evloop_addTimer(&feeder_loop, AIRNV_STATISTICS_INTERVAL * 1000, airnav_statistics, NULL) < 0
+            || evloop_addTimer(&feeder_loop, 30 * 1000, airnav_checkMLAT, NULL) < 0
+            || evloop_addTimer(&feeder_loop, AIRNAV_STATS_SEND_TIME * 1000, airnav_sendStats, NULL) < 0) {
+        airnav_log("Could not register feeder events: %s\n", strerror(errno));
+        exit(EXIT_FAILURE);
+    }
 
-    airnav_log_level(1, "Exited send_stats Successfull!\n");
-    pthread_exit(EXIT_SUCCESS);
+    // Not fatal if the port is taken
+    anrb_init(&anrb_output_loop);
 }
 
 /*
- * Thread to send data
+ * Accepts ANRB clients and feeds them what prepareData queues in flist2
  */
-void *airnav_threadSendData(void *argv) {
-    MODES_NOTUSED(argv);
+void *airnav_anrbThread(void *arg) {
+    MODES_NOTUSED(arg);
+
+    airnav_log_level(3, "Starting ANRB thread...\n");
+
+    evloop_run(&anrb_output_loop);
+
+    // Releases anything queued after the last wakeup
+    anrb_sendData(NULL);
+    anrb_close();
+    evloop_destroy(&anrb_output_loop);
+
+    airnav_log_level(1, "Exited ANRB thread Successfull!\n");
+    pthread_exit(EXIT_SUCCESS);
+}
+
+void *airnav_feederThread(void *arg) {
+    MODES_NOTUSED(arg);
 
     signal(SIGCHLD, SIG_IGN);
     signal(SIGPIPE, net_sigpipe_handler);
     signal(SIGINT, rbfeederSigintHandler);
     signal(SIGTERM, rbfeederSigtermHandler);
 
-    struct packet_list *local_list = NULL, *tmp_counter = NULL;
-    unsigned qtd = 0;
+    airnav_log_level(3, "Starting feeder thread...\n");
 
+    if (pthread_create(&t_connect, NULL, airnav_connectThread, NULL) != 0) {
+        airnav_log("Could not create connection thread.\n");
+        exit(EXIT_FAILURE);
+    }
+    airnav_requestConnect();
 
+    evloop_run(&feeder_loop);
 
-    while (!Modes.exit) {
+    // net_waitCmd() gives up on an attempt in progress once it sees Modes.exit
+    pthread_mutex_lock(&m_connect);
+    connect_stop = 1;
+    pthread_cond_signal(&c_connect);
+    pthread_mutex_unlock(&m_connect);
+    pthread_join(t_connect, NULL);
 
-        pthread_mutex_lock(&m_copy);
-        local_list = flist;
-        tmp_counter = flist;
-        flist = NULL;
-        packet_cache_count = 0;
-        pthread_mutex_unlock(&m_copy);
+    // Hand over anything queued after the last wakeup
+    airnav_sendData(NULL);
+    evloop_destroy(&feeder_loop);
 
+    airnav_log_level(1, "Exited feeder thread Successfull!\n");
+    pthread_exit(EXIT_SUCCESS);
+}
 
-        // Count how many itens we have
-        qtd = 0;
-        while (tmp_counter != NULL) {
-            qtd++;
-            tmp_counter = tmp_counter->next;
-        }
+/*
+ * Earliest time (secs) at which a resend rule could make prepareData
+ * emit something for this aircraft without a new message arriving, i.e.
+ * without the aircraft being marked dirty.
+ *
+ * Fields gated on trackDataValid() are resent every MAX_TIME_FIELD_*
+ * seconds for as long as the data is valid. Fields gated on
+ * trackDataAge() are only looked at while the data is at most
+ * AIRNAV_MAX_ITEM_AGE old, so their interval counts only if it runs out
+ * within that window; the position goes out on every sweep inside it.
+ * Wind and temperature only go out along with heading, altitude and
+ * position, so they are covered by those.
+ */
+static long airnav_nextResendDue(struct aircraft *b, int force_send, long now) {
+    long due = LONG_MAX;
+
+    // Forced sends repeat on every sweep for as long as the condition holds
+    if (force_send == 1) {
+        return now;
+    }
+
+#define DUE(_v, _t, _max) do { if (trackDataValid(_v) && (_t) + (_max) < due) due = (_t) + (_max); } while (0)
+    if (b->airground == AG_GROUND && b->airground_valid.source >= SOURCE_MODE_S_CHECKED) {
+        DUE(&b->airground_valid, b->an.rpisrv_emitted_airborne_time, MAX_TIME_FIELD_AIRBORNE);
+    }
+    DUE(&b->nic_baro_valid, b->an.rpisrv_emitted_nic_baro_time, MAX_TIME_FIELD_NIC_BARO);
+    DUE(&b->nac_p_valid, b->an.rpisrv_emitted_nac_p_time, MAX_TIME_FIELD_NAC_P);
+    DUE(&b->nac_v_valid, b->an.rpisrv_emitted_nac_v_time, MAX_TIME_FIELD_NAC_V);
+    DUE(&b->sil_valid, b->an.rpisrv_emitted_sil_time, MAX_TIME_FIELD_SIL);
+#undef DUE
+
+    // The data stays young enough until (at the latest) the sweep after
+    // now + what is left of AIRNAV_MAX_ITEM_AGE
+#define DUE_FRESH(_v, _t, _max) do {                                                   \
+        uint64_t _age = trackDataAge(_v);                                              \
+        if (_age <= AIRNAV_MAX_ITEM_AGE && (_t) + (_max) < due                        \
+                && (_t) + (_max) <= now + (long) ((AIRNAV_MAX_ITEM_AGE - _age) / 1000) + 1) \
+            due = (_t) + (_max);                                                       \
+    } while (0)
+    DUE_FRESH(&b->position_valid, now, 0);
+    DUE_FRESH(&b->callsign_valid, b->an.rpisrv_emitted_callsign_time, MAX_TIME_FIELD_CALLSIGN);
+    DUE_FRESH(&b->altitude_geom_valid, b->an.rpisrv_emitted_altitude_geom_time, MAX_TIME_FIELD_ALTITUDE);
+    DUE_FRESH(&b->altitude_baro_valid, b->an.rpisrv_emitted_altitude_baro_time, MAX_TIME_FIELD_ALTITUDE);
+    DUE_FRESH(&b->mag_heading_valid, b->an.rpisrv_emitted_mag_heading_time, MAX_TIME_FIELD_MAG_HEADING);
+    DUE_FRESH(&b->gs_valid, b->an.rpisrv_emitted_gs_time, MAX_TIME_FIELD_GS);
+    DUE_FRESH(&b->geom_rate_valid, b->an.rpisrv_emitted_geom_rate_time, MAX_TIME_FIELD_GEOM_RATE);
+    DUE_FRESH(&b->baro_rate_valid, b->an.rpisrv_emitted_baro_rate_time, MAX_TIME_FIELD_BARO_RATE);
+    // The squawk rule compares against the emitted squawk itself, which
+    // makes it due on every sweep; mirror it as it is
+    DUE_FRESH(&b->squawk_valid, b->an.rpisrv_emitted_squawk, MAX_TIME_FIELD_SQUAWKE);
+    DUE_FRESH(&b->ias_valid, b->an.rpisrv_emitted_ias_time, MAX_TIME_FIELD_IAS);
+    DUE_FRESH(&b->nav_modes_valid, b->an.rpisrv_emitted_nav_modes_time, MAX_TIME_FIELD_NAV_MODES);
+    DUE_FRESH(&b->nav_altitude_fms_valid, b->an.rpisrv_emitted_nav_altitude_fms_time, MAX_TIME_FIELD_NAV_ALT_FMS);
+    DUE_FRESH(&b->nav_altitude_mcp_valid, b->an.rpisrv_emitted_nav_altitude_mcp_time, MAX_TIME_FIELD_NAV_ALT_MCP);
+    DUE_FRESH(&b->nav_qnh_valid, b->an.rpisrv_emitted_nav_qnh_time, MAX_TIME_FIELD_NAV_QNH);
+#undef DUE_FRESH
+
+    return due;
+}
 
-        // Create main packet structure
-        if (local_list != NULL) {
-            // Send packets
-            sendMultipleFlights(local_list, qtd);
+/*
+ * Magnetic declination for the wind computation. The World Magnetic Model
+ * is evaluated on a grid around the receiver once a day (see
+ * airnav_maggrid.c); positions off the grid (no receiver location set, or
+ * beyond its range) still get the full model.
+ */
+static struct maggrid mag_grid;
+static time_t mag_grid_day = -1; // UTC day mag_grid was built for
+static double mag_grid_year;
+
+static double airnav_declination(double alt, double lat, double lon, time_t t) {
+    double dec, dip, ti, gv;
+
+    if (t / 86400 != mag_grid_day) {
+        struct tm tm;
+        gmtime_r(&t, &tm);
+        mag_grid_day = t / 86400;
+        mag_grid_year = tm.tm_year + 1900.0 + tm.tm_yday / 365.0;
+
+        // Without a receiver location, around the first aircraft of the day
+        double glat = lat, glon = lon;
+        if (Modes.bUserFlags & MODES_USER_LATLON_VALID) {
+            glat = Modes.fUserLat;
+            glon = Modes.fUserLon;
+        }
+        maggrid_destroy(&mag_grid);
+        if (maggrid_init(&mag_grid, glat, glon, Modes.maxRange, MAGGRID_STEP, mag_grid_year)) {
+            airnav_log_level(3, "Magnetic declination grid for %.2f built around %.4f,%.4f (%ux%u points)\n",
+                    mag_grid_year, glat, glon, mag_grid.rows, mag_grid.cols);
+        } else {
+            airnav_log("Could not allocate the magnetic declination grid, using the full model\n");
         }
+    }
 
-        sleep(1);
+    if (maggrid_lookup(&mag_grid, alt, lat, lon, &dec, &dip)) {
+        return dec;
     }
 
-    airnav_log_level(1, "Exited sendData Successfull!\n");
-    pthread_exit(EXIT_SUCCESS);
+    geomag_geomg1(alt, lat, lon, mag_grid_year, &dec, &dip, &ti, &gv);
+    return dec;
 }
 
 /*
@@ -1042,16 +1252,21 @@ void *airnav_prepareData(void *arg) {
     signal(SIGTERM, rbfeederSigtermHandler);
 
 
-    struct aircraft *b = Modes.aircrafts;
+    struct aircraft *b, *live;
+    struct aircraft snap; // Consistent copy of live, see trackSnapshotAircraft()
     uint64_t now = mstime();
     int send = 0;
     int force_send = 0;
+    int queued = 0;
     uint32_t extra = 0;
     struct packet_list *tmp, *tmp2;
+    // Built without holding m_copy/m_copy2, spliced onto flist/flist2 at the end
+    struct packet_list *local_list, *local_tail, *local_list2, *local_tail2;
+    int reader = trackRegisterReader();
 
     MODES_NOTUSED(arg);
     struct p_data *acf, *acf2;
-    struct asterixPacketDef_cat21 *packet = NULL;
+    struct cat21_record packet; // Reused for every aircraft
     struct timeval tv;
     //printf("Seconds since Jan. 1, 1970: %ld\n", tv.tv_sec);
 
@@ -1060,34 +1275,56 @@ void *airnav_prepareData(void *arg) {
 
 
 
-        //pthread_mutex_lock(&Modes.data_mutex);
-        pthread_mutex_lock(&m_copy);
-        pthread_mutex_lock(&m_copy2);
         packet_list_count = 0;
         currently_tracked_flights = 0;
+        queued = 0;
+        local_list = local_tail = local_list2 = local_tail2 = NULL;
 
-        b = Modes.aircrafts;
-        if (b) {
+        gettimeofday(&tv, NULL);
 
-            b = Modes.aircrafts;
+        // Never in the middle of a sweep: it rebuilds cat21_uap
+        asterix_applyReload();
+
+        // The decoder keeps updating (and expiring) aircraft while we
+        // sweep; this keeps every aircraft we can reach allocated
+        trackReadBegin(reader);
+
+        live = Modes.aircrafts;
+        if (live) {
+
+            while (live) {
+
+                if (!(live->addr & MODES_NON_ICAO_ADDRESS)) {
+                    currently_tracked_flights++;
+                }
+
+                // Only look at aircraft that changed since the last sweep,
+                // or that have a resend timer falling due
+                if (!atomic_exchange(&live->rpisrv_dirty, 0) && tv.tv_sec < live->an.rpisrv_next_due) {
+                    live = live->next;
+                    continue;
+                }
+
+                // Work from a copy that no decoder update was half way
+                // through. b->an is ours alone and goes back below
+                trackSnapshotAircraft(live, &snap);
+                b = &snap;
 
-            while (b) {
                 now = mstime();
                 acf = net_preparePacket_v2();
                 acf2 = net_preparePacket_v2(); // ANRB
                 send = 0;
-                gettimeofday(&tv, NULL);
                 force_send = 0;
 
 
                 // Asterix
+                cat21_recordInit(&packet, &cat21_uap);
                 if (asterix_enabled == 1 && cat21_loaded == 1) {
-                    packet = prepareAsterixPacket_cat21(MAX_CAT21_FSPEC_BYTES, MAX_CAT21_ITEMS);
                     // Not optional item
-                    cat021_setDataSourceSACSIC(packet, cat21items, asterix_sac, asterix_sic);
+                    cat021_setDataSourceSACSIC(&packet, asterix_sac, asterix_sic);
 
                     if (asterix_sid_enabled == 1) {
-                        cat021_setServiceId(packet, cat21items, asterix_sid);
+                        cat021_setServiceId(&packet, asterix_sid);
                     }
 
                 }
@@ -1098,18 +1335,19 @@ void *airnav_prepareData(void *arg) {
                     airnav_log_level(5, "Invalid ICAO code.\n");
                 } else {
                     acf->modes_addr = b->addr;
-                    acf->modes_addr_set = 1;
+                    acf->fields |= PDATA_MODES_ADDR;
                     // ANRB
                     acf2->modes_addr = b->addr;
-                    acf2->modes_addr_set = 1;
+                    acf2->fields |= PDATA_MODES_ADDR;
 
                     // Asterix
-                    unsigned char hexval[3];
-                    hexval[0] = (b->addr >> 16);
-                    hexval[1] = (b->addr >> 8);
-                    hexval[2] = (b->addr & 0x0000ff);
-                    cat021_setTargetAddress(packet, cat21items, hexval);
-                    currently_tracked_flights++;
+                    if (asterix_enabled == 1 && cat21_loaded == 1) {
+                        unsigned char hexval[3];
+                        hexval[0] = (b->addr >> 16);
+                        hexval[1] = (b->addr >> 8);
+                        hexval[2] = (b->addr & 0x0000ff);
+                        cat021_setTargetAddress(&packet, hexval);
+                    }
 
                     // Check conditions that force data to be sent
 
@@ -1174,13 +1412,13 @@ void *airnav_prepareData(void *arg) {
 
 
                         strcpy(acf->callsign, b->callsign);
-                        acf->callsign_set = 1;
+                        acf->fields |= PDATA_CALLSIGN;
                         // ANRB
                         strcpy(acf2->callsign, b->callsign);
-                        acf2->callsign_set = 1;
+                        acf2->fields |= PDATA_CALLSIGN;
                         //send = 0;
                         if (asterix_enabled == 1 && cat21_loaded == 1) {
-                            cat021_setTargetId(packet, cat21items, b->callsign);
+                            cat021_setTargetId(&packet, b->callsign);
                         }
 
                     } else {
@@ -1200,10 +1438,10 @@ void *airnav_prepareData(void *arg) {
                         b->an.rpisrv_emitted_airborne_time = tv.tv_sec;
                         b->an.rpisrv_emitted_airborne = 0;
                         acf->airborne = 0;
-                        acf->airborne_set = 1;
+                        acf->fields |= PDATA_AIRBORNE;
                         // ANRB
                         acf2->airborne = 0;
-                        acf2->airborne_set = 1;
+                        acf2->fields |= PDATA_AIRBORNE;
                         send = 1;
                         airnav_log_level(4, "[%06X] ******* Sending Airborne .\n", (b->addr & 0xffffff));
                     } else {
@@ -1227,17 +1465,17 @@ void *airnav_prepareData(void *arg) {
                                         b->an.rpisrv_emitted_airborne_time = tv.tv_sec;
 
                                         acf->airborne = 1;
-                                        acf->airborne_set = 1;
+                                        acf->fields |= PDATA_AIRBORNE;
                                         // ANRB
                                         acf2->airborne = 1;
-                                        acf2->airborne_set = 1;
+                                        acf2->fields |= PDATA_AIRBORNE;
                                     }
                                 }
                                 acf->altitude_geo = b->altitude_geom;
-                                acf->altitude_geo_set = 1;
+                                acf->fields |= PDATA_ALTITUDE_GEO;
                                 // ANRB
                                 acf2->altitude_geo = b->altitude_geom;
-                                acf2->altitude_geo_set = 1;
+                                acf2->fields |= PDATA_ALTITUDE_GEO;
                                 send = 1;
                                 airnav_log_level(4, "[%06X] Sending altitude_geom...%d\n", (b->addr & 0xffffff), b->altitude_geom);
                             } else {
@@ -1247,7 +1485,7 @@ void *airnav_prepareData(void *arg) {
 
                             // Asterix
                             if (asterix_enabled == 1 && cat21_loaded == 1) {
-                                cat021_setGeometricHeight(packet, cat21items, (b->altitude_geom / 100));
+                                cat021_setGeometricHeight(&packet, (b->altitude_geom / 100));
                             }
 
 
@@ -1274,17 +1512,17 @@ void *airnav_prepareData(void *arg) {
                                         b->an.rpisrv_emitted_airborne = 1;
                                         b->an.rpisrv_emitted_airborne_time = tv.tv_sec;
                                         acf->airborne = 1;
-                                        acf->airborne_set = 1;
+                                        acf->fields |= PDATA_AIRBORNE;
                                         // ANRB
                                         acf2->airborne = 1;
-                                        acf2->airborne_set = 1;
+                                        acf2->fields |= PDATA_AIRBORNE;
                                     }
                                 }
                                 acf->altitude = b->altitude_baro;
-                                acf->altitude_set = 1;
+                                acf->fields |= PDATA_ALTITUDE;
                                 // ANRB
                                 acf2->altitude = b->altitude_baro;
-                                acf2->altitude_set = 1;
+                                acf2->fields |= PDATA_ALTITUDE;
                                 send = 1;
 
 
@@ -1296,7 +1534,7 @@ void *airnav_prepareData(void *arg) {
 
                             // Asterix
                             if (asterix_enabled == 1 && cat21_loaded == 1) {
-                                cat021_setFlightLevel(packet, cat21items, (b->altitude_baro / 100));
+                                cat021_setFlightLevel(&packet, (b->altitude_baro / 100));
                             }
 
                         }
@@ -1311,23 +1549,23 @@ void *airnav_prepareData(void *arg) {
                     if (trackDataValid(&b->position_valid)) {
                         acf->lat = b->lat;
                         acf->lon = b->lon;
-                        acf->position_set = 1;
+                        acf->fields |= PDATA_POSITION;
 
                         if (((tv.tv_sec - b->an.rpisrv_emitted_pos_nic_time) >= MAX_TIME_FIELD_POS_NIC) || (b->an.rpisrv_emitted_pos_nic != b->pos_nic) || force_send == 1) { // Send only once every X seconds (or when data changed)
                             b->an.rpisrv_emitted_pos_nic_time = tv.tv_sec;
                             b->an.rpisrv_emitted_pos_nic = b->pos_nic;
                             acf->pos_nic = b->pos_nic;
-                            acf->pos_nic_set = 1;
+                            acf->fields |= PDATA_POS_NIC;
                         }
 
                         // ANRB
                         acf2->lat = b->lat;
                         acf2->lon = b->lon;
-                        acf2->position_set = 1;
+                        acf2->fields |= PDATA_POSITION;
                         send = 1;
                         // Asterix
                         if (asterix_enabled == 1 && cat21_loaded == 1) {
-                            cat021_setPosWGS84Precision(packet, cat21items, b->lat, b->lon);
+                            cat021_setPosWGS84Precision(&packet, b->lat, b->lon);
                         }
 
                     }
@@ -1344,10 +1582,10 @@ void *airnav_prepareData(void *arg) {
 
                         if (trackDataValid(&b->mag_heading_valid)) {
                             acf->heading = (b->mag_heading / 10);
-                            acf->heading_set = 1;
+                            acf->fields |= PDATA_HEADING;
                             // ANRB
                             acf2->heading = (b->mag_heading / 10);
-                            acf2->heading_set = 1;
+                            acf2->fields |= PDATA_HEADING;
                             send = 1;
 
                             airnav_log_level(4, "[%06X] Sending heading (mag)...%d\n", (b->addr & 0xffffff), (b->mag_heading / 10));
@@ -1360,7 +1598,7 @@ void *airnav_prepareData(void *arg) {
 
                     // Asterix
                     if (asterix_enabled == 1 && cat21_loaded == 1) {
-                        cat021_setMagneticHeading(packet, cat21items, b->mag_heading);
+                        cat021_setMagneticHeading(&packet, b->mag_heading);
                     }
 
                 }
@@ -1371,7 +1609,7 @@ void *airnav_prepareData(void *arg) {
                     if (trackDataValid(&b->tas_valid)) {
                         // Asterix
                         if (asterix_enabled == 1 && cat21_loaded == 1) {
-                            cat021_setTrueAirSpeed(packet, cat21items, 0, (short) b->tas);
+                            cat021_setTrueAirSpeed(&packet, 0, (short) b->tas);
                         }
                     }
                 }
@@ -1424,7 +1662,7 @@ void *airnav_prepareData(void *arg) {
 
 
                     // Calculate wind speed/direction
-                    if ((acf->altitude_set == 1) && (acf->position_set == 1) && (acf->heading_set == 1)) {
+                    if ((acf->fields & PDATA_ALTITUDE) && (acf->fields & PDATA_POSITION) && (acf->fields & PDATA_HEADING)) {
 
                         // If we have altitude and location set, we can check if we need to send temperature or not
                         if (((tv.tv_sec - b->an.rpisrv_emitted_temperature_time) >= MAX_TIME_FIELD_TEMPERATURE) || (b->an.rpisrv_emitted_temperature != (short) tempC)) { // 
@@ -1432,7 +1670,7 @@ void *airnav_prepareData(void *arg) {
                             b->an.rpisrv_emitted_temperature_time = tv.tv_sec;
 
                             acf->temperature = (short) tempC;
-                            acf->temperature_set = 1;
+                            acf->fields |= PDATA_TEMPERATURE;
                             send = 1;
                             airnav_log_level(4, "[%06X] Sending Weather: Air temp: %.3f K (%.3f C); \n", (b->addr & 0xffffff), temp, tempC);
                         } else {
@@ -1444,17 +1682,7 @@ void *airnav_prepareData(void *arg) {
                         double magLat = acf->lat;
                         double magLon = acf->lon;
 
-                        double declination; // Magnetic declination
-                        double dip; //
-                        double ti; // Total intensity
-                        double gv; // Grid variation
-
-                        time_t t = time(NULL);
-                        struct tm tm = *localtime(&t);
-                        sprintf(start_datetime, "%04d-%02d-%02d %02d:%02d:%02d", tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec);
-
-                        double decimalYear = ((double) (tm.tm_year + 1900.0)) + (((double) tm.tm_yday) / 365.0) + (((double) tm.tm_hour) / (24.0 * 365.0));
-                        geomag_geomg1(magAlt, magLat, magLon, decimalYear, &declination, &dip, &ti, &gv);
+                        double declination = airnav_declination(magAlt, magLat, magLon, tv.tv_sec); // Magnetic declination
 
                         double realHeading = b->mag_heading + declination;
                         double trackHeading = b->track;
@@ -1501,9 +1729,9 @@ void *airnav_prepareData(void *arg) {
 
 
                             acf->wind_dir = tmp_wind_dir;
-                            acf->wind_dir_set = 1;
+                            acf->fields |= PDATA_WIND_DIR;
                             acf->wind_speed = tmp_wind_speed;
-                            acf->wind_speed_set = 1;
+                            acf->fields |= PDATA_WIND_SPEED;
                             send = 1;
                             airnav_log_level(4, "[%06X] Sending Weather: Air temp: %.3f K (%.3f C); wind speed: %.3f m/s; wind angle: %.3f degrees. Components: %.3f,%.3f\n", (b->addr & 0xffffff), temp, tempC, windSpeed, windHeading, windX, windY);
                         } else {
@@ -1513,7 +1741,7 @@ void *airnav_prepareData(void *arg) {
                         //airnav_log_level(5, "[%06X] Air temp: %.3f K (%.3f C); wind speed: %.3f m/s; wind angle: %.3f degrees. Components: %.3f,%.3f\n", (b->addr & 0xffffff), temp, tempC, windSpeed, windHeading, windX, windY);
 
                     } else {
-                        airnav_log_level(5, "[%06X] missing parameters for wind calculation: altitude_set: %d; altitude_set: %d; position_set: %d; heading_set: %d;\n", acf->altitude_set, acf->position_set, acf->heading_set);
+                        airnav_log_level(5, "[%06X] missing parameters for wind calculation: altitude_set: %d; position_set: %d; heading_set: %d;\n", (b->addr & 0xffffff), (acf->fields & PDATA_ALTITUDE) != 0, (acf->fields & PDATA_POSITION) != 0, (acf->fields & PDATA_HEADING) != 0);
                     }
 
                 } else {
@@ -1532,10 +1760,10 @@ void *airnav_prepareData(void *arg) {
 
                         if (trackDataValid(&b->gs_valid)) {
                             acf->gnd_speed = (b->gs / 10);
-                            acf->gnd_speed_set = 1;
+                            acf->fields |= PDATA_GND_SPEED;
                             // ANRB
                             acf2->gnd_speed = (b->gs / 10);
-                            acf2->gnd_speed_set = 1;
+                            acf2->fields |= PDATA_GND_SPEED;
                             send = 1;
                             airnav_log_level(4, "[%06X] Sending ground speed...%.0f\n", (b->addr & 0xffffff), (b->gs / 10));
                         }
@@ -1556,10 +1784,10 @@ void *airnav_prepareData(void *arg) {
                             b->an.rpisrv_emitted_geom_rate_time = tv.tv_sec;
 
                             acf->vert_rate = (b->geom_rate / 10);
-                            acf->vert_rate_set = 1;
+                            acf->fields |= PDATA_VERT_RATE;
                             // ANRB
                             acf2->vert_rate = (b->geom_rate / 10);
-                            acf2->vert_rate_set = 1;
+                            acf2->fields |= PDATA_VERT_RATE;
                             send = 1;
                             airnav_log_level(4, "[%06X] Sending vertical rate geom...%d\n", (b->addr & 0xffffff), (b->geom_rate / 10));
                         } else {
@@ -1575,10 +1803,10 @@ void *airnav_prepareData(void *arg) {
                             b->an.rpisrv_emitted_baro_rate_time = tv.tv_sec;
 
                             acf->vert_rate = (b->baro_rate / 10);
-                            acf->vert_rate_set = 1;
+                            acf->fields |= PDATA_VERT_RATE;
                             // ANRB
                             acf2->vert_rate = (b->baro_rate / 10);
-                            acf2->vert_rate_set = 1;
+                            acf2->fields |= PDATA_VERT_RATE;
                             send = 1;
                             airnav_log_level(4, "[%06X] Sending vertical rate baro...%d\n", (b->addr & 0xffffff), (b->baro_rate / 10));
                         } else {
@@ -1597,10 +1825,10 @@ void *airnav_prepareData(void *arg) {
                             b->an.rpisrv_emitted_squawk_time = tv.tv_sec;
 
                             acf->squawk = b->squawk;
-                            acf->squawk_set = 1;
+                            acf->fields |= PDATA_SQUAWK;
                             // ANRB
                             acf2->squawk = b->squawk;
-                            acf2->squawk_set = 1;
+                            acf2->fields |= PDATA_SQUAWK;
                             send = 1;
                             airnav_log_level(4, "[%06X] Sending sqawk...%u\n", (b->addr & 0xffffff), b->squawk);
                         } else {
@@ -1621,10 +1849,10 @@ void *airnav_prepareData(void *arg) {
                         b->an.rpisrv_emitted_ias_time = tv.tv_sec;
 
                         acf->ias = (b->ias / 10);
-                        acf->ias_set = 1;
+                        acf->fields |= PDATA_IAS;
                         // ANRB
                         acf2->ias = (b->ias / 10);
-                        acf2->ias_set = 1;
+                        acf2->fields |= PDATA_IAS;
                         airnav_log_level(4, "[%06X] Sending IAS...%u\n", (b->addr & 0xffffff), b->ias);
                         send = 1;
                     } else {
@@ -1635,7 +1863,7 @@ void *airnav_prepareData(void *arg) {
 
                 // MLAT Flag check
                 if (mlat_check_is_mlat(b) == 1) {
-                    acf->is_mlat = 1;
+                    acf->fields |= PDATA_IS_MLAT;
                 }
 
 
@@ -1651,27 +1879,33 @@ void *airnav_prepareData(void *arg) {
 
                         if (b->nav_modes & NAV_MODE_AUTOPILOT) {
                             airnav_log_level(5, "HEX: %06X, AutoPilot: ON\n", b->addr);
-                            acf->nav_modes_autopilot_set = 1;
+                            acf->nav_modes |= NAV_MODE_AUTOPILOT;
+                            acf->fields |= PDATA_NAV_MODES;
                         }
                         if (b->nav_modes & NAV_MODE_VNAV) {
                             airnav_log_level(5, "HEX: %06X, VNAV: ON\n", b->addr);
-                            acf->nav_modes_vnav_set = 1;
+                            acf->nav_modes |= NAV_MODE_VNAV;
+                            acf->fields |= PDATA_NAV_MODES;
                         }
                         if (b->nav_modes & NAV_MODE_ALT_HOLD) {
                             airnav_log_level(5, "HEX: %06X, AltitudeHold: ON\n", b->addr);
-                            acf->nav_modes_alt_hold_set = 1;
+                            acf->nav_modes |= NAV_MODE_ALT_HOLD;
+                            acf->fields |= PDATA_NAV_MODES;
                         }
                         if (b->nav_modes & NAV_MODE_APPROACH) {
                             airnav_log_level(5, "HEX: %06X, Aproach: ON\n", b->addr);
-                            acf->nav_modes_aproach_set = 1;
+                            acf->nav_modes |= NAV_MODE_APPROACH;
+                            acf->fields |= PDATA_NAV_MODES;
                         }
                         if (b->nav_modes & NAV_MODE_LNAV) {
                             airnav_log_level(5, "HEX: %06X, LNAV: ON\n", b->addr);
-                            acf->nav_modes_lnav_set = 1;
+                            acf->nav_modes |= NAV_MODE_LNAV;
+                            acf->fields |= PDATA_NAV_MODES;
                         }
                         if (b->nav_modes & NAV_MODE_TCAS) {
                             airnav_log_level(5, "HEX: %06X, TCAS: ON\n", b->addr);
-                            acf->nav_modes_tcas_set = 1;
+                            acf->nav_modes |= NAV_MODE_TCAS;
+                            acf->fields |= PDATA_NAV_MODES;
                         }
 
                         airnav_log_level(4, "[%06X] Sending navigation modes\n", (b->addr & 0xffffff));
@@ -1691,7 +1925,7 @@ void *airnav_prepareData(void *arg) {
                         if (((tv.tv_sec - b->an.rpisrv_emitted_nav_altitude_fms_time) >= MAX_TIME_FIELD_NAV_ALT_FMS) || (b->an.rpisrv_emitted_nav_altitude_fms != b->nav_altitude_fms)) { // Send only once every 60 seconds (or when data changed)
                             b->an.rpisrv_emitted_nav_altitude_fms = b->nav_altitude_fms;
                             b->an.rpisrv_emitted_nav_altitude_fms_time = tv.tv_sec;
-                            acf->nav_altitude_fms_set = 1;
+                            acf->fields |= PDATA_NAV_ALTITUDE_FMS;
                             acf->nav_altitude_fms = (int) b->nav_altitude_fms;
                             airnav_log_level(4, "[%06X] Sending nav_altitude_fms: %u!\n", b->addr, b->nav_altitude_fms);
                         } else {
@@ -1709,7 +1943,7 @@ void *airnav_prepareData(void *arg) {
                             b->an.rpisrv_emitted_nav_altitude_mcp = b->nav_altitude_mcp;
                             b->an.rpisrv_emitted_nav_altitude_mcp_time = tv.tv_sec;
 
-                            acf->nav_altitude_mcp_set = 1;
+                            acf->fields |= PDATA_NAV_ALTITUDE_MCP;
                             acf->nav_altitude_mcp = b->nav_altitude_mcp;
                             airnav_log_level(4, "[%06X] Sending nav_altitude_mcp: %u!\n", b->addr, b->nav_altitude_mcp);
                         } else {
@@ -1723,17 +1957,18 @@ void *airnav_prepareData(void *arg) {
                     // Ignore unknow and invalid sources
                     if (b->nav_altitude_src > 1 && b->nav_altitude_src < 5) {
                         acf->nav_altitude_src = b->nav_altitude_src;
+                        acf->fields |= PDATA_NAV_ALTITUDE_SRC;
                         if (b->nav_altitude_src == 2) {
                             set_bit(&extra, 7);
-                            acf->extra_flags_set = 1;
+                            acf->fields |= PDATA_EXTRA_FLAGS;
                             acf->extra_flags = extra;
                         } else if (b->nav_altitude_src == 3) {
                             set_bit(&extra, 8);
-                            acf->extra_flags_set = 1;
+                            acf->fields |= PDATA_EXTRA_FLAGS;
                             acf->extra_flags = extra;
                         } else if (b->nav_altitude_src == 4) {
                             set_bit(&extra, 9);
-                            acf->extra_flags_set = 1;
+                            acf->fields |= PDATA_EXTRA_FLAGS;
                             acf->extra_flags = extra;
                         }
                         //                        airnav_log_level(4, "HEX: %06X, NAV_ALTITUDE_SOURCE Valid received! => %s\n", b->addr, nav_altitude_source_enum_string2(b->nav_altitude_src));
@@ -1748,7 +1983,7 @@ void *airnav_prepareData(void *arg) {
                         b->an.rpisrv_emitted_nav_qnh = b->nav_qnh;
                         b->an.rpisrv_emitted_nav_qnh_time = tv.tv_sec;
 
-                        acf->nav_qnh_set = 1;
+                        acf->fields |= PDATA_NAV_QNH;
                         acf->nav_qnh = (int) b->nav_qnh;
                         airnav_log_level(4, "[%06X] Sending NAV QNH Set: %.2f (%d)\n", (b->addr & 0xffffff), b->nav_qnh, (int) b->nav_qnh);
                     } else {
@@ -1760,7 +1995,7 @@ void *airnav_prepareData(void *arg) {
                 // NAV Heading is set?
                 if (trackDataAge(&b->nav_heading_valid) <= AIRNAV_MAX_ITEM_AGE) {
                     if ((int) b->nav_heading != 0) {
-                        acf->nav_heading_set = 1;
+                        acf->fields |= PDATA_NAV_HEADING;
                         acf->nav_heading = (int) b->nav_heading;
                         airnav_log_level(4, "HEX: %06X, NAV Heading Set: %.2f (%d)\n", b->addr, b->nav_heading, (int) b->nav_heading);
                     }
@@ -1773,7 +2008,7 @@ void *airnav_prepareData(void *arg) {
                         b->an.rpisrv_emitted_nic_baro_time = tv.tv_sec;
                         b->an.rpisrv_emitted_nic_baro = b->nic_baro;
                         acf->nic_baro = b->nic_baro;
-                        acf->nic_baro_set = 1;
+                        acf->fields |= PDATA_NIC_BARO;
                         send = 1;
                     }
                     //airnav_log("[%06X] nic_baro: %u\n", (b->addr & 0xffffff), b->nic_baro);
@@ -1785,7 +2020,7 @@ void *airnav_prepareData(void *arg) {
                         b->an.rpisrv_emitted_nac_p_time = tv.tv_sec;
                         b->an.rpisrv_emitted_nac_p = b->nac_p;
                         acf->nac_p = b->nac_p;
-                        acf->nac_p_set = 1;
+                        acf->fields |= PDATA_NAC_P;
                         send = 1;
                     }
                     //airnav_log("[%06X] nic_a: %u\n", (b->addr & 0xffffff), b->nic_a);
@@ -1797,7 +2032,7 @@ void *airnav_prepareData(void *arg) {
                         b->an.rpisrv_emitted_nac_v_time = tv.tv_sec;
                         b->an.rpisrv_emitted_nac_v = b->nac_v;
                         acf->nac_v = b->nac_v;
-                        acf->nac_v_set = 1;
+                        acf->fields |= PDATA_NAC_V;
                         send = 1;
                     }
                     //airnav_log("[%06X] nac_v: %u\n", (b->addr & 0xffffff), b->nac_v);
@@ -1811,9 +2046,9 @@ void *airnav_prepareData(void *arg) {
                         b->an.rpisrv_emitted_sil_time = tv.tv_sec;
                         b->an.rpisrv_emitted_sil = b->sil;
                         acf->sil = b->sil;
-                        acf->sil_set = 1;
+                        acf->fields |= PDATA_SIL;
                         acf->sil_type = b->sil_type;
-                        acf->sil_type_set = 1;
+                        acf->fields |= PDATA_SIL_TYPE;
                         send = 1;
                     }
                     //airnav_log("[%06X] sil: %u\n", (b->addr & 0xffffff), b->sil);
@@ -1822,47 +2057,72 @@ void *airnav_prepareData(void *arg) {
 
                 if (send == 1) {
                     airnav_log_level(12, "[Lat:%8.05f,Lon:%8.05f]Hex:%06x CLS:%s HDG:%d ALT:%d GSD:%d VR:%d SQW:%04x IAS:%d AIRBRN: %d\n", acf->lat, acf->lon, acf->modes_addr, acf->callsign, (acf->heading * 10), acf->altitude, (acf->gnd_speed * 10), (acf->vert_rate * 10), acf->squawk, acf->ias, acf->airborne);
-                    packet_cache_count++;
-                    acf->cmd = 5;
-                    // ANRB
-                    acf2->cmd = 5;
-
-                    tmp = malloc(sizeof (struct packet_list));
-                    tmp->next = flist;
+                    tmp = pool_getPacketListNode();
+                    tmp->next = local_list;
                     tmp->packet = acf;
-                    flist = tmp;
+                    local_list = tmp;
+                    if (local_tail == NULL) {
+                        local_tail = tmp;
+                    }
 
 
                     // ANRB
-                    tmp2 = malloc(sizeof (struct packet_list));
-                    tmp2->next = flist2;
+                    tmp2 = pool_getPacketListNode();
+                    tmp2->next = local_list2;
                     tmp2->packet = acf2;
-                    flist2 = tmp2;
+                    local_list2 = tmp2;
+                    if (local_tail2 == NULL) {
+                        local_tail2 = tmp2;
+                    }
 
                     send = 0;
+                    queued++;
 
                     if (asterix_enabled == 1 && cat21_loaded == 1) {
-                        asterix_SendCat21Packet(packet);
+                        asterix_SendCat21Packet(&packet, now);
                     }
 
 
                 } else {
-                    free(acf);
+                    pool_putPData(acf);
                     // ANRB
-                    free(acf2);
-                    if (asterix_enabled == 1 && cat21_loaded == 1) {
-                        free(packet);
-                    }
+                    pool_putPData(acf2);
                 }
 
+                b->an.rpisrv_next_due = airnav_nextResendDue(b, force_send, tv.tv_sec);
+                trackSetAirnavState(live, b);
 
-                b = b->next;
+                live = live->next;
             }
 
 
         }
-        pthread_mutex_unlock(&m_copy2);
-        pthread_mutex_unlock(&m_copy);
+        trackReadEnd(reader);
+
+        // Whatever is left of this sweep's target reports
+        if (asterix_enabled == 1 && cat21_loaded == 1) {
+            asterix_FlushCat21();
+        }
+
+        if (queued) {
+            pthread_mutex_lock(&m_copy);
+            local_tail->next = flist;
+            flist = local_list;
+            packet_cache_count += queued;
+            pthread_mutex_unlock(&m_copy);
+
+            pthread_mutex_lock(&m_copy2);
+            local_tail2->next = flist2;
+            flist2 = local_list2;
+            pthread_mutex_unlock(&m_copy2);
+        }
+
+        // Hand the batch to the feeder loop straight away instead of
+        // leaving it for a polling sender to find
+        if (queued) {
+            airnav_notifyFlights();
+            airnav_notifyANRB();
+        }
         sleep(AIRNAV_SEND_INTERVAL); // Send every X second
     }
 
@@ -1881,8 +2141,10 @@ void *airnav_prepareData(void *arg) {
 
 char *airnav_generateStatusJson(const char *url_path, int *len) {
 
-    char *buf = (char *) malloc(1024), *p = buf;
+    char *buf = (char *) malloc(4096), *p = buf;
     //int history_size;
+    struct pool_stats pdata_stats, plist_stats;
+    struct asterix_stats ast_stats;
 
     MODES_NOTUSED(url_path);
     char *myip = net_getLocalIp();
@@ -1927,6 +2189,17 @@ char *airnav_generateStatusJson(const char *url_path, int *len) {
             checkVhfRunning(), mlat_checkMLATRunning(), acars_checkACARSRunning(), vhf_mode, vhf_freqs, vhf_gain, vhf_squelch, vhf_correction, vhf_afc, autostart_vhf, autostart_mlat, myip, mac_a, g_lat, g_lon, g_alt, start_datetime, sn,
             pmu_temp, getCPUTemp(), 0.0, max_cpu_temp, 0, 0, 0, 0, airnav_com_inited, MODES_DUMP1090_VERSION, BDTIME);
 
+    pool_getStats(&pdata_stats, &plist_stats);
+    p += sprintf(p, ","
+            "\"packet_pool\": { \"allocs\": %lu, \"frees\": %lu, \"in_use\": %lu, \"max_in_use\": %lu, \"slabs\": %lu },"
+            "\"packet_list_pool\": { \"allocs\": %lu, \"frees\": %lu, \"in_use\": %lu, \"max_in_use\": %lu, \"slabs\": %lu }",
+            pdata_stats.allocs, pdata_stats.frees, pdata_stats.in_use, pdata_stats.max_in_use, pdata_stats.slabs,
+            plist_stats.allocs, plist_stats.frees, plist_stats.in_use, plist_stats.max_in_use, plist_stats.slabs);
+
+    asterix_getStats(&ast_stats);
+    p += sprintf(p, ","
+            "\"asterix\": { \"enabled\": %d, \"records\": %lu, \"datagrams\": %lu, \"bytes\": %lu, \"syscalls\": %lu, \"dropped\": %lu }",
+            asterix_enabled, ast_stats.records, ast_stats.datagrams, ast_stats.bytes, ast_stats.syscalls, ast_stats.dropped);
 
     p += sprintf(p, "}\n");
 
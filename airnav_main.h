@@ -25,10 +25,12 @@ extern "C" {
     void airnav_main(void);
     void airnav_init_mutex(void);
     void airnav_create_thread(void);
-    void *airnav_monitorConnection(void *arg);
-    void *airnav_statistics(void *arg);
-    void *airnav_send_stats_thread(void *argv);
-    void *airnav_threadSendData(void *argv);
+    void airnav_initFeeder(void);
+    void *airnav_feederThread(void *arg);
+    void *airnav_anrbThread(void *arg);
+    void airnav_notifyFlights(void);
+    void airnav_notifyANRB(void);
+    void airnav_stopFeeder(void);
     void *airnav_prepareData(void *arg);
     char *airnav_generateStatusJson(const char *url_path, int *len);
 
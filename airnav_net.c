@@ -9,7 +9,9 @@
 #include "airnav_net.h"
 #include "airnav_proc_packets.h"
 #include "airnav_utils.h"
+#include "airnav_framebuf.h"
 
+#include <errno.h>
 #include <signal.h>
 #include <unistd.h>
 #include <sys/types.h>          /* See NOTES */
@@ -20,6 +22,7 @@
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <netdb.h>
+#include <poll.h>
 #include "airnav_sk.h"
 
 
@@ -40,6 +43,7 @@ pthread_mutex_t m_packets_counter; //
 long packets_total = 0;
 long packets_last = 0;
 pthread_mutex_t m_cmd; // Mutex copy
+pthread_cond_t c_cmd; // Signalled with m_cmd held when expected_arrived is set
 ServerReply__ReplyStatus expected;
 char expected_arrived;
 int expected_id;
@@ -54,6 +58,8 @@ char *local_input_port;
 int anrb_port;
 
 pthread_t t_waitcmd;
+static struct outq net_outq; // Bytes for the server not yet taken by the socket
+static pthread_mutex_t m_outq = PTHREAD_MUTEX_INITIALIZER;
 
 
 
@@ -88,6 +94,10 @@ int net_connect(void) {
 
     if (connect(airnav_socket, (struct sockaddr *) &addr_airnav, sizeof (addr_airnav)) != -1) {
         /* Success */
+        // Anything left over belongs to the previous connection
+        pthread_mutex_lock(&m_outq);
+        outq_reset(&net_outq);
+        pthread_mutex_unlock(&m_outq);
         airnav_log("Connection established.\n");
         airnav_log_level(3, "Connected to %s on port %d\n", airnav_host, airnav_port);
         return 1;
@@ -162,166 +172,78 @@ void *net_thread_WaitCmds(void * argv) {
     signal(SIGTERM, rbfeederSigtermHandler);
 
 
-    int read_size;
-    char temp_char;
-    int buf_idx = 0;
-    unsigned short temp_size = 0;
-    unsigned short packet_size = 0;
-    long long unsigned bytes_garbage = 0;
-    char buf[BUFFLEN] = {0};
-
-    while (!Modes.exit) {
-
-
-        if (airnav_socket != -1) {
-
-            pthread_mutex_lock(&m_socket);
-            read_size = recv(airnav_socket, &temp_char, 1, MSG_PEEK | MSG_DONTWAIT);
-            pthread_mutex_unlock(&m_socket);
-
-
-            if (read_size > 0) { // There's data!
-
-                data_received = data_received + read_size;
-
-                pthread_mutex_lock(&m_socket);
-                if (buf_idx < BUFFLEN && (read_size = recv(airnav_socket, &temp_char, 1, 0) > 0)) {
-                    pthread_mutex_unlock(&m_socket);
-                    //last_success_received = (int) time(NULL); // Reset receiving timeout timer
-                    buf[buf_idx] = temp_char;
-                    buf_idx++;
-
-                    //airnav_log("Received: (dec: %d, Char: %c, buf_idx: %d)\n", temp_char, temp_char, buf_idx);
-
-
-
-
-
-
-
-
-
-
-
-
-                    // Check if we have at least 2 bytes in buffer (start of TX)
-                    if (buf_idx >= 2) {
-
-                        // check if first 2 bytes is start of tx
-                        if (buf[0] == txstart[0] && buf[1] == txstart[1]) {
-
-                            // Do things when TXStarted is already received
-
-                            // check if this is the final byte for packet size (byte number 4)
-                            if (buf_idx == 4) {
-                                airnav_log_level(6,"Packet Size Received.\n");
-                                airnav_log_level(6,"First byte value (unsigned int: %u).\n", buf[buf_idx - 2]);
-                                airnav_log_level(6,"Second byte value (unsigned int: %u).\n", buf[buf_idx - 1]);
-                                temp_size = (((unsigned short) buf[buf_idx - 2]) << 8) | (0x00ff & buf[buf_idx - 1]);
-                                // Check if we have valid packet size. At least 2 bytes of data
-                                if (temp_size <= 2) {
-
-                                    airnav_log_level(6,"Invalid packet size received (too small, %u). Reseting buffer.\n", temp_size);
-                                    // Increment garbage count for this client
-                                    bytes_garbage = bytes_garbage + buf_idx - 1;
-                                    memset(&buf, 0, sizeof (buf)); // Clear the buffer
-                                    buf_idx = 0;
-
-                                } else {
-                                    packet_size = temp_size;
-                                    airnav_log_level(6,"Valid packet size received. Value: %u\n", temp_size);
-                                }
-
-                            }
-
-                            // If we past the packet size index, start checking total received buffer
-                            if (buf_idx > 6) { // start of tx (2-bytes) + packet size (2-bytes) + 2 bytes of data (at least)
-                                //airnav_log("Data count in buffer: %d\n", c_list[slot].buf_idx - 4);
-
-                                // Check if we have all needed data and procced to decoding
-                                if (packet_size == (buf_idx - 4)) {
-                                    airnav_log_level(6,"All data received!! Let's decode...\n");
-                                    airnav_log_level(6,"Garbage from this client: %llu\n", bytes_garbage);
-                                    // Copy buffer to temporary pointer and send to proccess
-                                    char *tmp = NULL;
-                                    tmp = malloc(packet_size + 4);
-                                    memcpy(tmp, buf, packet_size + 4);
-                                    proccess_packet(tmp, packet_size + 4);
-                                    // Clear memory buffer
-                                    memset(&buf, 0, sizeof (buf)); // Clear the buffer
-                                    buf_idx = 0;
-                                    temp_char = 0;
-                                    packet_size = 0;
-                                    temp_size = 0;
-                                }
-
-                            }
-
-
-                        } else {
-
-                            airnav_log_level(6,"Checking for start of packet...start0=>%d, start1=>%d...buffer idx: %d, -1 => %d, -2 => %d\n", txstart[0], txstart[1], buf_idx, buf[buf_idx - 1], buf[buf_idx - 2]);
-                            if (buf[buf_idx - 1] == txstart[1] && buf[buf_idx - 2] == txstart[0]) {
-                                airnav_log_level(5,"Found start of Transmission bytes!! Position of first start byte: %d\n", buf_idx - 2);
-
-                                // Check if there's garbage before this start of TX
-                                if ((buf_idx - 2) > 0) {
-                                    // Increment garbage count for this client
-                                    bytes_garbage = bytes_garbage + (buf_idx - 2);
-                                }
-
-                                // Clear buffer and set first two bytes as tx start
-                                memset(&buf, 0, sizeof (buf)); // Clear the buffer
-                                buf_idx = 2;
-                                buf[0] = txstart[0];
-                                buf[1] = txstart[1];
-
-
-                            }
-
-
-                        }
-
-                    }
-
-
-
-
-
-
-
-
+    struct framebuf fb;
+    int fb_socket = -1; // Socket whose bytes are in fb
+    unsigned long long garbage_reported = 0;
 
+    if (!framebuf_init(&fb, BUFFLEN)) {
+        airnav_log("Could not allocate memory for the command buffer.\n");
+        pthread_exit(EXIT_SUCCESS);
+    }
 
+    while (!Modes.exit) {
 
+        if (airnav_socket == -1) {
+            usleep(100000);
+            continue;
+        }
 
+        // A partial frame from a previous connection is of no use
+        if (airnav_socket != fb_socket) {
+            framebuf_reset(&fb);
+            fb_socket = airnav_socket;
+        }
 
+        // Wait up to 100 miliseconds for data (or for room to send)
+        struct pollfd pfd;
+        pfd.fd = airnav_socket;
+        pfd.events = POLLIN;
+        if (net_outputPending()) {
+            pfd.events |= POLLOUT;
+        }
+        if (poll(&pfd, 1, 100) <= 0) {
+            continue;
+        }
 
+        if (pfd.revents & POLLOUT) {
+            net_flushOutput();
+        }
 
+        if (!(pfd.revents & (POLLIN | POLLHUP | POLLERR))) {
+            continue;
+        }
 
+        pthread_mutex_lock(&m_socket);
+        ssize_t read_size = framebuf_read(&fb, airnav_socket);
+        pthread_mutex_unlock(&m_socket);
 
+        if (read_size <= 0) {
+            if (read_size == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+                airnav_log_level(3, "Connection closed by server.\n");
+                net_force_disconnect();
+            }
+            continue;
+        }
 
-                } else {
-                    pthread_mutex_unlock(&m_socket);
-                    airnav_log_level(6, "Buffer is full!\n");
-                    memset(&buf, 0, sizeof (buf)); // Clear the buffer
-                    buf_idx = 0;
-                    temp_char = 0;
-                    packet_size = 0;
-                    temp_size = 0;
-                }
+        data_received = data_received + read_size;
 
-            } else { // No data.....sleep for 100 miliseconds to avoid 100% CPU usage
-                usleep(100000);
-            }
+        // Dispatch every complete frame straight from the buffer
+        const char *frame;
+        unsigned frame_len;
+        while ((frame = framebuf_next(&fb, &frame_len)) != NULL) {
+            airnav_log_level(6, "Packet received, size %u.\n", frame_len - FRAMEBUF_HEADER_SIZE);
+            proccess_packet(frame, frame_len);
+        }
 
-        } else {
-            //airnav_log("Socket inválido!\n");
-            usleep(100000);
+        if (fb.garbage != garbage_reported) {
+            airnav_log_level(6, "Garbage from server: %llu bytes (invalid frames: %lu, oversized: %lu)\n",
+                    fb.garbage, fb.invalid, fb.oversized);
+            garbage_reported = fb.garbage;
         }
 
     }
 
+    framebuf_destroy(&fb);
 
     airnav_log_level(1, "Exited WaitCmds Successfull!\n");
     pthread_exit(EXIT_SUCCESS);
@@ -332,84 +254,96 @@ void *net_thread_WaitCmds(void * argv) {
  * Function that send packets to clients
  */
 int net_send_packet(struct prepared_packet *packet) {
+    int ret = net_send_frame(packet->type, packet->buf, packet->len);
+
+    free(packet->buf);
+    free(packet);
 
+    return ret;
+}
 
-    //airnav_log_level(0,"Packet size: %u\n",packet->len);    
-    char size[2] = {0};
-    int sent_size = 0;
-    int total_sent = 0;
+/*
+ * Send one frame to the server. The caller keeps ownership of buf.
+ */
+int net_send_frame(enum messageTypes type, const void *buf, unsigned len) {
+    int ret;
 
-    // +1 is for the type of message that is not calculated before
-    size[0] = (packet->len + 1) >> 8;
-    size[1] = (packet->len + 1) & 0x00ff;
-    
-    if (packet->type == PINGPONG) {
+    //airnav_log_level(0,"Packet size: %u\n",len);    
+    if (type == PINGPONG) {
         airnav_log_level(5, "Sending ping packet.\n");
     }
-    
-    if ((sent_size = send(airnav_socket, txstart, 2, MSG_NOSIGNAL | MSG_DONTWAIT)) > -1) {
-        total_sent = total_sent + sent_size;
-    } else {
-        airnav_log_level(3, "Error sending data to server\n");
-        free(packet->buf);
-        free(packet);
-        net_force_disconnect();
-        return -1;
-    }
 
-    if ((sent_size = send(airnav_socket, size, 2, MSG_NOSIGNAL | MSG_DONTWAIT)) > -1) {
-        total_sent = total_sent + sent_size;
-    } else {
-        airnav_log_level(3, "Error sending data to server\n");
-        free(packet->buf);
-        free(packet);
-        net_force_disconnect();
-        return -1;
+    pthread_mutex_lock(&m_outq);
+    if (net_outq.buf == NULL && !outq_init(&net_outq, NET_OUTQ_SIZE)) {
+        pthread_mutex_unlock(&m_outq);
+        airnav_log("Could not allocate memory for output queue.\n");
+        return 0;
     }
+    ret = outq_sendFrame(&net_outq, airnav_socket, txstart, (char) type, buf, len);
+    pthread_mutex_unlock(&m_outq);
 
-    if ((sent_size = send(airnav_socket, &packet->type, 1, MSG_NOSIGNAL | MSG_DONTWAIT)) > -1) {
-        total_sent = total_sent + sent_size;
-    } else {
+    if (ret < 0) {
         airnav_log_level(3, "Error sending data to server\n");
-        free(packet->buf);
-        free(packet);
         net_force_disconnect();
         return -1;
     }
 
-    if ((sent_size = send(airnav_socket, packet->buf, packet->len, MSG_NOSIGNAL | MSG_DONTWAIT)) > -1) {
-        total_sent = total_sent + sent_size;
-    } else {
-        airnav_log_level(3, "Error sending data to server\n");
-        free(packet->buf);
-        free(packet);
-        net_force_disconnect();
-        return -1;
+    if (ret == 0) {
+        airnav_log_level(3, "Output queue to server is full, packet dropped.\n");
+        return 0;
     }
 
-
-    global_data_sent = global_data_sent + total_sent;
+    global_data_sent = global_data_sent + OUTQ_HEADER_SIZE + len;
     pthread_mutex_lock(&m_packets_counter);
     packets_total++;
     packets_last++;
     pthread_mutex_unlock(&m_packets_counter);
-    free(packet->buf);
-    free(packet);
 
     return 1;
 }
 
+/*
+ * Write out whatever is still pending in the output queue.
+ * Returns 1 when the queue is empty.
+ */
+int net_flushOutput(void) {
+    int ret = 1;
+
+    pthread_mutex_lock(&m_outq);
+    if (net_outq.len > 0) {
+        ret = outq_flush(&net_outq, airnav_socket);
+    }
+    pthread_mutex_unlock(&m_outq);
+
+    if (ret < 0) {
+        airnav_log_level(3, "Error sending data to server\n");
+        net_force_disconnect();
+    }
+
+    return ret == 1;
+}
+
+/*
+ * Are there bytes waiting for the socket to become writable?
+ */
+int net_outputPending(void) {
+    int pending;
+
+    pthread_mutex_lock(&m_outq);
+    pending = (net_outq.len > 0);
+    pthread_mutex_unlock(&m_outq);
+
+    return pending;
+}
+
 /*
  * Wait for specific CMD on socket
  */
 int net_waitCmd(ServerReply__ReplyStatus cmd, int id) {
 
     signal(SIGPIPE, net_sigpipe_handler);
-    static uint64_t next_update;
-    uint64_t now = mstime();
+    struct timespec deadline;
     int timeout = 0;
-    int abort = 0;
-    next_update = now + 1000;
 
     if (airnav_socket == -1) {
         airnav_log("Not connected to AirNAv Server\n");
@@ -422,39 +356,28 @@ int net_waitCmd(ServerReply__ReplyStatus cmd, int id) {
     if (id > 0) {
         expected_id = id;
     }
-    pthread_mutex_unlock(&m_cmd);
 
-    // Initial com
-    while (!abort) {
-
-        if (Modes.exit) {
-            abort = 1;
-        }
-
-        now = mstime();
-        if (now >= next_update) {
-            next_update = now + 1000;
+    // Woken by the reply handler as soon as the packet arrives; the one
+    // second slices are only there to notice Modes.exit
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    while (expected_arrived == 0 && !Modes.exit && timeout < AIRNAV_WAIT_PACKET_TIMEOUT) {
+        deadline.tv_sec++;
+        if (pthread_cond_timedwait(&c_cmd, &m_cmd, &deadline) == ETIMEDOUT) {
             timeout++;
             airnav_log_level(3, "Timeout...%d (of %d)\n", timeout, AIRNAV_WAIT_PACKET_TIMEOUT);
         }
+    }
 
-        if (timeout >= AIRNAV_WAIT_PACKET_TIMEOUT) {
-            abort = 1;
-        }
-
-        pthread_mutex_lock(&m_cmd);
-        if (expected_arrived == 1) {
-            airnav_log_level(3, "Expected CMD has arrived!\n");
-            expected_arrived = 0;
-            expected = 0;
-            expected_id = 0;
-            pthread_mutex_unlock(&m_cmd);
-            return cmd;
-        }
+    if (expected_arrived == 1) {
+        airnav_log_level(3, "Expected CMD has arrived!\n");
+        expected_arrived = 0;
+        expected = 0;
+        expected_id = 0;
         pthread_mutex_unlock(&m_cmd);
-        usleep(100000);
-
+        return cmd;
     }
+    pthread_mutex_unlock(&m_cmd);
+
     airnav_log_level(3, "Expected packet did not arrived :(\n");
 
     return 0;
@@ -495,115 +418,8 @@ void net_force_disconnect(void) {
  * Prepare a new packet
  */
 struct p_data *net_preparePacket_v2(void) {
-    struct p_data *pakg = malloc(sizeof (struct p_data));
-
-    pakg->cmd = 0;
-    pakg->c_version = 0;
-    pakg->c_type = 0;
-    pakg->c_type_set = 0;
-    memset(pakg->c_key, 0, 33);
-    pakg->c_key_set = 0;
-    pakg->c_version_set = 0;
-    pakg->modes_addr = 0;
-    pakg->modes_addr_set = 0;
-    memset(pakg->callsign, 0, 9);
-    pakg->callsign_set = 0;
-    pakg->altitude = 0;
-    pakg->altitude_set = 0;
-    pakg->lat = 0;
-    pakg->lon = 0;
-    pakg->position_set = 0;
-    pakg->heading = 0;
-    pakg->heading_set = 0;
-    pakg->gnd_speed = 0;
-    pakg->gnd_speed_set = 0;
-    pakg->ias = 0;
-    pakg->ias_set = 0;
-    pakg->vert_rate = 0;
-    pakg->vert_rate_set = 0;
-    pakg->squawk = 0;
-    pakg->squawk_set = 0;
-    pakg->airborne = 0;
-    pakg->airborne_set = 0;
-    memset(pakg->payload, 0, 501); // Payload for error and messages
-    pakg->payload_set = 0;
-    memset(pakg->c_ip, 0, 20);
-    pakg->extra_flags = 0;
-    pakg->extra_flags_set = 0;
-    pakg->is_mlat = 0;
-    pakg->is_978 = 0;
-    pakg->nav_altitude_fms_set = 0;
-    pakg->nav_altitude_fms = 0;
-    pakg->nav_altitude_mcp = 0;
-    pakg->nav_altitude_mcp_set = 0;
-    pakg->nav_heading = 0;
-    pakg->nav_heading_set = 0;
-    pakg->nav_qnh = 0;
-    pakg->nav_qnh_set = 0;
-
-    // Weather
-    pakg->weather_source = 0;
-    pakg->weather_source_set = 0;
-    pakg->wind_dir = 0;
-    pakg->wind_dir_set = 0;
-    pakg->wind_speed = 0;
-    pakg->wind_speed_set = 0;
-    pakg->temperature = 0;
-    pakg->temperature_set = 0;
-    pakg->pressure = 0;
-    pakg->pressure_set = 0;
-    pakg->humidity = 0;
-    pakg->humidity_set = 0;
-
-
-    // BDS4,5
-    pakg->turbulence = 0;
-    pakg->turbulence_set = 0;
-    pakg->wind_shear = 0;
-    pakg->wind_shear_set = 0;
-    pakg->micro_burst = 0;
-    pakg->micro_burst_set = 0;
-    pakg->icing_level = 0;
-    pakg->icing_level_set = 0;
-    pakg->wake_vortex = 0;
-    pakg->wake_vortex_set = 0;
-    pakg->average_static_pressure = 0;
-    pakg->average_static_pressure_set = 0;
-    pakg->radio_height = 0;
-    pakg->radio_height_set = 0;
-    pakg->static_air_temperature = 0;
-    pakg->static_air_temperature_set = 0;
-
-    // Nav Modes    
-    pakg->nav_modes_autopilot_set = 1;
-    pakg->nav_modes_vnav_set = 0;
-    pakg->nav_modes_alt_hold_set = 0;
-    pakg->nav_modes_aproach_set = 0;
-    pakg->nav_modes_lnav_set = 0;
-    pakg->nav_modes_tcas_set = 0;
-
-    // New fields - 24-08-2021
-    pakg->pos_nic = 0;
-    pakg->pos_nic_set = 0;
-    
-    pakg->nic_baro = 0;
-    pakg->nic_baro_set = 0;
-    
-    pakg->nac_p = 0;
-    pakg->nac_p_set = 0;
-    
-    pakg->nac_v = 0;
-    pakg->nac_v_set = 0;
-
-    pakg->sil = 0;
-    pakg->sil_set = 0;
-    
-    pakg->sil_type = 0;
-    pakg->sil_type_set = 0;
-
-    pakg->c_type = getClientType();
-
-    return pakg;
+    // Pool entries come back zeroed, i.e. with no fields set
+    return pool_getPData();
 }
 
 /*
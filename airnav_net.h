@@ -11,6 +11,7 @@
 
 #include "rbfeeder.h"
 #include "airnav_proc_packets.h"
+#include "airnav_outq.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -19,6 +20,7 @@ extern "C" {
     #define AIRNAV_MONITOR_SECONDS 60 // Check is connection is valid every X seconds
     #define AIRNAV_WAIT_PACKET_TIMEOUT 10 // Wwait X seconds for a packet from server (waiting response)
     #define DEFAULT_AIRNAV_HOST "rpiserver-ng.rb24.com"
+    #define NET_OUTQ_SIZE (256 * 1024) // Bytes buffered for the server while its socket is full
 
     /****** Variables ******/    
     extern char *mac_a;
@@ -38,6 +40,7 @@ extern "C" {
     extern long packets_total;
     extern long packets_last;
     extern pthread_mutex_t m_cmd;
+    extern pthread_cond_t c_cmd;
     extern ServerReply__ReplyStatus expected;
     extern char expected_arrived;
     extern int expected_id;
@@ -64,6 +67,9 @@ extern "C" {
     void net_sigpipe_handler();
     void *net_thread_WaitCmds(void * argv);
     int net_send_packet(struct prepared_packet *packet);
+    int net_send_frame(enum messageTypes type, const void *buf, unsigned len);
+    int net_flushOutput(void);
+    int net_outputPending(void);
     int net_waitCmd(ServerReply__ReplyStatus cmd, int id);
     int sendPing(void);
     void net_force_disconnect(void);
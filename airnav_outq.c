@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2020 - AirNav Systems
+ * 
+ * https://www.radarbox.com
+ * 
+ * More info: https://github.com/AirNav-Systems/rbfeeder
+ * 
+ */
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include "airnav_outq.h"
+
+/*
+ * Allocate the queue. size must hold at least one full frame.
+ */
+int outq_init(struct outq *q, size_t size) {
+    memset(q, 0, sizeof (*q));
+
+    if (size < OUTQ_HEADER_SIZE + OUTQ_MAX_PAYLOAD) {
+        size = OUTQ_HEADER_SIZE + OUTQ_MAX_PAYLOAD;
+    }
+
+    q->buf = malloc(size);
+    if (q->buf == NULL) {
+        return 0;
+    }
+    q->size = size;
+
+    return 1;
+}
+
+void outq_destroy(struct outq *q) {
+    free(q->buf);
+    memset(q, 0, sizeof (*q));
+}
+
+/*
+ * Drop anything pending, e.g. when the connection is replaced
+ */
+void outq_reset(struct outq *q) {
+    q->head = 0;
+    q->len = 0;
+}
+
+/*
+ * Append bytes to the tail of the queue. Caller checks for room.
+ */
+static void outq_push(struct outq *q, const char *data, size_t n) {
+    size_t tail = (q->head + q->len) % q->size;
+    size_t first = q->size - tail;
+
+    if (n == 0) {
+        return;
+    }
+    if (first > n) {
+        first = n;
+    }
+    memcpy(q->buf + tail, data, first);
+    memcpy(q->buf, data + first, n - first);
+    q->len += n;
+    q->bytes_queued += n;
+}
+
+/*
+ * Non-blocking gather write. Returns bytes written (0 if the socket
+ * would block) or -1 on error.
+ */
+static ssize_t outq_write(int fd, struct iovec *iov, int iovcnt) {
+    struct msghdr msg;
+    ssize_t n;
+
+    memset(&msg, 0, sizeof (msg));
+    msg.msg_iov = iov;
+    msg.msg_iovlen = iovcnt;
+
+    do {
+        n = sendmsg(fd, &msg, MSG_NOSIGNAL | MSG_DONTWAIT);
+    } while (n < 0 && errno == EINTR);
+
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+        return 0;
+    }
+    return n;
+}
+
+/*
+ * Write out as much of the queue as the socket takes.
+ * Returns 1 when the queue is empty, 0 when bytes remain, -1 on error.
+ */
+int outq_flush(struct outq *q, int fd) {
+    while (q->len > 0) {
+        struct iovec iov[2];
+        int iovcnt = 1;
+        size_t first = q->size - q->head;
+        ssize_t n;
+
+        if (first >= q->len) {
+            first = q->len;
+        } else {
+            iov[1].iov_base = q->buf;
+            iov[1].iov_len = q->len - first;
+            iovcnt = 2;
+        }
+        iov[0].iov_base = q->buf + q->head;
+        iov[0].iov_len = first;
+
+        n = outq_write(fd, iov, iovcnt);
+        if (n < 0) {
+            return -1;
+        }
+        if (n == 0) {
+            return 0;
+        }
+
+        q->head = (q->head + n) % q->size;
+        q->len -= n;
+    }
+
+    q->head = 0;
+    return 1;
+}
+
+/*
+ * Write iov out as one unit: all of it goes to the socket or the queue,
+ * or none of it does (see outq_sendFrame)
+ */
+static int outq_sendv(struct outq *q, int fd, struct iovec *iov, int iovcnt) {
+    size_t total = 0;
+    ssize_t n = 0;
+
+    for (int i = 0; i < iovcnt; i++) {
+        total += iov[i].iov_len;
+    }
+
+    if (q->len > 0 && outq_flush(q, fd) < 0) {
+        return -1;
+    }
+
+    if (q->len == 0) {
+        n = outq_write(fd, iov, iovcnt);
+        if (n < 0) {
+            return -1;
+        }
+    } else if (q->size - q->len < total) {
+        q->frames_dropped++;
+        return 0;
+    }
+
+    // Queue whatever was not written (an empty queue always has room)
+    for (int i = 0; i < iovcnt; i++) {
+        size_t skip = (size_t) n < iov[i].iov_len ? (size_t) n : iov[i].iov_len;
+        outq_push(q, (const char *) iov[i].iov_base + skip, iov[i].iov_len - skip);
+        n -= skip;
+    }
+
+    q->frames_sent++;
+    return 1;
+}
+
+/*
+ * Send one frame: start of TX, 2-byte big-endian size (payload + type),
+ * type byte, payload. Header and payload go out in a single gather write;
+ * any part the socket does not accept is queued. If older bytes are still
+ * pending the frame is queued behind them as a whole, or dropped when
+ * there is no room for it.
+ *
+ * Returns 1 if the frame was written or queued, 0 if it was dropped,
+ * -1 on socket error.
+ */
+int outq_sendFrame(struct outq *q, int fd, const char start[2], char type, const void *payload, size_t len) {
+    char header[OUTQ_HEADER_SIZE];
+    struct iovec iov[2];
+
+    if (len > OUTQ_MAX_PAYLOAD) {
+        q->frames_dropped++;
+        return 0;
+    }
+
+    header[0] = start[0];
+    header[1] = start[1];
+    header[2] = (char) ((len + 1) >> 8);
+    header[3] = (char) ((len + 1) & 0xff);
+    header[4] = type;
+
+    iov[0].iov_base = header;
+    iov[0].iov_len = OUTQ_HEADER_SIZE;
+    iov[1].iov_base = (void *) payload;
+    iov[1].iov_len = len;
+
+    return outq_sendv(q, fd, iov, len > 0 ? 2 : 1);
+}
+
+/*
+ * Same as outq_sendFrame() for a message that carries its own framing
+ * (e.g. an ANRB line): sent, queued or dropped whole.
+ */
+int outq_send(struct outq *q, int fd, const void *msg, size_t len) {
+    struct iovec iov;
+
+    if (len > q->size) {
+        q->frames_dropped++;
+        return 0;
+    }
+
+    iov.iov_base = (void *) msg;
+    iov.iov_len = len;
+
+    return outq_sendv(q, fd, &iov, 1);
+}
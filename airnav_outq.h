@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2020 - AirNav Systems
+ * 
+ * https://www.radarbox.com
+ * 
+ * More info: https://github.com/AirNav-Systems/rbfeeder
+ * 
+ */
+#ifndef AIRNAV_OUTQ_H
+#define AIRNAV_OUTQ_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define OUTQ_HEADER_SIZE 5 // start of TX (2) + size (2) + type (1)
+#define OUTQ_MAX_PAYLOAD 65534 // size field counts the type byte too
+
+    // Outbound byte queue for one framed connection. Whatever the socket
+    // does not take right away is kept here, in order, and written out
+    // before anything new, so a short write never splits a frame.
+    struct outq {
+        char *buf;
+        size_t size; // Capacity of buf
+        size_t head; // Offset of first unsent byte
+        size_t len; // Unsent bytes
+        unsigned long frames_sent; // Frames (or messages) written or queued
+        unsigned long frames_dropped; // Frames (or messages) refused because the queue was full
+        unsigned long bytes_queued; // Bytes that could not be written immediately
+    };
+
+
+    /****** Functions ******/
+    int outq_init(struct outq *q, size_t size);
+    void outq_destroy(struct outq *q);
+    void outq_reset(struct outq *q);
+    int outq_sendFrame(struct outq *q, int fd, const char start[2], char type, const void *payload, size_t len);
+    int outq_send(struct outq *q, int fd, const void *msg, size_t len);
+    int outq_flush(struct outq *q, int fd);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AIRNAV_OUTQ_H */
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2020 - AirNav Systems
+ * 
+ * https://www.radarbox.com
+ * 
+ * More info: https://github.com/AirNav-Systems/rbfeeder
+ * 
+ */
+#include "rbfeeder.h"
+#include "airnav_pool.h"
+
+/*
+ * Freelist allocators for the per-aircraft records that move between
+ * airnav_prepareData(), the upload thread and the ANRB thread.
+ *
+ * Items are carved out of slabs of POOL_SLAB_ITEMS and are never given
+ * back to the heap, so once the pools have grown to the busiest second
+ * seen, steady-state operation does no malloc/free at all. The slabs
+ * counter shows whether that is the case.
+ */
+
+struct pool_item {
+    struct pool_item *next;
+};
+
+struct pool {
+    size_t item_size;
+    struct pool_item *free_list;
+    pthread_mutex_t mutex;
+    struct pool_stats stats;
+};
+
+static struct pool pdata_pool = {
+    .item_size = sizeof (struct p_data),
+    .mutex = PTHREAD_MUTEX_INITIALIZER
+};
+
+static struct pool plist_pool = {
+    .item_size = sizeof (struct packet_list),
+    .mutex = PTHREAD_MUTEX_INITIALIZER
+};
+
+/*
+ * Add one slab worth of items to the freelist. Called with the pool locked.
+ */
+static int pool_grow(struct pool *p) {
+    char *slab = malloc(p->item_size * POOL_SLAB_ITEMS);
+
+    if (slab == NULL) {
+        return 0;
+    }
+
+    for (int i = POOL_SLAB_ITEMS - 1; i >= 0; i--) {
+        struct pool_item *item = (struct pool_item *) (slab + (size_t) i * p->item_size);
+        item->next = p->free_list;
+        p->free_list = item;
+    }
+    p->stats.slabs++;
+
+    return 1;
+}
+
+static void *pool_get(struct pool *p) {
+    struct pool_item *item;
+
+    pthread_mutex_lock(&p->mutex);
+    if (p->free_list == NULL && !pool_grow(p)) {
+        pthread_mutex_unlock(&p->mutex);
+        airnav_log("Could not allocate memory for packet pool.\n");
+        return NULL;
+    }
+
+    item = p->free_list;
+    p->free_list = item->next;
+
+    p->stats.allocs++;
+    p->stats.in_use++;
+    if (p->stats.in_use > p->stats.max_in_use) {
+        p->stats.max_in_use = p->stats.in_use;
+    }
+    pthread_mutex_unlock(&p->mutex);
+
+    memset(item, 0, p->item_size);
+    return item;
+}
+
+static void pool_put(struct pool *p, void *ptr) {
+    struct pool_item *item = ptr;
+
+    if (item == NULL) {
+        return;
+    }
+
+    pthread_mutex_lock(&p->mutex);
+    item->next = p->free_list;
+    p->free_list = item;
+    p->stats.frees++;
+    p->stats.in_use--;
+    pthread_mutex_unlock(&p->mutex);
+}
+
+/*
+ * Get a zeroed p_data
+ */
+struct p_data *pool_getPData(void) {
+    return pool_get(&pdata_pool);
+}
+
+void pool_putPData(struct p_data *pac) {
+    pool_put(&pdata_pool, pac);
+}
+
+/*
+ * Get a zeroed packet_list node
+ */
+struct packet_list *pool_getPacketListNode(void) {
+    return pool_get(&plist_pool);
+}
+
+void pool_putPacketListNode(struct packet_list *node) {
+    pool_put(&plist_pool, node);
+}
+
+/*
+ * Return a whole packet list, including the packets it holds
+ */
+void pool_putPacketList(struct packet_list *list) {
+    struct packet_list *next;
+
+    while (list != NULL) {
+        next = list->next;
+        pool_putPData(list->packet);
+        pool_putPacketListNode(list);
+        list = next;
+    }
+}
+
+/*
+ * Snapshot of the allocation counters
+ */
+void pool_getStats(struct pool_stats *pdata, struct pool_stats *plist) {
+    pthread_mutex_lock(&pdata_pool.mutex);
+    *pdata = pdata_pool.stats;
+    pthread_mutex_unlock(&pdata_pool.mutex);
+
+    pthread_mutex_lock(&plist_pool.mutex);
+    *plist = plist_pool.stats;
+    pthread_mutex_unlock(&plist_pool.mutex);
+}
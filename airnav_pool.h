@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2020 - AirNav Systems
+ * 
+ * https://www.radarbox.com
+ * 
+ * More info: https://github.com/AirNav-Systems/rbfeeder
+ * 
+ */
+#ifndef AIRNAV_POOL_H
+#define AIRNAV_POOL_H
+#include "airnav_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define POOL_SLAB_ITEMS 256 // Items carved out of each slab allocation
+
+    // Allocation counters for one pool
+    struct pool_stats {
+        unsigned long allocs; // Items handed out since startup
+        unsigned long frees; // Items returned since startup
+        unsigned long in_use; // Items currently handed out
+        unsigned long max_in_use; // High-water mark of in_use
+        unsigned long slabs; // Heap allocations made by the pool
+    };
+
+
+    /****** Functions ******/
+    struct p_data *pool_getPData(void);
+    void pool_putPData(struct p_data *pac);
+    struct packet_list *pool_getPacketListNode(void);
+    void pool_putPacketListNode(struct packet_list *node);
+    void pool_putPacketList(struct packet_list *list);
+    void pool_getStats(struct pool_stats *pdata, struct pool_stats *plist);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AIRNAV_POOL_H */
@@ -14,23 +14,19 @@
 #include <time.h>
 #include "airnav_cmd.h"
 #include "airnav_net.h"
+#include "airnav_flightenc.h"
 
 /*
- * Proccess and identify packet type
+ * Proccess and identify packet type. packet is a whole frame (start of
+ * TX, size, type, data) and stays owned by the caller.
  */
-void proccess_packet(char *packet, unsigned short p_size) {
+void proccess_packet(const char *packet, unsigned p_size) {
 
     enum messageTypes type = packet[4];
 
-    // Get packet data
-    uint8_t *data_buf = malloc(p_size - 5);
+    // Data follows the type byte
+    const uint8_t *data_buf = (const uint8_t *) packet + 5;
 
-    for (int i = 5; i < p_size; i++) {
-        //airnav_log("Packet value: %d => %d (%c)\n", i-5, packet[i], packet[i] );
-        data_buf[i - 5] = packet[i];
-    }
-
-    free(packet);
     airnav_log_level(6, "Packet type: %u\n", type);
 
     switch (type) {
@@ -57,7 +53,7 @@ void proccess_packet(char *packet, unsigned short p_size) {
 /*
  * Proccess server reply packet
  */
-void proccess_ServerReplyPacket(uint8_t *packet, unsigned p_size) {
+void proccess_ServerReplyPacket(const uint8_t *packet, unsigned p_size) {
     
     ServerReply *reply;
 
@@ -89,11 +85,13 @@ void proccess_ServerReplyPacket(uint8_t *packet, unsigned p_size) {
 
         if (reply->status == expected && expected_id == reply->id) {
             expected_arrived = 1;
+            pthread_cond_signal(&c_cmd);
         }
 
     } else {
         if (reply->status == expected) {
             expected_arrived = 1;
+            pthread_cond_signal(&c_cmd);
         }
     }
     pthread_mutex_unlock(&m_cmd);
@@ -185,7 +183,6 @@ void proccess_ServerReplyPacket(uint8_t *packet, unsigned p_size) {
     }
     
     
-    free(packet);
     server_reply__free_unpacked(reply, NULL);
 
 }
@@ -307,198 +304,51 @@ struct prepared_packet *create_packet_SysInfo(struct utsname *sysinfo) {
 }
 
 /*
- * Test function
+ * Send the flights collected in enc as one FlightPacket
  */
-void sendMultipleFlights(packet_list *flights, unsigned qtd) {
-
-    MODES_NOTUSED(flights);
-
-
-    FlightPacket fpacket = FLIGHT_PACKET__INIT;
-    FlightData **subs;
-    void *buf;
-
-    unsigned len, i, number_of_flights = 0;
-    subs = malloc(sizeof (FlightData*) * qtd);
-    i = 0;
-    
-    //struct packet_list *first = flights;
-    
-    while (flights != NULL) {
-        
-        
-        number_of_flights++;
-        subs[i] = malloc(sizeof (FlightData));
-        flight_data__init(subs[i]);        
-        subs[i]->addr = flights->packet->modes_addr;
-
-        if (flights->packet->callsign_set == 1) {
-            subs[i]->callsign = strdup(flights->packet->callsign);
-        }
-
-        if (flights->packet->altitude_set == 1) {
-            subs[i]->altitude = flights->packet->altitude;
-            subs[i]->has_altitude = 1;
-        }
-        
-        if (flights->packet->altitude_geo_set == 1) {            
-            subs[i]->altitude_geo = flights->packet->altitude_geo;
-            subs[i]->has_altitude_geo = 1;
-        }
-
-        if (flights->packet->position_set == 1) {
-            subs[i]->latitude = flights->packet->lat;
-            subs[i]->longitude = flights->packet->lon;
-            subs[i]->has_latitude = 1;
-            subs[i]->has_longitude = 1;
-        }
-
-        if (flights->packet->heading_set == 1) {
-            subs[i]->heading = flights->packet->heading;
-            subs[i]->has_heading = 1;
-        }
-
-        if (flights->packet->gnd_speed_set == 1) {
-            subs[i]->gnd_speed = flights->packet->gnd_speed;
-            subs[i]->has_gnd_speed = 1;
-        }
-
-        if (flights->packet->ias_set == 1) {
-            subs[i]->ias = flights->packet->ias;
-            subs[i]->has_ias = 1;
-        }
+static void sendFlightPacket(struct flightenc *enc) {
 
-        if (flights->packet->vert_rate_set == 1) {
-            subs[i]->vert_rate = flights->packet->vert_rate;
-            subs[i]->has_vert_rate = 1;
-        }
-
-        if (flights->packet->squawk_set == 1) {
-            subs[i]->squawk = flights->packet->squawk;
-            subs[i]->has_squawk = 1;
-        }
-
-        if (flights->packet->airborne_set == 1) {
-            subs[i]->airborne = flights->packet->airborne;
-            subs[i]->has_airborne = 1;
-        }
+    if (enc->flights == 0 || airnav_com_inited != 1) {
+        return;
+    }
 
-        if (flights->packet->is_978 == 1) {
-            subs[i]->is_978 = 1;
-            subs[i]->has_is_978 = 1;
-        }
+    if (net_send_frame(FLIGHT_PACKET, enc->buf, enc->len) == 1) {
+        // Increase packet counter (net_send_frame() already counted one)
+        pthread_mutex_lock(&m_packets_counter);
+        packets_total = packets_total + (enc->flights - 1);
+        packets_last = packets_last + (enc->flights - 1);
+        pthread_mutex_unlock(&m_packets_counter);
+    }
+}
 
-        if (flights->packet->is_mlat == 1) {
-            subs[i]->is_mlat = 1;
-            subs[i]->has_is_mlat = 1;
-        }
+void sendMultipleFlights(packet_list *flights, unsigned qtd) {
 
-        if (flights->packet->nav_altitude_fms_set == 1) {
-            subs[i]->nav_altitude_fms = flights->packet->nav_altitude_fms;
-            subs[i]->has_nav_altitude_fms = 1;
-        }
+    MODES_NOTUSED(qtd);
 
-        if (flights->packet->nav_altitude_mcp_set == 1) {
-            subs[i]->nav_altitude_mcp = flights->packet->nav_altitude_mcp;
-            subs[i]->has_nav_altitude_mcp = 1;
-        }
+    // Only used by the sendData thread; the buffer is kept between batches
+    static struct flightenc enc;
 
-        if (flights->packet->nav_qnh_set == 1) {
-            subs[i]->nav_qnh = flights->packet->nav_qnh;
-            subs[i]->has_nav_qnh = 1;
-        }
+    flightenc_reset(&enc);
 
-        // Weather
-        if (flights->packet->wind_dir_set == 1) {
-            subs[i]->wind_dir = flights->packet->wind_dir;
-            subs[i]->has_wind_dir = 1;
-        }
+    while (flights != NULL) {
 
-        if (flights->packet->wind_speed_set == 1) {
-            subs[i]->wind_speed = flights->packet->wind_speed;
-            subs[i]->has_wind_speed = 1;
+        // The frame size field is 16 bits, so large batches go out as
+        // several FlightPackets
+        if (enc.len + FLIGHTENC_MAX_FLIGHT_SIZE > OUTQ_MAX_PAYLOAD) {
+            sendFlightPacket(&enc);
+            flightenc_reset(&enc);
         }
 
-        if (flights->packet->temperature_set == 1) {
-            subs[i]->temperature = flights->packet->temperature;
-            subs[i]->has_temperature = 1;
+        if (!flightenc_addFlight(&enc, flights->packet)) {
+            airnav_log("Could not allocate memory for flight packet.\n");
         }
 
-        if (flights->packet->pos_nic_set == 1) {
-            subs[i]->pos_nic = flights->packet->pos_nic;
-            subs[i]->has_pos_nic = 1;
-        }
-        
-        if (flights->packet->nic_baro_set == 1) {
-            subs[i]->nic_baro = flights->packet->nic_baro;
-            subs[i]->has_nic_baro = 1;            
-        }
-        
-        if (flights->packet->nac_p_set == 1) {
-            subs[i]->nac_p = flights->packet->nac_p;
-            subs[i]->has_nac_p = 1;            
-        }
-        
-        if (flights->packet->nac_v_set == 1) {
-            subs[i]->nac_v = flights->packet->nac_v;
-            subs[i]->has_nac_v = 1;            
-        }
-        
-        if (flights->packet->sil_set == 1) {
-            subs[i]->sil = flights->packet->sil;
-            subs[i]->has_sil = 1;            
-        }
-        
-        if (flights->packet->sil_type_set == 1) {
-            subs[i]->sil_type = flights->packet->sil_type;
-            subs[i]->has_sil_type = 1;            
-        }
-        
-        free(flights->packet);
+        pool_putPData(flights->packet);
         struct packet_list *old = flights;
         flights = flights->next;
-        free(old);
-        i++;
+        pool_putPacketListNode(old);
 
     }
 
-    fpacket.n_fdata = qtd;
-    fpacket.fdata = subs;
-
-    len = flight_packet__get_packed_size(&fpacket);
-    
-    
-    if (airnav_com_inited == 1) {
-
-        buf = malloc(len); // Allocate memory     
-        flight_packet__pack(&fpacket, buf);
-        
-        struct prepared_packet *packet = malloc(sizeof (struct prepared_packet));
-        packet->buf = buf;
-        packet->len = len;
-        packet->type = FLIGHT_PACKET;
-
-        if (net_send_packet(packet) == 1 ) {
-            // Increase packet counter
-            pthread_mutex_lock(&m_packets_counter);
-            if (number_of_flights > 1) {
-                packets_total = packets_total + (number_of_flights - 1);
-                packets_last = packets_last + (number_of_flights - 1);
-            } else {
-                packets_total = packets_total + number_of_flights;
-                packets_last = packets_last + number_of_flights;
-            }
-            pthread_mutex_unlock(&m_packets_counter);
-        }
-
-    }
-    
-
-    for (i = 0; i < qtd; i++){
-        if (subs[i]->callsign != NULL) {
-            free(subs[i]->callsign);
-        }
-        free(subs[i]);
-    }
-    free(subs);
+    sendFlightPacket(&enc);
 }
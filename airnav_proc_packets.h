@@ -40,10 +40,10 @@ extern "C" {
     
     
     /****** Functions *******/
-    void proccess_packet(char *packet, unsigned short p_size);
+    void proccess_packet(const char *packet, unsigned p_size);
     struct prepared_packet *create_packet_AuthFeederRequest(char *sk, ClientType client_type, char *serial);
     struct prepared_packet *create_packet_SK_Request(ClientType client_type, char *serial);
-    void proccess_ServerReplyPacket(uint8_t *packet, unsigned p_size);
+    void proccess_ServerReplyPacket(const uint8_t *packet, unsigned p_size);
     struct prepared_packet *create_packet_Ping(int ping_id);
     void sendMultipleFlights(packet_list *flights, unsigned qtd);
     struct prepared_packet *create_packet_SysInfo(struct utsname *sysinfo);
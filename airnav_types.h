@@ -11,6 +11,7 @@
 
 #include <pthread.h>
 #include "dump1090.h"
+#include "airnav_outq.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -19,115 +20,73 @@ extern "C" {
 
     // This struct is only to organize local data before send.
     // This struct will not be send this way!
+    //
+    // Only the fields carried by FlightData are kept, ordered by size so
+    // there is no padding, and which of them are valid is tracked in a
+    // single bitmask instead of one short per field.
+
+    // p_data.fields
+#define PDATA_MODES_ADDR        (1U << 0)
+#define PDATA_CALLSIGN          (1U << 1)
+#define PDATA_ALTITUDE          (1U << 2)
+#define PDATA_ALTITUDE_GEO      (1U << 3)
+#define PDATA_POSITION          (1U << 4)
+#define PDATA_HEADING           (1U << 5)
+#define PDATA_GND_SPEED         (1U << 6)
+#define PDATA_IAS               (1U << 7)
+#define PDATA_VERT_RATE         (1U << 8)
+#define PDATA_SQUAWK            (1U << 9)
+#define PDATA_AIRBORNE          (1U << 10)
+#define PDATA_EXTRA_FLAGS       (1U << 11)
+#define PDATA_NAV_ALTITUDE_FMS  (1U << 12)
+#define PDATA_NAV_ALTITUDE_MCP  (1U << 13)
+#define PDATA_NAV_QNH           (1U << 14)
+#define PDATA_NAV_HEADING       (1U << 15)
+#define PDATA_NAV_ALTITUDE_SRC  (1U << 16)
+#define PDATA_NAV_MODES         (1U << 17)
+#define PDATA_WIND_DIR          (1U << 18)
+#define PDATA_WIND_SPEED        (1U << 19)
+#define PDATA_TEMPERATURE       (1U << 20)
+#define PDATA_POS_NIC           (1U << 21)
+#define PDATA_NIC_BARO          (1U << 22)
+#define PDATA_NAC_P             (1U << 23)
+#define PDATA_NAC_V             (1U << 24)
+#define PDATA_SIL               (1U << 25)
+#define PDATA_SIL_TYPE          (1U << 26)
+#define PDATA_IS_MLAT           (1U << 27) // flag only, no value
+#define PDATA_IS_978            (1U << 28) // flag only, no value
 
     typedef struct p_data {
-        char cmd;
-        uint64_t c_version;
-        char c_key[33];
-        short c_key_set;
-        short c_version_set;
-        char c_sn[30];
+        uint64_t timestp;
+        double lat;
+        double lon;
+        uint32_t fields; // PDATA_* bits of the values below that are set
         int32_t modes_addr;
-        short modes_addr_set;
-        char callsign[9];
-        short callsign_set;
         int32_t altitude;
-        short altitude_set;
         int32_t altitude_geo;
-        short altitude_geo_set;
-        double lat;
-        double lon;
-        short position_set;
-        short heading;
-        short heading_set;
-        short gnd_speed;
-        char c_type;
-        short c_type_set;
-        short gnd_speed_set;
-        short ias;
-        short ias_set;
-        short vert_rate;
-        short vert_rate_set;
-        short squawk;
-        short squawk_set;
-        char airborne;
-        short airborne_set;
-        char payload[501]; // Payload for error and messages
-        short payload_set;
-        uint64_t timestp;
-        char p_timestamp[25];
-        char c_ip[20];
         int32_t extra_flags;
-        short extra_flags_set;
-        int is_mlat;
-        short is_978;
-
-        short nav_altitude_fms_set;
-        unsigned nav_altitude_fms;
-        short nav_altitude_mcp_set;
-        unsigned nav_altitude_mcp;
-        short nav_qnh_set;
         int32_t nav_qnh;
-        short nav_heading_set;
         int32_t nav_heading;
-        char nav_altitude_src;
-
-        // Nav Modes
-        short nav_modes_autopilot_set;
-        short nav_modes_vnav_set;
-        short nav_modes_alt_hold_set;
-        short nav_modes_aproach_set;
-        short nav_modes_lnav_set;
-        short nav_modes_tcas_set;
-
-
-        // Weather
-        // BDS4,4
-        char weather_source;
-        short weather_source_set;
-        short wind_dir;
-        short wind_dir_set;
-        short wind_speed;
-        short wind_speed_set;
-        int32_t temperature;
-        short temperature_set;
-        int32_t pressure;
-        short pressure_set;
-        char humidity;
-        short humidity_set;
-
-        // BDS4,5
-        char turbulence;
-        short turbulence_set;
-        char wind_shear;
-        short wind_shear_set;
-        char micro_burst;
-        short micro_burst_set;
-        char icing_level;
-        short icing_level_set;
-        char wake_vortex;
-        short wake_vortex_set;
-        int32_t average_static_pressure;
-        short average_static_pressure_set;
-        int32_t radio_height;
-        short radio_height_set;
-        int32_t static_air_temperature;
-        short static_air_temperature_set;
-
-        unsigned pos_nic;
-        char pos_nic_set;
-        char nic_baro;
-        char nic_baro_set;
-        unsigned nac_p;
-        char nac_p_set;
-        unsigned nac_v;
-        char nac_v_set;
-        unsigned sil;
-        char sil_set;
-        unsigned sil_type;
-        char sil_type_set;
-
-
+        uint32_t nav_altitude_fms;
+        uint32_t nav_altitude_mcp;
+        int16_t heading;
+        int16_t gnd_speed;
+        int16_t ias;
+        int16_t vert_rate;
+        int16_t squawk;
+        int16_t wind_dir;
+        int16_t wind_speed;
+        int16_t temperature;
+        uint8_t airborne;
+        uint8_t nav_altitude_src;
+        uint8_t nav_modes; // NAV_MODE_* bits
+        uint8_t pos_nic;
+        uint8_t nic_baro;
+        uint8_t nac_p;
+        uint8_t nac_v;
+        uint8_t sil;
+        uint8_t sil_type;
+        char callsign[9];
     } p_data;
 
     typedef struct packet_list {
@@ -138,8 +97,10 @@ extern "C" {
     typedef struct s_anrb {
         int8_t active;
         int32_t port;
-        pthread_t s_thread;
-        int *socket;
+        int socket;
+        int ev_id; // Source on the feeder loop
+        int want_write; // Watching for EPOLLOUT (output is queued)
+        struct outq outq; // Bytes not yet taken by the socket
     } s_anrb;
 
 
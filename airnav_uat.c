@@ -7,6 +7,8 @@
  * 
  */
 #include "rbfeeder.h"
+#include "airnav_linebuf.h"
+#include <poll.h>
 
 pid_t p_978;
 char *dump978_cmd;
@@ -120,6 +122,12 @@ void *uat_airnav_ext978(void *arg) {
     int sock_978;
     struct sockaddr_in addr_978;
     int * p_int;
+    struct linebuf lb;
+
+    if (!linebuf_init(&lb, UAT_LINEBUF_SIZE)) {
+        airnav_log("Could not allocate memory for dump978 input buffer.\n");
+        return NULL;
+    }
 
 START_EXT:
     sock_978 = socket(AF_INET, SOCK_STREAM, 0);
@@ -151,41 +159,58 @@ START_EXT:
 
     airnav_log_level(1, "dump978 connected!\n");
 
-    int buffer_size = 4096;
-    int r = 0;
-    char buf[buffer_size];
-
-    memset(&buf, 0, 4096);
+    // dump978 sends one JSON object per line; a read may hold several
+    // of them, or end in the middle of one
+    linebuf_reset(&lb);
+    ssize_t r = 0;
 
     while (!Modes.exit) {
 
-        r = recv(sock_978, &buf, buffer_size, MSG_DONTWAIT);
+        struct pollfd pfd;
+        pfd.fd = sock_978;
+        pfd.events = POLLIN;
+        if (poll(&pfd, 1, 1000) <= 0) {
+            continue;
+        }
+
+        r = linebuf_read(&lb, sock_978);
         if (r > 0) {
 
-            r = 0;
-            airnav_log_level(4, "Received data from dump978: %s\n", buf);
-            uat_store978data(buf);
-            memset(&buf, 0, 4096);
-            usleep(40000);
-        } else if (r == 0) {
+            char *line;
+            int queued = 0;
+            while ((line = linebuf_next(&lb)) != NULL) {
+                airnav_log_level(4, "Received data from dump978: %s\n", line);
+                queued |= uat_store978data(line);
+            }
+
+            // One wakeup per read, so a burst goes out as one batch
+            if (queued) {
+                airnav_notifyFlights();
+            }
+
+        } else if (r == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
             close(sock_978);
             airnav_log_level(4, "Disconnected from dump978\n");
             //close(sock_int);
             sleep(5);
             goto START_EXT;
 
-        } else {
-            usleep(40000);
         }
 
 
     }
 
+    close(sock_978);
+    linebuf_destroy(&lb);
     return NULL;
 
 }
 
-int uat_store978data(char packet[4096]) {
+/*
+ * Decode one dump978 JSON object and queue it for sending.
+ * Returns 1 if it was queued.
+ */
+int uat_store978data(const char *packet) {
 
     int send = 0;
     json_t *root = load_json(packet);
@@ -196,8 +221,7 @@ int uat_store978data(char packet[4096]) {
         struct p_data *acf;
         acf = net_preparePacket_v2();
         acf->timestp = mstime();
-        acf->cmd = 5;
-        acf->is_978 = 1;
+        acf->fields |= PDATA_IS_978;
 
         // Check if ADDRESS is filled
         json_t *address = json_object_get(root, "address");
@@ -207,7 +231,7 @@ int uat_store978data(char packet[4096]) {
             int num = (int) strtol(address_s, NULL, 16);
 
             acf->modes_addr = num;
-            acf->modes_addr_set = 1;
+            acf->fields |= PDATA_MODES_ADDR;
             send = 1;
 
         }
@@ -225,7 +249,7 @@ int uat_store978data(char packet[4096]) {
                 double lon = json_real_value(lon_item);
                 acf->lat = lat;
                 acf->lon = lon;
-                acf->position_set = 1;
+                acf->fields |= PDATA_POSITION;
                 send = 1;
             }
 
@@ -240,7 +264,7 @@ int uat_store978data(char packet[4096]) {
             int ground_speed = json_integer_value(ground_speed_item);
 
             acf->gnd_speed = (ground_speed / 10);
-            acf->gnd_speed_set = 1;
+            acf->fields |= PDATA_GND_SPEED;
             send = 1;
 
         }
@@ -252,7 +276,7 @@ int uat_store978data(char packet[4096]) {
 
             double true_track = json_real_value(true_track_item);
             acf->heading = (true_track / 10);
-            acf->heading_set = 1;
+            acf->fields |= PDATA_HEADING;
             send = 1;
 
         }
@@ -264,7 +288,7 @@ int uat_store978data(char packet[4096]) {
 
             int vertical_velocity_geometric = json_integer_value(vertical_velocity_geometric_item);
             acf->vert_rate = (vertical_velocity_geometric / 10);
-            acf->vert_rate_set = 1;
+            acf->fields |= PDATA_VERT_RATE;
             send = 1;
         }
 
@@ -275,7 +299,7 @@ int uat_store978data(char packet[4096]) {
 
             int vertical_velocity_barometric = json_integer_value(vertical_velocity_barometric_item);
             acf->vert_rate = (vertical_velocity_barometric / 10);
-            acf->vert_rate_set = 1;
+            acf->fields |= PDATA_VERT_RATE;
             send = 1;
         }
 
@@ -286,7 +310,7 @@ int uat_store978data(char packet[4096]) {
             //pthread_mutex_lock(&Modes.data_mutex);
 
             struct packet_list *tmp;
-            tmp = malloc(sizeof (struct packet_list));
+            tmp = pool_getPacketListNode();
             tmp->next = flist;
             tmp->packet = acf;
             flist = tmp;
@@ -296,7 +320,7 @@ int uat_store978data(char packet[4096]) {
 
 
         } else {
-            free(acf);
+            pool_putPData(acf);
         }
 
         json_decref(root);
@@ -307,6 +331,6 @@ int uat_store978data(char packet[4096]) {
 
 
 
-    return -1;
+    return send;
 
 }
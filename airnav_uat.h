@@ -15,6 +15,8 @@
 extern "C" {
 #endif
 
+    #define UAT_LINEBUF_SIZE 16384 // Longest dump978 JSON line accepted
+
     /****** Variables ******/
     extern pid_t p_978;
     extern char *dump978_cmd;
@@ -28,7 +30,7 @@ extern "C" {
     int uat_check978Running(void);
     void uat_start978(void);
     void uat_stop978(void);
-    int uat_store978data(char packet[4096]);
+    int uat_store978data(const char *packet);
     void *uat_airnav_ext978(void *arg);
     void uat_restart978();
 
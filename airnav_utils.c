@@ -7,6 +7,11 @@
  * 
  */
 #include "airnav_utils.h"
+#include <semaphore.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <sched.h>
 
 void airnav_log_file_m(const char* fname, const char* filename, const char* format, ...) {
     AN_NOTUSED(format);
@@ -62,103 +67,550 @@ void airnav_log_file_pure_m(const char* filename, const char* format, ...) {
 
 }
 
+/*
+ * Logging
+ *
+ * airnav_log() and airnav_log_level() format the message once into a slot
+ * of a lock-free ring (bounded MPMC queue: each slot carries a sequence
+ * number telling producers and the writer whose turn it is) and return.
+ * A single writer thread adds the timestamps and writes the lines to the
+ * console/syslog and to log_file, which it keeps open. SIGHUP makes the
+ * writer reopen log_file, for logrotate.
+ *
+ * Before airnav_logStart() and after airnav_logStop() lines are written
+ * synchronously, under m_log_output like the writer's. airnav_logStop()
+ * waits for producers that already saw log_running before the final
+ * drain, so no line is lost on the way out. When the ring is full lines
+ * are dropped and counted.
+ */
+
+#define LOG_RING_SLOTS 256 // Must be a power of two
+#define LOG_MSG_SIZE 1024
+#define LOG_FNAME_SIZE 48
+
+struct log_entry {
+    atomic_uint seq;
+    time_t when;
+    char fname[LOG_FNAME_SIZE]; // Empty for airnav_log()
+    char msg[LOG_MSG_SIZE];
+};
+
+static struct log_entry log_ring[LOG_RING_SLOTS];
+static atomic_uint log_tail; // Next slot for producers
+static unsigned log_head; // Next slot for the writer (writer only)
+static atomic_ulong log_dropped;
+static atomic_int log_running;
+static atomic_int log_producers; // airnav_logMessage() calls between checking log_running and publishing
+static volatile sig_atomic_t log_reopen;
+static sem_t log_sem;
+static pthread_t log_thread;
+static FILE *log_fp; // Under m_log_output
+static pthread_mutex_t m_log_output = PTHREAD_MUTEX_INITIALIZER; // airnav_logOutput() and its static buffers
+
+/*
+ * Write one line to its destinations. Caller holds m_log_output.
+ */
+static void airnav_logOutput(time_t when, const char *fname, const char *msg) {
+    static time_t last_when = -1;
+    static char timebuf[128];
+    static char timebuf2[128];
+
+    if (when != last_when) {
+        struct tm local;
+        localtime_r(&when, &local);
+        strftime(timebuf, 128, "\x1B[35m[\x1B[33m%F %T\x1B[35m]\x1B[0m", &local);
+        strftime(timebuf2, 128, "[%F %T]", &local);
+        timebuf[127] = 0;
+        timebuf2[127] = 0;
+        last_when = when;
+    }
+
+    if (fname[0] == 0) {
+        if (daemon_mode == 0) {
+            fprintf(stderr, "%s  %s", timebuf, msg);
+        } else {
+            syslog(LOG_NOTICE, "%s  %s", timebuf2, msg);
+        }
+    } else {
+        if (daemon_mode == 0) {
+            fprintf(stdout, "%s \x1B[35m[\x1B[31m%s\x1B[35m]\x1B[0m  %s", timebuf, fname, msg);
+        } else {
+            syslog(LOG_NOTICE, "%s [%s] %s", timebuf2, fname, msg);
+        }
+    }
+
+    if (log_file != NULL) {
+        if (log_fp == NULL) {
+            log_fp = fopen(log_file, "a");
+            if (log_fp == NULL) {
+                printf("Can't create log file %s\n", log_file);
+                return;
+            }
+        }
+        if (fname[0] == 0) {
+            fprintf(log_fp, "%s  %s", timebuf2, msg);
+        } else {
+            fprintf(log_fp, "%s [%s] %s", timebuf2, fname, msg);
+        }
+    }
+}
+
+/*
+ * Claim a free slot, or NULL if the ring is full
+ */
+static struct log_entry *airnav_logReserve(unsigned *ticket) {
+    unsigned pos = atomic_load_explicit(&log_tail, memory_order_relaxed);
+
+    for (;;) {
+        struct log_entry *e = &log_ring[pos & (LOG_RING_SLOTS - 1)];
+        unsigned seq = atomic_load_explicit(&e->seq, memory_order_acquire);
+        int diff = (int) (seq - pos);
+
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&log_tail, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)) {
+                *ticket = pos;
+                return e;
+            }
+        } else if (diff < 0) {
+            return NULL;
+        } else {
+            pos = atomic_load_explicit(&log_tail, memory_order_relaxed);
+        }
+    }
+}
+
+static void airnav_logMessage(const char *fname, const char *format, va_list ap) {
+    struct log_entry *e;
+    unsigned ticket;
+
+    atomic_fetch_add(&log_producers, 1);
+    if (!atomic_load(&log_running)) {
+        char msg[LOG_MSG_SIZE];
+        atomic_fetch_sub(&log_producers, 1);
+        vsnprintf(msg, LOG_MSG_SIZE, format, ap);
+        pthread_mutex_lock(&m_log_output);
+        airnav_logOutput(time(NULL), fname, msg);
+        if (log_fp != NULL) {
+            fflush(log_fp);
+        }
+        pthread_mutex_unlock(&m_log_output);
+        return;
+    }
+
+    e = airnav_logReserve(&ticket);
+    if (e == NULL) {
+        atomic_fetch_add(&log_dropped, 1);
+        atomic_fetch_sub(&log_producers, 1);
+        return;
+    }
+
+    e->when = time(NULL);
+    strncpy(e->fname, fname, LOG_FNAME_SIZE - 1);
+    e->fname[LOG_FNAME_SIZE - 1] = 0;
+    vsnprintf(e->msg, LOG_MSG_SIZE, format, ap);
+
+    atomic_store_explicit(&e->seq, ticket + 1, memory_order_release);
+    sem_post(&log_sem);
+    atomic_fetch_sub(&log_producers, 1);
+}
+
+/*
+ * Write out everything queued so far
+ */
+static void airnav_logDrain(void) {
+    unsigned long dropped;
+
+    pthread_mutex_lock(&m_log_output);
+
+    if (log_reopen) {
+        log_reopen = 0;
+        if (log_fp != NULL) {
+            fclose(log_fp);
+            log_fp = NULL; // Reopened on next line
+        }
+    }
+
+    for (;;) {
+        struct log_entry *e = &log_ring[log_head & (LOG_RING_SLOTS - 1)];
+
+        if (atomic_load_explicit(&e->seq, memory_order_acquire) != log_head + 1) {
+            break;
+        }
+        airnav_logOutput(e->when, e->fname, e->msg);
+        atomic_store_explicit(&e->seq, log_head + LOG_RING_SLOTS, memory_order_release);
+        log_head++;
+    }
+
+    dropped = atomic_exchange(&log_dropped, 0);
+    if (dropped > 0) {
+        char msg[128];
+        snprintf(msg, sizeof (msg), "Log buffer full, %lu lines dropped.\n", dropped);
+        airnav_logOutput(time(NULL), "", msg);
+    }
+
+    if (log_fp != NULL) {
+        fflush(log_fp);
+    }
+
+    pthread_mutex_unlock(&m_log_output);
+}
+
+static void *airnav_logWriter(void *arg) {
+    MODES_NOTUSED(arg);
+
+    while (atomic_load(&log_running)) {
+        while (sem_wait(&log_sem) < 0 && errno == EINTR)
+            ;
+
+        airnav_logDrain();
+    }
+
+    airnav_logDrain();
+    return NULL;
+}
+
+/*
+ * SIGHUP: reopen log file (after logrotate moved it)
+ */
+void airnav_logReopenHandler(int dummy) {
+    MODES_NOTUSED(dummy);
+    log_reopen = 1;
+    sem_post(&log_sem);
+}
+
+/*
+ * Start the background log writer
+ */
+void airnav_logStart(void) {
+    if (atomic_load(&log_running)) {
+        return;
+    }
+
+    for (unsigned i = 0; i < LOG_RING_SLOTS; i++) {
+        atomic_init(&log_ring[i].seq, i);
+    }
+    atomic_store(&log_tail, 0);
+    log_head = 0;
+    sem_init(&log_sem, 0, 0);
+
+    atomic_store(&log_running, 1);
+    if (pthread_create(&log_thread, NULL, airnav_logWriter, NULL) != 0) {
+        atomic_store(&log_running, 0);
+        airnav_log("Could not start log writer thread, logging synchronously.\n");
+        return;
+    }
+
+    signal(SIGHUP, airnav_logReopenHandler);
+    atexit(airnav_logStop);
+}
+
+/*
+ * Flush queued lines and go back to synchronous logging
+ */
+void airnav_logStop(void) {
+    if (!atomic_exchange(&log_running, 0)) {
+        return;
+    }
+
+    // Lines already being queued go out with the final drain; anything
+    // after this is written synchronously
+    while (atomic_load(&log_producers) > 0) {
+        sched_yield();
+    }
+
+    sem_post(&log_sem);
+    pthread_join(log_thread, NULL);
+}
+
 void airnav_log(const char* format, ...) {
+    va_list ap;
 
     if (disable_log == 1) {
         return;
     }
 
-    char timebuf[128];
-    char timebuf2[128];
-    char msg[1024];
-    char msg2[1024];
-    time_t now;
-    struct tm local;
-    va_list ap, ap2;
-    now = time(NULL);
-    localtime_r(&now, &local);
-    strftime(timebuf, 128, "\x1B[35m[\x1B[33m%F %T\x1B[35m]\x1B[0m", &local);
-    strftime(timebuf2, 128, "[%F %T]", &local);
-    timebuf[127] = 0;
-    timebuf2[127] = 0;
     va_start(ap, format);
-    va_start(ap2, format);
-    vsnprintf(msg, 1024, format, ap);
-    vsnprintf(msg2, 1024, format, ap2);
+    airnav_logMessage("", format, ap);
     va_end(ap);
-    va_end(ap2);
-    msg[1023] = 0;
-    msg2[1023] = 0;
-    if (daemon_mode == 0) {
-        fprintf(stderr, "%s  %s", timebuf, msg);
+}
+
+/*
+ * Use through the airnav_log_level() macro, which checks the level before
+ * any arguments are evaluated or anything is formatted.
+ */
+void airnav_log_level_m(const char* fname, const int level, const char* format, ...) {
+    va_list ap;
+
+    if (disable_log == 1 || debug_level < level) {
+        return;
+    }
+
+    va_start(ap, format);
+    airnav_logMessage(fname, format, ap);
+    va_end(ap);
+}
+
+/*
+ * Parsed ini files
+ *
+ * Each ini file is parsed once and the GKeyFile kept in memory; the
+ * ini_get* functions read from it under a read lock, without touching the
+ * disk. The directory of each cached file is watched with inotify (editors
+ * and ini_save* may replace the file rather than rewrite it) and the file
+ * is parsed again as soon as it changes; the new GKeyFile is swapped in
+ * under the write lock. Without inotify, the file's mtime is checked on
+ * each read instead.
+ */
+
+#define INI_CACHE_SIZE 8
+#define INI_WATCH_EVENTS (IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE | IN_MOVED_FROM)
+
+struct ini_cache_entry {
+    char *path;
+    const char *name; // Points into path, after the last '/'
+    int wd; // inotify watch on the directory, -1 if none
+    GKeyFile *kf; // NULL if not loaded (or failed to load)
+    struct timespec mtime; // Of the file that kf was parsed from
+};
+
+static struct ini_cache_entry ini_cache[INI_CACHE_SIZE];
+static pthread_rwlock_t ini_cache_lock = PTHREAD_RWLOCK_INITIALIZER;
+static pthread_mutex_t ini_watch_mutex = PTHREAD_MUTEX_INITIALIZER;
+static int ini_inotify_fd = -1;
+static int ini_watch_failed = 0;
+static void (*ini_reload_callback)(const char *ini_file);
+
+static struct ini_cache_entry *ini_findEntry(const char *ini_file) {
+    for (int i = 0; i < INI_CACHE_SIZE; i++) {
+        if (ini_cache[i].path != NULL && strcmp(ini_cache[i].path, ini_file) == 0) {
+            return &ini_cache[i];
+        }
+    }
+    return NULL;
+}
+
+static void ini_getMtime(const char *ini_file, struct timespec *mtime) {
+    struct stat st;
+
+    if (stat(ini_file, &st) == 0) {
+        *mtime = st.st_mtim;
     } else {
-        syslog(LOG_NOTICE, "%s  %s", timebuf2, msg);
+        mtime->tv_sec = 0;
+        mtime->tv_nsec = 0;
     }
+}
 
-    if (log_file != NULL) {
-        FILE * fp;
-        fp = fopen(log_file, "a");
-        if (fp == NULL) {
-            printf("Can't create log file %s\n", log_file);
-            return;
+static void ini_watchEntry(struct ini_cache_entry *e);
+
+/*
+ * Parse ini_file and swap the result into the cache
+ */
+static void ini_reload(const char *ini_file) {
+    GKeyFile *kf = g_key_file_new();
+    GKeyFile *old = NULL;
+    GError *error = NULL;
+    struct timespec mtime;
+    struct ini_cache_entry *e;
+
+    ini_getMtime(ini_file, &mtime);
+    if (g_key_file_load_from_file(kf, ini_file, G_KEY_FILE_KEEP_COMMENTS, &error) == FALSE) {
+        g_key_file_free(kf);
+        kf = NULL;
+        if (error != NULL) {
+            g_error_free(error);
         }
-        fprintf(fp, "%s  %s", timebuf2, msg2);
-        fclose(fp);
     }
 
+    pthread_rwlock_wrlock(&ini_cache_lock);
+    e = ini_findEntry(ini_file);
+    if (e == NULL) {
+        // New file; take a free slot or, failing that, the last one
+        e = &ini_cache[INI_CACHE_SIZE - 1];
+        for (int i = 0; i < INI_CACHE_SIZE; i++) {
+            if (ini_cache[i].path == NULL) {
+                e = &ini_cache[i];
+                break;
+            }
+        }
+        if (e->kf != NULL) {
+            g_key_file_free(e->kf);
+        }
+        free(e->path);
+        e->path = strdup(ini_file);
+        e->name = strrchr(e->path, '/') ? strrchr(e->path, '/') + 1 : e->path;
+        e->kf = NULL;
+        ini_watchEntry(e);
+    }
+    old = e->kf;
+    e->kf = kf;
+    e->mtime = mtime;
+    pthread_rwlock_unlock(&ini_cache_lock);
 
+    if (old != NULL) {
+        g_key_file_free(old);
+    }
 }
 
-void airnav_log_level_m(const char* fname, const int level, const char* format, ...) {
-    MODES_NOTUSED(level);
-    MODES_NOTUSED(format);
+/*
+ * Forget the parsed copy, e.g. after writing the file ourselves
+ */
+static void ini_invalidate(const char *ini_file) {
+    struct ini_cache_entry *e;
+    GKeyFile *old = NULL;
+
+    pthread_rwlock_wrlock(&ini_cache_lock);
+    e = ini_findEntry(ini_file);
+    if (e != NULL) {
+        old = e->kf;
+        e->kf = NULL;
+    }
+    pthread_rwlock_unlock(&ini_cache_lock);
 
-    if (disable_log == 1) {
-        return;
+    if (old != NULL) {
+        g_key_file_free(old);
     }
+}
 
-    if (debug_level >= level) {
-        char timebuf[128];
-        char timebuf2[128];
-        char msg[1024];
-        char msg2[1024];
-        time_t now;
-        struct tm local;
-        va_list ap, ap2;
-        now = time(NULL);
-        localtime_r(&now, &local);
-        strftime(timebuf, 128, "\x1B[35m[\x1B[33m%F %T\x1B[35m]\x1B[0m", &local);
-        strftime(timebuf2, 128, "[%F %T]", &local);
-        timebuf[127] = 0;
-        timebuf2[127] = 0;
-        va_start(ap, format);
-        va_start(ap2, format);
-        vsnprintf(msg, 1024, format, ap);
-        vsnprintf(msg2, 1024, format, ap2);
-        va_end(ap);
-        va_end(ap2);
-        msg[1023] = 0;
-        msg2[1023] = 0;
-        if (daemon_mode == 0) {
-            fprintf(stdout, "%s \x1B[35m[\x1B[31m%s\x1B[35m]\x1B[0m  %s", timebuf, fname, msg);
-        } else {
-            syslog(LOG_NOTICE, "%s [%s] %s", timebuf2, fname, msg);
+/*
+ * Get the parsed ini_file with the read lock held; release with
+ * ini_release(). Returns NULL (lock not held) if the file can't be loaded.
+ */
+static GKeyFile *ini_acquire(const char *ini_file) {
+    struct ini_cache_entry *e;
+
+    for (int attempt = 0; attempt < 2; attempt++) {
+        pthread_rwlock_rdlock(&ini_cache_lock);
+        e = ini_findEntry(ini_file);
+        if (e != NULL && e->kf != NULL) {
+            struct timespec mtime = e->mtime;
+
+            if (e->wd >= 0) {
+                return e->kf;
+            }
+
+            // Not watched, check whether it changed
+            ini_getMtime(ini_file, &mtime);
+            if (mtime.tv_sec == e->mtime.tv_sec && mtime.tv_nsec == e->mtime.tv_nsec) {
+                return e->kf;
+            }
         }
+        pthread_rwlock_unlock(&ini_cache_lock);
 
-        if (log_file != NULL) {
-            FILE * fp;
-            fp = fopen(log_file, "a");
-            if (fp == NULL) {
-                printf("Can't create log file %s\n", log_file);
-                return;
+        if (attempt == 0) {
+            ini_reload(ini_file);
+        }
+    }
+
+    return NULL;
+}
+
+static void ini_release(void) {
+    pthread_rwlock_unlock(&ini_cache_lock);
+}
+
+static void *ini_watchThread(void *arg) {
+    char buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    MODES_NOTUSED(arg);
+
+    while (!Modes.exit) {
+        struct pollfd pfd;
+        ssize_t len;
+
+        pfd.fd = ini_inotify_fd;
+        pfd.events = POLLIN;
+        if (poll(&pfd, 1, 1000) <= 0) {
+            continue;
+        }
+
+        len = read(ini_inotify_fd, buf, sizeof (buf));
+        if (len <= 0) {
+            continue;
+        }
+
+        for (char *p = buf; p < buf + len; ) {
+            const struct inotify_event *ev = (const struct inotify_event *) p;
+            char path[PATH_MAX] = {0};
+
+            p += sizeof (struct inotify_event) + ev->len;
+            if (ev->len == 0) {
+                continue;
+            }
+
+            pthread_rwlock_rdlock(&ini_cache_lock);
+            for (int i = 0; i < INI_CACHE_SIZE; i++) {
+                if (ini_cache[i].path != NULL && ini_cache[i].wd == ev->wd && strcmp(ini_cache[i].name, ev->name) == 0) {
+                    strncpy(path, ini_cache[i].path, sizeof (path) - 1);
+                    break;
+                }
+            }
+            pthread_rwlock_unlock(&ini_cache_lock);
+
+            if (path[0] != 0) {
+                airnav_log_level(3, "Configuration file %s changed, reloading.\n", path);
+                ini_reload(path);
+                if (ini_reload_callback != NULL) {
+                    ini_reload_callback(path);
+                }
             }
-            fprintf(fp, "%s [%s] %s", timebuf2, fname, msg2);
-            fclose(fp);
         }
+    }
+
+    return NULL;
+}
+
+/*
+ * Watch the directory e lives in. Called with the cache write lock held.
+ */
+static void ini_watchEntry(struct ini_cache_entry *e) {
+    char dir[PATH_MAX];
+
+    e->wd = -1;
 
+    pthread_mutex_lock(&ini_watch_mutex);
+    if (ini_inotify_fd < 0 && !ini_watch_failed) {
+        pthread_t thread;
+
+        ini_inotify_fd = inotify_init1(IN_CLOEXEC | IN_NONBLOCK);
+        if (ini_inotify_fd < 0 || pthread_create(&thread, NULL, ini_watchThread, NULL) != 0) {
+            if (ini_inotify_fd >= 0) {
+                close(ini_inotify_fd);
+                ini_inotify_fd = -1;
+            }
+            ini_watch_failed = 1;
+        } else {
+            pthread_detach(thread);
+        }
     }
+    pthread_mutex_unlock(&ini_watch_mutex);
 
+    if (ini_inotify_fd < 0) {
+        return;
+    }
 
+    if (e->name == e->path) {
+        strcpy(dir, ".");
+    } else {
+        size_t n = e->name - e->path - 1;
+        if (n == 0) {
+            n = 1; // file in /
+        }
+        if (n >= sizeof (dir)) {
+            return;
+        }
+        memcpy(dir, e->path, n);
+        dir[n] = 0;
+    }
+
+    // Adding the same directory twice returns the same watch descriptor
+    e->wd = inotify_add_watch(ini_inotify_fd, dir, INI_WATCH_EVENTS);
+}
+
+/*
+ * Function to call (from the watcher thread) after an ini file was
+ * changed on disk and reloaded
+ */
+void ini_setReloadCallback(void (*callback)(const char *ini_file)) {
+    ini_reload_callback = callback;
 }
 
 /*
@@ -168,19 +620,14 @@ void airnav_log_level_m(const char* fname, const int level, const char* format,
 void ini_getString(char **item, char *ini_file, char *section, char *key, char *def_value) {
     GKeyFile *localini;
     GError *error = NULL;
-    localini = g_key_file_new();
 
     if (*item != NULL) {
         free(*item);
+        *item = NULL;
     }
 
-    if (g_key_file_load_from_file(localini, ini_file, G_KEY_FILE_KEEP_COMMENTS, &error) == FALSE) {
+    if ((localini = ini_acquire(ini_file)) == NULL) {
         airnav_log("Error loading ini file (%s).\n", ini_file);
-        g_key_file_free(localini);
-
-        if (error != NULL) {
-            g_error_free(error);
-        }
 
         //*item =  def_value;
         if (def_value != NULL) {
@@ -193,7 +640,7 @@ void ini_getString(char **item, char *ini_file, char *section, char *key, char *
 
 
     *item = g_key_file_get_string(localini, section, key, &error);
-    g_key_file_free(localini);
+    ini_release();
 
     if (error != NULL) {
         g_error_free(error);
@@ -220,19 +667,13 @@ int ini_getInteger(char *ini_file, char *section, char *key, int def_value) {
     GError *error = NULL;
     int abc = 0;
 
-    localini = g_key_file_new();
-
-    if (g_key_file_load_from_file(localini, ini_file, G_KEY_FILE_KEEP_COMMENTS, &error) == FALSE) {
+    if ((localini = ini_acquire(ini_file)) == NULL) {
         airnav_log("Error loading ini file.\n");
-        g_key_file_free(localini);
-        if (error != NULL) {
-            g_error_free(error);
-        }
         return def_value;
     }
 
     abc = g_key_file_get_integer(localini, section, key, &error);
-    g_key_file_free(localini);
+    ini_release();
 
     if (error != NULL) {
         if (error->code == G_KEY_FILE_ERROR_KEY_NOT_FOUND || error->code == G_KEY_FILE_ERROR_INVALID_VALUE || error->code == G_KEY_FILE_ERROR_GROUP_NOT_FOUND) {
@@ -258,19 +699,13 @@ int ini_getBoolean(char *ini_file, char *section, char *key, int def_value) {
     GError *error = NULL;
     int abc = 0;
 
-    localini = g_key_file_new();
-
-    if (g_key_file_load_from_file(localini, ini_file, G_KEY_FILE_KEEP_COMMENTS, &error) == FALSE) {
+    if ((localini = ini_acquire(ini_file)) == NULL) {
         airnav_log("Error loading ini file.\n");
-        g_key_file_free(localini);
-        if (error != NULL) {
-            g_error_free(error);
-        }
         return def_value;
     }
 
     abc = g_key_file_get_boolean(localini, section, key, &error);
-    g_key_file_free(localini);
+    ini_release();
 
     if (error != NULL) {
         if (error->code == G_KEY_FILE_ERROR_KEY_NOT_FOUND || error->code == G_KEY_FILE_ERROR_INVALID_VALUE || error->code == G_KEY_FILE_ERROR_GROUP_NOT_FOUND) {
@@ -333,6 +768,7 @@ int ini_saveGeneric(char *ini_file, char *section, char *key, char *value) {
     }
     fprintf(inif, "%s", tmpdata);
     fclose(inif);
+    ini_invalidate(ini_file);
 
 
     g_key_file_free(localini);
@@ -391,6 +827,7 @@ int ini_saveDouble(char *ini_file, char *section, char *key, double value) {
     }
     fprintf(inif, "%s", tmpdata);
     fclose(inif);
+    ini_invalidate(ini_file);
 
 
     g_key_file_free(localini);
@@ -445,6 +882,7 @@ int ini_saveInteger(char *ini_file, char *section, char *key, int value) {
     }
     fprintf(inif, "%s", tmpdata);
     fclose(inif);
+    ini_invalidate(ini_file);
 
 
     g_key_file_free(localini);
@@ -466,19 +904,13 @@ double ini_getDouble(char *ini_file, char *section, char *key, double def_value)
     GError *error = NULL;
     double abc = 0;
 
-    localini = g_key_file_new();
-
-    if (g_key_file_load_from_file(localini, ini_file, G_KEY_FILE_KEEP_COMMENTS, &error) == FALSE) {
+    if ((localini = ini_acquire(ini_file)) == NULL) {
         airnav_log("Error loading ini file.\n");
-        g_key_file_free(localini);
-        if (error != NULL) {
-            g_error_free(error);
-        }
         return def_value;
     }
 
     abc = g_key_file_get_double(localini, section, key, &error);
-    g_key_file_free(localini);
+    ini_release();
 
     if (error != NULL) {
         if (error->code == G_KEY_FILE_ERROR_KEY_NOT_FOUND || error->code == G_KEY_FILE_ERROR_INVALID_VALUE || error->code == G_KEY_FILE_ERROR_GROUP_NOT_FOUND) {
@@ -746,32 +1178,17 @@ json_t *load_json(const char *text) {
  */
 int ini_hasSection(char *ini_file, char *section) {
     GKeyFile *localini;
-    GError *error = NULL;
-    localini = g_key_file_new();
+    int has;
 
-    if (g_key_file_load_from_file(localini, ini_file, G_KEY_FILE_KEEP_COMMENTS, &error) == FALSE) {
+    if ((localini = ini_acquire(ini_file)) == NULL) {
         airnav_log("Error loading ini file (%s).\n", ini_file);
-        g_key_file_free(localini);
-
-        if (error != NULL) {
-            g_error_free(error);
-        }
-
-        return 0;
-    }
-
-    if (g_key_file_has_group(localini, section)) {
-        g_key_file_free(localini);
-        return 1;
-    } else {
-        g_key_file_free(localini);
         return 0;
     }
 
-    g_key_file_free(localini);
-
+    has = g_key_file_has_group(localini, section) ? 1 : 0;
+    ini_release();
 
-    return 0;
+    return has;
 }
 
 long fseek_filesize(const char *filename) {
@@ -16,7 +16,10 @@
 #include <glib.h>
 #include <spawn.h>
 
-#define airnav_log_level(...) airnav_log_level_m( __FUNCTION__ , __VA_ARGS__)
+#define airnav_log_level(level, ...) do { \
+        if (disable_log != 1 && debug_level >= (level)) \
+            airnav_log_level_m( __FUNCTION__ , (level), __VA_ARGS__); \
+    } while (0)
 #define airnav_log_file(...) airnav_log_file_m( __FUNCTION__ , __VA_ARGS__)
 #define airnav_log_file_pure(...) airnav_log_file_pure_m( __VA_ARGS__)
 
@@ -31,6 +34,9 @@ extern "C" {
     void airnav_log_file_pure_m(const char* filename, const char* format, ...);
     void airnav_log(const char* format, ...);
     void airnav_log_level_m(const char* fname, const int level, const char* format, ...);
+    void airnav_logStart(void);
+    void airnav_logStop(void);
+    void airnav_logReopenHandler(int dummy);
     void ini_getString(char **item, char *ini_file, char *section, char *key, char *def_value);
     int ini_getInteger(char *ini_file, char *section, char *key, int def_value);
     int ini_getBoolean(char *ini_file, char *section, char *key, int def_value);
@@ -49,6 +55,7 @@ extern "C" {
     char *airnav_concat(char* ori, const char* format, ...);
     json_t *load_json(const char *text);
     int ini_hasSection(char *ini_file, char *section);
+    void ini_setReloadCallback(void (*callback)(const char *ini_file));
     long fseek_filesize(const char *filename);
     void removePidFile(void);
     void createPidFile(void);
@@ -0,0 +1,546 @@
+/*
+ * Copyright (c) 2020 - AirNav Systems
+ *
+ * https://www.radarbox.com
+ *
+ * More info: https://github.com/AirNav-Systems/rbfeeder
+ *
+ */
+
+// cat21tests.c - round-trip tests for the ASTERIX CAT021 encoder
+// (airnav_cat21.c)
+//
+// Random target reports, each with a random subset of the items, are
+// packed into datagrams the way the feeder does it, and every datagram is
+// taken apart by a decoder written from the CAT021 edition 2.4 UAP below
+// (not from the encoder's compiled tables). Each decoded item must give
+// back the value that was set, within the resolution of the item, and
+// the datagrams must stay under the size limit. A known record is also
+// checked byte for byte.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "airnav_cat21.h"
+
+#define TARGETS 20000
+#define DATAGRAM 1400
+
+static int failures = 0;
+
+#define CHECK(cond, ...) do {                             \
+        if (!(cond)) {                                   \
+            fprintf(stderr, "FAIL: " __VA_ARGS__);       \
+            fprintf(stderr, "\n");                       \
+            ++failures;                                  \
+        }                                                \
+    } while (0)
+
+// CAT021 edition 2.4 UAP, as in the spec file; lengths of variable items
+// given as 1, the way atoi() reads "1+"
+static const struct {
+    unsigned frn;
+    const char *id;
+    unsigned length;
+} uap_24[] = {
+    {1, "I021/010", 2}, {2, "I021/040", 1}, {3, "I021/161", 2}, {4, "I021/015", 1},
+    {5, "I021/071", 3}, {6, "I021/130", 6}, {7, "I021/131", 8},
+    {8, "I021/072", 3}, {9, "I021/150", 2}, {10, "I021/151", 2}, {11, "I021/080", 3},
+    {12, "I021/073", 3}, {13, "I021/074", 4}, {14, "I021/075", 3},
+    {15, "I021/076", 4}, {16, "I021/140", 2}, {17, "I021/090", 1}, {18, "I021/210", 1},
+    {19, "I021/070", 2}, {20, "I021/230", 2}, {21, "I021/145", 2},
+    {22, "I021/152", 2}, {23, "I021/200", 1}, {24, "I021/155", 2}, {25, "I021/157", 2},
+    {26, "I021/160", 4}, {27, "I021/165", 2}, {28, "I021/077", 3},
+    {29, "I021/170", 6}, {30, "I021/020", 1}, {31, "I021/220", 1}, {32, "I021/146", 2},
+    {33, "I021/148", 2}, {34, "I021/110", 1}, {35, "I021/016", 1},
+    {36, "I021/008", 1}, {37, "I021/271", 1}, {38, "I021/132", 1}, {39, "I021/250", 1},
+    {40, "I021/260", 7}, {41, "I021/400", 1}, {42, "I021/295", 1},
+};
+
+#define UAP_24_COUNT (sizeof (uap_24) / sizeof (uap_24[0]))
+
+// What was set on one target; an item is in the record if its bit is set
+struct target {
+    uint64_t items; // Bit per enum cat21_item
+    unsigned sac, sic, sid;
+    unsigned char address[3];
+    char callsign[9];
+    double lat, lon;
+    int flevel;
+    short height;
+    float heading;
+    short tas;
+    unsigned time_pos, time_vel, time_report;
+    unsigned time_hp;
+    char fsi;
+    short track;
+    unsigned char mode3a[2];
+    char emitter, amplitude, receiver, service;
+    char status[5]; // icf, lnav, me, ps, ss
+    char mops[3]; // vns, vn, ltt
+    char oper[7]; // ra, tc, ts, arv, cdtia, ntcas, sa
+    short sel_alt;
+    char sel_alt_flags[2]; // sas, source
+    short fss_alt;
+    char fss_flags[3]; // mv, ah, am
+    unsigned re;
+    short air_speed, baro_rate, geo_rate;
+    short gspeed, track_angle;
+    float roll, track_rate;
+};
+
+// I021/nnn of each enum cat21_item
+static const int item_numbers[CAT21_ITEM_COUNT] = {
+    8, 10, 15, 16, 20, 70, 71, 72, 73, 74, 75, 76, 77, 80, 130, 131, 132,
+    140, 145, 146, 148, 150, 151, 152, 155, 157, 160, 161, 165, 170, 200,
+    210, 230, 400
+};
+
+#define HAS(t, item) ((t)->items & ((uint64_t) 1 << (item)))
+
+static void random_target(struct target *t) {
+    static const char chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 ";
+
+    memset(t, 0, sizeof (*t));
+
+    // What the feeder always sends, then each other item half the time
+    t->items = (uint64_t) 1 << CAT21_I010 | (uint64_t) 1 << CAT21_I080;
+    for (int i = 0; i < CAT21_ITEM_COUNT; i++) {
+        if (rand() % 2) {
+            t->items |= (uint64_t) 1 << i;
+        }
+    }
+
+    t->sac = 1 + rand() % 255;
+    t->sic = 1 + rand() % 255;
+    t->sid = 1 + rand() % 255;
+    for (int i = 0; i < 3; i++) {
+        t->address[i] = rand();
+    }
+    for (int i = 0; i < 8; i++) {
+        t->callsign[i] = chars[rand() % (sizeof (chars) - 1)];
+    }
+    t->lat = (rand() % 1800000) / 10000.0 - 90;
+    t->lon = (rand() % 3600000) / 10000.0 - 180;
+    t->flevel = 1 + rand() % 500;
+    t->height = rand() % 500;
+    t->heading = (rand() % 3600) / 10.0f;
+    t->tas = rand() % 1000;
+    t->time_pos = rand() % 86400;
+    t->time_vel = rand() % 86400;
+    t->time_report = rand() % 86400;
+    t->time_hp = rand() % 1000000000;
+    t->fsi = rand() % 4;
+    t->track = rand() % 4096;
+    t->mode3a[0] = rand() & 0x0f;
+    t->mode3a[1] = rand();
+    t->emitter = rand() % 25;
+    t->amplitude = rand();
+    t->receiver = rand();
+    t->service = rand();
+    t->status[0] = rand() % 2;
+    t->status[1] = rand() % 2;
+    t->status[2] = rand() % 2;
+    t->status[3] = rand() % 8;
+    t->status[4] = rand() % 4;
+    t->mops[0] = rand() % 2;
+    t->mops[1] = rand() % 8;
+    t->mops[2] = rand() % 8;
+    for (int i = 0; i < 7; i++) {
+        t->oper[i] = rand() % (i == 1 ? 4 : 2);
+    }
+    t->sel_alt = rand() % 32000;
+    t->sel_alt_flags[0] = rand() % 2;
+    t->sel_alt_flags[1] = rand() % 4;
+    t->fss_alt = rand() % 32000;
+    t->fss_flags[0] = rand() % 2;
+    t->fss_flags[1] = rand() % 2;
+    t->fss_flags[2] = rand() % 2;
+    t->re = rand() % 2;
+    // The top bit of these is IM/RE, so only non-negative values go through
+    t->air_speed = rand() % 0x8000;
+    t->baro_rate = rand() % 0x8000;
+    t->geo_rate = rand() % 0x8000;
+    t->gspeed = rand() % 7000;
+    t->track_angle = rand() % 360;
+    t->roll = (rand() % 18000 - 9000) / 100.0f;
+    t->track_rate = (rand() % 2000 - 1000) / 32.0f;
+}
+
+static void fill_record(struct cat21_record *rec, const struct target *t) {
+    if (HAS(t, CAT21_I008)) cat021_setAircraftOperStatus(rec, t->oper[0], t->oper[1], t->oper[2], t->oper[3], t->oper[4], t->oper[5], t->oper[6]);
+    if (HAS(t, CAT21_I010)) cat021_setDataSourceSACSIC(rec, t->sac, t->sic);
+    if (HAS(t, CAT21_I015)) cat021_setServiceId(rec, t->sid);
+    if (HAS(t, CAT21_I016)) cat021_setServiveManagement(rec, t->service);
+    if (HAS(t, CAT21_I020)) cat021_setEmitterCat(rec, t->emitter);
+    if (HAS(t, CAT21_I070)) cat021_setMode3A(rec, t->mode3a);
+    if (HAS(t, CAT21_I071)) cat021_setTimeAplicabilityPosition(rec, t->time_pos);
+    if (HAS(t, CAT21_I072)) cat021_setTimeAplicabilityVelocity(rec, t->time_vel);
+    if (HAS(t, CAT21_I073)) cat021_setTimeMsgRcptPos(rec, t->time_pos);
+    if (HAS(t, CAT21_I074)) cat021_setTimeMsgRcptPosPrecision(rec, t->fsi, t->time_hp);
+    if (HAS(t, CAT21_I075)) cat021_setTimeMsgRcptVel(rec, t->time_vel);
+    if (HAS(t, CAT21_I076)) cat021_setTimeMsgRcptVelPrecision(rec, t->fsi, t->time_hp);
+    if (HAS(t, CAT21_I077)) cat021_setTimeASTERIXReport(rec, t->time_report);
+    if (HAS(t, CAT21_I080)) cat021_setTargetAddress(rec, t->address);
+    if (HAS(t, CAT21_I130)) cat021_setPosWGS84(rec, t->lat, t->lon);
+    if (HAS(t, CAT21_I131)) cat021_setPosWGS84Precision(rec, t->lat, t->lon);
+    if (HAS(t, CAT21_I132)) cat021_setMessageAmplitude(rec, t->amplitude);
+    if (HAS(t, CAT21_I140)) cat021_setGeometricHeight(rec, t->height);
+    if (HAS(t, CAT21_I145)) cat021_setFlightLevel(rec, t->flevel);
+    if (HAS(t, CAT21_I146)) cat021_setSelectedAltitude(rec, t->sel_alt_flags[0], t->sel_alt_flags[1], t->sel_alt);
+    if (HAS(t, CAT21_I148)) cat021_setFinalStateSelectedAltitude(rec, t->fss_flags[0], t->fss_flags[1], t->fss_flags[2], t->fss_alt);
+    if (HAS(t, CAT21_I150)) cat021_setAirSpeed(rec, t->re, t->air_speed);
+    if (HAS(t, CAT21_I151)) cat021_setTrueAirSpeed(rec, t->re, t->tas);
+    if (HAS(t, CAT21_I152)) cat021_setMagneticHeading(rec, t->heading);
+    if (HAS(t, CAT21_I155)) cat021_setBaroVertRate(rec, t->re, t->baro_rate);
+    if (HAS(t, CAT21_I157)) cat021_setGeoVertRate(rec, t->re, t->geo_rate);
+    if (HAS(t, CAT21_I160)) cat021_setAirborneVector(rec, t->re, t->gspeed, t->track_angle);
+    if (HAS(t, CAT21_I161)) cat021_setTrackNumber(rec, t->track);
+    if (HAS(t, CAT21_I165)) cat021_setTrackAngleRate(rec, t->track_rate);
+    if (HAS(t, CAT21_I170)) cat021_setTargetId(rec, t->callsign);
+    if (HAS(t, CAT21_I200)) cat021_setTargetStatus(rec, t->status[0], t->status[1], t->status[2], t->status[3], t->status[4]);
+    if (HAS(t, CAT21_I210)) cat021_setMOPSVersion(rec, t->mops[0], t->mops[1], t->mops[2]);
+    if (HAS(t, CAT21_I230)) cat021_setRollAngle(rec, t->roll);
+    if (HAS(t, CAT21_I400)) cat021_setReceiverID(rec, t->receiver);
+}
+
+/*
+ * Decoder
+ */
+
+static unsigned get16(const uint8_t *p) {
+    return p[0] << 8 | p[1];
+}
+
+static unsigned get24(const uint8_t *p) {
+    return p[0] << 16 | p[1] << 8 | p[2];
+}
+
+static uint32_t get32(const uint8_t *p) {
+    return (uint32_t) p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+}
+
+static int sext(unsigned v, unsigned bits) {
+    return (int) (v << (32 - bits)) >> (32 - bits);
+}
+
+static const char *uap_id(unsigned frn, unsigned *length) {
+    for (unsigned i = 0; i < UAP_24_COUNT; i++) {
+        if (uap_24[i].frn == frn) {
+            *length = uap_24[i].length;
+            return uap_24[i].id;
+        }
+    }
+    return NULL;
+}
+
+static int near(double a, double b, double tolerance) {
+    return fabs(a - b) <= tolerance;
+}
+
+// Check one decoded item against what was set on the target
+static void check_item(unsigned n, const char *id, const uint8_t *d, const struct target *t) {
+    int item = atoi(id + 5);
+
+#define ITEM(cond) CHECK(cond, "target %u: %s decodes wrong", n, id)
+    switch (item) {
+        case 8:
+            ITEM(d[0] == (t->oper[0] << 7 | t->oper[1] << 5 | t->oper[2] << 4 | t->oper[3] << 3 | t->oper[4] << 2 | t->oper[5] << 1 | t->oper[6]));
+            break;
+        case 10:
+            ITEM(d[0] == t->sac && d[1] == t->sic);
+            break;
+        case 15:
+            ITEM(d[0] == t->sid);
+            break;
+        case 16:
+            ITEM(d[0] == (uint8_t) t->service);
+            break;
+        case 20:
+            ITEM(d[0] == t->emitter);
+            break;
+        case 70:
+            ITEM(d[0] == t->mode3a[0] && d[1] == t->mode3a[1]);
+            break;
+        case 71:
+        case 73:
+            ITEM(get24(d) == t->time_pos * 128);
+            break;
+        case 72:
+        case 75:
+            ITEM(get24(d) == t->time_vel * 128);
+            break;
+        case 77:
+            ITEM(get24(d) == t->time_report * 128);
+            break;
+        case 74:
+        case 76:
+            // 2^-30 s units, within float precision
+            ITEM(d[0] >> 6 == t->fsi && near((get32(d) & 0x3fffffff) * 0.9313, t->time_hp, 200));
+            break;
+        case 80:
+            ITEM(!memcmp(d, t->address, 3));
+            break;
+        case 130:
+            ITEM(near(sext(get24(d), 24) * (180.0 / (1 << 23)), t->lat, 2 * 180.0 / (1 << 23)) &&
+                 near(sext(get24(d + 3), 24) * (180.0 / (1 << 23)), t->lon, 2 * 180.0 / (1 << 23)));
+            break;
+        case 131:
+            ITEM(near((int32_t) get32(d) * (180.0 / (1 << 30)), t->lat, 2 * 180.0 / (1 << 30)) &&
+                 near((int32_t) get32(d + 4) * (180.0 / (1 << 30)), t->lon, 2 * 180.0 / (1 << 30)));
+            break;
+        case 132:
+            ITEM(d[0] == (uint8_t) t->amplitude);
+            break;
+        case 140:
+            ITEM(near(sext(get16(d), 16) * 6.25, t->height, 6.25));
+            break;
+        case 145:
+            ITEM(sext(get16(d), 16) == t->flevel * 4);
+            break;
+        case 146:
+            ITEM(d[0] >> 7 == t->sel_alt_flags[0] && (d[0] >> 5 & 3) == t->sel_alt_flags[1] && near((get16(d) & 0x1fff) * 25, t->sel_alt, 25));
+            break;
+        case 148:
+            ITEM(d[0] >> 5 == (t->fss_flags[0] << 2 | t->fss_flags[1] << 1 | t->fss_flags[2]) && near((get16(d) & 0x1fff) * 25, t->fss_alt, 25));
+            break;
+        case 150:
+            ITEM(get16(d) == (t->re << 15 | t->air_speed));
+            break;
+        case 151:
+            ITEM(get16(d) == (t->re << 15 | t->tas));
+            break;
+        case 152:
+            ITEM(near(get16(d) * (360.0 / 65536), t->heading, 2 * 360.0 / 65536));
+            break;
+        case 155:
+            ITEM(get16(d) == (t->re << 15 | t->baro_rate));
+            break;
+        case 157:
+            ITEM(get16(d) == (t->re << 15 | t->geo_rate));
+            break;
+        case 160:
+            ITEM(d[0] >> 7 == t->re && near((get16(d) & 0x7fff) * 0.22, t->gspeed, 0.22) &&
+                 near(get16(d + 2) * (360.0 / 65536), t->track_angle, 360.0 / 65536));
+            break;
+        case 161:
+            ITEM(get16(d) == (unsigned) t->track);
+            break;
+        case 165:
+            ITEM(near(sext(get16(d), 16) / 32.0, t->track_rate, 1 / 32.0));
+            break;
+        case 170:
+        {
+            // Six bits per character, IA-5
+            uint64_t bits = (uint64_t) get16(d) << 32 | get32(d + 2);
+            char callsign[9] = {0};
+            for (int i = 0; i < 8; i++) {
+                unsigned c = bits >> (42 - 6 * i) & 0x3f;
+                callsign[i] = (char) (c >= 1 && c <= 26 ? 'A' + c - 1 : c);
+            }
+            ITEM(!strcmp(callsign, t->callsign));
+            break;
+        }
+        case 200:
+            ITEM(d[0] == (t->status[0] << 7 | t->status[1] << 6 | t->status[2] << 5 | t->status[3] << 2 | t->status[4]));
+            break;
+        case 210:
+            ITEM(d[0] == (t->mops[0] << 6 | t->mops[1] << 3 | t->mops[2]));
+            break;
+        case 230:
+            ITEM(near(sext(get16(d), 16) / 100.0, t->roll, 0.0101));
+            break;
+        case 400:
+            ITEM(d[0] == (uint8_t) t->receiver);
+            break;
+        default:
+            CHECK(0, "target %u: unexpected item %s", n, id);
+            break;
+    }
+#undef ITEM
+}
+
+// Decode one data block; targets[first..] are the records it must hold
+static unsigned decode_block(const uint8_t *buf, size_t len, const struct target *targets, unsigned first) {
+    unsigned n = first;
+
+    CHECK(len >= CAT21_BLOCK_HEADER_SIZE && buf[0] == CAT21_CATEGORY && get16(buf + 1) == len,
+          "block at target %u: bad header", first);
+
+    size_t pos = CAT21_BLOCK_HEADER_SIZE;
+    while (pos < len) {
+        const struct target *t = &targets[n];
+        uint8_t fspec[CAT21_MAX_FSPEC_BYTES];
+        unsigned fspec_len = 0;
+        uint64_t seen = 0;
+
+        do {
+            if (fspec_len == CAT21_MAX_FSPEC_BYTES || pos >= len) {
+                CHECK(0, "target %u: FSPEC runs off", n);
+                return n;
+            }
+            fspec[fspec_len++] = buf[pos++];
+        } while (fspec[fspec_len - 1] & 1);
+        CHECK(fspec[fspec_len - 1] != 0, "target %u: FSPEC ends with an empty byte", n);
+
+        for (unsigned frn = 1; frn <= fspec_len * 7; frn++) {
+            if (!(fspec[(frn - 1) / 7] & (0x80 >> ((frn - 1) % 7)))) {
+                continue;
+            }
+
+            unsigned length;
+            const char *id = uap_id(frn, &length);
+            if (id == NULL || pos + length > len) {
+                CHECK(0, "target %u: FRN %u unknown or truncated", n, frn);
+                return n;
+            }
+            check_item(n, id, buf + pos, t);
+            pos += length;
+
+            for (int i = 0; i < CAT21_ITEM_COUNT; i++) {
+                if (item_numbers[i] == atoi(id + 5)) {
+                    seen |= (uint64_t) 1 << i;
+                }
+            }
+        }
+
+        CHECK(seen == t->items, "target %u: items %llx decoded, %llx set", n, (unsigned long long) seen, (unsigned long long) t->items);
+        n++;
+    }
+
+    return n;
+}
+
+static void build_uap(struct cat21_uap *uap, const char *skip) {
+    cat21_uapReset(uap);
+    for (unsigned i = 0; i < UAP_24_COUNT; i++) {
+        if (skip && !strcmp(uap_24[i].id, skip)) {
+            continue;
+        }
+        int known = 0;
+        for (int k = 0; k < CAT21_ITEM_COUNT; k++) {
+            known |= item_numbers[k] == atoi(uap_24[i].id + 5);
+        }
+        int ret = cat21_uapAddItem(uap, uap_24[i].id, uap_24[i].frn, uap_24[i].length);
+        CHECK(ret == known, "uap: %s added with %d, expected %d", uap_24[i].id, ret, known);
+    }
+    cat21_uapCompile(uap);
+}
+
+// Spec entries the encoder cannot honour are refused
+static void test_uap(void) {
+    struct cat21_uap uap;
+    int before = failures;
+
+    cat21_uapReset(&uap);
+    CHECK(cat21_uapAddItem(&uap, "I021/080", 11, 4) == -1, "uap: wrong length accepted");
+    CHECK(cat21_uapAddItem(&uap, "I021/080", 0, 3) == -1, "uap: FRN 0 accepted");
+    CHECK(cat21_uapAddItem(&uap, "I021/080", CAT21_MAX_FRN + 1, 3) == -1, "uap: FRN past FSPEC accepted");
+    CHECK(cat21_uapAddItem(&uap, "I021/080", 11, 3) == 1, "uap: I021/080 refused");
+
+    if (failures == before)
+        fprintf(stderr, "uap:  PASS\n");
+}
+
+// A record as the feeder sends it, byte for byte; an item the spec does
+// not have is left out
+static void test_known_record(void) {
+    static const uint8_t expected[] = {
+        21, 0x00, 0x13, // CAT, LEN
+        0x81, 0x11, 0x01, 0x01, 0x80, // FSPEC: FRN 1, 11, 29
+        0x01, 0x02, // I021/010
+        0xab, 0xcd, 0xef, // I021/080
+        0x50, 0x54, 0xd4, 0xc7, 0x2c, 0xf4 // I021/170 "TEST1234"
+    };
+    static const unsigned char address[3] = {0xab, 0xcd, 0xef};
+    struct cat21_uap uap;
+    struct cat21_record rec;
+    struct cat21_block blk;
+    int before = failures;
+
+    build_uap(&uap, "I021/145");
+    cat21_blockInit(&blk, DATAGRAM);
+
+    cat21_recordInit(&rec, &uap);
+    CHECK(cat021_setTargetId(&rec, "TEST1234") == 1, "known record: I021/170 not set");
+    CHECK(cat021_setDataSourceSACSIC(&rec, 1, 2) == 1, "known record: I021/010 not set");
+    CHECK(cat021_setFlightLevel(&rec, 350) == -1, "known record: I021/145 set without being in the spec");
+    CHECK(cat021_setTargetAddress(&rec, address) == 1, "known record: I021/080 not set");
+    CHECK(cat021_setDataSourceSACSIC(&rec, 0, 2) == -1, "known record: SAC 0 accepted");
+
+    cat21_blockAdd(&blk, &rec);
+    size_t len = cat21_blockFinish(&blk);
+    CHECK(len == sizeof (expected) && !memcmp(blk.buf, expected, len), "known record: wrong bytes");
+
+    if (failures == before)
+        fprintf(stderr, "known record:  PASS\n");
+    cat21_blockDestroy(&blk);
+}
+
+// Random records packed into datagrams of at most size bytes
+static void test_roundtrip(const char *name, size_t size) {
+    struct cat21_uap uap;
+    struct cat21_record rec;
+    struct cat21_block blk;
+    struct target *targets = malloc(TARGETS * sizeof (*targets));
+    unsigned decoded = 0, datagrams = 0, alone = 0;
+    int before = failures;
+
+    build_uap(&uap, NULL);
+    if (targets == NULL || !cat21_blockInit(&blk, size)) {
+        CHECK(0, "%s: setup failed", name);
+        free(targets);
+        return;
+    }
+
+    for (unsigned n = 0; n <= TARGETS; n++) {
+        if (n < TARGETS) {
+            random_target(&targets[n]);
+            cat21_recordInit(&rec, &uap);
+            fill_record(&rec, &targets[n]);
+            if (cat21_blockAdd(&blk, &rec)) {
+                continue;
+            }
+        }
+
+        // Datagram full (or the end): take it apart
+        size_t len = cat21_blockFinish(&blk);
+        CHECK(len <= size || blk.records == 1, "%s: %zu byte datagram with %u records", name, len, blk.records);
+        alone += blk.records == 1;
+        unsigned first = decoded;
+        decoded = decode_block(blk.buf, len, targets, decoded);
+        CHECK(decoded - first == blk.records, "%s: %u records decoded, %u sent", name, decoded - first, blk.records);
+        datagrams++;
+
+        cat21_blockReset(&blk);
+        if (n < TARGETS) {
+            CHECK(cat21_blockAdd(&blk, &rec), "%s: record refused by an empty block", name);
+        }
+        if (failures - before > 20) {
+            break;
+        }
+    }
+
+    CHECK(decoded == TARGETS, "%s: %u of %u records decoded", name, decoded, TARGETS);
+    if (failures == before)
+        fprintf(stderr, "%s:  PASS (%u records in %u datagrams, %u alone)\n", name, decoded, datagrams, alone);
+
+    cat21_blockDestroy(&blk);
+    free(targets);
+}
+
+int main(int argc, char **argv) {
+    (void) argc;
+    (void) argv;
+
+    srand(1);
+
+    test_uap();
+    test_known_record();
+    test_roundtrip("round trip", DATAGRAM);
+    test_roundtrip("one record per datagram", 1);
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,127 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// checksumtests.c - tests for the Mode S CRC implementations
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Every modes_checksum_u8 implementation this CPU can run is checked
+// against a bit-at-a-time reference, on known-good messages, on random
+// 56-bit and 112-bit messages, and on every other length from 3 to 14 bytes.
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dsp/generated/starch.h"
+
+#define RANDOM_MESSAGES 100000
+
+// Known-good messages; all have syndrome 0
+static const char *knownMessages[] = {
+    "8D4840D6202CC371C32CE0576098", // DF17 identification, KLM1023
+    "8D40621D58C382D690C8AC2863A7", // DF17 airborne position
+    "8D485020994409940838175B284F", // DF17 airborne velocity
+    NULL
+};
+
+static uint32_t referenceChecksum(const uint8_t *msg, unsigned len)
+{
+    uint32_t rem = 0;
+    for (unsigned i = 0; i < (len - 3) * 8; ++i) {
+        unsigned bit = (msg[i / 8] >> (7 - (i % 8))) & 1;
+        unsigned top = (rem >> 23) & 1;
+        rem = (rem << 1) & 0xffffff;
+        if (bit ^ top)
+            rem ^= 0xfff409;
+    }
+
+    return rem ^ (msg[len - 3] << 16) ^ (msg[len - 2] << 8) ^ msg[len - 1];
+}
+
+static unsigned parseHex(const char *hex, uint8_t *out)
+{
+    unsigned len = strlen(hex) / 2;
+    for (unsigned i = 0; i < len; ++i) {
+        unsigned byte;
+        sscanf(hex + 2 * i, "%2x", &byte);
+        out[i] = byte;
+    }
+    return len;
+}
+
+static bool testImplementation(starch_modes_checksum_u8_regentry *entry)
+{
+    uint8_t msg[14];
+    uint32_t syndrome;
+    unsigned failures = 0;
+
+    for (const char **hex = knownMessages; *hex; ++hex) {
+        unsigned len = parseHex(*hex, msg);
+        entry->callable(msg, len, &syndrome);
+        if (syndrome != 0) {
+            fprintf(stderr, "%s:  FAIL: %s gives syndrome %06X (expected 000000)\n", entry->name, *hex, syndrome);
+            ++failures;
+        }
+    }
+
+    srand(1);
+    for (unsigned i = 0; i < RANDOM_MESSAGES; ++i) {
+        unsigned len = (i & 1) ? 14 : 7;
+        for (unsigned j = 0; j < len; ++j)
+            msg[j] = rand() % 256;
+
+        uint32_t expected = referenceChecksum(msg, len);
+        entry->callable(msg, len, &syndrome);
+        if (syndrome != expected) {
+            if (failures < 10)
+                fprintf(stderr, "%s:  FAIL: %u-bit message %u gives syndrome %06X (expected %06X)\n", entry->name, len * 8, i, syndrome, expected);
+            ++failures;
+        }
+    }
+
+    // other lengths take the fallback paths
+    for (unsigned len = 3; len <= 14; ++len) {
+        for (unsigned j = 0; j < len; ++j)
+            msg[j] = rand() % 256;
+
+        uint32_t expected = referenceChecksum(msg, len);
+        entry->callable(msg, len, &syndrome);
+        if (syndrome != expected) {
+            fprintf(stderr, "%s:  FAIL: %u-byte message gives syndrome %06X (expected %06X)\n", entry->name, len, syndrome, expected);
+            ++failures;
+        }
+    }
+
+    if (failures)
+        return false;
+
+    fprintf(stderr, "%s:  PASS\n", entry->name);
+    return true;
+}
+
+int main(int __attribute__ ((unused)) argc, char __attribute__ ((unused)) **argv)
+{
+    int ok = 1;
+
+    for (starch_modes_checksum_u8_regentry *entry = starch_modes_checksum_u8_registry; entry->name; ++entry) {
+        if (entry->flavor_supported && !entry->flavor_supported()) {
+            fprintf(stderr, "%s:  skipped (unsupported on this CPU)\n", entry->name);
+            continue;
+        }
+        ok = testImplementation(entry) && ok;
+    }
+
+    return ok ? 0 : 1;
+}
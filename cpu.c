@@ -46,6 +46,15 @@ int cpu_supports_avx2(void)
 #endif
 }
 
+int cpu_supports_avx2_pclmul(void)
+{
+#ifdef CPU_FEATURES_ARCH_X86
+    return x86_info()->features.avx2 && x86_info()->features.pclmulqdq;
+#else
+    return 0;
+#endif
+}
+
 //
 // ARM
 //
@@ -4,6 +4,7 @@
 // x86
 int cpu_supports_avx(void);
 int cpu_supports_avx2(void);
+int cpu_supports_avx2_pclmul(void);
 
 // ARM
 int cpu_supports_armv7_neon_vfpv4(void);
@@ -27,9 +27,62 @@ static struct errorinfo NO_ERRORS;
 // Generator polynomial for the Mode S CRC:
 #define MODES_GENERATOR_POLY 0xfff409U
 
-// CRC values for all single-byte messages;
-// used to speed up CRC calculation.
-static uint32_t crc_table[256];
+// The table-driven, slicing and carry-less multiply versions live in
+// dsp/impl/modes_checksum_u8.c; starch picks one for this CPU.
+uint32_t modesChecksum(const uint8_t *message, int bits)
+{
+    uint32_t rem;
+    int n = bits/8;
+
+    assert(bits % 8 == 0);
+    assert(n >= 3);
+
+    starch_modes_checksum_u8(message, n, &rem);
+    return rem;
+}
+
+// Correctable syndromes are found with a perfect hash generated ahead of
+// time by "crctests --generate" (see the crcgen make target): the hash of
+// a syndrome picks a bucket and a candidate slot, the bucket's displacement
+// is XORed into the slot, and no two correctable syndromes share a slot.
+// A syndrome is correctable iff its slot holds that syndrome.
+
+#define SYNDROME_HASH_BUCKET_MUL 0x85EBCA6BU
+#define SYNDROME_HASH_SLOT_MUL 0x9E3779B1U
+
+struct syndromeHash {
+    int bucket_bits;                // log2 of the number of buckets
+    int slot_bits;                  // log2 of the number of slots
+    int entries;                    // number of correctable syndromes
+    const uint16_t *displacement;   // per-bucket slot displacement
+    struct errorinfo *slots;        // entries, empty slots have syndrome 0
+};
+
+static inline uint32_t syndromeHashBucket(const struct syndromeHash *hash, uint32_t syndrome)
+{
+    return (syndrome * SYNDROME_HASH_BUCKET_MUL) >> (32 - hash->bucket_bits);
+}
+
+static inline uint32_t syndromeHashSlot(const struct syndromeHash *hash, uint32_t syndrome, uint16_t displacement)
+{
+    return ((syndrome * SYNDROME_HASH_SLOT_MUL) >> (32 - hash->slot_bits)) ^ displacement;
+}
+
+static struct errorinfo *syndromeHashLookup(const struct syndromeHash *hash, uint32_t syndrome)
+{
+    uint16_t displacement = hash->displacement[syndromeHashBucket(hash, syndrome)];
+    struct errorinfo *ei = &hash->slots[syndromeHashSlot(hash, syndrome, displacement)];
+    return (ei->syndrome == syndrome) ? ei : NULL;
+}
+
+// Generated tables for 1-bit correction (syndromeHash_1_56, syndromeHash_1_112)
+// and 2-bit correction with 4-bit detection (syndromeHash_2_56, syndromeHash_2_112)
+#include "crc_syndromes.h"
+
+static const struct syndromeHash *syndromeHash_short;
+static const struct syndromeHash *syndromeHash_long;
+
+#ifdef CRCDEBUG
 
 // Syndrome values for all single-bit errors;
 // used to speed up construction of error-
@@ -41,19 +94,6 @@ static void initLookupTables()
     int i;
     uint8_t msg[112/8];
 
-    for (i = 0; i < 256; ++i) {
-        uint32_t c = i << 16;
-        int j;
-        for (j = 0; j < 8; ++j) {
-            if (c & 0x800000)
-                c = (c<<1) ^ MODES_GENERATOR_POLY;
-            else
-                c = (c<<1);
-        }
-
-        crc_table[i] = c & 0x00ffffff;
-    }
-
     memset(msg, 0, sizeof(msg));
     for (i = 0; i < 112; ++i) {
         msg[i/8] ^= 1 << (7 - (i & 7));
@@ -62,30 +102,6 @@ static void initLookupTables()
     }
 }
 
-uint32_t modesChecksum(const uint8_t *message, int bits)
-{
-    uint32_t rem = 0;
-    int i;
-    int n = bits/8;
-
-    assert(bits % 8 == 0);
-    assert(n >= 3);
-
-    for (i = 0; i < n-3; ++i) {
-        rem = (rem << 8) ^ crc_table[message[i] ^ ((rem & 0xff0000) >> 16)];
-        rem = rem & 0xffffff;
-    }
-
-    rem = rem ^ (message[n-3] << 16) ^ (message[n-2] << 8) ^ (message[n-1]);
-    return rem;
-}
-
-static struct errorinfo *bitErrorTable_short;
-static int bitErrorTableSize_short;
-
-static struct errorinfo *bitErrorTable_long;
-static int bitErrorTableSize_long;
-
 // compare two errorinfo structures
 static int syndrome_compare(const void *x, const void *y) {
     struct errorinfo *ex = (struct errorinfo*)x;
@@ -131,7 +147,7 @@ static int prepareSubtable(struct errorinfo *table, int n, int maxsize, int offs
 {
     int i = 0;
 
-    if (error_bit >= max_errors)
+    if (error_bit >= max_errors || error_bit >= MODES_MAX_BITERRORS)
         return n;
 
     for (i = startbit; i < endbit; ++i) {
@@ -200,9 +216,7 @@ static struct errorinfo *prepareErrorTable(int bits, int max_correct, int max_de
         maxsize += combinations(bits, i); // space needed for all i-bit errors
     }
 
-#ifdef CRCDEBUG
     fprintf(stderr, "Preparing syndrome table to correct up to %d-bit errors (detecting %d-bit errors) in a %d-bit message (max %d entries)\n", max_correct, max_detect, bits, maxsize);
-#endif
 
     table = malloc(maxsize * sizeof(struct errorinfo));
     base_entry.syndrome = 0;
@@ -212,14 +226,11 @@ static struct errorinfo *prepareErrorTable(int bits, int max_correct, int max_de
 
     usedsize = prepareSubtable(table, 0, maxsize, 112 - bits, 0, bits, &base_entry, 0, max_correct);
 
-#ifdef CRCDEBUG
     fprintf(stderr, "%d syndromes (expected %d).\n", usedsize, maxsize);
     fprintf(stderr, "Sorting syndromes..\n");
-#endif
 
     qsort(table, usedsize, sizeof(struct errorinfo), syndrome_compare);
 
-#ifdef CRCDEBUG
     {
         // Show the table stats
         fprintf(stderr, "Undetectable errors:\n");
@@ -234,14 +245,11 @@ static struct errorinfo *prepareErrorTable(int bits, int max_correct, int max_de
             fprintf(stderr, "  %d undetectable %d-bit errors\n", count, i);
         }
     }
-#endif
 
     // Handle ambiguous cases, where there is more than one possible error pattern
     // that produces a given syndrome (this happens with >2 bit errors).
 
-#ifdef CRCDEBUG
     fprintf(stderr, "Finding collisions..\n");
-#endif
     for (i = 0, j = 0; i < usedsize; ++i) {
         if (i < usedsize-1 && table[i+1].syndrome == table[i].syndrome) {
             // skip over this entry and all collisions
@@ -258,9 +266,7 @@ static struct errorinfo *prepareErrorTable(int bits, int max_correct, int max_de
     }
 
     if (j < usedsize) {
-#ifdef CRCDEBUG
         fprintf(stderr, "Discarded %d collisions.\n", usedsize - j);
-#endif
         usedsize = j;
     }
 
@@ -268,16 +274,11 @@ static struct errorinfo *prepareErrorTable(int bits, int max_correct, int max_de
     if (max_detect > max_correct) {
         int flagged;
 
-#ifdef CRCDEBUG
         fprintf(stderr, "Flagging collisions between %d - %d bits..\n", max_correct+1, max_detect);
-#endif
 
         flagged = flagCollisions(table, usedsize, 112 - bits, 0, bits, 0, 1, max_correct+1, max_detect);
 
-#ifdef CRCDEBUG
         fprintf(stderr, "Flagged %d collisions for removal.\n", flagged);
-#else
-#endif
 
         if (flagged > 0) {
             for (i = 0, j = 0; i < usedsize; ++i) {
@@ -288,23 +289,18 @@ static struct errorinfo *prepareErrorTable(int bits, int max_correct, int max_de
                 }
             }
 
-#ifdef CRCDEBUG
             fprintf(stderr, "Discarded %d flagged collisions.\n", usedsize - j);
-#endif
             usedsize = j;
         }
     }
 
     if (usedsize < maxsize) {
-#ifdef CRCDEBUG
         fprintf(stderr, "Shrinking table from %d to %d..\n", maxsize, usedsize);
         table = realloc(table, usedsize * sizeof(struct errorinfo));
-#endif
     }
 
     *size_out = usedsize;
 
-#ifdef CRCDEBUG
     {
         // Check the table.
         unsigned char *msg = malloc(bits/8);
@@ -346,36 +342,31 @@ static struct errorinfo *prepareErrorTable(int bits, int max_correct, int max_de
 
         fprintf(stderr, "  %d entries total\n", usedsize);
     }
-#endif
 
     return table;
 }
 
-// Precompute syndrome tables for 56- and 112-bit messages.
+#endif /* CRCDEBUG */
+
+// Select the syndrome tables for 56- and 112-bit messages.
 void modesChecksumInit(int fixBits)
 {
-    initLookupTables();
-
     switch (fixBits) {
     case 0:
-        bitErrorTable_short = bitErrorTable_long = NULL;
-        bitErrorTableSize_short = bitErrorTableSize_long = 0;
+        syndromeHash_short = syndromeHash_long = NULL;
         break;
 
     case 1:
-        // For 1 bit correction, we have 100% coverage up to 4 bit detection, so don't bother
-        // with flagging collisions there.
-        bitErrorTable_short = prepareErrorTable(MODES_SHORT_MSG_BITS, 1, 1, &bitErrorTableSize_short);
-        bitErrorTable_long = prepareErrorTable(MODES_LONG_MSG_BITS, 1, 1, &bitErrorTableSize_long);
+        // For 1 bit correction, we have 100% coverage up to 4 bit detection, so the
+        // tables were built without flagging collisions there.
+        syndromeHash_short = &syndromeHash_1_56;
+        syndromeHash_long = &syndromeHash_1_112;
         break;
 
     default:
         // Detect out to 4 bit errors; this reduces our 2-bit coverage to about 65%.
-        // This can take a little while - tell the user.
-        fprintf(stderr, "Preparing error correction tables.. ");
-        bitErrorTable_short = prepareErrorTable(MODES_SHORT_MSG_BITS, 2, 4, &bitErrorTableSize_short);
-        bitErrorTable_long = prepareErrorTable(MODES_LONG_MSG_BITS, 2, 4, &bitErrorTableSize_long);
-        fprintf(stderr, "done.\n");
+        syndromeHash_short = &syndromeHash_2_56;
+        syndromeHash_long = &syndromeHash_2_112;
         break;
     }
 }
@@ -385,23 +376,18 @@ void modesChecksumInit(int fixBits)
 // syndrome is uncorrectable
 struct errorinfo *modesChecksumDiagnose(uint32_t syndrome, int bitlen)
 {
-    struct errorinfo *table;
-    int tablesize;
-
-    struct errorinfo ei;
+    const struct syndromeHash *hash;
 
     if (syndrome == 0)
         return &NO_ERRORS;
 
     assert (bitlen == 56 || bitlen == 112);
-    if (bitlen == 56) { table = bitErrorTable_short; tablesize = bitErrorTableSize_short; }
-    else { table = bitErrorTable_long; tablesize = bitErrorTableSize_long; }
+    hash = (bitlen == 56 ? syndromeHash_short : syndromeHash_long);
 
-    if (!table)
+    if (!hash)
         return NULL;
 
-    ei.syndrome = syndrome;
-    return bsearch(&ei, table, tablesize, sizeof(struct errorinfo), syndrome_compare);
+    return syndromeHashLookup(hash, syndrome);
 }
 
 // Given a message and an error-correction descriptor,
@@ -418,14 +404,295 @@ void modesChecksumFix(uint8_t *msg, struct errorinfo *info)
 }
 
 #ifdef CRCDEBUG
+// Perfect hash construction, for "crctests --generate": buckets are placed
+// largest first, each at the first displacement that puts all of its
+// syndromes into free slots. Returns 0 if some bucket does not fit.
+static int *bucketSizes;
+
+static int bucket_compare(const void *x, const void *y)
+{
+    int bx = *(const int *)x, by = *(const int *)y;
+    if (bucketSizes[bx] != bucketSizes[by])
+        return bucketSizes[by] - bucketSizes[bx];
+    return bx - by;
+}
+
+static int buildSyndromeHash(struct syndromeHash *hash, struct errorinfo *table, int size)
+{
+    int buckets = 1 << hash->bucket_bits;
+    int slots = 1 << hash->slot_bits;
+    int *order = malloc(buckets * sizeof(int));
+    int *members = malloc(size * sizeof(int));
+    int *placed = malloc(size * sizeof(int));
+    uint16_t *displacement = calloc(buckets, sizeof(uint16_t));
+    struct errorinfo *slot_table = calloc(slots, sizeof(struct errorinfo));
+    int i, ok = 1;
+
+    bucketSizes = calloc(buckets, sizeof(int));
+    for (i = 0; i < size; ++i) {
+        assert(table[i].syndrome != 0);
+        ++bucketSizes[syndromeHashBucket(hash, table[i].syndrome)];
+    }
+    for (i = 0; i < buckets; ++i)
+        order[i] = i;
+    qsort(order, buckets, sizeof(int), bucket_compare);
+
+    for (i = 0; i < buckets && ok && bucketSizes[order[i]] > 0; ++i) {
+        int bucket = order[i];
+        int n = 0, j, k, d;
+
+        for (j = 0; j < size; ++j)
+            if ((int) syndromeHashBucket(hash, table[j].syndrome) == bucket)
+                members[n++] = j;
+
+        for (d = 0; d < slots; ++d) {
+            for (j = 0; j < n; ++j) {
+                placed[j] = syndromeHashSlot(hash, table[members[j]].syndrome, d);
+                if (slot_table[placed[j]].syndrome != 0)
+                    break;
+                for (k = 0; k < j; ++k)
+                    if (placed[k] == placed[j])
+                        break;
+                if (k < j)
+                    break;
+            }
+
+            if (j == n)
+                break;
+        }
+
+        if (d == slots) {
+            ok = 0;
+            break;
+        }
+
+        displacement[bucket] = d;
+        for (j = 0; j < n; ++j)
+            slot_table[placed[j]] = table[members[j]];
+    }
+
+    free(order);
+    free(members);
+    free(placed);
+    free(bucketSizes);
+
+    if (!ok) {
+        free(displacement);
+        free(slot_table);
+        return 0;
+    }
+
+    hash->entries = size;
+    hash->displacement = displacement;
+    hash->slots = slot_table;
+    return 1;
+}
+
+// Find the smallest table that a perfect hash can be built for
+static void buildSmallestSyndromeHash(struct syndromeHash *hash, struct errorinfo *table, int size)
+{
+    int slot_bits = 1;
+    while ((1 << slot_bits) < size)
+        ++slot_bits;
+
+    for (;; ++slot_bits) {
+        for (hash->bucket_bits = slot_bits - 3; hash->bucket_bits < slot_bits; ++hash->bucket_bits) {
+            if (hash->bucket_bits < 1)
+                continue;
+            hash->slot_bits = slot_bits;
+            if (buildSyndromeHash(hash, table, size))
+                return;
+        }
+    }
+}
+
+static void writeSyndromeHash(FILE *f, const char *name, const struct syndromeHash *hash)
+{
+    int buckets = 1 << hash->bucket_bits;
+    int slots = 1 << hash->slot_bits;
+    int i;
+
+    fprintf(f, "static const uint16_t %s_displacement[%d] = {", name, buckets);
+    for (i = 0; i < buckets; ++i)
+        fprintf(f, "%s%u,", (i % 16) ? " " : "\n    ", hash->displacement[i]);
+    fprintf(f, "\n};\n\n");
+
+    fprintf(f, "static struct errorinfo %s_slots[%d] = {\n", name, slots);
+    for (i = 0; i < slots; ++i) {
+        const struct errorinfo *ei = &hash->slots[i];
+        if (ei->syndrome != 0)
+            fprintf(f, "    [%d] = { 0x%06X, %d, { %d, %d } },\n", i, ei->syndrome, ei->errors, ei->bit[0], ei->bit[1]);
+    }
+    fprintf(f, "};\n\n");
+
+    fprintf(f, "static const struct syndromeHash %s = { %d, %d, %d, %s_displacement, %s_slots };\n\n",
+            name, hash->bucket_bits, hash->slot_bits, hash->entries, name, name);
+}
+
+// The tables that modesChecksumInit can select, and how they are built
+static const struct {
+    const char *name;
+    const struct syndromeHash *hash;
+    int bits;
+    int max_correct;
+    int max_detect;
+} syndromeHashes[] = {
+    { "syndromeHash_1_56",  &syndromeHash_1_56,  MODES_SHORT_MSG_BITS, 1, 1 },
+    { "syndromeHash_1_112", &syndromeHash_1_112, MODES_LONG_MSG_BITS,  1, 1 },
+    { "syndromeHash_2_56",  &syndromeHash_2_56,  MODES_SHORT_MSG_BITS, 2, 4 },
+    { "syndromeHash_2_112", &syndromeHash_2_112, MODES_LONG_MSG_BITS,  2, 4 },
+    { NULL, NULL, 0, 0, 0 }
+};
+
+static int generateSyndromeHashes(FILE *f)
+{
+    int i;
+
+    fprintf(f,
+            "// Part of dump1090, a Mode S message decoder for RTLSDR devices.\n"
+            "//\n"
+            "// crc_syndromes.h: perfect hashes of correctable Mode S CRC syndromes,\n"
+            "// included by crc.c.\n"
+            "//\n"
+            "// Generated by \"crctests --generate\" (make crcgen); do not edit.\n\n");
+
+    for (i = 0; syndromeHashes[i].name; ++i) {
+        struct syndromeHash hash;
+        struct errorinfo *table;
+        int size;
+
+        table = prepareErrorTable(syndromeHashes[i].bits, syndromeHashes[i].max_correct, syndromeHashes[i].max_detect, &size);
+        buildSmallestSyndromeHash(&hash, table, size);
+        fprintf(stderr, "%s: %d syndromes in %d slots, %d buckets\n", syndromeHashes[i].name, size, 1 << hash.slot_bits, 1 << hash.bucket_bits);
+        writeSyndromeHash(f, syndromeHashes[i].name, &hash);
+
+        free((void *) hash.displacement);
+        free(hash.slots);
+        free(table);
+    }
+
+    return 0;
+}
+
+// Check the compiled-in hashes against freshly built sorted tables: the
+// same syndromes, the same corrections, and no false hits
+static int verifySyndromeHashes(void)
+{
+    int i, j, failures = 0;
+
+    srand(1);
+    for (i = 0; syndromeHashes[i].name; ++i) {
+        const struct syndromeHash *hash = syndromeHashes[i].hash;
+        struct errorinfo *table;
+        int size;
+
+        table = prepareErrorTable(syndromeHashes[i].bits, syndromeHashes[i].max_correct, syndromeHashes[i].max_detect, &size);
+
+        if (size != hash->entries) {
+            fprintf(stderr, "%s: FAIL: %d syndromes, table has %d\n", syndromeHashes[i].name, hash->entries, size);
+            ++failures;
+        }
+
+        for (j = 0; j < size; ++j) {
+            struct errorinfo *ei = syndromeHashLookup(hash, table[j].syndrome);
+            if (!ei || ei->errors != table[j].errors || ei->bit[0] != table[j].bit[0] || ei->bit[1] != table[j].bit[1]) {
+                fprintf(stderr, "%s: FAIL: syndrome %06X not found or differs\n", syndromeHashes[i].name, table[j].syndrome);
+                ++failures;
+            }
+        }
+
+        for (j = 0; j < 1000000; ++j) {
+            struct errorinfo key;
+            key.syndrome = 1 + rand() % 0xFFFFFF;
+            struct errorinfo *expected = bsearch(&key, table, size, sizeof(struct errorinfo), syndrome_compare);
+            struct errorinfo *ei = syndromeHashLookup(hash, key.syndrome);
+            if (!expected != !ei) {
+                fprintf(stderr, "%s: FAIL: syndrome %06X is %s by bsearch but %s by hash\n", syndromeHashes[i].name,
+                        key.syndrome, expected ? "found" : "not found", ei ? "found" : "not found");
+                ++failures;
+            }
+        }
+
+        if (!failures)
+            fprintf(stderr, "%s: PASS\n", syndromeHashes[i].name);
+        free(table);
+    }
+
+    return failures ? 1 : 0;
+}
+
+static double elapsedNanos(const struct timespec *start, const struct timespec *end)
+{
+    return (end->tv_sec - start->tv_sec) * 1e9 + (end->tv_nsec - start->tv_nsec);
+}
+
+// Compare the bsearch lookup that modesChecksumDiagnose used to do with
+// the hash lookup, on a mix of correctable and random syndromes
+static int benchmarkSyndromeHashes(void)
+{
+    int i, j;
+    const int lookups = 10000000;
+    uint32_t *syndromes = malloc(lookups * sizeof(uint32_t));
+
+    srand(1);
+    for (i = 0; syndromeHashes[i].name; ++i) {
+        const struct syndromeHash *hash = syndromeHashes[i].hash;
+        struct errorinfo *table;
+        struct timespec start, end;
+        int size, found;
+
+        table = prepareErrorTable(syndromeHashes[i].bits, syndromeHashes[i].max_correct, syndromeHashes[i].max_detect, &size);
+        for (j = 0; j < lookups; ++j)
+            syndromes[j] = (j & 1) ? table[rand() % size].syndrome : (uint32_t) (1 + rand() % 0xFFFFFF);
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        found = 0;
+        for (j = 0; j < lookups; ++j) {
+            struct errorinfo key;
+            key.syndrome = syndromes[j];
+            found += (bsearch(&key, table, size, sizeof(struct errorinfo), syndrome_compare) != NULL);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        fprintf(stderr, "%s: bsearch %.1f ns/lookup (%d found)\n", syndromeHashes[i].name, elapsedNanos(&start, &end) / lookups, found);
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        found = 0;
+        for (j = 0; j < lookups; ++j)
+            found += (syndromeHashLookup(hash, syndromes[j]) != NULL);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        fprintf(stderr, "%s: hash    %.1f ns/lookup (%d found)\n", syndromeHashes[i].name, elapsedNanos(&start, &end) / lookups, found);
+
+        free(table);
+    }
+
+    free(syndromes);
+    return 0;
+}
+
 int main(int argc, char **argv)
 {
     int shortlen, longlen;
     int i;
     struct errorinfo *shorttable, *longtable;
 
+    if (argc == 2 && !strcmp(argv[1], "--generate")) {
+        initLookupTables();
+        return generateSyndromeHashes(stdout);
+    }
+
+    if (argc == 2 && !strcmp(argv[1], "--verify")) {
+        initLookupTables();
+        return verifySyndromeHashes();
+    }
+
+    if (argc == 2 && !strcmp(argv[1], "--benchmark")) {
+        initLookupTables();
+        return benchmarkSyndromeHashes();
+    }
+
     if (argc < 3) {
         fprintf(stderr, "syntax: crctests <ncorrect> <ndetect>\n");
+        fprintf(stderr, "        crctests --generate | --verify | --benchmark\n");
         return 1;
     }
 
@@ -0,0 +1,5599 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// crc_syndromes.h: perfect hashes of correctable Mode S CRC syndromes,
+// included by crc.c.
+//
+// Generated by "crctests --generate" (make crcgen); do not edit.
+
+static const uint16_t syndromeHash_1_56_displacement[32] = {
+    2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 2, 1,
+    3, 1, 2, 1, 0, 2, 0, 1, 0, 3, 0, 1, 16, 2, 3, 0,
+};
+
+static struct errorinfo syndromeHash_1_56_slots[64] = {
+    [0] = { 0x457C29, 1, { 10, -1 } },
+    [1] = { 0xEA04AD, 1, { 8, -1 } },
+    [2] = { 0x00E0D8, 1, { 27, -1 } },
+    [3] = { 0x00706C, 1, { 28, -1 } },
+    [4] = { 0x01C1B0, 1, { 26, -1 } },
+    [5] = { 0x000080, 1, { 48, -1 } },
+    [6] = { 0x8AF852, 1, { 9, -1 } },
+    [7] = { 0xF91024, 1, { 16, -1 } },
+    [8] = { 0x1C1B00, 1, { 22, -1 } },
+    [9] = { 0x038360, 1, { 25, -1 } },
+    [10] = { 0x375104, 1, { 13, -1 } },
+    [11] = { 0xA01E91, 1, { 4, -1 } },
+    [12] = { 0xAFF54C, 1, { 5, -1 } },
+    [13] = { 0x200000, 1, { 34, -1 } },
+    [14] = { 0x000002, 1, { 54, -1 } },
+    [15] = { 0x000100, 1, { 47, -1 } },
+    [17] = { 0x0706C0, 1, { 24, -1 } },
+    [18] = { 0xE0D800, 1, { 19, -1 } },
+    [19] = { 0x0DD441, 1, { 15, -1 } },
+    [21] = { 0x6EA208, 1, { 12, -1 } },
+    [22] = { 0x383600, 1, { 21, -1 } },
+    [23] = { 0x57FAA6, 1, { 6, -1 } },
+    [26] = { 0x400000, 1, { 33, -1 } },
+    [27] = { 0x000200, 1, { 46, -1 } },
+    [28] = { 0x001000, 1, { 43, -1 } },
+    [29] = { 0x010000, 1, { 39, -1 } },
+    [30] = { 0x000004, 1, { 53, -1 } },
+    [31] = { 0xFF38B7, 1, { 1, -1 } },
+    [32] = { 0x003836, 1, { 29, -1 } },
+    [33] = { 0x2BFD53, 1, { 7, -1 } },
+    [34] = { 0x000040, 1, { 49, -1 } },
+    [35] = { 0x7C8812, 1, { 17, -1 } },
+    [36] = { 0x000001, 1, { 55, -1 } },
+    [37] = { 0x1BA882, 1, { 14, -1 } },
+    [38] = { 0x100000, 1, { 35, -1 } },
+    [39] = { 0x0E0D80, 1, { 23, -1 } },
+    [40] = { 0x706C00, 1, { 20, -1 } },
+    [41] = { 0xFFF409, 1, { 31, -1 } },
+    [42] = { 0xDD4410, 1, { 11, -1 } },
+    [43] = { 0x80665F, 1, { 2, -1 } },
+    [46] = { 0x000800, 1, { 44, -1 } },
+    [48] = { 0x000020, 1, { 50, -1 } },
+    [49] = { 0x3E4409, 1, { 18, -1 } },
+    [50] = { 0x001C1B, 1, { 30, -1 } },
+    [51] = { 0x080000, 1, { 36, -1 } },
+    [52] = { 0x004000, 1, { 41, -1 } },
+    [53] = { 0x000400, 1, { 45, -1 } },
+    [54] = { 0x800000, 1, { 32, -1 } },
+    [56] = { 0x000010, 1, { 51, -1 } },
+    [57] = { 0x040000, 1, { 37, -1 } },
+    [58] = { 0x002000, 1, { 42, -1 } },
+    [59] = { 0xBFC92B, 1, { 3, -1 } },
+    [60] = { 0x000008, 1, { 52, -1 } },
+    [61] = { 0x018567, 1, { 0, -1 } },
+    [62] = { 0x020000, 1, { 38, -1 } },
+    [63] = { 0x008000, 1, { 40, -1 } },
+};
+
+static const struct syndromeHash syndromeHash_1_56 = { 5, 6, 56, syndromeHash_1_56_displacement, syndromeHash_1_56_slots };
+
+static const uint16_t syndromeHash_1_112_displacement[64] = {
+    3, 1, 0, 0, 0, 0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 10,
+    18, 0, 0, 0, 1, 4, 1, 0, 1, 0, 3, 5, 2, 0, 1, 1,
+    3, 3, 21, 1, 3, 0, 0, 5, 6, 2, 4, 1, 3, 1, 14, 0,
+    19, 0, 2, 9, 18, 2, 11, 0, 34, 4, 1, 0, 6, 0, 0, 2,
+};
+
+static struct errorinfo syndromeHash_1_112_slots[128] = {
+    [0] = { 0x038360, 1, { 81, -1 } },
+    [1] = { 0x457C29, 1, { 66, -1 } },
+    [2] = { 0xEA04AD, 1, { 64, -1 } },
+    [3] = { 0x5F4C21, 1, { 14, -1 } },
+    [4] = { 0x6159C0, 1, { 50, -1 } },
+    [5] = { 0x00E0D8, 1, { 83, -1 } },
+    [6] = { 0x00706C, 1, { 84, -1 } },
+    [7] = { 0x8AF852, 1, { 65, -1 } },
+    [8] = { 0xF91024, 1, { 72, -1 } },
+    [9] = { 0x3F6D11, 1, { 32, -1 } },
+    [10] = { 0xF1B77E, 1, { 2, -1 } },
+    [11] = { 0x57FAA6, 1, { 62, -1 } },
+    [12] = { 0x1C9AF5, 1, { 1, -1 } },
+    [13] = { 0x000080, 1, { 104, -1 } },
+    [14] = { 0xC2B380, 1, { 49, -1 } },
+    [15] = { 0x01C1B0, 1, { 82, -1 } },
+    [17] = { 0xD05C14, 1, { 15, -1 } },
+    [19] = { 0x7EDA22, 1, { 31, -1 } },
+    [20] = { 0xA01E91, 1, { 60, -1 } },
+    [21] = { 0x375104, 1, { 69, -1 } },
+    [22] = { 0xBE9842, 1, { 13, -1 } },
+    [23] = { 0x1C1B00, 1, { 78, -1 } },
+    [25] = { 0x3935EA, 1, { 0, -1 } },
+    [26] = { 0x000100, 1, { 103, -1 } },
+    [27] = { 0x200000, 1, { 90, -1 } },
+    [29] = { 0xAFF54C, 1, { 61, -1 } },
+    [30] = { 0x000002, 1, { 110, -1 } },
+    [31] = { 0x2C38BC, 1, { 8, -1 } },
+    [32] = { 0x2B705A, 1, { 45, -1 } },
+    [33] = { 0x185670, 1, { 52, -1 } },
+    [36] = { 0xE0D800, 1, { 75, -1 } },
+    [37] = { 0xFDB444, 1, { 30, -1 } },
+    [38] = { 0x0706C0, 1, { 80, -1 } },
+    [39] = { 0x0B0E2F, 1, { 10, -1 } },
+    [40] = { 0x383600, 1, { 77, -1 } },
+    [42] = { 0xADC168, 1, { 43, -1 } },
+    [43] = { 0x6EA208, 1, { 68, -1 } },
+    [47] = { 0x381323, 1, { 35, -1 } },
+    [48] = { 0x0DD441, 1, { 71, -1 } },
+    [50] = { 0x8E03CE, 1, { 37, -1 } },
+    [51] = { 0x049C81, 1, { 29, -1 } },
+    [52] = { 0x82C48D, 1, { 12, -1 } },
+    [53] = { 0x000200, 1, { 102, -1 } },
+    [54] = { 0x400000, 1, { 89, -1 } },
+    [55] = { 0x7A9309, 1, { 48, -1 } },
+    [56] = { 0x587178, 1, { 7, -1 } },
+    [57] = { 0x24E408, 1, { 26, -1 } },
+    [58] = { 0x72F8C3, 1, { 19, -1 } },
+    [59] = { 0x001000, 1, { 99, -1 } },
+    [60] = { 0x000004, 1, { 109, -1 } },
+    [61] = { 0xE04C8C, 1, { 33, -1 } },
+    [62] = { 0x010000, 1, { 95, -1 } },
+    [63] = { 0xFF38B7, 1, { 57, -1 } },
+    [64] = { 0xDC7AF7, 1, { 39, -1 } },
+    [65] = { 0xE3F395, 1, { 36, -1 } },
+    [66] = { 0x30ACE0, 1, { 51, -1 } },
+    [67] = { 0x003836, 1, { 85, -1 } },
+    [68] = { 0x91C77F, 1, { 40, -1 } },
+    [69] = { 0x2BFD53, 1, { 63, -1 } },
+    [70] = { 0x78DBBF, 1, { 3, -1 } },
+    [71] = { 0x000040, 1, { 105, -1 } },
+    [72] = { 0x682E0A, 1, { 16, -1 } },
+    [73] = { 0x0E0D80, 1, { 79, -1 } },
+    [74] = { 0x1BA882, 1, { 70, -1 } },
+    [75] = { 0x7C8812, 1, { 73, -1 } },
+    [76] = { 0x000001, 1, { 111, -1 } },
+    [77] = { 0x9CB936, 1, { 21, -1 } },
+    [78] = { 0x161C5E, 1, { 9, -1 } },
+    [79] = { 0x100000, 1, { 91, -1 } },
+    [80] = { 0x15B82D, 1, { 46, -1 } },
+    [81] = { 0x0C2B38, 1, { 53, -1 } },
+    [82] = { 0x706C00, 1, { 76, -1 } },
+    [83] = { 0xFFF409, 1, { 87, -1 } },
+    [84] = { 0x56E0B4, 1, { 44, -1 } },
+    [85] = { 0xFA7D13, 1, { 11, -1 } },
+    [86] = { 0xDD4410, 1, { 67, -1 } },
+    [87] = { 0xD8D449, 1, { 23, -1 } },
+    [88] = { 0xC68665, 1, { 20, -1 } },
+    [89] = { 0x4701E7, 1, { 38, -1 } },
+    [90] = { 0x008000, 1, { 96, -1 } },
+    [91] = { 0x9E31E9, 1, { 5, -1 } },
+    [92] = { 0x127204, 1, { 27, -1 } },
+    [93] = { 0x000800, 1, { 100, -1 } },
+    [94] = { 0x702646, 1, { 34, -1 } },
+    [95] = { 0x80665F, 1, { 58, -1 } },
+    [96] = { 0xC397DB, 1, { 4, -1 } },
+    [97] = { 0x001C1B, 1, { 86, -1 } },
+    [98] = { 0x3E4409, 1, { 74, -1 } },
+    [99] = { 0x000020, 1, { 106, -1 } },
+    [100] = { 0x341705, 1, { 17, -1 } },
+    [102] = { 0x4E5C9B, 1, { 22, -1 } },
+    [103] = { 0x080000, 1, { 92, -1 } },
+    [104] = { 0xF52612, 1, { 47, -1 } },
+    [105] = { 0x004000, 1, { 97, -1 } },
+    [106] = { 0x093902, 1, { 28, -1 } },
+    [107] = { 0x06159C, 1, { 54, -1 } },
+    [108] = { 0x800000, 1, { 88, -1 } },
+    [110] = { 0x939020, 1, { 24, -1 } },
+    [111] = { 0x000400, 1, { 101, -1 } },
+    [112] = { 0xA476D9, 1, { 42, -1 } },
+    [113] = { 0x000010, 1, { 107, -1 } },
+    [114] = { 0xE5F186, 1, { 18, -1 } },
+    [115] = { 0x040000, 1, { 93, -1 } },
+    [116] = { 0xBFC92B, 1, { 59, -1 } },
+    [117] = { 0x030ACE, 1, { 55, -1 } },
+    [118] = { 0x002000, 1, { 98, -1 } },
+    [119] = { 0x49C810, 1, { 25, -1 } },
+    [120] = { 0x000008, 1, { 108, -1 } },
+    [121] = { 0x020000, 1, { 94, -1 } },
+    [122] = { 0x018567, 1, { 56, -1 } },
+    [123] = { 0xB0E2F0, 1, { 6, -1 } },
+    [124] = { 0xB719BB, 1, { 41, -1 } },
+};
+
+static const struct syndromeHash syndromeHash_1_112 = { 6, 7, 112, syndromeHash_1_112_displacement, syndromeHash_1_112_slots };
+
+static const uint16_t syndromeHash_2_56_displacement[512] = {
+    4, 10, 2, 51, 0, 6, 27, 3, 0, 0, 5, 9, 1, 0, 0, 0,
+    1, 2, 1, 1, 0, 22, 5, 11, 0, 22, 3, 0, 1, 2, 2, 1,
+    11, 0, 7, 0, 14, 3, 5, 8, 0, 0, 0, 9, 8, 2, 2, 0,
+    14, 5, 4, 4, 1, 0, 4, 0, 0, 2, 1, 4, 5, 11, 4, 0,
+    10, 2, 7, 22, 0, 0, 2, 1, 0, 1, 1, 33, 2, 7, 8, 6,
+    0, 4, 0, 22, 2, 15, 0, 0, 2, 4, 5, 0, 0, 5, 1, 0,
+    9, 27, 5, 1, 2, 0, 2, 1, 1, 0, 0, 0, 12, 4, 9, 1,
+    0, 5, 1, 0, 6, 1, 2, 0, 30, 0, 18, 0, 11, 17, 45, 5,
+    4, 6, 2, 5, 0, 22, 5, 1, 0, 6, 23, 18, 0, 2, 1, 0,
+    0, 4, 1, 3, 0, 2, 8, 0, 4, 0, 4, 0, 22, 0, 3, 1,
+    4, 2, 0, 8, 0, 9, 3, 1, 1, 4, 16, 10, 1, 9, 7, 14,
+    7, 7, 3, 4, 2, 3, 0, 2, 0, 1, 9, 5, 11, 3, 0, 0,
+    6, 4, 2, 8, 26, 17, 2, 4, 3, 0, 1, 43, 1, 0, 0, 32,
+    18, 34, 0, 3, 4, 0, 0, 1, 4, 2, 8, 4, 7, 1, 15, 2,
+    0, 4, 0, 2, 1, 0, 2, 4, 1, 12, 4, 0, 4, 6, 0, 37,
+    0, 21, 13, 1, 0, 13, 1, 0, 7, 0, 1, 0, 5, 4, 7, 14,
+    6, 3, 38, 15, 13, 4, 15, 0, 9, 14, 19, 53, 5, 1, 48, 24,
+    7, 14, 1, 23, 31, 13, 1, 20, 0, 2, 0, 14, 4, 5, 0, 4,
+    18, 0, 59, 0, 4, 61, 3, 0, 2, 11, 7, 0, 51, 1, 15, 2,
+    8, 3, 0, 18, 0, 0, 0, 1, 7, 0, 0, 2, 6, 0, 10, 3,
+    0, 6, 2, 13, 8, 3, 4, 11, 5, 1, 23, 7, 0, 0, 2, 8,
+    0, 3, 11, 13, 1, 56, 26, 2, 1, 8, 0, 26, 15, 4, 20, 9,
+    7, 34, 65, 10, 0, 2, 66, 4, 16, 17, 11, 24, 0, 1, 22, 16,
+    0, 2, 6, 6, 10, 1, 1, 91, 17, 0, 1, 82, 1, 5, 0, 2,
+    12, 8, 0, 9, 65, 8, 2, 0, 12, 1, 3, 26, 2, 32, 42, 66,
+    1, 0, 73, 5, 1, 1, 5, 0, 71, 1, 4, 32, 25, 2, 4, 3,
+    0, 10, 6, 34, 5, 27, 17, 7, 13, 5, 9, 1, 4, 1, 6, 1,
+    7, 1, 2, 12, 9, 13, 14, 4, 4, 0, 0, 39, 2, 9, 70, 0,
+    1, 0, 0, 9, 67, 7, 1, 0, 5, 1, 3, 0, 35, 13, 10, 3,
+    1, 3, 7, 5, 1, 0, 2, 42, 43, 36, 13, 0, 12, 106, 1, 3,
+    10, 0, 13, 7, 3, 11, 39, 1, 17, 6, 80, 25, 1, 10, 19, 0,
+    23, 2, 4, 1, 7, 2, 5, 0, 49, 56, 0, 51, 54, 7, 40, 4,
+};
+
+static struct errorinfo syndromeHash_2_56_slots[2048] = {
+    [0] = { 0x8AC064, 2, { 9, 29 } },
+    [1] = { 0x351029, 2, { 10, 20 } },
+    [2] = { 0x0D3499, 2, { 15, 27 } },
+    [3] = { 0x6A2052, 2, { 9, 19 } },
+    [4] = { 0x4BE1A6, 2, { 6, 22 } },
+    [5] = { 0x080100, 2, { 36, 47 } },
+    [6] = { 0xAFF56C, 2, { 5, 50 } },
+    [7] = { 0x4E0D80, 2, { 23, 33 } },
+    [8] = { 0x000044, 2, { 49, 53 } },
+    [9] = { 0x7C9812, 2, { 17, 43 } },
+    [10] = { 0x01E1B0, 2, { 26, 42 } },
+    [11] = { 0xFF38F7, 2, { 1, 49 } },
+    [12] = { 0x9C1B00, 2, { 22, 32 } },
+    [13] = { 0x5BA882, 2, { 14, 33 } },
+    [14] = { 0x87FF2B, 2, { 3, 21 } },
+    [15] = { 0xD440A4, 2, { 8, 18 } },
+    [16] = { 0x2BFD13, 2, { 7, 49 } },
+    [17] = { 0xAFCD7A, 2, { 5, 29 } },
+    [18] = { 0x0786C0, 2, { 24, 40 } },
+    [19] = { 0xF93024, 2, { 16, 42 } },
+    [20] = { 0x040080, 2, { 37, 48 } },
+    [21] = { 0x457C29, 1, { 10, -1 } },
+    [22] = { 0x7D8812, 2, { 17, 39 } },
+    [23] = { 0x3F30C0, 2, { 21, 24 } },
+    [24] = { 0x3DC769, 2, { 18, 25 } },
+    [25] = { 0x038760, 2, { 25, 45 } },
+    [26] = { 0x57FAB6, 2, { 6, 51 } },
+    [27] = { 0x280000, 2, { 34, 36 } },
+    [28] = { 0x03C360, 2, { 25, 41 } },
+    [29] = { 0x0E0F80, 2, { 23, 46 } },
+    [30] = { 0xB75104, 2, { 13, 32 } },
+    [31] = { 0x1A6932, 2, { 14, 26 } },
+    [32] = { 0x57FA26, 2, { 6, 48 } },
+    [33] = { 0x25F0D3, 2, { 7, 23 } },
+    [34] = { 0x0FCC30, 2, { 23, 26 } },
+    [35] = { 0x7E6180, 2, { 20, 23 } },
+    [36] = { 0x1BAA82, 2, { 14, 46 } },
+    [37] = { 0x00706C, 1, { 28, -1 } },
+    [38] = { 0x01C1B8, 2, { 26, 52 } },
+    [39] = { 0x8AF852, 1, { 9, -1 } },
+    [40] = { 0x0A9E0D, 2, { 2, 9 } },
+    [41] = { 0xEA04AD, 1, { 8, -1 } },
+    [42] = { 0x001040, 2, { 43, 49 } },
+    [43] = { 0x010040, 2, { 39, 49 } },
+    [44] = { 0xCF847B, 2, { 9, 10 } },
+    [45] = { 0x57E6BD, 2, { 6, 30 } },
+    [46] = { 0x3E440B, 2, { 18, 54 } },
+    [47] = { 0x03C1B0, 2, { 26, 38 } },
+    [48] = { 0xBF38B7, 2, { 1, 33 } },
+    [49] = { 0xBBC92B, 2, { 3, 37 } },
+    [50] = { 0x7B8ED2, 2, { 17, 24 } },
+    [51] = { 0x0E1D80, 2, { 23, 43 } },
+    [52] = { 0x0DDC41, 2, { 15, 44 } },
+    [53] = { 0xFEF907, 2, { 1, 26 } },
+    [54] = { 0xF9102C, 2, { 16, 52 } },
+    [55] = { 0x34D264, 2, { 13, 25 } },
+    [56] = { 0x500000, 2, { 33, 35 } },
+    [57] = { 0x070EC0, 2, { 24, 44 } },
+    [58] = { 0x1C5B00, 2, { 22, 41 } },
+    [59] = { 0x7C8816, 2, { 17, 53 } },
+    [60] = { 0x380E36, 2, { 21, 29 } },
+    [61] = { 0xFB1024, 2, { 16, 38 } },
+    [62] = { 0x00141B, 2, { 30, 44 } },
+    [63] = { 0xEA3C9B, 2, { 8, 29 } },
+    [64] = { 0xB45DCE, 2, { 5, 14 } },
+    [65] = { 0xAFF44C, 2, { 5, 47 } },
+    [66] = { 0xBFC9AB, 2, { 3, 48 } },
+    [67] = { 0x375504, 2, { 13, 45 } },
+    [68] = { 0x038370, 2, { 25, 51 } },
+    [69] = { 0x606C00, 2, { 20, 35 } },
+    [70] = { 0x3A8545, 2, { 13, 15 } },
+    [72] = { 0x131489, 2, { 8, 16 } },
+    [73] = { 0x8FF54C, 2, { 5, 34 } },
+    [74] = { 0xFFF408, 2, { 31, 55 } },
+    [75] = { 0x450C45, 2, { 10, 28 } },
+    [76] = { 0xF13537, 2, { 1, 23 } },
+    [77] = { 0x97C34C, 2, { 5, 21 } },
+    [78] = { 0x00E0D8, 1, { 27, -1 } },
+    [79] = { 0x080002, 2, { 36, 54 } },
+    [80] = { 0x1F9860, 2, { 22, 25 } },
+    [81] = { 0x400001, 2, { 33, 55 } },
+    [82] = { 0xA05E91, 2, { 4, 41 } },
+    [83] = { 0x000022, 2, { 50, 54 } },
+    [84] = { 0xC17CBE, 2, { 1, 18 } },
+    [85] = { 0x100200, 2, { 35, 46 } },
+    [86] = { 0xC34139, 2, { 3, 17 } },
+    [87] = { 0x002836, 2, { 29, 43 } },
+    [88] = { 0x002080, 2, { 42, 48 } },
+    [89] = { 0x2BFD57, 2, { 7, 53 } },
+    [90] = { 0x003832, 2, { 29, 53 } },
+    [91] = { 0xDC9683, 2, { 4, 17 } },
+    [92] = { 0x078360, 2, { 25, 37 } },
+    [93] = { 0xA8F38C, 2, { 5, 24 } },
+    [94] = { 0x80665E, 2, { 2, 55 } },
+    [95] = { 0xFCC300, 2, { 19, 22 } },
+    [97] = { 0x1C1B10, 2, { 22, 51 } },
+    [100] = { 0xA80EAF, 2, { 6, 31 } },
+    [101] = { 0xEFF409, 2, { 31, 35 } },
+    [103] = { 0x01DDAB, 2, { 26, 30 } },
+    [104] = { 0x07E618, 2, { 24, 27 } },
+    [105] = { 0xF71DA4, 2, { 16, 23 } },
+    [106] = { 0x000088, 2, { 48, 52 } },
+    [107] = { 0x383E00, 2, { 21, 44 } },
+    [108] = { 0x000201, 2, { 46, 55 } },
+    [109] = { 0x153C1A, 2, { 1, 8 } },
+    [110] = { 0x0E0D84, 2, { 23, 53 } },
+    [111] = { 0x1BB882, 2, { 14, 43 } },
+    [112] = { 0xBF892B, 2, { 3, 41 } },
+    [113] = { 0xA00000, 2, { 32, 34 } },
+    [114] = { 0x375114, 2, { 13, 51 } },
+    [115] = { 0x69A4C8, 2, { 12, 24 } },
+    [116] = { 0x1BA886, 2, { 14, 53 } },
+    [117] = { 0x020080, 2, { 38, 48 } },
+    [118] = { 0x701C6C, 2, { 20, 28 } },
+    [119] = { 0x0F0D80, 2, { 23, 39 } },
+    [120] = { 0x800100, 2, { 32, 47 } },
+    [121] = { 0x1C1F00, 2, { 22, 45 } },
+    [123] = { 0x1B485A, 2, { 14, 27 } },
+    [124] = { 0x40F19C, 2, { 1, 3 } },
+    [126] = { 0x38B600, 2, { 21, 40 } },
+    [127] = { 0x0185E7, 2, { 0, 48 } },
+    [129] = { 0x003876, 2, { 29, 49 } },
+    [130] = { 0x007064, 2, { 28, 52 } },
+    [132] = { 0x88F852, 2, { 9, 38 } },
+    [133] = { 0xA01E11, 2, { 4, 48 } },
+    [134] = { 0xBC0591, 2, { 4, 22 } },
+    [135] = { 0x457C21, 2, { 10, 52 } },
+    [137] = { 0x0706E0, 2, { 24, 50 } },
+    [141] = { 0x57FAAE, 2, { 6, 52 } },
+    [142] = { 0xE804AD, 2, { 8, 38 } },
+    [143] = { 0x0DD461, 2, { 15, 50 } },
+    [144] = { 0x708CD8, 2, { 20, 27 } },
+    [145] = { 0x750A8A, 2, { 12, 14 } },
+    [146] = { 0xEA04A5, 2, { 8, 52 } },
+    [147] = { 0x06E42D, 2, { 16, 31 } },
+    [148] = { 0x01C1B0, 1, { 26, -1 } },
+    [149] = { 0x262912, 2, { 7, 15 } },
+    [150] = { 0xBBB613, 2, { 4, 14 } },
+    [151] = { 0x101000, 2, { 35, 43 } },
+    [152] = { 0x200400, 2, { 34, 45 } },
+    [153] = { 0xC0D800, 2, { 19, 34 } },
+    [154] = { 0xCD4410, 2, { 11, 35 } },
+    [155] = { 0x455C29, 2, { 10, 42 } },
+    [156] = { 0xA41E91, 2, { 4, 37 } },
+    [157] = { 0x706E00, 2, { 20, 46 } },
+    [158] = { 0x100004, 2, { 35, 53 } },
+    [160] = { 0xF91024, 1, { 16, -1 } },
+    [161] = { 0x204000, 2, { 34, 41 } },
+    [163] = { 0xE0D820, 2, { 19, 50 } },
+    [164] = { 0x03A360, 2, { 25, 42 } },
+    [165] = { 0x800002, 2, { 32, 54 } },
+    [166] = { 0x110000, 2, { 35, 39 } },
+    [167] = { 0x3FC92B, 2, { 3, 32 } },
+    [168] = { 0x45F1E1, 2, { 5, 8 } },
+    [170] = { 0xC0665F, 2, { 2, 33 } },
+    [171] = { 0x000500, 2, { 45, 47 } },
+    [173] = { 0x004100, 2, { 41, 47 } },
+    [174] = { 0x00506C, 2, { 28, 42 } },
+    [176] = { 0xFFF609, 2, { 31, 46 } },
+    [178] = { 0x2AFD53, 2, { 7, 39 } },
+    [179] = { 0x018167, 2, { 0, 45 } },
+    [181] = { 0x038368, 2, { 25, 52 } },
+    [182] = { 0x8A188A, 2, { 9, 27 } },
+    [183] = { 0x8AD852, 2, { 9, 42 } },
+    [184] = { 0x001001, 2, { 43, 55 } },
+    [185] = { 0x0F06C0, 2, { 24, 36 } },
+    [186] = { 0x000005, 2, { 53, 55 } },
+    [187] = { 0x010001, 2, { 39, 55 } },
+    [188] = { 0xE8D800, 2, { 19, 36 } },
+    [190] = { 0x00E0D0, 2, { 27, 52 } },
+    [192] = { 0xE038D8, 2, { 19, 27 } },
+    [193] = { 0x7C8852, 2, { 17, 49 } },
+    [194] = { 0x1C3B00, 2, { 22, 42 } },
+    [195] = { 0x383620, 2, { 21, 50 } },
+    [196] = { 0x000080, 1, { 48, -1 } },
+    [198] = { 0x6EAA08, 2, { 12, 44 } },
+    [203] = { 0x79767B, 2, { 2, 16 } },
+    [204] = { 0x03BB56, 2, { 25, 29 } },
+    [205] = { 0x200010, 2, { 34, 51 } },
+    [206] = { 0xD34990, 2, { 11, 23 } },
+    [207] = { 0x805E69, 2, { 2, 29 } },
+    [208] = { 0x2A7834, 2, { 0, 7 } },
+    [209] = { 0x00C0D8, 2, { 27, 42 } },
+    [210] = { 0x1C1B08, 2, { 22, 52 } },
+    [211] = { 0x000402, 2, { 45, 54 } },
+    [212] = { 0x578ACA, 2, { 6, 28 } },
+    [213] = { 0x000110, 2, { 47, 51 } },
+    [214] = { 0x3F85B9, 2, { 18, 26 } },
+    [215] = { 0xDD4610, 2, { 11, 46 } },
+    [217] = { 0x8B39E2, 2, { 9, 26 } },
+    [219] = { 0x2BED53, 2, { 7, 43 } },
+    [220] = { 0xA03E91, 2, { 4, 42 } },
+    [221] = { 0x80661F, 2, { 2, 49 } },
+    [222] = { 0x417C29, 2, { 10, 37 } },
+    [223] = { 0x377104, 2, { 13, 42 } },
+    [224] = { 0x004002, 2, { 41, 54 } },
+    [225] = { 0x11CF41, 2, { 15, 22 } },
+    [226] = { 0x707C00, 2, { 20, 43 } },
+    [227] = { 0x183600, 2, { 21, 34 } },
+    [228] = { 0x1AA882, 2, { 14, 39 } },
+    [229] = { 0x1E1B00, 2, { 22, 38 } },
+    [230] = { 0x103836, 2, { 29, 35 } },
+    [231] = { 0x240000, 2, { 34, 37 } },
+    [232] = { 0x716C00, 2, { 20, 39 } },
+    [233] = { 0x37510C, 2, { 13, 52 } },
+    [234] = { 0x8AE449, 2, { 9, 30 } },
+    [237] = { 0x706C04, 2, { 20, 53 } },
+    [238] = { 0xF9F0FC, 2, { 16, 27 } },
+    [239] = { 0x6EA228, 2, { 12, 50 } },
+    [241] = { 0x040100, 2, { 37, 47 } },
+    [242] = { 0x457CA9, 2, { 10, 48 } },
+    [243] = { 0x3690B4, 2, { 13, 26 } },
+    [244] = { 0x3C8812, 2, { 17, 33 } },
+    [245] = { 0xA01E99, 2, { 4, 52 } },
+    [246] = { 0x067209, 2, { 18, 21 } },
+    [247] = { 0x7F5EE8, 2, { 1, 2 } },
+    [248] = { 0xB7C92B, 2, { 3, 36 } },
+    [249] = { 0x81E338, 2, { 0, 2 } },
+    [253] = { 0xA21E91, 2, { 4, 38 } },
+    [254] = { 0x57FAA6, 1, { 6, -1 } },
+    [255] = { 0x000012, 2, { 51, 54 } },
+    [256] = { 0x003837, 2, { 29, 55 } },
+    [257] = { 0x0070EC, 2, { 28, 48 } },
+    [258] = { 0xFFF40D, 2, { 31, 53 } },
+    [260] = { 0x00FCC3, 2, { 27, 30 } },
+    [261] = { 0x6C7700, 2, { 20, 22 } },
+    [262] = { 0x80765F, 2, { 2, 43 } },
+    [263] = { 0x8AF8D2, 2, { 9, 48 } },
+    [265] = { 0xDF994C, 2, { 5, 20 } },
+    [266] = { 0x202000, 2, { 34, 42 } },
+    [267] = { 0x4EA208, 2, { 12, 34 } },
+    [268] = { 0x8AF842, 2, { 9, 51 } },
+    [269] = { 0x81665F, 2, { 2, 39 } },
+    [271] = { 0x220000, 2, { 34, 38 } },
+    [274] = { 0x0E119B, 2, { 23, 30 } },
+    [275] = { 0x0E0DC0, 2, { 23, 49 } },
+    [276] = { 0x001C1A, 2, { 30, 55 } },
+    [278] = { 0x8706C0, 2, { 24, 32 } },
+    [279] = { 0x801633, 2, { 2, 28 } },
+    [281] = { 0x040002, 2, { 37, 54 } },
+    [282] = { 0x8DD441, 2, { 15, 32 } },
+    [283] = { 0x8DB21E, 2, { 2, 15 } },
+    [286] = { 0xD09051, 2, { 11, 15 } },
+    [287] = { 0xAFF55C, 2, { 5, 51 } },
+    [288] = { 0x0DC85A, 2, { 15, 30 } },
+    [289] = { 0x1BA8C2, 2, { 14, 49 } },
+    [290] = { 0x457829, 2, { 10, 45 } },
+    [291] = { 0x00E0C8, 2, { 27, 51 } },
+    [292] = { 0x6E42D0, 2, { 12, 27 } },
+    [293] = { 0xE4092D, 2, { 8, 23 } },
+    [294] = { 0xE119B0, 2, { 19, 26 } },
+    [296] = { 0x0706D0, 2, { 24, 51 } },
+    [297] = { 0xDD5410, 2, { 11, 43 } },
+    [298] = { 0xB7375B, 2, { 2, 13 } },
+    [300] = { 0xBFC90B, 2, { 3, 50 } },
+    [301] = { 0x038360, 1, { 25, -1 } },
+    [302] = { 0x4C5224, 2, { 6, 14 } },
+    [303] = { 0xEA1514, 2, { 11, 13 } },
+    [305] = { 0x3E4408, 2, { 18, 55 } },
+    [306] = { 0xDD4414, 2, { 11, 53 } },
+    [308] = { 0x002100, 2, { 42, 47 } },
+    [309] = { 0x8AB852, 2, { 9, 41 } },
+    [311] = { 0x453C29, 2, { 10, 41 } },
+    [313] = { 0xE0DC00, 2, { 19, 45 } },
+    [314] = { 0x00306C, 2, { 28, 41 } },
+    [318] = { 0x200008, 2, { 34, 52 } },
+    [319] = { 0xEA00AD, 2, { 8, 45 } },
+    [320] = { 0xF92812, 2, { 16, 29 } },
+    [321] = { 0x7C8813, 2, { 17, 55 } },
+    [322] = { 0xA19BF6, 2, { 0, 4 } },
+    [324] = { 0x400800, 2, { 33, 44 } },
+    [325] = { 0x2CFB93, 2, { 7, 24 } },
+    [326] = { 0x408000, 2, { 33, 40 } },
+    [327] = { 0x0746C0, 2, { 24, 41 } },
+    [329] = { 0x1C1B00, 1, { 22, -1 } },
+    [330] = { 0xA01E91, 1, { 4, -1 } },
+    [331] = { 0x3E3465, 2, { 18, 28 } },
+    [333] = { 0x000108, 2, { 47, 52 } },
+    [334] = { 0x002002, 2, { 42, 54 } },
+    [335] = { 0x7F9256, 2, { 2, 31 } },
+    [336] = { 0x2E4409, 2, { 18, 35 } },
+    [337] = { 0x100040, 2, { 35, 49 } },
+    [338] = { 0xD16B23, 2, { 3, 12 } },
+    [339] = { 0x218567, 2, { 0, 34 } },
+    [341] = { 0x020100, 2, { 38, 47 } },
+    [342] = { 0x000A00, 2, { 44, 46 } },
+    [343] = { 0xB83600, 2, { 21, 32 } },
+    [346] = { 0xFF48DB, 2, { 1, 28 } },
+    [347] = { 0x375104, 1, { 13, -1 } },
+    [348] = { 0x3BFD53, 2, { 7, 35 } },
+    [349] = { 0x8BE3C2, 2, { 4, 7 } },
+    [350] = { 0x008200, 2, { 40, 46 } },
+    [351] = { 0x00A0D8, 2, { 27, 41 } },
+    [352] = { 0x55FAA6, 2, { 6, 38 } },
+    [353] = { 0x6A04AD, 2, { 8, 32 } },
+    [355] = { 0x915601, 2, { 12, 31 } },
+    [356] = { 0x0AF852, 2, { 9, 32 } },
+    [357] = { 0x401C1B, 2, { 30, 33 } },
+    [359] = { 0xE0D810, 2, { 19, 51 } },
+    [360] = { 0x96E352, 2, { 9, 22 } },
+    [362] = { 0x000041, 2, { 49, 55 } },
+    [363] = { 0x018547, 2, { 0, 50 } },
+    [364] = { 0xFEF409, 2, { 31, 39 } },
+    [368] = { 0x3EA4D1, 2, { 18, 27 } },
+    [369] = { 0xEEA208, 2, { 12, 32 } },
+    [370] = { 0x0DD451, 2, { 15, 51 } },
+    [371] = { 0x00000A, 2, { 52, 54 } },
+    [373] = { 0x1E0D80, 2, { 23, 35 } },
+    [376] = { 0x020002, 2, { 38, 54 } },
+    [377] = { 0x070640, 2, { 24, 48 } },
+    [378] = { 0x01C1A0, 2, { 26, 51 } },
+    [380] = { 0xFFE409, 2, { 31, 43 } },
+    [384] = { 0xBF492B, 2, { 3, 40 } },
+    [385] = { 0xF910A4, 2, { 16, 48 } },
+    [386] = { 0xFFB8B7, 2, { 1, 40 } },
+    [387] = { 0xD07291, 2, { 4, 20 } },
+    [388] = { 0xE4D800, 2, { 19, 37 } },
+    [389] = { 0xF1F989, 2, { 23, 31 } },
+    [390] = { 0x20706C, 2, { 28, 34 } },
+    [391] = { 0x57DAA6, 2, { 6, 42 } },
+    [392] = { 0xBFC12B, 2, { 3, 44 } },
+    [393] = { 0x001E1B, 2, { 30, 46 } },
+    [394] = { 0x6A62F2, 2, { 2, 8 } },
+    [395] = { 0x7E4409, 2, { 18, 33 } },
+    [396] = { 0x387600, 2, { 21, 41 } },
+    [397] = { 0x80665B, 2, { 2, 53 } },
+    [398] = { 0xDC4410, 2, { 11, 39 } },
+    [399] = { 0xA2210D, 2, { 5, 15 } },
+    [400] = { 0x06C770, 2, { 24, 26 } },
+    [401] = { 0x000100, 1, { 47, -1 } },
+    [402] = { 0x70701B, 2, { 20, 30 } },
+    [403] = { 0x1CFBD8, 2, { 22, 27 } },
+    [404] = { 0x018360, 2, { 25, 38 } },
+    [405] = { 0x008004, 2, { 40, 53 } },
+    [406] = { 0xFCBBD7, 2, { 1, 25 } },
+    [407] = { 0x0E0D81, 2, { 23, 55 } },
+    [408] = { 0x776AC0, 2, { 20, 24 } },
+    [409] = { 0x0776AC, 2, { 24, 28 } },
+    [410] = { 0x706C40, 2, { 20, 49 } },
+    [411] = { 0x001800, 2, { 43, 44 } },
+    [412] = { 0xDDA4C8, 2, { 11, 27 } },
+    [413] = { 0x1BA883, 2, { 14, 55 } },
+    [414] = { 0x400020, 2, { 33, 50 } },
+    [415] = { 0x0C15F1, 2, { 15, 26 } },
+    [416] = { 0x3E4609, 2, { 18, 46 } },
+    [417] = { 0x000804, 2, { 44, 53 } },
+    [418] = { 0x590EB5, 2, { 4, 16 } },
+    [419] = { 0x6EBE13, 2, { 12, 30 } },
+    [420] = { 0xF2ECF6, 2, { 1, 15 } },
+    [422] = { 0xFFF449, 2, { 31, 49 } },
+    [423] = { 0x6EA608, 2, { 12, 45 } },
+    [424] = { 0x000220, 2, { 46, 50 } },
+    [425] = { 0x6EE208, 2, { 12, 41 } },
+    [426] = { 0xAF1594, 2, { 5, 27 } },
+    [427] = { 0xC51A76, 2, { 2, 10 } },
+    [429] = { 0x7F0B72, 2, { 17, 25 } },
+    [430] = { 0x009000, 2, { 40, 43 } },
+    [431] = { 0x010800, 2, { 39, 44 } },
+    [432] = { 0x090B40, 2, { 23, 24 } },
+    [433] = { 0xFE716E, 2, { 0, 31 } },
+    [436] = { 0xE204AD, 2, { 8, 36 } },
+    [437] = { 0x200000, 1, { 34, -1 } },
+    [440] = { 0xFF38B5, 2, { 1, 54 } },
+    [442] = { 0x010567, 2, { 0, 40 } },
+    [443] = { 0x0181B0, 2, { 26, 41 } },
+    [444] = { 0x82F852, 2, { 9, 36 } },
+    [445] = { 0x018000, 2, { 39, 40 } },
+    [446] = { 0xA0FE49, 2, { 4, 27 } },
+    [447] = { 0x383610, 2, { 21, 51 } },
+    [448] = { 0x355104, 2, { 13, 38 } },
+    [449] = { 0xC15F10, 2, { 11, 22 } },
+    [450] = { 0x480000, 2, { 33, 36 } },
+    [451] = { 0x239E82, 2, { 14, 21 } },
+    [452] = { 0xC7C209, 2, { 21, 31 } },
+    [453] = { 0x81A7EF, 2, { 2, 26 } },
+    [454] = { 0x011C1B, 2, { 30, 39 } },
+    [455] = { 0xCEBC99, 2, { 4, 12 } },
+    [456] = { 0x53FAA6, 2, { 6, 37 } },
+    [457] = { 0x3C3600, 2, { 21, 37 } },
+    [458] = { 0xE45C8B, 2, { 14, 31 } },
+    [459] = { 0x72B908, 2, { 12, 22 } },
+    [460] = { 0x306C00, 2, { 20, 33 } },
+    [461] = { 0x0726C0, 2, { 24, 42 } },
+    [462] = { 0x100001, 2, { 35, 55 } },
+    [463] = { 0x80645F, 2, { 2, 46 } },
+    [464] = { 0xC12624, 2, { 16, 21 } },
+    [465] = { 0xE0F800, 2, { 19, 42 } },
+    [466] = { 0x457D29, 2, { 10, 47 } },
+    [467] = { 0x6EA218, 2, { 12, 51 } },
+    [468] = { 0xEA048D, 2, { 8, 50 } },
+    [469] = { 0x0DF441, 2, { 15, 42 } },
+    [470] = { 0x657C29, 2, { 10, 34 } },
+    [471] = { 0xBFF409, 2, { 31, 33 } },
+    [472] = { 0xA10501, 2, { 7, 9 } },
+    [473] = { 0xAAF852, 2, { 9, 34 } },
+    [475] = { 0xDD4450, 2, { 11, 49 } },
+    [476] = { 0x457C09, 2, { 10, 50 } },
+    [477] = { 0x6D2168, 2, { 12, 25 } },
+    [479] = { 0xE0D808, 2, { 19, 52 } },
+    [480] = { 0x00716C, 2, { 28, 47 } },
+    [481] = { 0x3E5409, 2, { 18, 43 } },
+    [482] = { 0xEA05AD, 2, { 8, 47 } },
+    [483] = { 0x001C1F, 2, { 30, 53 } },
+    [484] = { 0x8AF952, 2, { 9, 47 } },
+    [485] = { 0x0DD449, 2, { 15, 52 } },
+    [486] = { 0x00485A, 2, { 28, 29 } },
+    [487] = { 0x0CE412, 2, { 17, 20 } },
+    [488] = { 0x000002, 1, { 54, -1 } },
+    [489] = { 0x0706C8, 2, { 24, 52 } },
+    [490] = { 0x69BEAF, 2, { 6, 18 } },
+    [491] = { 0x791024, 2, { 16, 32 } },
+    [492] = { 0x080200, 2, { 36, 46 } },
+    [493] = { 0x00704C, 2, { 28, 50 } },
+    [494] = { 0x1C6B6C, 2, { 22, 28 } },
+    [495] = { 0xDF38B7, 2, { 1, 34 } },
+    [496] = { 0xE2D800, 2, { 19, 38 } },
+    [497] = { 0x227CA7, 2, { 1, 11 } },
+    [498] = { 0x457C2B, 2, { 10, 54 } },
+    [499] = { 0x0FD441, 2, { 15, 38 } },
+    [500] = { 0x001020, 2, { 43, 50 } },
+    [501] = { 0x728592, 2, { 17, 23 } },
+    [502] = { 0xFEBDD0, 2, { 0, 1 } },
+    [503] = { 0x000024, 2, { 50, 53 } },
+    [504] = { 0x897C24, 2, { 16, 20 } },
+    [505] = { 0xFF8465, 2, { 28, 31 } },
+    [506] = { 0xAFF54C, 1, { 5, -1 } },
+    [507] = { 0x20E0D8, 2, { 27, 34 } },
+    [508] = { 0x3E440D, 2, { 18, 53 } },
+    [509] = { 0x87609F, 2, { 2, 24 } },
+    [510] = { 0x3F4409, 2, { 18, 39 } },
+    [511] = { 0x00B836, 2, { 29, 40 } },
+    [512] = { 0x01F986, 2, { 26, 29 } },
+    [514] = { 0xA1DF21, 2, { 4, 26 } },
+    [515] = { 0x90665F, 2, { 2, 35 } },
+    [518] = { 0x00E1D8, 2, { 27, 47 } },
+    [519] = { 0xD8EE00, 2, { 19, 21 } },
+    [520] = { 0x8ABEB6, 2, { 6, 11 } },
+    [522] = { 0x9D4410, 2, { 11, 33 } },
+    [523] = { 0x0383E0, 2, { 25, 48 } },
+    [524] = { 0x00706E, 2, { 28, 54 } },
+    [525] = { 0xA06EFD, 2, { 4, 28 } },
+    [526] = { 0xEA04AF, 2, { 8, 54 } },
+    [527] = { 0x57BAA6, 2, { 6, 41 } },
+    [531] = { 0x706C01, 2, { 20, 55 } },
+    [532] = { 0x181B00, 2, { 22, 37 } },
+    [533] = { 0xE3EF09, 2, { 22, 31 } },
+    [534] = { 0x563B16, 2, { 6, 26 } },
+    [535] = { 0x2A3CE3, 2, { 7, 26 } },
+    [536] = { 0x375184, 2, { 13, 48 } },
+    [541] = { 0x010020, 2, { 39, 50 } },
+    [543] = { 0x103C67, 2, { 3, 5 } },
+    [544] = { 0x3E7C3F, 2, { 18, 29 } },
+    [545] = { 0x4BD916, 2, { 13, 17 } },
+    [546] = { 0x383608, 2, { 21, 52 } },
+    [547] = { 0x42CC1B, 2, { 17, 18 } },
+    [548] = { 0x335104, 2, { 13, 37 } },
+    [549] = { 0x1C2336, 2, { 22, 29 } },
+    [550] = { 0xC00000, 2, { 32, 33 } },
+    [551] = { 0x1C1B80, 2, { 22, 48 } },
+    [552] = { 0x081000, 2, { 36, 43 } },
+    [553] = { 0x01997C, 2, { 0, 30 } },
+    [557] = { 0x3A3600, 2, { 21, 38 } },
+    [558] = { 0x003834, 2, { 29, 54 } },
+    [559] = { 0x00E0DA, 2, { 27, 54 } },
+    [561] = { 0x4F2D4C, 2, { 5, 19 } },
+    [563] = { 0x080004, 2, { 36, 53 } },
+    [567] = { 0x457429, 2, { 10, 44 } },
+    [568] = { 0x800200, 2, { 32, 46 } },
+    [569] = { 0x1FD7BA, 2, { 3, 4 } },
+    [570] = { 0xF11024, 2, { 16, 36 } },
+    [571] = { 0x8F54B7, 2, { 1, 20 } },
+    [573] = { 0x090000, 2, { 36, 39 } },
+    [576] = { 0xDC85A0, 2, { 11, 26 } },
+    [578] = { 0x0DD441, 1, { 15, -1 } },
+    [581] = { 0x21C1B0, 2, { 26, 34 } },
+    [582] = { 0xA01E81, 2, { 4, 51 } },
+    [583] = { 0xE0D800, 1, { 19, -1 } },
+    [584] = { 0x1B90B4, 2, { 14, 29 } },
+    [585] = { 0x000C1B, 2, { 30, 43 } },
+    [586] = { 0x8AF052, 2, { 9, 44 } },
+    [588] = { 0xDD02F4, 2, { 6, 9 } },
+    [590] = { 0x37E653, 2, { 7, 22 } },
+    [591] = { 0x000840, 2, { 44, 49 } },
+    [592] = { 0xAB9B0C, 2, { 2, 7 } },
+    [593] = { 0x0706C0, 1, { 24, -1 } },
+    [594] = { 0x400400, 2, { 33, 45 } },
+    [595] = { 0x008040, 2, { 40, 49 } },
+    [597] = { 0x404000, 2, { 33, 41 } },
+    [598] = { 0x98A448, 2, { 5, 13 } },
+    [600] = { 0xDD4411, 2, { 11, 55 } },
+    [602] = { 0x01C190, 2, { 26, 50 } },
+    [605] = { 0xB1C4AB, 2, { 3, 23 } },
+    [606] = { 0x8A7852, 2, { 9, 40 } },
+    [608] = { 0xF91124, 2, { 16, 47 } },
+    [609] = { 0x7C8810, 2, { 17, 54 } },
+    [611] = { 0x0060D8, 2, { 27, 40 } },
+    [612] = { 0xADF54C, 2, { 5, 38 } },
+    [613] = { 0xFAB502, 2, { 3, 10 } },
+    [614] = { 0x8DFE92, 2, { 9, 24 } },
+    [615] = { 0x000600, 2, { 45, 46 } },
+    [619] = { 0x004200, 2, { 41, 46 } },
+    [620] = { 0xA5A429, 2, { 10, 19 } },
+    [621] = { 0xF91004, 2, { 16, 50 } },
+    [624] = { 0x304989, 2, { 18, 23 } },
+    [625] = { 0xAFF544, 2, { 5, 52 } },
+    [626] = { 0xA01A91, 2, { 4, 45 } },
+    [627] = { 0x5ED4AB, 2, { 10, 14 } },
+    [629] = { 0x371104, 2, { 13, 41 } },
+    [630] = { 0x083836, 2, { 29, 36 } },
+    [631] = { 0x4E2809, 2, { 18, 20 } },
+    [632] = { 0x001C5B, 2, { 30, 49 } },
+    [633] = { 0x400010, 2, { 33, 51 } },
+    [634] = { 0x01C1B2, 2, { 26, 54 } },
+    [636] = { 0x225F09, 2, { 18, 22 } },
+    [637] = { 0x071ADB, 2, { 24, 30 } },
+    [638] = { 0x807A44, 2, { 2, 30 } },
+    [639] = { 0xBFC92A, 2, { 3, 55 } },
+    [641] = { 0x59F726, 2, { 6, 23 } },
+    [643] = { 0x801000, 2, { 32, 43 } },
+    [646] = { 0xF91026, 2, { 16, 54 } },
+    [647] = { 0xAFD54C, 2, { 5, 42 } },
+    [648] = { 0xFF3CB7, 2, { 1, 45 } },
+    [649] = { 0x7C8832, 2, { 17, 50 } },
+    [650] = { 0xAFC92B, 2, { 3, 35 } },
+    [651] = { 0x200080, 2, { 34, 48 } },
+    [652] = { 0x13CB53, 2, { 7, 21 } },
+    [653] = { 0x808687, 2, { 2, 27 } },
+    [654] = { 0x800004, 2, { 32, 53 } },
+    [655] = { 0xFF24AC, 2, { 1, 30 } },
+    [656] = { 0x000180, 2, { 47, 48 } },
+    [657] = { 0xFF78B7, 2, { 1, 41 } },
+    [658] = { 0xEBC51D, 2, { 8, 26 } },
+    [659] = { 0x383600, 1, { 21, -1 } },
+    [660] = { 0x440000, 2, { 33, 37 } },
+    [661] = { 0x810000, 2, { 32, 39 } },
+    [662] = { 0x000404, 2, { 45, 53 } },
+    [664] = { 0x7CB024, 2, { 17, 29 } },
+    [665] = { 0x3E4449, 2, { 18, 49 } },
+    [666] = { 0x7C68CA, 2, { 17, 27 } },
+    [667] = { 0x201E91, 2, { 4, 32 } },
+    [668] = { 0x2BFD51, 2, { 7, 54 } },
+    [669] = { 0x0506C0, 2, { 24, 38 } },
+    [670] = { 0x2AE6C3, 2, { 4, 9 } },
+    [671] = { 0x000210, 2, { 46, 51 } },
+    [675] = { 0x5C8812, 2, { 17, 34 } },
+    [676] = { 0x005000, 2, { 41, 43 } },
+    [678] = { 0x000060, 2, { 49, 50 } },
+    [680] = { 0x0E8D80, 2, { 23, 40 } },
+    [683] = { 0x108000, 2, { 35, 40 } },
+    [684] = { 0x0141B0, 2, { 26, 40 } },
+    [685] = { 0x001400, 2, { 43, 45 } },
+    [687] = { 0x040200, 2, { 37, 46 } },
+    [688] = { 0x018566, 2, { 0, 55 } },
+    [689] = { 0x57FBA6, 2, { 6, 47 } },
+    [690] = { 0x77FAA6, 2, { 6, 34 } },
+    [691] = { 0x100800, 2, { 35, 44 } },
+    [692] = { 0xAE1311, 2, { 4, 23 } },
+    [694] = { 0x6EA208, 1, { 12, -1 } },
+    [695] = { 0x2BFD73, 2, { 7, 50 } },
+    [697] = { 0x35E241, 2, { 15, 21 } },
+    [698] = { 0x004004, 2, { 41, 53 } },
+    [699] = { 0xEA8965, 2, { 5, 10 } },
+    [700] = { 0xFF3837, 2, { 1, 48 } },
+    [701] = { 0x010400, 2, { 39, 45 } },
+    [702] = { 0x919ABF, 2, { 1, 12 } },
+    [703] = { 0xE49035, 2, { 1, 14 } },
+    [704] = { 0x57FA86, 2, { 6, 50 } },
+    [705] = { 0x014000, 2, { 39, 41 } },
+    [706] = { 0x080040, 2, { 36, 49 } },
+    [709] = { 0x2BFC53, 2, { 7, 47 } },
+    [711] = { 0x0ADCAD, 2, { 8, 19 } },
+    [713] = { 0xABF54C, 2, { 5, 37 } },
+    [714] = { 0x1BA880, 2, { 14, 54 } },
+    [715] = { 0xFFC92B, 2, { 3, 33 } },
+    [716] = { 0x1CAC57, 2, { 7, 13 } },
+    [717] = { 0x15F0A4, 2, { 8, 31 } },
+    [718] = { 0xD4095A, 2, { 7, 31 } },
+    [719] = { 0x0BFD53, 2, { 7, 34 } },
+    [721] = { 0x041000, 2, { 37, 43 } },
+    [722] = { 0xFFCC3F, 2, { 29, 31 } },
+    [723] = { 0xA1F8CC, 2, { 5, 23 } },
+    [724] = { 0x238360, 2, { 25, 34 } },
+    [725] = { 0x000801, 2, { 44, 55 } },
+    [727] = { 0x803836, 2, { 29, 32 } },
+    [728] = { 0x008001, 2, { 40, 55 } },
+    [729] = { 0x141B00, 2, { 22, 36 } },
+    [730] = { 0xE30019, 2, { 11, 18 } },
+    [731] = { 0x402000, 2, { 33, 42 } },
+    [732] = { 0x001010, 2, { 43, 51 } },
+    [733] = { 0x0E0DA0, 2, { 23, 50 } },
+    [734] = { 0xBFCB2B, 2, { 3, 46 } },
+    [735] = { 0xAFF5CC, 2, { 5, 48 } },
+    [737] = { 0x101C1B, 2, { 30, 35 } },
+    [740] = { 0x7D49A2, 2, { 17, 26 } },
+    [742] = { 0x000014, 2, { 51, 53 } },
+    [743] = { 0xD78904, 2, { 13, 19 } },
+    [744] = { 0x0E0C80, 2, { 23, 47 } },
+    [745] = { 0x010010, 2, { 39, 51 } },
+    [748] = { 0x1BA8A2, 2, { 14, 50 } },
+    [749] = { 0x01F50B, 2, { 0, 28 } },
+    [750] = { 0x400008, 2, { 33, 52 } },
+    [752] = { 0x0F88E7, 2, { 0, 23 } },
+    [754] = { 0x000082, 2, { 48, 54 } },
+    [755] = { 0x002200, 2, { 42, 46 } },
+    [757] = { 0x038340, 2, { 25, 50 } },
+    [760] = { 0x062893, 2, { 1, 16 } },
+    [761] = { 0x3C1B00, 2, { 22, 34 } },
+    [765] = { 0x420000, 2, { 33, 38 } },
+    [767] = { 0x040004, 2, { 37, 53 } },
+    [768] = { 0x1FE0B7, 2, { 1, 19 } },
+    [769] = { 0x70EC00, 2, { 20, 40 } },
+    [772] = { 0xEEC457, 2, { 2, 12 } },
+    [773] = { 0x000208, 2, { 46, 52 } },
+    [774] = { 0xD4C5E4, 2, { 1, 7 } },
+    [776] = { 0x038362, 2, { 25, 54 } },
+    [777] = { 0x2B72B4, 2, { 6, 17 } },
+    [778] = { 0xAFB54C, 2, { 5, 41 } },
+    [780] = { 0x100020, 2, { 35, 50 } },
+    [781] = { 0x59F30C, 2, { 12, 13 } },
+    [782] = { 0x003C36, 2, { 29, 45 } },
+    [783] = { 0x7B3820, 2, { 10, 18 } },
+    [784] = { 0xAFF14C, 2, { 5, 45 } },
+    [786] = { 0x050000, 2, { 37, 39 } },
+    [788] = { 0x381600, 2, { 21, 42 } },
+    [789] = { 0x0306C0, 2, { 24, 37 } },
+    [790] = { 0x020200, 2, { 38, 46 } },
+    [791] = { 0xFC8812, 2, { 17, 32 } },
+    [792] = { 0xFFFC09, 2, { 31, 44 } },
+    [793] = { 0x018767, 2, { 0, 46 } },
+    [794] = { 0x6CA208, 2, { 12, 38 } },
+    [795] = { 0x8A883E, 2, { 9, 28 } },
+    [796] = { 0x577AA6, 2, { 6, 40 } },
+    [797] = { 0x83B0A5, 2, { 1, 17 } },
+    [798] = { 0xA01F91, 2, { 4, 47 } },
+    [799] = { 0x6E8208, 2, { 12, 42 } },
+    [800] = { 0x57F2A6, 2, { 6, 44 } },
+    [801] = { 0x6EA200, 2, { 12, 52 } },
+    [802] = { 0x39F7B0, 2, { 21, 26 } },
+    [803] = { 0xEA04AC, 2, { 8, 55 } },
+    [804] = { 0x0D8EE0, 2, { 23, 25 } },
+    [805] = { 0x007836, 2, { 29, 41 } },
+    [806] = { 0xBFD92B, 2, { 3, 43 } },
+    [807] = { 0xE0E036, 2, { 19, 29 } },
+    [808] = { 0x457C28, 2, { 10, 55 } },
+    [809] = { 0x418567, 2, { 0, 33 } },
+    [810] = { 0xFF38BF, 2, { 1, 52 } },
+    [811] = { 0xE0D880, 2, { 19, 48 } },
+    [812] = { 0x000021, 2, { 50, 55 } },
+    [813] = { 0x1C1B02, 2, { 22, 54 } },
+    [814] = { 0x806E5F, 2, { 2, 44 } },
+    [815] = { 0xBFC92F, 2, { 3, 53 } },
+    [816] = { 0xEED580, 2, { 19, 23 } },
+    [817] = { 0x80E65F, 2, { 2, 40 } },
+    [818] = { 0x0EED58, 2, { 23, 27 } },
+    [819] = { 0x1BB499, 2, { 14, 30 } },
+    [820] = { 0x5D224F, 2, { 2, 11 } },
+    [821] = { 0x800040, 2, { 32, 49 } },
+    [822] = { 0x003000, 2, { 42, 43 } },
+    [823] = { 0x72B15C, 2, { 5, 11 } },
+    [824] = { 0x018527, 2, { 0, 49 } },
+    [825] = { 0x2FF54C, 2, { 5, 32 } },
+    [826] = { 0x09D441, 2, { 15, 37 } },
+    [827] = { 0x0DD4C1, 2, { 15, 48 } },
+    [828] = { 0x182BE2, 2, { 14, 25 } },
+    [829] = { 0x57C290, 2, { 6, 29 } },
+    [830] = { 0x375106, 2, { 13, 54 } },
+    [831] = { 0x3055D1, 2, { 7, 14 } },
+    [832] = { 0x002004, 2, { 42, 53 } },
+    [833] = { 0x7C8C12, 2, { 17, 45 } },
+    [834] = { 0x030360, 2, { 25, 40 } },
+    [835] = { 0x180000, 2, { 35, 36 } },
+    [836] = { 0xA8C211, 2, { 1, 6 } },
+    [837] = { 0xB21D6A, 2, { 3, 15 } },
+    [838] = { 0x012000, 2, { 39, 42 } },
+    [839] = { 0x706C20, 2, { 20, 50 } },
+    [842] = { 0xDD4C10, 2, { 11, 44 } },
+    [843] = { 0xABFD53, 2, { 7, 32 } },
+    [844] = { 0x382A1B, 2, { 21, 30 } },
+    [845] = { 0x7CC812, 2, { 17, 41 } },
+    [846] = { 0xDD7C26, 2, { 11, 29 } },
+    [849] = { 0x0165BF, 2, { 0, 27 } },
+    [851] = { 0xA01E93, 2, { 4, 54 } },
+    [853] = { 0x00000C, 2, { 52, 53 } },
+    [854] = { 0xDDC410, 2, { 11, 40 } },
+    [855] = { 0x021000, 2, { 38, 43 } },
+    [857] = { 0x019567, 2, { 0, 43 } },
+    [858] = { 0x010008, 2, { 39, 52 } },
+    [859] = { 0xFE16E4, 2, { 16, 24 } },
+    [860] = { 0x000440, 2, { 45, 49 } },
+    [861] = { 0xE09800, 2, { 19, 41 } },
+    [862] = { 0x5F112B, 2, { 3, 19 } },
+    [863] = { 0x080001, 2, { 36, 55 } },
+    [864] = { 0x1C1300, 2, { 22, 44 } },
+    [865] = { 0x001008, 2, { 43, 52 } },
+    [866] = { 0x400000, 1, { 33, -1 } },
+    [867] = { 0x0D9441, 2, { 15, 41 } },
+    [869] = { 0x0702C0, 2, { 24, 45 } },
+    [870] = { 0x004040, 2, { 41, 49 } },
+    [871] = { 0x0DD041, 2, { 15, 45 } },
+    [872] = { 0x030000, 2, { 38, 39 } },
+    [873] = { 0x020004, 2, { 38, 53 } },
+    [874] = { 0xA461A9, 2, { 3, 14 } },
+    [875] = { 0x80665D, 2, { 2, 54 } },
+    [876] = { 0x8E0D80, 2, { 23, 32 } },
+    [877] = { 0x200100, 2, { 34, 47 } },
+    [880] = { 0x383680, 2, { 21, 48 } },
+    [881] = { 0xFFF429, 2, { 31, 50 } },
+    [884] = { 0x506C00, 2, { 20, 34 } },
+    [885] = { 0x9BA882, 2, { 14, 32 } },
+    [886] = { 0x000200, 1, { 46, -1 } },
+    [887] = { 0xED0C41, 2, { 15, 19 } },
+    [888] = { 0x39F43B, 2, { 10, 17 } },
+    [889] = { 0x121680, 2, { 22, 23 } },
+    [890] = { 0xF6B943, 2, { 7, 11 } },
+    [891] = { 0x043836, 2, { 29, 37 } },
+    [896] = { 0x6AA208, 2, { 12, 37 } },
+    [898] = { 0xA01691, 2, { 4, 44 } },
+    [900] = { 0x6EA288, 2, { 12, 48 } },
+    [901] = { 0x60D800, 2, { 19, 32 } },
+    [902] = { 0x000050, 2, { 49, 51 } },
+    [903] = { 0x473D04, 2, { 13, 20 } },
+    [905] = { 0x457E29, 2, { 10, 46 } },
+    [906] = { 0xCAF852, 2, { 9, 33 } },
+    [907] = { 0xDFF409, 2, { 31, 34 } },
+    [908] = { 0x80667F, 2, { 2, 50 } },
+    [910] = { 0xA39DF1, 2, { 4, 25 } },
+    [911] = { 0x023836, 2, { 29, 38 } },
+    [912] = { 0x786C00, 2, { 20, 36 } },
+    [913] = { 0x40706C, 2, { 28, 33 } },
+    [914] = { 0x00726C, 2, { 28, 46 } },
+    [915] = { 0xE57210, 2, { 11, 21 } },
+    [916] = { 0xAFE957, 2, { 5, 30 } },
+    [917] = { 0xA7F54C, 2, { 5, 36 } },
+    [918] = { 0xFF38B7, 1, { 1, -1 } },
+    [919] = { 0x200002, 2, { 34, 54 } },
+    [920] = { 0x900000, 2, { 32, 35 } },
+    [921] = { 0x0E4D80, 2, { 23, 41 } },
+    [922] = { 0x872C13, 2, { 9, 15 } },
+    [923] = { 0x0090B4, 2, { 27, 28 } },
+    [924] = { 0x0683A7, 2, { 0, 24 } },
+    [925] = { 0xBEC92B, 2, { 3, 39 } },
+    [926] = { 0xC869B3, 2, { 1, 13 } },
+    [927] = { 0x000102, 2, { 47, 54 } },
+    [928] = { 0x1BE882, 2, { 14, 41 } },
+    [929] = { 0x245434, 2, { 11, 16 } },
+    [930] = { 0x8AFA52, 2, { 9, 46 } },
+    [931] = { 0xDD4430, 2, { 11, 50 } },
+    [932] = { 0x040040, 2, { 37, 49 } },
+    [935] = { 0x383200, 2, { 21, 45 } },
+    [936] = { 0x8AF812, 2, { 9, 49 } },
+    [937] = { 0x90B400, 2, { 19, 20 } },
+    [938] = { 0x750C5B, 2, { 9, 31 } },
+    [939] = { 0xED026D, 2, { 8, 24 } },
+    [940] = { 0x40E0D8, 2, { 27, 33 } },
+    [944] = { 0x07B382, 2, { 14, 22 } },
+    [946] = { 0x2FFD53, 2, { 7, 37 } },
+    [947] = { 0x00702C, 2, { 28, 49 } },
+    [948] = { 0x800001, 2, { 32, 55 } },
+    [949] = { 0x7DB841, 2, { 15, 20 } },
+    [950] = { 0x1BAC82, 2, { 14, 45 } },
+    [951] = { 0xEA06AD, 2, { 8, 46 } },
+    [952] = { 0x88665F, 2, { 2, 36 } },
+    [955] = { 0x00383E, 2, { 29, 52 } },
+    [956] = { 0x001000, 1, { 43, -1 } },
+    [958] = { 0x37B1DC, 2, { 13, 27 } },
+    [960] = { 0x0E0D90, 2, { 23, 51 } },
+    [961] = { 0xF22048, 2, { 15, 31 } },
+    [963] = { 0x0E0D00, 2, { 23, 48 } },
+    [964] = { 0x008800, 2, { 40, 44 } },
+    [965] = { 0xFC7769, 2, { 25, 31 } },
+    [966] = { 0x000004, 1, { 53, -1 } },
+    [967] = { 0x00E2D8, 2, { 27, 46 } },
+    [968] = { 0xE91024, 2, { 16, 35 } },
+    [969] = { 0x7CA812, 2, { 17, 42 } },
+    [970] = { 0x19C824, 2, { 16, 19 } },
+    [971] = { 0x104000, 2, { 35, 41 } },
+    [972] = { 0x010000, 1, { 39, -1 } },
+    [973] = { 0x100400, 2, { 35, 45 } },
+    [974] = { 0x008567, 2, { 0, 39 } },
+    [975] = { 0x1BA892, 2, { 14, 51 } },
+    [977] = { 0xBFC96B, 2, { 3, 49 } },
+    [978] = { 0x00E098, 2, { 27, 49 } },
+    [980] = { 0xE8338D, 2, { 3, 6 } },
+    [984] = { 0x457C2D, 2, { 10, 53 } },
+    [985] = { 0x1BA802, 2, { 14, 48 } },
+    [986] = { 0x018563, 2, { 0, 53 } },
+    [987] = { 0xDA42D0, 2, { 11, 24 } },
+    [988] = { 0xD37D5E, 2, { 5, 17 } },
+    [992] = { 0x000401, 2, { 45, 55 } },
+    [993] = { 0xEA14AD, 2, { 8, 43 } },
+    [994] = { 0x38D6D8, 2, { 21, 27 } },
+    [995] = { 0xAFF54E, 2, { 5, 54 } },
+    [998] = { 0x1FA882, 2, { 14, 37 } },
+    [999] = { 0x7C881A, 2, { 17, 52 } },
+    [1000] = { 0xE50B24, 2, { 16, 22 } },
+    [1002] = { 0xF06C00, 2, { 20, 32 } },
+    [1003] = { 0x44F94E, 2, { 0, 10 } },
+    [1004] = { 0x50E601, 2, { 12, 18 } },
+    [1005] = { 0x7E8812, 2, { 17, 38 } },
+    [1006] = { 0x8AF856, 2, { 9, 53 } },
+    [1007] = { 0x05D441, 2, { 15, 36 } },
+    [1008] = { 0x004001, 2, { 41, 55 } },
+    [1009] = { 0x100010, 2, { 35, 51 } },
+    [1010] = { 0xEB04AD, 2, { 8, 39 } },
+    [1011] = { 0x01706C, 2, { 28, 39 } },
+    [1012] = { 0x009C1B, 2, { 30, 40 } },
+    [1013] = { 0xC6EC92, 2, { 11, 14 } },
+    [1014] = { 0x8BF852, 2, { 9, 39 } },
+    [1015] = { 0x41C1B0, 2, { 26, 33 } },
+    [1017] = { 0x002040, 2, { 42, 49 } },
+    [1018] = { 0x8F9809, 2, { 20, 31 } },
+    [1019] = { 0x01BD51, 2, { 0, 29 } },
+    [1021] = { 0x000048, 2, { 49, 52 } },
+    [1024] = { 0x2BFD5B, 2, { 7, 52 } },
+    [1025] = { 0x03F30C, 2, { 25, 28 } },
+    [1027] = { 0xFD38B7, 2, { 1, 38 } },
+    [1028] = { 0x303600, 2, { 21, 36 } },
+    [1029] = { 0x2DD441, 2, { 15, 34 } },
+    [1030] = { 0x3E4C09, 2, { 18, 44 } },
+    [1031] = { 0xA026A7, 2, { 4, 29 } },
+    [1032] = { 0xEB81CA, 2, { 0, 8 } },
+    [1033] = { 0x456032, 2, { 10, 30 } },
+    [1034] = { 0x0707C0, 2, { 24, 47 } },
+    [1035] = { 0x020040, 2, { 38, 49 } },
+    [1036] = { 0x000011, 2, { 51, 55 } },
+    [1037] = { 0xE45A5A, 2, { 9, 12 } },
+    [1038] = { 0x140000, 2, { 35, 37 } },
+    [1039] = { 0x3EC409, 2, { 18, 40 } },
+    [1041] = { 0x00F0D8, 2, { 27, 43 } },
+    [1043] = { 0x8E6BDF, 2, { 2, 23 } },
+    [1044] = { 0xF91224, 2, { 16, 46 } },
+    [1045] = { 0x000820, 2, { 44, 50 } },
+    [1046] = { 0x01E0D8, 2, { 27, 39 } },
+    [1047] = { 0xB8505F, 2, { 2, 21 } },
+    [1049] = { 0xAF754C, 2, { 5, 40 } },
+    [1052] = { 0x1C071B, 2, { 22, 30 } },
+    [1053] = { 0x008020, 2, { 40, 50 } },
+    [1054] = { 0x0E2D80, 2, { 23, 42 } },
+    [1055] = { 0x003836, 1, { 29, -1 } },
+    [1057] = { 0x5A2EE7, 2, { 6, 15 } },
+    [1058] = { 0xFF18B7, 2, { 1, 42 } },
+    [1059] = { 0x2706C0, 2, { 24, 34 } },
+    [1063] = { 0x001C19, 2, { 30, 54 } },
+    [1065] = { 0x01C3B0, 2, { 26, 46 } },
+    [1066] = { 0x60BE5F, 2, { 2, 19 } },
+    [1068] = { 0x47FAA6, 2, { 6, 35 } },
+    [1069] = { 0x5479C6, 2, { 6, 25 } },
+    [1070] = { 0x040001, 2, { 37, 55 } },
+    [1071] = { 0xE0D802, 2, { 19, 54 } },
+    [1072] = { 0xAC762C, 2, { 5, 25 } },
+    [1073] = { 0x00E0DC, 2, { 27, 53 } },
+    [1077] = { 0x0706C2, 2, { 24, 54 } },
+    [1079] = { 0x0DD541, 2, { 15, 47 } },
+    [1080] = { 0x0DD443, 2, { 15, 54 } },
+    [1081] = { 0xE0D900, 2, { 19, 47 } },
+    [1082] = { 0x1BA88A, 2, { 14, 52 } },
+    [1083] = { 0x0E0D88, 2, { 23, 52 } },
+    [1084] = { 0x2078CE, 2, { 2, 4 } },
+    [1085] = { 0x0DA42D, 2, { 15, 28 } },
+    [1087] = { 0x400080, 2, { 33, 48 } },
+    [1088] = { 0x080800, 2, { 36, 44 } },
+    [1089] = { 0x706C10, 2, { 20, 51 } },
+    [1090] = { 0x001C3B, 2, { 30, 50 } },
+    [1091] = { 0x002001, 2, { 42, 55 } },
+    [1092] = { 0x859836, 2, { 16, 17 } },
+    [1093] = { 0x982891, 2, { 4, 21 } },
+    [1094] = { 0xFB38B7, 2, { 1, 37 } },
+    [1098] = { 0x66A208, 2, { 12, 36 } },
+    [1099] = { 0x01C1B4, 2, { 26, 53 } },
+    [1100] = { 0x007068, 2, { 28, 53 } },
+    [1101] = { 0x383700, 2, { 21, 47 } },
+    [1102] = { 0x447C29, 2, { 10, 39 } },
+    [1103] = { 0x38466C, 2, { 21, 28 } },
+    [1104] = { 0x01D1B0, 2, { 26, 43 } },
+    [1105] = { 0x000280, 2, { 46, 48 } },
+    [1106] = { 0x102000, 2, { 35, 42 } },
+    [1107] = { 0x39B367, 2, { 0, 21 } },
+    [1108] = { 0x7C8812, 1, { 17, -1 } },
+    [1110] = { 0x088000, 2, { 36, 40 } },
+    [1111] = { 0xFFF419, 2, { 31, 51 } },
+    [1114] = { 0x456C29, 2, { 10, 43 } },
+    [1116] = { 0x97B22C, 2, { 12, 16 } },
+    [1117] = { 0x746C00, 2, { 20, 37 } },
+    [1118] = { 0xB4BC5B, 2, { 9, 18 } },
+    [1119] = { 0x7D0D75, 2, { 0, 17 } },
+    [1120] = { 0x9E5A98, 2, { 4, 18 } },
+    [1121] = { 0x3E4429, 2, { 18, 50 } },
+    [1122] = { 0x100008, 2, { 35, 52 } },
+    [1123] = { 0x000040, 1, { 49, -1 } },
+    [1125] = { 0xE05800, 2, { 19, 40 } },
+    [1126] = { 0xEA04A9, 2, { 8, 53 } },
+    [1127] = { 0x081C1B, 2, { 30, 36 } },
+    [1128] = { 0x459CF1, 2, { 10, 27 } },
+    [1129] = { 0x8AE852, 2, { 9, 43 } },
+    [1130] = { 0x00606C, 2, { 28, 43 } },
+    [1131] = { 0x118567, 2, { 0, 35 } },
+    [1133] = { 0xE0D000, 2, { 19, 44 } },
+    [1134] = { 0x2BC565, 2, { 7, 29 } },
+    [1136] = { 0x0D5441, 2, { 15, 40 } },
+    [1137] = { 0x0C1B00, 2, { 22, 35 } },
+    [1138] = { 0xF8F2C9, 2, { 24, 31 } },
+    [1139] = { 0x120000, 2, { 35, 38 } },
+    [1140] = { 0x000009, 2, { 52, 55 } },
+    [1141] = { 0xADCAD0, 2, { 4, 15 } },
+    [1142] = { 0xAE702B, 2, { 0, 5 } },
+    [1143] = { 0x383602, 2, { 21, 54 } },
+    [1144] = { 0xFE35B9, 2, { 26, 31 } },
+    [1145] = { 0x1E4409, 2, { 18, 34 } },
+    [1146] = { 0x6EA308, 2, { 12, 47 } },
+    [1147] = { 0x3FAF74, 2, { 2, 3 } },
+    [1148] = { 0xB8CFEB, 2, { 3, 24 } },
+    [1149] = { 0xA01E90, 2, { 4, 55 } },
+    [1150] = { 0x2BFD53, 1, { 7, -1 } },
+    [1151] = { 0x7CF87E, 2, { 17, 28 } },
+    [1152] = { 0xFF38A7, 2, { 1, 51 } },
+    [1153] = { 0x457C69, 2, { 10, 49 } },
+    [1154] = { 0x84665F, 2, { 2, 37 } },
+    [1155] = { 0x275104, 2, { 13, 35 } },
+    [1156] = { 0x363B80, 2, { 21, 23 } },
+    [1157] = { 0x438360, 2, { 25, 33 } },
+    [1158] = { 0x6FCCA6, 2, { 6, 21 } },
+    [1159] = { 0xA3D22B, 2, { 3, 22 } },
+    [1164] = { 0x020001, 2, { 38, 55 } },
+    [1166] = { 0x46D90F, 2, { 3, 16 } },
+    [1169] = { 0x372168, 2, { 13, 28 } },
+    [1176] = { 0x001080, 2, { 43, 48 } },
+    [1177] = { 0x6EA20A, 2, { 12, 54 } },
+    [1178] = { 0xF61FAD, 2, { 8, 22 } },
+    [1179] = { 0x001836, 2, { 29, 42 } },
+    [1181] = { 0x020607, 2, { 0, 25 } },
+    [1182] = { 0xE7DEC0, 2, { 19, 24 } },
+    [1183] = { 0xEA04ED, 2, { 8, 49 } },
+    [1186] = { 0x800800, 2, { 32, 44 } },
+    [1187] = { 0x080020, 2, { 36, 50 } },
+    [1188] = { 0x000084, 2, { 48, 53 } },
+    [1189] = { 0x50CDFB, 2, { 1, 5 } },
+    [1190] = { 0x0E0D80, 1, { 23, -1 } },
+    [1191] = { 0x010080, 2, { 39, 48 } },
+    [1194] = { 0x808000, 2, { 32, 40 } },
+    [1195] = { 0x5C1B00, 2, { 22, 33 } },
+    [1196] = { 0xF89543, 2, { 0, 16 } },
+    [1197] = { 0x1BA882, 1, { 14, -1 } },
+    [1198] = { 0x7C9409, 2, { 17, 30 } },
+    [1200] = { 0x4B71A9, 2, { 10, 23 } },
+    [1201] = { 0xD232AD, 2, { 8, 21 } },
+    [1202] = { 0x057C29, 2, { 10, 33 } },
+    [1205] = { 0x706C08, 2, { 20, 52 } },
+    [1206] = { 0xFA9452, 2, { 9, 20 } },
+    [1209] = { 0x038320, 2, { 25, 49 } },
+    [1212] = { 0x775104, 2, { 13, 33 } },
+    [1213] = { 0xE323B7, 2, { 1, 22 } },
+    [1216] = { 0x353179, 2, { 3, 9 } },
+    [1217] = { 0x726C00, 2, { 20, 38 } },
+    [1218] = { 0x0E7DEC, 2, { 23, 28 } },
+    [1219] = { 0x29FD53, 2, { 7, 38 } },
+    [1220] = { 0x000001, 1, { 55, -1 } },
+    [1222] = { 0x00C1B0, 2, { 26, 39 } },
+    [1223] = { 0xAA04AD, 2, { 8, 33 } },
+    [1224] = { 0x0363B8, 2, { 25, 27 } },
+    [1226] = { 0x3BB560, 2, { 21, 25 } },
+    [1228] = { 0x6ED264, 2, { 12, 28 } },
+    [1229] = { 0x801C1B, 2, { 30, 32 } },
+    [1230] = { 0x000C00, 2, { 44, 45 } },
+    [1231] = { 0x6E2208, 2, { 12, 40 } },
+    [1233] = { 0x628D3B, 2, { 3, 11 } },
+    [1234] = { 0x375304, 2, { 13, 46 } },
+    [1235] = { 0x004800, 2, { 41, 44 } },
+    [1236] = { 0x0485A0, 2, { 24, 25 } },
+    [1238] = { 0xE01E91, 2, { 4, 33 } },
+    [1239] = { 0x008400, 2, { 40, 45 } },
+    [1240] = { 0x100000, 1, { 35, -1 } },
+    [1241] = { 0x7F38B7, 2, { 1, 32 } },
+    [1243] = { 0x00C000, 2, { 40, 41 } },
+    [1244] = { 0xF81024, 2, { 16, 39 } },
+    [1245] = { 0xF91020, 2, { 16, 53 } },
+    [1246] = { 0x039360, 2, { 25, 43 } },
+    [1248] = { 0x60AF88, 2, { 12, 23 } },
+    [1249] = { 0x395C84, 2, { 13, 23 } },
+    [1250] = { 0xC7542D, 2, { 16, 18 } },
+    [1252] = { 0x00242D, 2, { 29, 30 } },
+    [1254] = { 0xDD6410, 2, { 11, 42 } },
+    [1255] = { 0x0044D7, 2, { 0, 26 } },
+    [1256] = { 0x82665F, 2, { 2, 38 } },
+    [1257] = { 0xBE4409, 2, { 18, 32 } },
+    [1258] = { 0xFFE812, 2, { 30, 31 } },
+    [1260] = { 0x9C5012, 2, { 17, 19 } },
+    [1261] = { 0xBFD530, 2, { 3, 30 } },
+    [1262] = { 0x557C29, 2, { 10, 35 } },
+    [1263] = { 0xBDA956, 2, { 9, 13 } },
+    [1264] = { 0x800020, 2, { 32, 50 } },
+    [1265] = { 0xF90024, 2, { 16, 43 } },
+    [1266] = { 0x003826, 2, { 29, 51 } },
+    [1268] = { 0x0E35B6, 2, { 23, 29 } },
+    [1269] = { 0x0038B6, 2, { 29, 48 } },
+    [1270] = { 0xDD4418, 2, { 11, 52 } },
+    [1271] = { 0x983839, 2, { 10, 11 } },
+    [1272] = { 0x44BE12, 2, { 17, 21 } },
+    [1273] = { 0x609312, 2, { 17, 22 } },
+    [1274] = { 0x3942C9, 2, { 18, 24 } },
+    [1275] = { 0x000810, 2, { 44, 51 } },
+    [1276] = { 0x005C1B, 2, { 30, 41 } },
+    [1277] = { 0x10706C, 2, { 28, 35 } },
+    [1278] = { 0x038364, 2, { 25, 53 } },
+    [1279] = { 0xC15744, 2, { 5, 12 } },
+    [1280] = { 0x84F5D2, 2, { 9, 23 } },
+    [1281] = { 0xFFD86F, 2, { 1, 27 } },
+    [1282] = { 0x2BDD53, 2, { 7, 42 } },
+    [1283] = { 0x008010, 2, { 40, 51 } },
+    [1285] = { 0xFA04AD, 2, { 8, 35 } },
+    [1286] = { 0xDF4410, 2, { 11, 38 } },
+    [1287] = { 0x01C1F0, 2, { 26, 49 } },
+    [1288] = { 0x9AF852, 2, { 9, 35 } },
+    [1289] = { 0x455F5B, 2, { 7, 12 } },
+    [1292] = { 0x040800, 2, { 37, 44 } },
+    [1293] = { 0x0C0D80, 2, { 23, 38 } },
+    [1294] = { 0x788812, 2, { 17, 37 } },
+    [1295] = { 0x2B1D8B, 2, { 7, 27 } },
+    [1296] = { 0x25EC8B, 2, { 14, 18 } },
+    [1297] = { 0x00CCBE, 2, { 1, 31 } },
+    [1298] = { 0x600000, 2, { 33, 34 } },
+    [1299] = { 0xE0C41B, 2, { 19, 30 } },
+    [1300] = { 0x1C1B04, 2, { 22, 53 } },
+    [1301] = { 0xE0A86C, 2, { 19, 28 } },
+    [1302] = { 0x00706D, 2, { 28, 55 } },
+    [1303] = { 0x88982F, 2, { 3, 13 } },
+    [1304] = { 0x2796A6, 2, { 6, 20 } },
+    [1307] = { 0x1A2DE5, 2, { 0, 14 } },
+    [1308] = { 0x400100, 2, { 33, 47 } },
+    [1309] = { 0x19A882, 2, { 14, 38 } },
+    [1310] = { 0x048000, 2, { 37, 40 } },
+    [1311] = { 0x3E4419, 2, { 18, 51 } },
+    [1312] = { 0x55CD86, 2, { 3, 8 } },
+    [1313] = { 0x46FF49, 2, { 10, 25 } },
+    [1316] = { 0x000420, 2, { 45, 50 } },
+    [1318] = { 0x6E817A, 2, { 7, 10 } },
+    [1319] = { 0x706C00, 1, { 20, -1 } },
+    [1320] = { 0x10E0D8, 2, { 27, 35 } },
+    [1321] = { 0x200200, 2, { 34, 46 } },
+    [1322] = { 0xA11E91, 2, { 4, 39 } },
+    [1323] = { 0xA01E95, 2, { 4, 53 } },
+    [1325] = { 0x004020, 2, { 41, 50 } },
+    [1326] = { 0xA71851, 2, { 4, 24 } },
+    [1327] = { 0xF8D194, 2, { 16, 26 } },
+    [1328] = { 0xF738B7, 2, { 1, 36 } },
+    [1329] = { 0x000300, 2, { 46, 47 } },
+    [1330] = { 0x56FAA6, 2, { 6, 39 } },
+    [1331] = { 0x1B8882, 2, { 14, 42 } },
+    [1332] = { 0xB3EE4C, 2, { 5, 22 } },
+    [1333] = { 0x0FEBDD, 2, { 4, 5 } },
+    [1334] = { 0x7C8802, 2, { 17, 51 } },
+    [1335] = { 0x041C1B, 2, { 30, 37 } },
+    [1336] = { 0x7D5A81, 2, { 4, 11 } },
+    [1337] = { 0x7C8892, 2, { 17, 48 } },
+    [1338] = { 0xFFF409, 1, { 31, -1 } },
+    [1339] = { 0xEA74C1, 2, { 8, 28 } },
+    [1340] = { 0x57FAA2, 2, { 6, 53 } },
+    [1341] = { 0x00E0D9, 2, { 27, 55 } },
+    [1342] = { 0x880000, 2, { 32, 36 } },
+    [1343] = { 0x403D22, 2, { 3, 31 } },
+    [1344] = { 0xB91024, 2, { 16, 33 } },
+    [1345] = { 0x80665F, 1, { 2, -1 } },
+    [1346] = { 0x57EAA6, 2, { 6, 43 } },
+    [1348] = { 0xF96048, 2, { 16, 28 } },
+    [1349] = { 0x400002, 2, { 33, 54 } },
+    [1352] = { 0x0000C0, 2, { 48, 49 } },
+    [1353] = { 0x9A68AD, 2, { 8, 20 } },
+    [1354] = { 0x8AF853, 2, { 9, 55 } },
+    [1357] = { 0x084000, 2, { 36, 41 } },
+    [1358] = { 0x84081F, 2, { 5, 7 } },
+    [1359] = { 0x2BFDD3, 2, { 7, 48 } },
+    [1360] = { 0x1D1B00, 2, { 22, 39 } },
+    [1361] = { 0x3E5812, 2, { 18, 30 } },
+    [1362] = { 0xBA8820, 2, { 10, 31 } },
+    [1363] = { 0x000030, 2, { 50, 51 } },
+    [1369] = { 0x002800, 2, { 42, 44 } },
+    [1370] = { 0x000202, 2, { 46, 54 } },
+    [1371] = { 0x028360, 2, { 25, 39 } },
+    [1372] = { 0xFF39B7, 2, { 1, 47 } },
+    [1373] = { 0x080400, 2, { 36, 45 } },
+    [1374] = { 0x020800, 2, { 38, 44 } },
+    [1377] = { 0xEFF54C, 2, { 5, 33 } },
+    [1378] = { 0x000808, 2, { 44, 52 } },
+    [1379] = { 0x00A000, 2, { 40, 42 } },
+    [1380] = { 0x0DD440, 2, { 15, 55 } },
+    [1381] = { 0xFF3897, 2, { 1, 50 } },
+    [1383] = { 0x040020, 2, { 37, 50 } },
+    [1384] = { 0x0A0D80, 2, { 23, 37 } },
+    [1385] = { 0xDD4410, 1, { 11, -1 } },
+    [1386] = { 0x897B32, 2, { 9, 25 } },
+    [1387] = { 0x50FC66, 2, { 6, 24 } },
+    [1388] = { 0x2BFD43, 2, { 7, 51 } },
+    [1389] = { 0x201000, 2, { 34, 43 } },
+    [1390] = { 0x57FAE6, 2, { 6, 49 } },
+    [1391] = { 0x11C1B0, 2, { 26, 35 } },
+    [1392] = { 0x6BC482, 2, { 14, 20 } },
+    [1395] = { 0xC1F9FE, 2, { 7, 8 } },
+    [1396] = { 0x008008, 2, { 40, 52 } },
+    [1397] = { 0xAFF74C, 2, { 5, 46 } },
+    [1398] = { 0x200004, 2, { 34, 53 } },
+    [1399] = { 0xBDFE0B, 2, { 6, 8 } },
+    [1400] = { 0x001100, 2, { 43, 47 } },
+    [1401] = { 0xF91064, 2, { 16, 49 } },
+    [1402] = { 0x1D9E67, 2, { 0, 22 } },
+    [1405] = { 0x968CBF, 2, { 8, 17 } },
+    [1406] = { 0x210000, 2, { 34, 39 } },
+    [1407] = { 0x567FC1, 2, { 0, 6 } },
+    [1408] = { 0x003C1B, 2, { 30, 42 } },
+    [1409] = { 0x028000, 2, { 38, 40 } },
+    [1410] = { 0x2BBD53, 2, { 7, 41 } },
+    [1411] = { 0xBFC929, 2, { 3, 54 } },
+    [1412] = { 0x01C1B1, 2, { 26, 55 } },
+    [1413] = { 0x3D9C10, 2, { 11, 19 } },
+    [1414] = { 0x2CF986, 2, { 13, 14 } },
+    [1415] = { 0x080010, 2, { 36, 51 } },
+    [1416] = { 0x84A6A5, 2, { 8, 12 } },
+    [1417] = { 0x010100, 2, { 39, 47 } },
+    [1419] = { 0x57F8A6, 2, { 6, 46 } },
+    [1420] = { 0x365104, 2, { 13, 39 } },
+    [1421] = { 0x018D67, 2, { 0, 44 } },
+    [1423] = { 0x15B95A, 2, { 7, 18 } },
+    [1424] = { 0xAFF50C, 2, { 5, 49 } },
+    [1426] = { 0x2BF953, 2, { 7, 45 } },
+    [1427] = { 0x038160, 2, { 25, 46 } },
+    [1431] = { 0xF91025, 2, { 16, 55 } },
+    [1432] = { 0x2BE148, 2, { 7, 30 } },
+    [1433] = { 0x000104, 2, { 47, 53 } },
+    [1434] = { 0x375100, 2, { 13, 53 } },
+    [1435] = { 0x1C0B00, 2, { 22, 43 } },
+    [1436] = { 0x374104, 2, { 13, 43 } },
+    [1437] = { 0x17FAA6, 2, { 6, 33 } },
+    [1438] = { 0xFDF409, 2, { 31, 38 } },
+    [1439] = { 0x45441F, 2, { 10, 29 } },
+    [1440] = { 0x021C1B, 2, { 30, 38 } },
+    [1441] = { 0x001002, 2, { 43, 54 } },
+    [1443] = { 0x0C0000, 2, { 36, 37 } },
+    [1444] = { 0x806657, 2, { 2, 52 } },
+    [1445] = { 0xA00E91, 2, { 4, 43 } },
+    [1446] = { 0x3E6409, 2, { 18, 42 } },
+    [1447] = { 0xE987CD, 2, { 8, 25 } },
+    [1449] = { 0x704C00, 2, { 20, 42 } },
+    [1450] = { 0xBFC82B, 2, { 3, 47 } },
+    [1451] = { 0x000006, 2, { 53, 54 } },
+    [1453] = { 0xFFF401, 2, { 31, 52 } },
+    [1456] = { 0x4706C0, 2, { 24, 33 } },
+    [1457] = { 0x9FC92B, 2, { 3, 34 } },
+    [1458] = { 0x800400, 2, { 32, 45 } },
+    [1459] = { 0x283600, 2, { 21, 35 } },
+    [1460] = { 0x010002, 2, { 39, 54 } },
+    [1461] = { 0x002020, 2, { 42, 50 } },
+    [1462] = { 0x100080, 2, { 35, 48 } },
+    [1463] = { 0x804000, 2, { 32, 41 } },
+    [1464] = { 0x1C1B40, 2, { 22, 49 } },
+    [1466] = { 0xFF30B7, 2, { 1, 44 } },
+    [1468] = { 0x018565, 2, { 0, 54 } },
+    [1469] = { 0x0E0980, 2, { 23, 45 } },
+    [1470] = { 0x3958AE, 2, { 6, 12 } },
+    [1471] = { 0x4DD441, 2, { 15, 33 } },
+    [1472] = { 0xFFD409, 2, { 31, 42 } },
+    [1476] = { 0x203836, 2, { 29, 34 } },
+    [1477] = { 0x485A00, 2, { 20, 21 } },
+    [1478] = { 0xFA9344, 2, { 16, 25 } },
+    [1479] = { 0xE0DA00, 2, { 19, 46 } },
+    [1480] = { 0xFF14D1, 2, { 27, 31 } },
+    [1482] = { 0x0DD641, 2, { 15, 46 } },
+    [1484] = { 0x003936, 2, { 29, 47 } },
+    [1485] = { 0xAE34FC, 2, { 5, 26 } },
+    [1487] = { 0x000081, 2, { 48, 55 } },
+    [1488] = { 0x80465F, 2, { 2, 42 } },
+    [1489] = { 0xA01ED1, 2, { 4, 49 } },
+    [1490] = { 0x020020, 2, { 38, 50 } },
+    [1491] = { 0x1C1900, 2, { 22, 46 } },
+    [1492] = { 0xD2ED77, 2, { 7, 16 } },
+    [1493] = { 0x000800, 1, { 44, -1 } },
+    [1494] = { 0xC70EB7, 2, { 1, 21 } },
+    [1495] = { 0xCFA52B, 2, { 3, 20 } },
+    [1496] = { 0x03D9C1, 2, { 15, 23 } },
+    [1497] = { 0x003816, 2, { 29, 50 } },
+    [1499] = { 0x1BD8EE, 2, { 14, 28 } },
+    [1501] = { 0x800010, 2, { 32, 51 } },
+    [1502] = { 0x122A1A, 2, { 12, 17 } },
+    [1504] = { 0x018467, 2, { 0, 47 } },
+    [1505] = { 0x000028, 2, { 50, 52 } },
+    [1506] = { 0xE7D0EC, 2, { 8, 15 } },
+    [1508] = { 0x082000, 2, { 36, 42 } },
+    [1509] = { 0x008000, 1, { 40, -1 } },
+    [1510] = { 0x748812, 2, { 17, 36 } },
+    [1511] = { 0x0DD401, 2, { 15, 49 } },
+    [1514] = { 0x070680, 2, { 24, 49 } },
+    [1516] = { 0xA01C91, 2, { 4, 46 } },
+    [1519] = { 0x004400, 2, { 41, 45 } },
+    [1521] = { 0x57FAA7, 2, { 6, 55 } },
+    [1522] = { 0x375144, 2, { 13, 49 } },
+    [1524] = { 0x0C5126, 2, { 0, 15 } },
+    [1525] = { 0x783600, 2, { 21, 33 } },
+    [1529] = { 0x45FC29, 2, { 10, 40 } },
+    [1530] = { 0x840000, 2, { 32, 37 } },
+    [1533] = { 0x637649, 2, { 12, 15 } },
+    [1534] = { 0x080008, 2, { 36, 52 } },
+    [1536] = { 0x098567, 2, { 0, 36 } },
+    [1537] = { 0x75C0E5, 2, { 1, 9 } },
+    [1538] = { 0x00786C, 2, { 28, 44 } },
+    [1539] = { 0x22B019, 2, { 11, 31 } },
+    [1540] = { 0xFBF409, 2, { 31, 37 } },
+    [1541] = { 0x722D2D, 2, { 10, 13 } },
+    [1542] = { 0x0A0000, 2, { 36, 38 } },
+    [1543] = { 0xEA0CAD, 2, { 8, 44 } },
+    [1544] = { 0x001C1B, 1, { 30, -1 } },
+    [1545] = { 0x7C8912, 2, { 17, 47 } },
+    [1546] = { 0x000410, 2, { 45, 51 } },
+    [1547] = { 0x00F06C, 2, { 28, 40 } },
+    [1548] = { 0x138360, 2, { 25, 35 } },
+    [1549] = { 0x3FC16E, 2, { 0, 18 } },
+    [1550] = { 0xBC4A4B, 2, { 3, 25 } },
+    [1551] = { 0x004010, 2, { 41, 51 } },
+    [1552] = { 0xEA84AD, 2, { 8, 40 } },
+    [1553] = { 0x0706C4, 2, { 24, 53 } },
+    [1554] = { 0xF80FEA, 2, { 5, 6 } },
+    [1555] = { 0xE0D804, 2, { 19, 53 } },
+    [1556] = { 0xE1D800, 2, { 19, 39 } },
+    [1557] = { 0xFFF489, 2, { 31, 48 } },
+    [1558] = { 0x0DD445, 2, { 15, 53 } },
+    [1559] = { 0x23FD53, 2, { 7, 36 } },
+    [1560] = { 0x038361, 2, { 25, 55 } },
+    [1561] = { 0xAEF54C, 2, { 5, 39 } },
+    [1563] = { 0xF67040, 2, { 9, 17 } },
+    [1564] = { 0xAEEA82, 2, { 6, 16 } },
+    [1565] = { 0x0716C0, 2, { 24, 43 } },
+    [1566] = { 0x200040, 2, { 34, 49 } },
+    [1567] = { 0xBFB947, 2, { 3, 28 } },
+    [1568] = { 0x8066DF, 2, { 2, 48 } },
+    [1569] = { 0xE15D67, 2, { 0, 19 } },
+    [1570] = { 0x060D80, 2, { 23, 36 } },
+    [1571] = { 0x1C1B01, 2, { 22, 55 } },
+    [1572] = { 0x040400, 2, { 37, 45 } },
+    [1575] = { 0x00E8D8, 2, { 27, 44 } },
+    [1576] = { 0x3E4409, 1, { 18, -1 } },
+    [1577] = { 0x044000, 2, { 37, 41 } },
+    [1578] = { 0x000140, 2, { 47, 49 } },
+    [1580] = { 0xAF7884, 2, { 8, 10 } },
+    [1583] = { 0xA0028A, 2, { 4, 30 } },
+    [1584] = { 0x80664F, 2, { 2, 51 } },
+    [1585] = { 0xD94410, 2, { 11, 37 } },
+    [1586] = { 0x706C80, 2, { 20, 48 } },
+    [1588] = { 0x003036, 2, { 29, 44 } },
+    [1589] = { 0x706800, 2, { 20, 45 } },
+    [1590] = { 0x000020, 1, { 50, -1 } },
+    [1592] = { 0xAFF548, 2, { 5, 53 } },
+    [1593] = { 0x802000, 2, { 32, 42 } },
+    [1595] = { 0x702C00, 2, { 20, 41 } },
+    [1596] = { 0xBE4C4C, 2, { 0, 3 } },
+    [1597] = { 0xB01E91, 2, { 4, 35 } },
+    [1598] = { 0xDD0410, 2, { 11, 41 } },
+    [1599] = { 0x56E568, 2, { 5, 16 } },
+    [1600] = { 0x13A882, 2, { 14, 36 } },
+    [1601] = { 0xAFE54C, 2, { 5, 43 } },
+    [1602] = { 0x943478, 2, { 3, 7 } },
+    [1603] = { 0x2E0D80, 2, { 23, 34 } },
+    [1605] = { 0x01C9B0, 2, { 26, 44 } },
+    [1606] = { 0x1B1DC0, 2, { 22, 24 } },
+    [1607] = { 0x8AF850, 2, { 9, 54 } },
+    [1609] = { 0xAF8520, 2, { 5, 28 } },
+    [1610] = { 0xCE4120, 2, { 13, 16 } },
+    [1612] = { 0xFFB409, 2, { 31, 41 } },
+    [1614] = { 0xFFF009, 2, { 31, 45 } },
+    [1615] = { 0x73EF60, 2, { 20, 25 } },
+    [1616] = { 0x36D463, 2, { 0, 13 } },
+    [1617] = { 0x800008, 2, { 32, 52 } },
+    [1618] = { 0xAD2810, 2, { 11, 20 } },
+    [1619] = { 0x000042, 2, { 49, 54 } },
+    [1620] = { 0x375105, 2, { 13, 55 } },
+    [1621] = { 0xBC6C0D, 2, { 10, 16 } },
+    [1622] = { 0x040010, 2, { 37, 51 } },
+    [1623] = { 0xDD4400, 2, { 11, 51 } },
+    [1624] = { 0x80265F, 2, { 2, 41 } },
+    [1625] = { 0x7D4A29, 2, { 10, 21 } },
+    [1626] = { 0x383604, 2, { 21, 53 } },
+    [1627] = { 0xDD4490, 2, { 11, 48 } },
+    [1628] = { 0xBFCD2B, 2, { 3, 45 } },
+    [1629] = { 0x80625F, 2, { 2, 45 } },
+    [1630] = { 0x820000, 2, { 32, 38 } },
+    [1631] = { 0x3BA882, 2, { 14, 34 } },
+    [1632] = { 0x073EF6, 2, { 24, 29 } },
+    [1634] = { 0x393600, 2, { 21, 39 } },
+    [1636] = { 0x8AF872, 2, { 9, 50 } },
+    [1637] = { 0x01B1DC, 2, { 26, 28 } },
+    [1638] = { 0x376932, 2, { 13, 29 } },
+    [1639] = { 0x1DDAB0, 2, { 22, 26 } },
+    [1640] = { 0x002400, 2, { 42, 45 } },
+    [1641] = { 0xBA449E, 2, { 1, 10 } },
+    [1642] = { 0x1BA982, 2, { 14, 47 } },
+    [1643] = { 0x0242D0, 2, { 25, 26 } },
+    [1644] = { 0x006000, 2, { 41, 42 } },
+    [1645] = { 0x818567, 2, { 0, 32 } },
+    [1646] = { 0x7C0812, 2, { 17, 40 } },
+    [1647] = { 0x080000, 1, { 36, -1 } },
+    [1648] = { 0xB3E618, 2, { 11, 12 } },
+    [1649] = { 0x7C8012, 2, { 17, 44 } },
+    [1650] = { 0x5FEA98, 2, { 4, 31 } },
+    [1651] = { 0x6EB208, 2, { 12, 43 } },
+    [1652] = { 0x000408, 2, { 45, 52 } },
+    [1653] = { 0x7FF409, 2, { 31, 32 } },
+    [1654] = { 0x3057C4, 2, { 13, 24 } },
+    [1656] = { 0x60ABA2, 2, { 6, 13 } },
+    [1657] = { 0xCB2553, 2, { 7, 19 } },
+    [1658] = { 0x001C13, 2, { 30, 52 } },
+    [1659] = { 0xCA04AD, 2, { 8, 34 } },
+    [1660] = { 0xDD4010, 2, { 11, 45 } },
+    [1661] = { 0x6EA20C, 2, { 12, 53 } },
+    [1662] = { 0x1CAE42, 2, { 14, 24 } },
+    [1663] = { 0xE562B8, 2, { 4, 10 } },
+    [1664] = { 0x0CD441, 2, { 15, 39 } },
+    [1665] = { 0x00E0F8, 2, { 27, 50 } },
+    [1666] = { 0x427AE9, 2, { 10, 24 } },
+    [1667] = { 0x9150D0, 2, { 9, 14 } },
+    [1668] = { 0x0606C0, 2, { 24, 39 } },
+    [1669] = { 0xF7E437, 2, { 4, 6 } },
+    [1670] = { 0xBFC93B, 2, { 3, 51 } },
+    [1671] = { 0xF91824, 2, { 16, 44 } },
+    [1672] = { 0xF99024, 2, { 16, 40 } },
+    [1674] = { 0x6F276F, 2, { 0, 12 } },
+    [1675] = { 0x020400, 2, { 38, 45 } },
+    [1676] = { 0x705436, 2, { 20, 29 } },
+    [1677] = { 0x4D7C29, 2, { 10, 36 } },
+    [1678] = { 0xE0C800, 2, { 19, 43 } },
+    [1679] = { 0x3C4409, 2, { 18, 38 } },
+    [1680] = { 0x100100, 2, { 35, 47 } },
+    [1681] = { 0x01C567, 2, { 0, 41 } },
+    [1682] = { 0x002010, 2, { 42, 51 } },
+    [1683] = { 0x3740BD, 2, { 8, 11 } },
+    [1684] = { 0x08706C, 2, { 28, 36 } },
+    [1685] = { 0x6FA208, 2, { 12, 39 } },
+    [1687] = { 0x004008, 2, { 41, 52 } },
+    [1688] = { 0x300000, 2, { 34, 35 } },
+    [1689] = { 0x2B7D53, 2, { 7, 40 } },
+    [1691] = { 0x3E4401, 2, { 18, 52 } },
+    [1693] = { 0x0DC441, 2, { 15, 43 } },
+    [1694] = { 0x0E0D82, 2, { 23, 54 } },
+    [1695] = { 0x00665F, 2, { 2, 32 } },
+    [1697] = { 0x2BF553, 2, { 7, 44 } },
+    [1698] = { 0x837C1B, 2, { 17, 31 } },
+    [1702] = { 0xBE2256, 2, { 2, 18 } },
+    [1704] = { 0x83E53F, 2, { 2, 25 } },
+    [1705] = { 0x5D4410, 2, { 11, 32 } },
+    [1706] = { 0x1F2C09, 2, { 19, 31 } },
+    [1708] = { 0x042000, 2, { 37, 42 } },
+    [1709] = { 0x000018, 2, { 51, 52 } },
+    [1710] = { 0xFF38B6, 2, { 1, 55 } },
+    [1711] = { 0x000101, 2, { 47, 55 } },
+    [1714] = { 0x08E0D8, 2, { 27, 36 } },
+    [1715] = { 0x200001, 2, { 34, 55 } },
+    [1716] = { 0x287E33, 2, { 7, 25 } },
+    [1719] = { 0x020010, 2, { 38, 51 } },
+    [1721] = { 0x100002, 2, { 35, 54 } },
+    [1722] = { 0xE0D840, 2, { 19, 49 } },
+    [1723] = { 0x60FCFF, 2, { 8, 9 } },
+    [1724] = { 0x018577, 2, { 0, 51 } },
+    [1725] = { 0x000880, 2, { 44, 48 } },
+    [1726] = { 0x024000, 2, { 38, 41 } },
+    [1727] = { 0x44BD99, 2, { 10, 26 } },
+    [1728] = { 0x040008, 2, { 37, 52 } },
+    [1729] = { 0x167CC3, 2, { 14, 15 } },
+    [1730] = { 0x1ECE08, 2, { 12, 20 } },
+    [1732] = { 0x800000, 1, { 32, -1 } },
+    [1733] = { 0x0E0580, 2, { 23, 44 } },
+    [1734] = { 0x1B2882, 2, { 14, 40 } },
+    [1735] = { 0xEF38B7, 2, { 1, 35 } },
+    [1736] = { 0x01C0B0, 2, { 26, 47 } },
+    [1737] = { 0x1BA082, 2, { 14, 44 } },
+    [1738] = { 0x008080, 2, { 40, 48 } },
+    [1741] = { 0xF7F409, 2, { 31, 36 } },
+    [1742] = { 0x80706C, 2, { 28, 32 } },
+    [1743] = { 0xBE089B, 2, { 3, 26 } },
+    [1744] = { 0xC57C29, 2, { 10, 32 } },
+    [1747] = { 0xBFF54C, 2, { 5, 35 } },
+    [1748] = { 0x060000, 2, { 37, 38 } },
+    [1749] = { 0x000003, 2, { 54, 55 } },
+    [1750] = { 0x058567, 2, { 0, 37 } },
+    [1751] = { 0x382600, 2, { 21, 43 } },
+    [1752] = { 0x400200, 2, { 33, 46 } },
+    [1753] = { 0x0704C0, 2, { 24, 46 } },
+    [1760] = { 0xBF29F3, 2, { 3, 27 } },
+    [1761] = { 0xBFE92B, 2, { 3, 42 } },
+    [1762] = { 0x0DEC77, 2, { 15, 29 } },
+    [1763] = { 0x706D00, 2, { 20, 47 } },
+    [1765] = { 0xC8A50D, 2, { 13, 31 } },
+    [1766] = { 0x571A7E, 2, { 6, 27 } },
+    [1767] = { 0x001C9B, 2, { 30, 48 } },
+    [1768] = { 0x09150D, 2, { 13, 18 } },
+    [1770] = { 0xA0D800, 2, { 19, 33 } },
+    [1772] = { 0x001C0B, 2, { 30, 51 } },
+    [1773] = { 0x71E967, 2, { 0, 20 } },
+    [1775] = { 0x242D00, 2, { 21, 22 } },
+    [1776] = { 0xAFF54D, 2, { 5, 55 } },
+    [1777] = { 0x3A4409, 2, { 18, 37 } },
+    [1778] = { 0xFFF509, 2, { 31, 47 } },
+    [1780] = { 0xD91024, 2, { 16, 34 } },
+    [1781] = { 0x73E876, 2, { 9, 16 } },
+    [1783] = { 0xF83E77, 2, { 1, 24 } },
+    [1784] = { 0x004000, 1, { 41, -1 } },
+    [1787] = { 0x000400, 1, { 45, -1 } },
+    [1789] = { 0xA0665F, 2, { 2, 34 } },
+    [1790] = { 0xDEC770, 2, { 11, 25 } },
+    [1792] = { 0x5F2626, 2, { 1, 4 } },
+    [1793] = { 0xD54410, 2, { 11, 36 } },
+    [1794] = { 0x7C07F5, 2, { 6, 7 } },
+    [1795] = { 0x457C39, 2, { 10, 51 } },
+    [1796] = { 0x002008, 2, { 42, 52 } },
+    [1797] = { 0x383640, 2, { 21, 49 } },
+    [1798] = { 0x8E7A08, 2, { 12, 19 } },
+    [1799] = { 0x038B60, 2, { 25, 44 } },
+    [1800] = { 0xC1B000, 2, { 18, 31 } },
+    [1801] = { 0x706C02, 2, { 20, 54 } },
+    [1802] = { 0x80675F, 2, { 2, 47 } },
+    [1803] = { 0x577541, 2, { 7, 17 } },
+    [1804] = { 0xF4C465, 2, { 15, 16 } },
+    [1805] = { 0xE0D801, 2, { 19, 55 } },
+    [1806] = { 0x3E4489, 2, { 18, 48 } },
+    [1807] = { 0x500145, 2, { 5, 31 } },
+    [1808] = { 0xDD4510, 2, { 11, 47 } },
+    [1809] = { 0x00E4D8, 2, { 27, 45 } },
+    [1810] = { 0x8AFC52, 2, { 9, 45 } },
+    [1811] = { 0x00746C, 2, { 28, 45 } },
+    [1812] = { 0x818D22, 2, { 3, 18 } },
+    [1813] = { 0x022000, 2, { 38, 42 } },
+    [1814] = { 0xFFF40B, 2, { 31, 54 } },
+    [1815] = { 0x57BC42, 2, { 9, 11 } },
+    [1816] = { 0x000010, 1, { 51, -1 } },
+    [1817] = { 0x401000, 2, { 33, 43 } },
+    [1818] = { 0xEA44AD, 2, { 8, 41 } },
+    [1819] = { 0x00181B, 2, { 30, 45 } },
+    [1820] = { 0x01A567, 2, { 0, 42 } },
+    [1821] = { 0xFD4410, 2, { 11, 34 } },
+    [1822] = { 0x57FAA4, 2, { 6, 54 } },
+    [1823] = { 0x383400, 2, { 21, 46 } },
+    [1824] = { 0x040000, 1, { 37, -1 } },
+    [1825] = { 0xDE9C09, 2, { 18, 19 } },
+    [1826] = { 0x1706C0, 2, { 24, 35 } },
+    [1827] = { 0x3E4009, 2, { 18, 45 } },
+    [1828] = { 0x020008, 2, { 38, 52 } },
+    [1829] = { 0x4A1A3C, 2, { 4, 8 } },
+    [1830] = { 0x6EA008, 2, { 12, 46 } },
+    [1831] = { 0x09C1B0, 2, { 26, 36 } },
+    [1832] = { 0x400004, 2, { 33, 53 } },
+    [1833] = { 0xD79CF9, 2, { 2, 6 } },
+    [1834] = { 0x569408, 2, { 12, 21 } },
+    [1835] = { 0xE2B8A6, 2, { 14, 16 } },
+    [1836] = { 0x6EA248, 2, { 12, 49 } },
+    [1837] = { 0x01856F, 2, { 0, 52 } },
+    [1838] = { 0x410000, 2, { 33, 39 } },
+    [1839] = { 0x1DD441, 2, { 15, 35 } },
+    [1840] = { 0x039F7B, 2, { 25, 30 } },
+    [1841] = { 0x3E0409, 2, { 18, 41 } },
+    [1842] = { 0xF0D800, 2, { 19, 35 } },
+    [1843] = { 0x00D8EE, 2, { 27, 29 } },
+    [1844] = { 0x672090, 2, { 14, 17 } },
+    [1845] = { 0xF90C3F, 2, { 16, 30 } },
+    [1846] = { 0x001200, 2, { 43, 46 } },
+    [1847] = { 0xF1AC2F, 2, { 8, 14 } },
+    [1848] = { 0x012168, 2, { 26, 27 } },
+    [1849] = { 0x0E5721, 2, { 15, 25 } },
+    [1850] = { 0x1C9B00, 2, { 22, 40 } },
+    [1851] = { 0x80E0D8, 2, { 27, 32 } },
+    [1852] = { 0x038567, 2, { 0, 38 } },
+    [1853] = { 0x375904, 2, { 13, 44 } },
+    [1854] = { 0x9BCEDD, 2, { 2, 14 } },
+    [1855] = { 0x000204, 2, { 46, 53 } },
+    [1856] = { 0x00707C, 2, { 28, 51 } },
+    [1857] = { 0x37D104, 2, { 13, 40 } },
+    [1858] = { 0x48A868, 2, { 10, 15 } },
+    [1861] = { 0x0706C1, 2, { 24, 55 } },
+    [1863] = { 0xEA04BD, 2, { 8, 51 } },
+    [1864] = { 0x010200, 2, { 39, 46 } },
+    [1866] = { 0x706400, 2, { 20, 44 } },
+    [1867] = { 0x080080, 2, { 36, 48 } },
+    [1868] = { 0xA09E91, 2, { 4, 40 } },
+    [1873] = { 0xDD4412, 2, { 11, 54 } },
+    [1875] = { 0xFF7409, 2, { 31, 40 } },
+    [1876] = { 0xEA18B6, 2, { 8, 30 } },
+    [1877] = { 0x2EA208, 2, { 12, 33 } },
+    [1878] = { 0xFF3AB7, 2, { 1, 46 } },
+    [1879] = { 0x0000A0, 2, { 48, 50 } },
+    [1880] = { 0x8B7D35, 2, { 0, 9 } },
+    [1881] = { 0x81C1B0, 2, { 26, 32 } },
+    [1884] = { 0xEE04AD, 2, { 8, 37 } },
+    [1885] = { 0x8EF852, 2, { 9, 37 } },
+    [1886] = { 0xDD55A9, 2, { 8, 13 } },
+    [1888] = { 0xDD580B, 2, { 11, 30 } },
+    [1890] = { 0x2B8D3F, 2, { 7, 28 } },
+    [1892] = { 0x0F6704, 2, { 13, 21 } },
+    [1894] = { 0xEA042D, 2, { 8, 48 } },
+    [1895] = { 0xBFC92B, 1, { 3, -1 } },
+    [1896] = { 0x91B145, 2, { 5, 18 } },
+    [1899] = { 0x5FFAA6, 2, { 6, 36 } },
+    [1900] = { 0x038260, 2, { 25, 47 } },
+    [1901] = { 0xFB7082, 2, { 14, 19 } },
+    [1902] = { 0x00E058, 2, { 27, 48 } },
+    [1906] = { 0xB2CE52, 2, { 9, 21 } },
+    [1908] = { 0x002000, 1, { 42, -1 } },
+    [1909] = { 0x403836, 2, { 29, 33 } },
+    [1913] = { 0x04706C, 2, { 28, 37 } },
+    [1916] = { 0x6C8812, 2, { 17, 35 } },
+    [1917] = { 0x6F63B8, 2, { 12, 26 } },
+    [1920] = { 0x01C5B0, 2, { 26, 45 } },
+    [1921] = { 0x04E0D8, 2, { 27, 37 } },
+    [1922] = { 0xDCC177, 2, { 0, 11 } },
+    [1923] = { 0x1C1B20, 2, { 22, 50 } },
+    [1924] = { 0x2F9313, 2, { 2, 5 } },
+    [1925] = { 0x1C1A00, 2, { 22, 47 } },
+    [1927] = { 0xBFF11D, 2, { 3, 29 } },
+    [1928] = { 0x003A36, 2, { 29, 46 } },
+    [1929] = { 0x40C691, 2, { 4, 19 } },
+    [1930] = { 0xFF0081, 2, { 1, 29 } },
+    [1931] = { 0x2BDE21, 2, { 10, 12 } },
+    [1932] = { 0x000008, 1, { 52, -1 } },
+    [1933] = { 0x200800, 2, { 34, 44 } },
+    [1934] = { 0x001004, 2, { 43, 53 } },
+    [1935] = { 0x7EA208, 2, { 12, 35 } },
+    [1936] = { 0x020000, 1, { 38, -1 } },
+    [1937] = { 0xF91424, 2, { 16, 45 } },
+    [1938] = { 0x2B4A04, 2, { 13, 22 } },
+    [1939] = { 0x006C77, 2, { 28, 30 } },
+    [1940] = { 0xB722A6, 2, { 6, 19 } },
+    [1941] = { 0x0B8360, 2, { 25, 36 } },
+    [1942] = { 0xF95024, 2, { 16, 41 } },
+    [1943] = { 0x208000, 2, { 34, 40 } },
+    [1944] = { 0x339048, 2, { 15, 18 } },
+    [1945] = { 0xA01EB1, 2, { 4, 50 } },
+    [1946] = { 0x000900, 2, { 44, 47 } },
+    [1947] = { 0x383601, 2, { 21, 55 } },
+    [1949] = { 0xEAE475, 2, { 8, 27 } },
+    [1950] = { 0x375004, 2, { 13, 47 } },
+    [1951] = { 0x375124, 2, { 13, 50 } },
+    [1952] = { 0xFCEE4D, 2, { 2, 17 } },
+    [1953] = { 0x800080, 2, { 32, 48 } },
+    [1955] = { 0x018567, 1, { 0, -1 } },
+    [1956] = { 0xDD347C, 2, { 11, 28 } },
+    [1958] = { 0x9C7D5F, 2, { 2, 22 } },
+    [1959] = { 0xEA24AD, 2, { 8, 42 } },
+    [1960] = { 0x008100, 2, { 40, 47 } },
+    [1962] = { 0x2BFD52, 2, { 7, 55 } },
+    [1963] = { 0x6EA209, 2, { 12, 55 } },
+    [1965] = { 0xE35B60, 2, { 19, 25 } },
+    [1968] = { 0x715C53, 2, { 15, 17 } },
+    [1970] = { 0xF00A5F, 2, { 2, 20 } },
+    [1971] = { 0x201C1B, 2, { 30, 34 } },
+    [1974] = { 0x8AF85A, 2, { 9, 52 } },
+    [1975] = { 0x01C130, 2, { 26, 48 } },
+    [1977] = { 0x250D1E, 2, { 5, 9 } },
+    [1978] = { 0x011000, 2, { 39, 43 } },
+    [1979] = { 0x801E91, 2, { 4, 34 } },
+    [1980] = { 0x596729, 2, { 10, 22 } },
+    [1981] = { 0x364409, 2, { 18, 36 } },
+    [1984] = { 0x02706C, 2, { 28, 38 } },
+    [1986] = { 0xD7FAA6, 2, { 6, 32 } },
+    [1987] = { 0x5B9153, 2, { 7, 20 } },
+    [1988] = { 0x001D1B, 2, { 30, 47 } },
+    [1989] = { 0x000802, 2, { 44, 54 } },
+    [1990] = { 0xA1CC02, 2, { 11, 17 } },
+    [1991] = { 0x008002, 2, { 40, 54 } },
+    [1992] = { 0x3F5104, 2, { 13, 36 } },
+    [1993] = { 0x7C8A12, 2, { 17, 46 } },
+    [1995] = { 0x15A502, 2, { 14, 23 } },
+    [1996] = { 0xBDC92B, 2, { 3, 38 } },
+    [1997] = { 0x12868F, 2, { 6, 10 } },
+    [1998] = { 0xA81E91, 2, { 4, 36 } },
+    [1999] = { 0x05C1B0, 2, { 26, 37 } },
+    [2000] = { 0x004080, 2, { 41, 48 } },
+    [2003] = { 0x6E9A3E, 2, { 12, 29 } },
+    [2004] = { 0xFF38B3, 2, { 1, 53 } },
+    [2005] = { 0x0BA882, 2, { 14, 35 } },
+    [2006] = { 0x71ADB0, 2, { 20, 26 } },
+    [2007] = { 0x010004, 2, { 39, 53 } },
+    [2008] = { 0xFD1024, 2, { 16, 37 } },
+    [2009] = { 0x400040, 2, { 33, 49 } },
+    [2010] = { 0x000480, 2, { 45, 48 } },
+    [2011] = { 0xF91034, 2, { 16, 51 } },
+    [2013] = { 0xAFFD4C, 2, { 5, 44 } },
+    [2014] = { 0xFF28B7, 2, { 1, 43 } },
+    [2015] = { 0xBFC923, 2, { 3, 52 } },
+    [2016] = { 0x3E4509, 2, { 18, 47 } },
+    [2017] = { 0x974F95, 2, { 4, 13 } },
+    [2018] = { 0x6BFD53, 2, { 7, 33 } },
+    [2020] = { 0x02E0D8, 2, { 27, 38 } },
+    [2021] = { 0x0AD281, 2, { 15, 24 } },
+    [2022] = { 0x013836, 2, { 29, 39 } },
+    [2024] = { 0x477C29, 2, { 10, 38 } },
+    [2025] = { 0x175104, 2, { 13, 34 } },
+    [2026] = { 0x374D1F, 2, { 13, 30 } },
+    [2028] = { 0x57FEA6, 2, { 6, 45 } },
+    [2029] = { 0x838360, 2, { 25, 32 } },
+    [2030] = { 0xFE38B7, 2, { 1, 39 } },
+    [2031] = { 0x000240, 2, { 46, 49 } },
+    [2039] = { 0x2BFF53, 2, { 7, 46 } },
+    [2040] = { 0x000120, 2, { 47, 50 } },
+    [2045] = { 0x000090, 2, { 48, 51 } },
+    [2046] = { 0x200020, 2, { 34, 50 } },
+};
+
+static const struct syndromeHash syndromeHash_2_56 = { 9, 11, 1596, syndromeHash_2_56_displacement, syndromeHash_2_56_slots };
+
+static const uint16_t syndromeHash_2_112_displacement[1024] = {
+    0, 4, 3, 0, 1, 0, 0, 1, 2, 0, 1, 0, 0, 2, 2, 6,
+    2, 0, 0, 0, 3, 0, 0, 1, 5, 0, 0, 1, 1, 1, 0, 1,
+    2, 0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 1, 0, 0, 0, 1,
+    0, 0, 15, 0, 1, 0, 0, 1, 0, 3, 1, 0, 0, 0, 5, 2,
+    2, 0, 0, 2, 2, 3, 2, 3, 2, 3, 3, 0, 4, 2, 0, 0,
+    0, 2, 2, 0, 1, 0, 0, 1, 1, 0, 0, 4, 0, 6, 1, 0,
+    0, 3, 0, 0, 0, 4, 0, 0, 2, 0, 2, 0, 0, 0, 2, 0,
+    1, 3, 5, 2, 3, 0, 0, 0, 1, 1, 1, 0, 0, 7, 0, 2,
+    0, 1, 0, 0, 0, 4, 4, 2, 4, 0, 4, 1, 0, 3, 0, 2,
+    1, 0, 0, 2, 0, 1, 1, 4, 0, 18, 2, 0, 2, 2, 0, 8,
+    0, 2, 0, 4, 1, 0, 7, 2, 0, 0, 2, 1, 5, 2, 0, 1,
+    1, 4, 1, 1, 0, 1, 0, 2, 2, 0, 1, 4, 2, 3, 0, 0,
+    0, 0, 0, 2, 1, 5, 2, 4, 1, 4, 1, 0, 2, 1, 0, 1,
+    4, 1, 12, 0, 1, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 4,
+    0, 2, 14, 6, 1, 0, 1, 0, 4, 0, 8, 4, 1, 0, 0, 1,
+    2, 10, 7, 2, 6, 0, 1, 1, 1, 1, 1, 1, 3, 7, 1, 3,
+    1, 1, 2, 2, 1, 2, 0, 0, 1, 0, 0, 19, 5, 0, 0, 0,
+    4, 11, 2, 0, 1, 1, 3, 3, 3, 1, 1, 5, 0, 3, 1, 3,
+    1, 1, 0, 1, 0, 20, 1, 1, 1, 0, 0, 2, 0, 0, 6, 0,
+    0, 3, 0, 2, 0, 0, 3, 0, 0, 3, 3, 0, 8, 2, 3, 0,
+    1, 4, 0, 4, 1, 12, 0, 2, 2, 1, 0, 5, 0, 0, 0, 5,
+    0, 4, 0, 0, 0, 5, 1, 3, 1, 0, 11, 3, 1, 2, 4, 1,
+    0, 0, 1, 0, 0, 0, 6, 0, 0, 1, 0, 2, 0, 1, 1, 0,
+    1, 5, 1, 0, 15, 1, 10, 0, 0, 0, 12, 6, 0, 2, 2, 1,
+    1, 6, 0, 2, 1, 3, 0, 0, 0, 0, 0, 2, 1, 2, 1, 1,
+    1, 5, 3, 3, 0, 10, 0, 0, 4, 0, 0, 7, 0, 0, 3, 0,
+    2, 2, 0, 1, 0, 3, 0, 1, 4, 0, 0, 0, 0, 0, 0, 4,
+    2, 0, 9, 0, 0, 0, 2, 4, 0, 7, 5, 0, 0, 6, 2, 0,
+    0, 1, 0, 1, 1, 4, 1, 0, 1, 2, 0, 2, 2, 0, 9, 1,
+    2, 1, 3, 2, 0, 0, 0, 0, 2, 0, 0, 0, 3, 0, 7, 1,
+    1, 0, 0, 1, 4, 0, 0, 6, 0, 0, 1, 0, 0, 2, 10, 1,
+    3, 1, 0, 0, 2, 8, 1, 1, 0, 5, 2, 12, 0, 1, 17, 0,
+    2, 0, 0, 2, 1, 1, 0, 2, 0, 0, 1, 5, 1, 0, 2, 0,
+    1, 0, 3, 11, 0, 2, 0, 1, 1, 6, 5, 0, 4, 0, 0, 1,
+    0, 0, 0, 0, 3, 0, 0, 5, 0, 4, 1, 1, 3, 7, 0, 0,
+    8, 1, 0, 4, 0, 1, 1, 4, 3, 7, 0, 1, 0, 5, 1, 1,
+    2, 0, 0, 1, 0, 1, 0, 0, 1, 0, 0, 0, 1, 5, 8, 2,
+    0, 0, 4, 0, 4, 0, 0, 1, 0, 3, 0, 1, 3, 0, 1, 0,
+    0, 0, 1, 0, 1, 0, 1, 2, 0, 1, 0, 1, 13, 8, 1, 0,
+    0, 0, 0, 0, 5, 4, 0, 1, 2, 1, 0, 0, 6, 1, 0, 0,
+    0, 0, 1, 1, 0, 4, 1, 6, 2, 0, 0, 0, 0, 0, 3, 16,
+    7, 5, 2, 1, 0, 13, 8, 1, 3, 2, 0, 3, 0, 0, 1, 6,
+    2, 2, 6, 3, 0, 0, 1, 0, 0, 4, 4, 2, 6, 1, 0, 4,
+    0, 2, 0, 0, 1, 5, 8, 5, 3, 2, 0, 0, 1, 1, 1, 7,
+    0, 2, 1, 0, 0, 3, 0, 1, 4, 3, 0, 1, 3, 0, 9, 5,
+    0, 4, 2, 1, 0, 1, 2, 0, 0, 1, 0, 0, 1, 6, 11, 0,
+    2, 2, 0, 2, 2, 1, 3, 8, 0, 3, 0, 1, 3, 18, 2, 1,
+    0, 3, 2, 4, 2, 0, 4, 0, 3, 1, 5, 1, 1, 1, 0, 7,
+    4, 8, 0, 0, 0, 0, 0, 0, 15, 5, 1, 0, 2, 0, 0, 0,
+    1, 1, 4, 3, 0, 0, 0, 1, 8, 12, 10, 0, 2, 0, 4, 0,
+    0, 0, 1, 0, 0, 1, 3, 8, 0, 4, 4, 0, 6, 2, 8, 4,
+    0, 13, 0, 0, 10, 0, 2, 0, 14, 5, 0, 0, 0, 4, 2, 9,
+    1, 0, 0, 0, 1, 0, 2, 0, 5, 2, 0, 5, 1, 1, 0, 1,
+    0, 5, 1, 1, 0, 0, 0, 4, 0, 2, 1, 0, 1, 1, 12, 3,
+    0, 0, 0, 0, 4, 1, 1, 26, 1, 1, 25, 0, 0, 0, 1, 0,
+    27, 4, 2, 0, 4, 0, 1, 5, 0, 0, 0, 0, 0, 1, 13, 2,
+    0, 0, 1, 6, 11, 0, 0, 9, 2, 0, 2, 1, 0, 9, 7, 1,
+    1, 2, 4, 3, 0, 0, 0, 0, 0, 2, 1, 1, 0, 0, 3, 0,
+    0, 0, 0, 0, 9, 0, 3, 0, 1, 0, 0, 0, 1, 2, 0, 1,
+    1, 1, 15, 0, 0, 0, 2, 6, 7, 2, 3, 2, 0, 4, 0, 0,
+    0, 2, 0, 2, 1, 2, 0, 2, 0, 5, 2, 3, 1, 1, 1, 0,
+    1, 1, 1, 2, 1, 0, 7, 2, 1, 0, 2, 0, 1, 3, 0, 1,
+    0, 0, 12, 0, 0, 1, 0, 0, 0, 4, 0, 3, 1, 8, 0, 0,
+    0, 2, 0, 29, 0, 3, 0, 5, 0, 7, 1, 9, 23, 0, 1, 3,
+};
+
+static struct errorinfo syndromeHash_2_112_slots[8192] = {
+    [5] = { 0x351029, 2, { 66, 76 } },
+    [6] = { 0x2F2FED, 2, { 16, 38 } },
+    [9] = { 0x07E618, 2, { 80, 83 } },
+    [10] = { 0x6A2052, 2, { 65, 75 } },
+    [12] = { 0x5E5FDA, 2, { 15, 37 } },
+    [13] = { 0x25F0D3, 2, { 63, 79 } },
+    [14] = { 0xBAF28D, 2, { 12, 77 } },
+    [17] = { 0xD440A4, 2, { 64, 74 } },
+    [18] = { 0x0FCC30, 2, { 79, 82 } },
+    [19] = { 0xD686EB, 2, { 44, 58 } },
+    [24] = { 0x4BE1A6, 2, { 62, 78 } },
+    [26] = { 0xBCBFB4, 2, { 14, 36 } },
+    [27] = { 0x4E0D80, 2, { 79, 89 } },
+    [28] = { 0xE04C88, 2, { 33, 109 } },
+    [31] = { 0xDDE2A5, 2, { 18, 35 } },
+    [35] = { 0xC5EF62, 2, { 16, 43 } },
+    [37] = { 0x292084, 2, { 31, 62 } },
+    [43] = { 0x222174, 2, { 13, 21 } },
+    [44] = { 0x41EE55, 2, { 0, 3 } },
+    [45] = { 0x1F9860, 2, { 78, 81 } },
+    [47] = { 0x57E6BD, 2, { 62, 86 } },
+    [49] = { 0xAA7106, 2, { 46, 59 } },
+    [50] = { 0x2C5BC6, 2, { 6, 21 } },
+    [51] = { 0x3E440B, 2, { 74, 110 } },
+    [53] = { 0xCD18A4, 2, { 30, 51 } },
+    [54] = { 0x9C1B00, 2, { 78, 88 } },
+    [55] = { 0x97C34C, 2, { 61, 77 } },
+    [59] = { 0x0D3499, 2, { 71, 83 } },
+    [60] = { 0x7C9812, 2, { 73, 99 } },
+    [61] = { 0x01E1B0, 2, { 82, 98 } },
+    [62] = { 0x5BA882, 2, { 70, 89 } },
+    [63] = { 0x91D77F, 2, { 40, 99 } },
+    [67] = { 0x2BFD13, 2, { 63, 105 } },
+    [69] = { 0x7AF142, 2, { 50, 70 } },
+    [71] = { 0x37EAAF, 2, { 1, 45 } },
+    [80] = { 0x040080, 2, { 93, 104 } },
+    [81] = { 0x457C29, 1, { 66, -1 } },
+    [84] = { 0x4442E8, 2, { 12, 20 } },
+    [88] = { 0x2CB7E0, 2, { 51, 78 } },
+    [92] = { 0x3F30C0, 2, { 77, 80 } },
+    [93] = { 0xAFCD7A, 2, { 61, 85 } },
+    [101] = { 0x038760, 2, { 81, 101 } },
+    [102] = { 0x7C8816, 2, { 73, 109 } },
+    [103] = { 0x58B78C, 2, { 5, 20 } },
+    [106] = { 0x000022, 2, { 106, 110 } },
+    [109] = { 0x57FAB6, 2, { 62, 107 } },
+    [111] = { 0xD0400F, 2, { 15, 86 } },
+    [114] = { 0x03C360, 2, { 81, 97 } },
+    [115] = { 0xC093F9, 2, { 20, 54 } },
+    [116] = { 0x280000, 2, { 90, 92 } },
+    [119] = { 0x1A6932, 2, { 70, 82 } },
+    [120] = { 0xF93024, 2, { 72, 98 } },
+    [121] = { 0x3DC769, 2, { 74, 81 } },
+    [124] = { 0xB75104, 2, { 69, 88 } },
+    [125] = { 0x586178, 2, { 7, 99 } },
+    [126] = { 0x1B51B3, 2, { 51, 63 } },
+    [127] = { 0x7D8812, 2, { 73, 95 } },
+    [134] = { 0x30DC8C, 2, { 51, 84 } },
+    [135] = { 0x57FA26, 2, { 62, 104 } },
+    [138] = { 0x6FD55E, 2, { 0, 44 } },
+    [141] = { 0x01C1B8, 2, { 82, 108 } },
+    [142] = { 0xF5E284, 2, { 49, 69 } },
+    [144] = { 0x1BAA82, 2, { 70, 102 } },
+    [150] = { 0x00706C, 1, { 84, -1 } },
+    [152] = { 0x3F6D19, 2, { 32, 108 } },
+    [161] = { 0x6E5C9B, 2, { 22, 90 } },
+    [163] = { 0x080100, 2, { 92, 103 } },
+    [164] = { 0x8AF852, 1, { 65, -1 } },
+    [165] = { 0xEA04AD, 1, { 64, -1 } },
+    [166] = { 0x9A4B09, 2, { 48, 75 } },
+    [167] = { 0x79DBBF, 2, { 3, 95 } },
+    [170] = { 0x8885D0, 2, { 11, 19 } },
+    [171] = { 0x00141B, 2, { 86, 100 } },
+    [175] = { 0x001040, 2, { 99, 105 } },
+    [176] = { 0x8F8FE1, 2, { 6, 32 } },
+    [177] = { 0xCF847B, 2, { 65, 66 } },
+    [178] = { 0xBEE82E, 2, { 13, 84 } },
+    [188] = { 0x7E6180, 2, { 76, 79 } },
+    [189] = { 0x596FC0, 2, { 50, 77 } },
+    [190] = { 0x03C1B0, 2, { 82, 94 } },
+    [191] = { 0x5F4C21, 1, { 14, -1 } },
+    [193] = { 0x567CF8, 2, { 7, 79 } },
+    [195] = { 0x070EC0, 2, { 80, 100 } },
+    [197] = { 0xBBC92B, 2, { 59, 93 } },
+    [201] = { 0xF9102C, 2, { 72, 108 } },
+    [202] = { 0xB16F18, 2, { 4, 19 } },
+    [203] = { 0xA476D8, 2, { 42, 111 } },
+    [206] = { 0xFEF907, 2, { 57, 82 } },
+    [207] = { 0xF787A4, 2, { 39, 63 } },
+    [210] = { 0xEBFC06, 2, { 18, 79 } },
+    [211] = { 0x8A1113, 2, { 11, 76 } },
+    [215] = { 0x000044, 2, { 105, 109 } },
+    [216] = { 0x0A9E0D, 2, { 58, 65 } },
+    [217] = { 0xC37CCB, 2, { 23, 70 } },
+    [219] = { 0xAFF56C, 2, { 61, 106 } },
+    [221] = { 0x0B7A14, 2, { 17, 32 } },
+    [222] = { 0xA8246D, 2, { 20, 68 } },
+    [224] = { 0x5682A5, 2, { 39, 65 } },
+    [225] = { 0x7B8ED2, 2, { 73, 80 } },
+    [226] = { 0xC317DB, 2, { 4, 96 } },
+    [227] = { 0x060213, 2, { 18, 36 } },
+    [228] = { 0x0786C0, 2, { 80, 96 } },
+    [229] = { 0x7D9627, 2, { 16, 46 } },
+    [230] = { 0xE04CCC, 2, { 33, 105 } },
+    [231] = { 0x89011B, 2, { 21, 46 } },
+    [232] = { 0x500000, 2, { 89, 91 } },
+    [233] = { 0x8CEF1B, 2, { 22, 49 } },
+    [235] = { 0xBF38B7, 2, { 57, 89 } },
+    [237] = { 0xA0F2E5, 2, { 39, 73 } },
+    [238] = { 0x1BB3D3, 2, { 2, 64 } },
+    [240] = { 0x010040, 2, { 95, 105 } },
+    [242] = { 0x1C5B00, 2, { 78, 97 } },
+    [244] = { 0x34D264, 2, { 69, 81 } },
+    [246] = { 0x26159C, 2, { 54, 90 } },
+    [249] = { 0xB0C2F0, 2, { 6, 98 } },
+    [252] = { 0xEA3C9B, 2, { 64, 85 } },
+    [253] = { 0x36A366, 2, { 50, 62 } },
+    [254] = { 0xFB1024, 2, { 72, 94 } },
+    [255] = { 0x747EDD, 2, { 11, 37 } },
+    [260] = { 0x7FDE40, 2, { 47, 65 } },
+    [263] = { 0x61B918, 2, { 50, 83 } },
+    [264] = { 0x03FEF2, 2, { 52, 70 } },
+    [265] = { 0xB45DCE, 2, { 61, 70 } },
+    [268] = { 0xC666BD, 2, { 20, 83 } },
+    [269] = { 0xF2C9E0, 2, { 24, 50 } },
+    [270] = { 0xAFF44C, 2, { 61, 103 } },
+    [275] = { 0x038370, 2, { 81, 107 } },
+    [277] = { 0xBFC9AB, 2, { 59, 104 } },
+    [278] = { 0x04AEBE, 2, { 23, 39 } },
+    [281] = { 0xB40933, 2, { 36, 62 } },
+    [282] = { 0x1CBAF5, 2, { 1, 98 } },
+    [283] = { 0x2BFD57, 2, { 63, 109 } },
+    [289] = { 0x415356, 2, { 4, 12 } },
+    [292] = { 0xFFF408, 2, { 87, 111 } },
+    [296] = { 0x00E0D8, 1, { 83, -1 } },
+    [297] = { 0x375504, 2, { 69, 101 } },
+    [298] = { 0x3A8545, 2, { 69, 71 } },
+    [301] = { 0x003832, 2, { 85, 109 } },
+    [303] = { 0x51E674, 2, { 44, 80 } },
+    [304] = { 0x11FBF2, 2, { 2, 33 } },
+    [306] = { 0xB047C7, 2, { 37, 74 } },
+    [307] = { 0x7EDA32, 2, { 31, 107 } },
+    [313] = { 0x036D37, 2, { 11, 72 } },
+    [314] = { 0xF52712, 2, { 47, 103 } },
+    [318] = { 0x080002, 2, { 92, 110 } },
+    [319] = { 0x03A473, 2, { 9, 46 } },
+    [320] = { 0xFC3123, 2, { 30, 56 } },
+    [321] = { 0xF3B77E, 2, { 2, 94 } },
+    [324] = { 0xE14654, 2, { 52, 72 } },
+    [325] = { 0x100200, 2, { 91, 102 } },
+    [329] = { 0xC1B94E, 2, { 49, 55 } },
+    [334] = { 0x400001, 2, { 89, 111 } },
+    [336] = { 0x002836, 2, { 85, 99 } },
+    [337] = { 0xC17CBE, 2, { 57, 74 } },
+    [338] = { 0x49C800, 2, { 25, 107 } },
+    [341] = { 0xA05E91, 2, { 60, 97 } },
+    [343] = { 0xC80A64, 2, { 15, 52 } },
+    [344] = { 0xDCB936, 2, { 21, 89 } },
+    [350] = { 0x002080, 2, { 98, 104 } },
+    [354] = { 0xA8F38C, 2, { 61, 80 } },
+    [357] = { 0xA78571, 2, { 7, 87 } },
+    [358] = { 0x561C5E, 2, { 9, 89 } },
+    [362] = { 0x450C45, 2, { 66, 84 } },
+    [376] = { 0xBE9842, 1, { 13, -1 } },
+    [378] = { 0xB2DF80, 2, { 49, 76 } },
+    [380] = { 0x078360, 2, { 81, 93 } },
+    [381] = { 0x219603, 2, { 14, 31 } },
+    [382] = { 0x7CA290, 2, { 23, 42 } },
+    [383] = { 0xFCC300, 2, { 75, 78 } },
+    [386] = { 0x0E1D80, 2, { 79, 99 } },
+    [390] = { 0xF18F48, 2, { 2, 85 } },
+    [391] = { 0xEFF409, 2, { 87, 91 } },
+    [394] = { 0xACF9F0, 2, { 6, 78 } },
+    [404] = { 0xA80EAF, 2, { 62, 87 } },
+    [409] = { 0x01DDAB, 2, { 82, 86 } },
+    [413] = { 0xA9F17F, 2, { 40, 77 } },
+    [415] = { 0x749E89, 2, { 48, 79 } },
+    [416] = { 0x1E9AF5, 2, { 1, 94 } },
+    [419] = { 0xFA7D12, 2, { 11, 111 } },
+    [421] = { 0xA04C8C, 2, { 33, 89 } },
+    [422] = { 0xBA4D61, 2, { 46, 61 } },
+    [423] = { 0x4388DA, 2, { 22, 71 } },
+    [429] = { 0xDC7AF6, 2, { 39, 111 } },
+    [430] = { 0x000088, 2, { 104, 108 } },
+    [433] = { 0x683E0A, 2, { 16, 99 } },
+    [435] = { 0x3D4789, 2, { 49, 87 } },
+    [436] = { 0x153C1A, 2, { 57, 64 } },
+    [443] = { 0x16F428, 2, { 16, 31 } },
+    [448] = { 0xAD054A, 2, { 38, 64 } },
+    [450] = { 0x7F37E7, 2, { 38, 77 } },
+    [451] = { 0xFB2C4E, 2, { 15, 45 } },
+    [452] = { 0x4C2B38, 2, { 53, 89 } },
+    [453] = { 0x83053D, 2, { 12, 82 } },
+    [455] = { 0x39BED2, 2, { 20, 57 } },
+    [456] = { 0xC78665, 2, { 20, 95 } },
+    [459] = { 0x0F0D80, 2, { 79, 95 } },
+    [460] = { 0x0C0426, 2, { 17, 35 } },
+    [461] = { 0xF71DA4, 2, { 72, 79 } },
+    [465] = { 0xA00000, 2, { 88, 90 } },
+    [466] = { 0x1BA886, 2, { 70, 109 } },
+    [469] = { 0xBF892B, 2, { 59, 97 } },
+    [473] = { 0x69A4C8, 2, { 68, 80 } },
+    [474] = { 0x3767A6, 2, { 1, 63 } },
+    [477] = { 0x6159C0, 1, { 50, -1 } },
+    [479] = { 0xDD8855, 2, { 15, 71 } },
+    [482] = { 0x020080, 2, { 94, 104 } },
+    [487] = { 0x38B600, 2, { 77, 96 } },
+    [492] = { 0x2489D6, 2, { 1, 35 } },
+    [496] = { 0x498810, 2, { 25, 97 } },
+    [499] = { 0x40F19C, 2, { 57, 59 } },
+    [503] = { 0xC2B388, 2, { 49, 108 } },
+    [505] = { 0x6D46CC, 2, { 49, 61 } },
+    [508] = { 0x46E0B4, 2, { 44, 91 } },
+    [511] = { 0xE8FDBA, 2, { 10, 36 } },
+    [516] = { 0x9B2D23, 2, { 26, 59 } },
+    [517] = { 0x2E2A5E, 2, { 9, 77 } },
+    [518] = { 0x003876, 2, { 85, 105 } },
+    [521] = { 0xB7E430, 2, { 6, 80 } },
+    [522] = { 0xEA7D13, 2, { 11, 91 } },
+    [524] = { 0xFFBC80, 2, { 46, 64 } },
+    [525] = { 0xC37230, 2, { 49, 82 } },
+    [527] = { 0xE0D820, 2, { 75, 106 } },
+    [530] = { 0xA01E11, 2, { 60, 104 } },
+    [532] = { 0x07FDE4, 2, { 51, 69 } },
+    [537] = { 0x457C21, 2, { 66, 108 } },
+    [538] = { 0xE476D9, 2, { 42, 89 } },
+    [540] = { 0x992B7B, 2, { 0, 60 } },
+    [541] = { 0xE94ED3, 2, { 49, 63 } },
+    [550] = { 0x0706E0, 2, { 80, 106 } },
+    [552] = { 0x6CA897, 2, { 24, 57 } },
+    [553] = { 0x54EA2E, 2, { 36, 41 } },
+    [555] = { 0x095D7C, 2, { 22, 38 } },
+    [557] = { 0x0DD461, 2, { 71, 106 } },
+    [560] = { 0x91C77B, 2, { 40, 109 } },
+    [562] = { 0x42802A, 2, { 35, 48 } },
+    [563] = { 0x7C8695, 2, { 48, 54 } },
+    [564] = { 0x57FAAE, 2, { 62, 108 } },
+    [566] = { 0x3975EA, 2, { 0, 97 } },
+    [567] = { 0x2C48D0, 2, { 8, 84 } },
+    [569] = { 0xE804AD, 2, { 64, 94 } },
+    [571] = { 0x343061, 2, { 29, 51 } },
+    [572] = { 0x6745AF, 2, { 15, 41 } },
+    [578] = { 0x82A6AC, 2, { 3, 11 } },
+    [588] = { 0x1E844E, 2, { 34, 68 } },
+    [592] = { 0xCD4410, 2, { 67, 91 } },
+    [593] = { 0x750A8A, 2, { 68, 70 } },
+    [594] = { 0x01C1B0, 1, { 82, -1 } },
+    [595] = { 0x6EAA08, 2, { 68, 100 } },
+    [597] = { 0xD45C14, 2, { 15, 93 } },
+    [599] = { 0x101000, 2, { 91, 99 } },
+    [600] = { 0xBBB613, 2, { 60, 70 } },
+    [601] = { 0x708CD8, 2, { 76, 83 } },
+    [603] = { 0x519E60, 2, { 25, 52 } },
+    [605] = { 0x007064, 2, { 84, 108 } },
+    [606] = { 0xA3CCE8, 2, { 43, 79 } },
+    [607] = { 0x5D4C21, 2, { 14, 94 } },
+    [608] = { 0x75404D, 2, { 47, 58 } },
+    [609] = { 0x17B0E9, 2, { 30, 64 } },
+    [610] = { 0x23F7E4, 2, { 1, 32 } },
+    [611] = { 0x3F6D11, 1, { 32, -1 } },
+    [612] = { 0x0B0E2D, 2, { 10, 110 } },
+    [613] = { 0xFDB464, 2, { 30, 106 } },
+    [614] = { 0xA41E91, 2, { 60, 93 } },
+    [619] = { 0x455C29, 2, { 66, 98 } },
+    [622] = { 0x4E549B, 2, { 22, 100 } },
+    [623] = { 0xEA04A5, 2, { 64, 108 } },
+    [627] = { 0x06DA6E, 2, { 10, 71 } },
+    [629] = { 0x706E00, 2, { 76, 102 } },
+    [635] = { 0xC9AE4F, 2, { 25, 58 } },
+    [636] = { 0x100004, 2, { 91, 109 } },
+    [637] = { 0x0748E6, 2, { 8, 45 } },
+    [638] = { 0x7D9D7C, 2, { 15, 43 } },
+    [640] = { 0x200400, 2, { 90, 101 } },
+    [648] = { 0x03A360, 2, { 81, 98 } },
+    [651] = { 0x687036, 2, { 34, 52 } },
+    [658] = { 0x204000, 2, { 90, 97 } },
+    [659] = { 0xF91024, 1, { 72, -1 } },
+    [664] = { 0x09496E, 2, { 28, 84 } },
+    [665] = { 0x110000, 2, { 91, 95 } },
+    [667] = { 0x95D7C0, 2, { 18, 34 } },
+    [668] = { 0xA79F5B, 2, { 52, 59 } },
+    [670] = { 0x980DB2, 2, { 35, 60 } },
+    [671] = { 0x800002, 2, { 88, 110 } },
+    [674] = { 0x939000, 2, { 24, 106 } },
+    [678] = { 0x30B0FB, 2, { 51, 86 } },
+    [679] = { 0x45F1E1, 2, { 61, 64 } },
+    [680] = { 0xD8A425, 2, { 23, 84 } },
+    [682] = { 0x8E03CF, 2, { 37, 111 } },
+    [683] = { 0x7A73D1, 2, { 48, 83 } },
+    [684] = { 0x00506C, 2, { 84, 98 } },
+    [685] = { 0x000500, 2, { 101, 103 } },
+    [686] = { 0xFBA147, 2, { 15, 63 } },
+    [687] = { 0x21258F, 2, { 6, 40 } },
+    [697] = { 0x8AD852, 2, { 65, 98 } },
+    [698] = { 0xC0665F, 2, { 58, 89 } },
+    [699] = { 0xF21F60, 2, { 49, 51 } },
+    [700] = { 0x004100, 2, { 97, 103 } },
+    [706] = { 0x018167, 2, { 56, 101 } },
+    [710] = { 0x3CAA81, 2, { 29, 77 } },
+    [713] = { 0xAC38BC, 2, { 8, 88 } },
+    [715] = { 0x2AFD53, 2, { 63, 95 } },
+    [717] = { 0x2D1F15, 2, { 27, 32 } },
+    [722] = { 0x20644E, 2, { 4, 36 } },
+    [724] = { 0xA47699, 2, { 42, 105 } },
+    [726] = { 0x8A188A, 2, { 65, 83 } },
+    [729] = { 0x5E7701, 2, { 26, 48 } },
+    [731] = { 0x5D1D16, 2, { 41, 64 } },
+    [733] = { 0xF1B77E, 1, { 2, -1 } },
+    [734] = { 0x038368, 2, { 81, 108 } },
+    [735] = { 0x55B82D, 2, { 46, 89 } },
+    [736] = { 0xAC5CB1, 2, { 34, 39 } },
+    [738] = { 0x000005, 2, { 109, 111 } },
+    [739] = { 0xE8D800, 2, { 75, 92 } },
+    [740] = { 0xA64DD8, 2, { 2, 62 } },
+    [742] = { 0x3304FE, 2, { 2, 49 } },
+    [752] = { 0xE04C8D, 2, { 33, 111 } },
+    [753] = { 0x00E0D0, 2, { 83, 108 } },
+    [754] = { 0x39356A, 2, { 0, 104 } },
+    [755] = { 0x733973, 2, { 19, 82 } },
+    [756] = { 0x432C06, 2, { 13, 30 } },
+    [759] = { 0x142B9F, 2, { 8, 35 } },
+    [760] = { 0x916D77, 2, { 21, 71 } },
+    [761] = { 0x010001, 2, { 95, 111 } },
+    [762] = { 0x7EDA2A, 2, { 31, 108 } },
+    [763] = { 0x0F06C0, 2, { 80, 92 } },
+    [764] = { 0xF94520, 2, { 22, 41 } },
+    [765] = { 0xFA1AEA, 2, { 55, 72 } },
+    [767] = { 0x4375F9, 2, { 5, 67 } },
+    [771] = { 0x9CED84, 2, { 30, 50 } },
+    [772] = { 0x7C8852, 2, { 73, 105 } },
+    [775] = { 0x9DB936, 2, { 21, 95 } },
+    [778] = { 0xF223ED, 2, { 3, 65 } },
+    [780] = { 0x2BED53, 2, { 63, 99 } },
+    [782] = { 0x1C3B00, 2, { 78, 98 } },
+    [785] = { 0x6C8F57, 2, { 9, 48 } },
+    [786] = { 0x716B2C, 2, { 17, 66 } },
+    [790] = { 0x315C25, 2, { 26, 46 } },
+    [792] = { 0xB20955, 2, { 5, 8 } },
+    [797] = { 0x850DE1, 2, { 10, 37 } },
+    [815] = { 0x0C3B38, 2, { 53, 99 } },
+    [818] = { 0x200010, 2, { 90, 107 } },
+    [819] = { 0x03BB56, 2, { 81, 85 } },
+    [820] = { 0x1C9AF5, 1, { 1, -1 } },
+    [821] = { 0x15BA2D, 2, { 46, 102 } },
+    [827] = { 0xF1D761, 2, { 20, 69 } },
+    [829] = { 0x5E0EE8, 2, { 51, 68 } },
+    [831] = { 0xE93D12, 2, { 47, 78 } },
+    [834] = { 0x3D35EA, 2, { 0, 93 } },
+    [836] = { 0x160045, 2, { 9, 86 } },
+    [837] = { 0x8B39E2, 2, { 65, 82 } },
+    [839] = { 0x4D64A8, 2, { 11, 41 } },
+    [845] = { 0x8711B4, 2, { 21, 70 } },
+    [848] = { 0x578ACA, 2, { 62, 84 } },
+    [854] = { 0xB26C95, 2, { 27, 60 } },
+    [860] = { 0x24DC3E, 2, { 26, 85 } },
+    [862] = { 0x000110, 2, { 103, 107 } },
+    [865] = { 0xD07C14, 2, { 15, 98 } },
+    [866] = { 0xA26345, 2, { 42, 54 } },
+    [868] = { 0xF47093, 2, { 11, 79 } },
+    [869] = { 0x389323, 2, { 35, 96 } },
+    [870] = { 0x7A8F12, 2, { 48, 86 } },
+    [872] = { 0x81CB9B, 2, { 3, 72 } },
+    [873] = { 0x2A7834, 2, { 56, 63 } },
+    [879] = { 0xDCAD66, 2, { 3, 42 } },
+    [880] = { 0xA03E91, 2, { 60, 98 } },
+    [881] = { 0xC68661, 2, { 20, 109 } },
+    [882] = { 0x2C3CBC, 2, { 8, 101 } },
+    [884] = { 0x80661F, 2, { 58, 105 } },
+    [885] = { 0x000080, 1, { 104, -1 } },
+    [886] = { 0x0771E3, 2, { 0, 74 } },
+    [887] = { 0x2DE850, 2, { 15, 30 } },
+    [889] = { 0x417C29, 2, { 66, 93 } },
+    [890] = { 0xFE283D, 2, { 10, 47 } },
+    [893] = { 0x717BA3, 2, { 19, 81 } },
+    [896] = { 0x1AA882, 2, { 70, 95 } },
+    [897] = { 0xFE6FCE, 2, { 37, 76 } },
+    [898] = { 0x2C78BC, 2, { 8, 97 } },
+    [899] = { 0x822AA7, 2, { 16, 64 } },
+    [901] = { 0x11CF41, 2, { 71, 78 } },
+    [903] = { 0x985670, 2, { 52, 88 } },
+    [910] = { 0x2B707A, 2, { 45, 106 } },
+    [911] = { 0x737DA4, 2, { 19, 56 } },
+    [912] = { 0x78D9BF, 2, { 3, 102 } },
+    [914] = { 0xDD4610, 2, { 67, 102 } },
+    [915] = { 0x1E1B00, 2, { 78, 94 } },
+    [921] = { 0x60625B, 2, { 7, 35 } },
+    [922] = { 0x3842BC, 2, { 44, 68 } },
+    [923] = { 0x18084C, 2, { 16, 34 } },
+    [926] = { 0x334C7A, 2, { 21, 61 } },
+    [927] = { 0x240000, 2, { 90, 93 } },
+    [932] = { 0x37510C, 2, { 69, 108 } },
+    [940] = { 0x975DF3, 2, { 15, 38 } },
+    [941] = { 0x103836, 2, { 85, 91 } },
+    [942] = { 0x4701E6, 2, { 38, 111 } },
+    [943] = { 0xE0C76A, 2, { 23, 35 } },
+    [944] = { 0x40521D, 2, { 33, 60 } },
+    [945] = { 0xC43C08, 2, { 26, 75 } },
+    [946] = { 0x59E6DC, 2, { 1, 66 } },
+    [953] = { 0x4C836F, 2, { 40, 67 } },
+    [954] = { 0xD34990, 2, { 67, 79 } },
+    [955] = { 0xF9F0FC, 2, { 72, 83 } },
+    [957] = { 0x008D09, 2, { 45, 63 } },
+    [958] = { 0x6ECF4C, 2, { 0, 62 } },
+    [959] = { 0xC2B380, 1, { 49, -1 } },
+    [961] = { 0x3C8812, 2, { 73, 89 } },
+    [966] = { 0x38F45A, 2, { 0, 82 } },
+    [967] = { 0x040100, 2, { 93, 103 } },
+    [968] = { 0x067209, 2, { 74, 77 } },
+    [974] = { 0x716C00, 2, { 76, 95 } },
+    [975] = { 0x732BC4, 2, { 27, 50 } },
+    [976] = { 0x230ACE, 2, { 55, 90 } },
+    [977] = { 0xF3DF31, 2, { 53, 87 } },
+    [981] = { 0x30D8D8, 2, { 45, 70 } },
+    [983] = { 0xA622CA, 2, { 5, 35 } },
+    [984] = { 0x4913AC, 2, { 0, 34 } },
+    [996] = { 0x5E34D1, 2, { 32, 50 } },
+    [998] = { 0x81E338, 2, { 56, 58 } },
+    [999] = { 0x931020, 2, { 24, 96 } },
+    [1004] = { 0xB7C92B, 2, { 59, 92 } },
+    [1009] = { 0x0981F9, 2, { 13, 41 } },
+    [1011] = { 0x8AE449, 2, { 65, 86 } },
+    [1012] = { 0xA21E91, 2, { 60, 94 } },
+    [1014] = { 0xDA8D98, 2, { 48, 60 } },
+    [1015] = { 0x7F5EE8, 2, { 57, 58 } },
+    [1018] = { 0x8DC168, 2, { 43, 90 } },
+    [1020] = { 0x000012, 2, { 107, 110 } },
+    [1021] = { 0x57FAA6, 1, { 62, -1 } },
+    [1023] = { 0x05123A, 2, { 28, 53 } },
+    [1024] = { 0xEA2A42, 2, { 22, 42 } },
+    [1025] = { 0x00FCC3, 2, { 83, 86 } },
+    [1026] = { 0xF28BDC, 2, { 37, 73 } },
+    [1027] = { 0xFFF40D, 2, { 87, 109 } },
+    [1029] = { 0x6F8697, 2, { 2, 5 } },
+    [1030] = { 0xB848E1, 2, { 52, 60 } },
+    [1031] = { 0x6C7700, 2, { 76, 78 } },
+    [1034] = { 0x5C54BC, 2, { 8, 76 } },
+    [1037] = { 0x0070EC, 2, { 84, 104 } },
+    [1041] = { 0x003837, 2, { 85, 111 } },
+    [1047] = { 0x4EA208, 2, { 68, 90 } },
+    [1049] = { 0x8AF8D2, 2, { 65, 104 } },
+    [1052] = { 0xC8D449, 2, { 23, 91 } },
+    [1060] = { 0x0FFBC8, 2, { 50, 68 } },
+    [1061] = { 0x80765F, 2, { 58, 99 } },
+    [1062] = { 0xB454FD, 2, { 16, 39 } },
+    [1065] = { 0x822455, 2, { 12, 83 } },
+    [1067] = { 0xF18191, 2, { 27, 36 } },
+    [1068] = { 0xEBD62F, 2, { 10, 75 } },
+    [1069] = { 0xDF994C, 2, { 61, 76 } },
+    [1074] = { 0x76F478, 2, { 52, 68 } },
+    [1075] = { 0x8AF842, 2, { 65, 107 } },
+    [1077] = { 0x62275E, 2, { 2, 24 } },
+    [1079] = { 0xCAD4D1, 2, { 42, 68 } },
+    [1080] = { 0x954926, 2, { 49, 62 } },
+    [1086] = { 0x093102, 2, { 28, 100 } },
+    [1087] = { 0x2425E9, 2, { 50, 66 } },
+    [1088] = { 0x801633, 2, { 58, 84 } },
+    [1091] = { 0xE773D3, 2, { 4, 26 } },
+    [1094] = { 0x05891A, 2, { 11, 87 } },
+    [1098] = { 0x0E119B, 2, { 79, 86 } },
+    [1101] = { 0x20F054, 2, { 30, 67 } },
+    [1102] = { 0x3719BB, 2, { 41, 88 } },
+    [1103] = { 0x0E0DC0, 2, { 79, 105 } },
+    [1105] = { 0xD9512E, 2, { 23, 56 } },
+    [1106] = { 0xA9D45C, 2, { 35, 40 } },
+    [1107] = { 0x12BAF8, 2, { 21, 37 } },
+    [1112] = { 0xA45C5B, 2, { 23, 73 } },
+    [1124] = { 0x9B1FA3, 2, { 6, 63 } },
+    [1125] = { 0x850054, 2, { 34, 47 } },
+    [1126] = { 0x040002, 2, { 93, 110 } },
+    [1128] = { 0x81665F, 2, { 58, 95 } },
+    [1129] = { 0x9C40D9, 2, { 42, 77 } },
+    [1130] = { 0x5891A0, 2, { 7, 83 } },
+    [1131] = { 0x8DD441, 2, { 71, 88 } },
+    [1132] = { 0xAFF55C, 2, { 61, 107 } },
+    [1138] = { 0x1BA8C2, 2, { 70, 105 } },
+    [1139] = { 0x6860C2, 2, { 28, 50 } },
+    [1141] = { 0xC42C87, 2, { 39, 52 } },
+    [1145] = { 0x682E4A, 2, { 16, 105 } },
+    [1146] = { 0xD09051, 2, { 67, 71 } },
+    [1147] = { 0xCE8B5E, 2, { 14, 40 } },
+    [1154] = { 0x453C29, 2, { 66, 97 } },
+    [1158] = { 0x0EDE8F, 2, { 55, 71 } },
+    [1159] = { 0x51EF3A, 2, { 54, 62 } },
+    [1163] = { 0xBFDE5B, 2, { 42, 70 } },
+    [1168] = { 0x35B1A6, 2, { 40, 42 } },
+    [1170] = { 0xC4CF49, 2, { 23, 78 } },
+    [1172] = { 0x457829, 2, { 66, 101 } },
+    [1173] = { 0xE4092D, 2, { 64, 79 } },
+    [1176] = { 0xAB1605, 2, { 45, 58 } },
+    [1177] = { 0x3D089C, 2, { 33, 67 } },
+    [1179] = { 0x5B4E6E, 2, { 42, 57 } },
+    [1180] = { 0x44AED9, 2, { 42, 75 } },
+    [1183] = { 0x7A9B09, 2, { 48, 100 } },
+    [1184] = { 0x202000, 2, { 90, 98 } },
+    [1185] = { 0xFB7D13, 2, { 11, 95 } },
+    [1186] = { 0xEA1514, 2, { 67, 69 } },
+    [1187] = { 0xED4F6D, 2, { 40, 73 } },
+    [1188] = { 0xBA9842, 2, { 13, 93 } },
+    [1189] = { 0x038360, 1, { 81, -1 } },
+    [1191] = { 0xF78382, 2, { 18, 27 } },
+    [1194] = { 0xDD7AF7, 2, { 39, 95 } },
+    [1196] = { 0xDD5410, 2, { 67, 99 } },
+    [1198] = { 0x49C910, 2, { 25, 103 } },
+    [1202] = { 0xE119B0, 2, { 75, 82 } },
+    [1208] = { 0x00E0C8, 2, { 83, 107 } },
+    [1209] = { 0xA33CC0, 2, { 24, 51 } },
+    [1210] = { 0x882D6C, 2, { 7, 15 } },
+    [1212] = { 0x0C08EF, 2, { 10, 80 } },
+    [1213] = { 0x3094D6, 2, { 51, 85 } },
+    [1214] = { 0x1F22BF, 2, { 47, 64 } },
+    [1215] = { 0xBFC90B, 2, { 59, 106 } },
+    [1216] = { 0xF6A572, 2, { 47, 81 } },
+    [1217] = { 0x47EFC8, 2, { 0, 31 } },
+    [1218] = { 0x7EDA22, 1, { 31, -1 } },
+    [1219] = { 0x2F61D2, 2, { 29, 63 } },
+    [1220] = { 0x161C5A, 2, { 9, 109 } },
+    [1221] = { 0x15FE12, 2, { 47, 75 } },
+    [1224] = { 0x9655BE, 2, { 37, 52 } },
+    [1226] = { 0x9E96AE, 2, { 31, 33 } },
+    [1227] = { 0xDE31E9, 2, { 5, 89 } },
+    [1230] = { 0xB7375B, 2, { 58, 69 } },
+    [1236] = { 0x8AB852, 2, { 65, 97 } },
+    [1237] = { 0x002100, 2, { 98, 103 } },
+    [1242] = { 0x381223, 2, { 35, 103 } },
+    [1244] = { 0x9CA936, 2, { 21, 99 } },
+    [1245] = { 0x3B35EA, 2, { 0, 94 } },
+    [1247] = { 0xECA809, 2, { 46, 72 } },
+    [1251] = { 0x3B89F5, 2, { 38, 73 } },
+    [1253] = { 0x0DB4DC, 2, { 9, 70 } },
+    [1256] = { 0x160C5E, 2, { 9, 99 } },
+    [1257] = { 0xEA00AD, 2, { 64, 101 } },
+    [1260] = { 0x39D532, 2, { 0, 83 } },
+    [1262] = { 0xE0DC00, 2, { 75, 101 } },
+    [1264] = { 0x040C0E, 2, { 55, 80 } },
+    [1268] = { 0x5F0C21, 2, { 14, 97 } },
+    [1271] = { 0xF26592, 2, { 41, 66 } },
+    [1272] = { 0x0E91CC, 2, { 7, 44 } },
+    [1273] = { 0xF78434, 2, { 7, 61 } },
+    [1274] = { 0x87A6B2, 2, { 15, 62 } },
+    [1275] = { 0x200008, 2, { 90, 108 } },
+    [1276] = { 0x8B0E2F, 2, { 10, 88 } },
+    [1277] = { 0xFB3AF8, 2, { 14, 42 } },
+    [1279] = { 0x3C656C, 2, { 24, 61 } },
+    [1280] = { 0xBBDD36, 2, { 9, 43 } },
+    [1281] = { 0x400800, 2, { 89, 100 } },
+    [1282] = { 0x0E6591, 2, { 37, 58 } },
+    [1285] = { 0x5F4821, 2, { 14, 101 } },
+    [1287] = { 0x868665, 2, { 20, 89 } },
+    [1290] = { 0x9A906C, 2, { 43, 69 } },
+    [1295] = { 0x9B2107, 2, { 8, 41 } },
+    [1297] = { 0xD27777, 2, { 39, 79 } },
+    [1298] = { 0x2CFB93, 2, { 63, 80 } },
+    [1301] = { 0x0746C0, 2, { 80, 97 } },
+    [1302] = { 0xDEDB41, 2, { 47, 63 } },
+    [1305] = { 0x100040, 2, { 91, 105 } },
+    [1308] = { 0xF6CD0B, 2, { 28, 87 } },
+    [1309] = { 0xE71856, 2, { 6, 62 } },
+    [1310] = { 0xB86D73, 2, { 24, 63 } },
+    [1311] = { 0x9E33E9, 2, { 5, 102 } },
+    [1312] = { 0x52479B, 2, { 22, 78 } },
+    [1315] = { 0x408000, 2, { 89, 96 } },
+    [1316] = { 0x1C1B00, 1, { 78, -1 } },
+    [1317] = { 0xE57186, 2, { 18, 96 } },
+    [1318] = { 0x000108, 2, { 103, 108 } },
+    [1321] = { 0xC55A22, 2, { 48, 59 } },
+    [1326] = { 0xAD21B0, 2, { 43, 83 } },
+    [1327] = { 0x3E3465, 2, { 74, 84 } },
+    [1329] = { 0xC336E7, 2, { 49, 56 } },
+    [1330] = { 0x220000, 2, { 90, 94 } },
+    [1334] = { 0x282E0A, 2, { 16, 89 } },
+    [1335] = { 0xD0E06C, 2, { 33, 51 } },
+    [1336] = { 0x1292DC, 2, { 27, 83 } },
+    [1339] = { 0x10FC61, 2, { 6, 60 } },
+    [1342] = { 0x863C3B, 2, { 43, 63 } },
+    [1345] = { 0x8BE3C2, 2, { 60, 63 } },
+    [1347] = { 0x2E4409, 2, { 74, 91 } },
+    [1352] = { 0x848516, 2, { 45, 61 } },
+    [1357] = { 0x218567, 2, { 56, 90 } },
+    [1358] = { 0x6161F6, 2, { 50, 85 } },
+    [1362] = { 0xF4E7A2, 2, { 47, 82 } },
+    [1363] = { 0xB98D89, 2, { 23, 50 } },
+    [1365] = { 0xD45B89, 2, { 17, 33 } },
+    [1366] = { 0xB5488C, 2, { 14, 64 } },
+    [1368] = { 0x000A00, 2, { 100, 102 } },
+    [1370] = { 0x00A0D8, 2, { 83, 97 } },
+    [1373] = { 0xB83600, 2, { 77, 88 } },
+    [1374] = { 0x424B1E, 2, { 5, 39 } },
+    [1375] = { 0xD16B23, 2, { 59, 68 } },
+    [1377] = { 0x3BFD53, 2, { 63, 91 } },
+    [1379] = { 0x82AA55, 2, { 36, 50 } },
+    [1388] = { 0x375104, 1, { 69, -1 } },
+    [1391] = { 0x10FB41, 2, { 38, 62 } },
+    [1403] = { 0x96C1BF, 2, { 40, 80 } },
+    [1404] = { 0xD05C14, 1, { 15, -1 } },
+    [1405] = { 0x008200, 2, { 96, 102 } },
+    [1407] = { 0xB8C86D, 2, { 30, 66 } },
+    [1410] = { 0x000041, 2, { 105, 111 } },
+    [1411] = { 0xDFC182, 2, { 13, 50 } },
+    [1413] = { 0x9E31A9, 2, { 5, 105 } },
+    [1415] = { 0x2A4404, 2, { 27, 77 } },
+    [1416] = { 0x368724, 2, { 3, 22 } },
+    [1417] = { 0x3B6D11, 2, { 32, 93 } },
+    [1420] = { 0xA07A52, 2, { 15, 34 } },
+    [1422] = { 0x795502, 2, { 28, 76 } },
+    [1423] = { 0x9CB976, 2, { 21, 105 } },
+    [1426] = { 0x0AF852, 2, { 65, 88 } },
+    [1427] = { 0x55FAA6, 2, { 62, 94 } },
+    [1429] = { 0x0302CE, 2, { 55, 100 } },
+    [1430] = { 0x6A04AD, 2, { 64, 88 } },
+    [1432] = { 0xC014BB, 2, { 4, 81 } },
+    [1433] = { 0x5A3E2A, 2, { 26, 31 } },
+    [1434] = { 0xA7D9E7, 2, { 38, 75 } },
+    [1435] = { 0x341704, 2, { 17, 111 } },
+    [1438] = { 0xA01E91, 1, { 60, -1 } },
+    [1440] = { 0xE0D810, 2, { 75, 107 } },
+    [1441] = { 0xE2F395, 2, { 36, 95 } },
+    [1445] = { 0x252EEA, 2, { 0, 78 } },
+    [1446] = { 0x401C1B, 2, { 86, 89 } },
+    [1453] = { 0x40C89C, 2, { 3, 35 } },
+    [1456] = { 0xFEF409, 2, { 87, 95 } },
+    [1457] = { 0xBCEE02, 2, { 25, 47 } },
+    [1462] = { 0xBA3A2C, 2, { 40, 63 } },
+    [1464] = { 0x0706D0, 2, { 80, 107 } },
+    [1466] = { 0xD14FEF, 2, { 14, 37 } },
+    [1467] = { 0x0B4E2F, 2, { 10, 97 } },
+    [1468] = { 0xE3F391, 2, { 36, 109 } },
+    [1469] = { 0xAB705A, 2, { 45, 88 } },
+    [1470] = { 0xFC633F, 2, { 2, 71 } },
+    [1472] = { 0xD8D409, 2, { 23, 105 } },
+    [1473] = { 0xAB10BE, 2, { 10, 60 } },
+    [1474] = { 0xD8FECB, 2, { 42, 73 } },
+    [1475] = { 0x3EA4D1, 2, { 74, 83 } },
+    [1476] = { 0x00000A, 2, { 108, 110 } },
+    [1482] = { 0x0DD451, 2, { 71, 107 } },
+    [1483] = { 0x915601, 2, { 68, 87 } },
+    [1486] = { 0x6609FC, 2, { 1, 48 } },
+    [1487] = { 0x8147ED, 2, { 12, 81 } },
+    [1488] = { 0x070640, 2, { 80, 104 } },
+    [1491] = { 0xC29380, 2, { 49, 98 } },
+    [1493] = { 0xB0E3F0, 2, { 6, 103 } },
+    [1497] = { 0x0503AF, 2, { 10, 79 } },
+    [1498] = { 0xAC16F7, 2, { 39, 76 } },
+    [1499] = { 0x3F6D91, 2, { 32, 104 } },
+    [1505] = { 0x01C1A0, 2, { 82, 107 } },
+    [1507] = { 0xE672E6, 2, { 18, 81 } },
+    [1508] = { 0x604778, 2, { 7, 77 } },
+    [1509] = { 0xE383F9, 2, { 36, 84 } },
+    [1510] = { 0xE3E395, 2, { 36, 99 } },
+    [1511] = { 0x1BC275, 2, { 20, 67 } },
+    [1516] = { 0x28573E, 2, { 7, 34 } },
+    [1521] = { 0xD68665, 2, { 20, 91 } },
+    [1522] = { 0xA28342, 2, { 13, 78 } },
+    [1524] = { 0x1E0D80, 2, { 79, 91 } },
+    [1525] = { 0xFFE409, 2, { 87, 99 } },
+    [1526] = { 0xFDB454, 2, { 30, 107 } },
+    [1528] = { 0x86EBF2, 2, { 4, 66 } },
+    [1531] = { 0x020002, 2, { 94, 110 } },
+    [1533] = { 0x241705, 2, { 17, 91 } },
+    [1535] = { 0x7DF207, 2, { 34, 71 } },
+    [1537] = { 0x895F5D, 2, { 28, 58 } },
+    [1538] = { 0xBF492B, 2, { 59, 96 } },
+    [1539] = { 0x001E1B, 2, { 86, 102 } },
+    [1540] = { 0xB0E2D0, 2, { 6, 106 } },
+    [1541] = { 0xDB1001, 2, { 26, 87 } },
+    [1544] = { 0xF910A4, 2, { 72, 104 } },
+    [1546] = { 0x6A62F2, 2, { 58, 64 } },
+    [1549] = { 0xFFB8B7, 2, { 57, 96 } },
+    [1550] = { 0xE4D800, 2, { 75, 93 } },
+    [1552] = { 0x3FD4AC, 2, { 16, 62 } },
+    [1553] = { 0x6119C0, 2, { 50, 97 } },
+    [1555] = { 0x82C4AD, 2, { 12, 106 } },
+    [1558] = { 0x80665B, 2, { 58, 109 } },
+    [1559] = { 0xFCBBD7, 2, { 57, 81 } },
+    [1560] = { 0x57DAA6, 2, { 62, 98 } },
+    [1561] = { 0x5374FF, 2, { 40, 49 } },
+    [1562] = { 0x21ECFD, 2, { 8, 71 } },
+    [1563] = { 0x387600, 2, { 77, 97 } },
+    [1565] = { 0x3086B9, 2, { 22, 31 } },
+    [1568] = { 0xE2D658, 2, { 16, 65 } },
+    [1569] = { 0x6395CA, 2, { 36, 58 } },
+    [1570] = { 0xBFC12B, 2, { 59, 100 } },
+    [1571] = { 0x5F85A7, 2, { 33, 59 } },
+    [1572] = { 0x14B82D, 2, { 46, 95 } },
+    [1573] = { 0xFB84F8, 2, { 4, 35 } },
+    [1575] = { 0xD91EAE, 2, { 8, 47 } },
+    [1576] = { 0x62B84A, 2, { 25, 45 } },
+    [1577] = { 0xAFF090, 2, { 44, 72 } },
+    [1578] = { 0x782E0A, 2, { 16, 91 } },
+    [1581] = { 0xD07291, 2, { 60, 76 } },
+    [1582] = { 0x6CFCB4, 2, { 38, 63 } },
+    [1585] = { 0xA2210D, 2, { 61, 71 } },
+    [1590] = { 0x43CC34, 2, { 15, 24 } },
+    [1597] = { 0xD569BC, 2, { 32, 64 } },
+    [1599] = { 0x15B829, 2, { 46, 109 } },
+    [1600] = { 0x06C770, 2, { 80, 82 } },
+    [1601] = { 0xD50008, 2, { 23, 71 } },
+    [1604] = { 0x4AEF39, 2, { 47, 59 } },
+    [1606] = { 0x18BC2F, 2, { 22, 44 } },
+    [1613] = { 0x1CFBD8, 2, { 78, 83 } },
+    [1616] = { 0x5BD19E, 2, { 53, 62 } },
+    [1617] = { 0x70701B, 2, { 76, 86 } },
+    [1620] = { 0x9F628F, 2, { 18, 48 } },
+    [1621] = { 0x0C2938, 2, { 53, 102 } },
+    [1622] = { 0x7E0F88, 2, { 29, 48 } },
+    [1623] = { 0x7CDA22, 2, { 31, 94 } },
+    [1624] = { 0xC7C209, 2, { 77, 87 } },
+    [1625] = { 0xDC7AF3, 2, { 39, 109 } },
+    [1626] = { 0x24EC08, 2, { 26, 100 } },
+    [1628] = { 0x9E31ED, 2, { 5, 109 } },
+    [1630] = { 0x189AF5, 2, { 1, 93 } },
+    [1631] = { 0x187670, 2, { 52, 98 } },
+    [1632] = { 0x8E0BCE, 2, { 37, 100 } },
+    [1633] = { 0x1AC931, 2, { 18, 57 } },
+    [1634] = { 0x834FBD, 2, { 2, 19 } },
+    [1635] = { 0xDDA4C8, 2, { 67, 83 } },
+    [1636] = { 0x2B745A, 2, { 45, 101 } },
+    [1637] = { 0x400020, 2, { 89, 106 } },
+    [1638] = { 0xB86DD9, 2, { 42, 78 } },
+    [1639] = { 0x0776AC, 2, { 80, 84 } },
+    [1640] = { 0x776AC0, 2, { 76, 80 } },
+    [1641] = { 0xA74D6B, 2, { 33, 38 } },
+    [1642] = { 0x3935EA, 1, { 0, -1 } },
+    [1643] = { 0xCAE540, 2, { 30, 69 } },
+    [1644] = { 0x1AFC92, 2, { 20, 39 } },
+    [1645] = { 0x001800, 2, { 99, 100 } },
+    [1646] = { 0x522C1B, 2, { 23, 65 } },
+    [1647] = { 0xF1B76E, 2, { 2, 107 } },
+    [1648] = { 0xADDD73, 2, { 43, 86 } },
+    [1649] = { 0x570E2D, 2, { 27, 66 } },
+    [1651] = { 0x0C15F1, 2, { 71, 82 } },
+    [1654] = { 0x9F31E9, 2, { 5, 95 } },
+    [1655] = { 0x4711E7, 2, { 38, 99 } },
+    [1656] = { 0xB5A6BC, 2, { 46, 60 } },
+    [1657] = { 0xBE5DDA, 2, { 3, 20 } },
+    [1658] = { 0xFEBE8A, 2, { 30, 55 } },
+    [1659] = { 0xBC1DD0, 2, { 50, 67 } },
+    [1660] = { 0x1BA883, 2, { 70, 111 } },
+    [1661] = { 0xDC4410, 2, { 67, 95 } },
+    [1666] = { 0x2C008A, 2, { 8, 85 } },
+    [1667] = { 0x12BEED, 2, { 46, 80 } },
+    [1672] = { 0x009000, 2, { 96, 99 } },
+    [1673] = { 0x18ECF7, 2, { 41, 61 } },
+    [1675] = { 0x8E83CE, 2, { 37, 96 } },
+    [1676] = { 0x9AC950, 2, { 10, 40 } },
+    [1677] = { 0x590EB5, 2, { 60, 72 } },
+    [1678] = { 0x3E4609, 2, { 74, 102 } },
+    [1679] = { 0x6EBE13, 2, { 68, 86 } },
+    [1680] = { 0xE3F3D5, 2, { 36, 105 } },
+    [1681] = { 0x921AD1, 2, { 5, 53 } },
+    [1682] = { 0xF21B3E, 2, { 21, 68 } },
+    [1685] = { 0xA5C53C, 2, { 7, 30 } },
+    [1686] = { 0x9A92FD, 2, { 12, 52 } },
+    [1687] = { 0x6EA608, 2, { 68, 101 } },
+    [1692] = { 0xD9300E, 2, { 5, 38 } },
+    [1696] = { 0x425423, 2, { 19, 51 } },
+    [1697] = { 0xAF1594, 2, { 61, 83 } },
+    [1698] = { 0xFFF449, 2, { 87, 105 } },
+    [1700] = { 0x3F6911, 2, { 32, 101 } },
+    [1701] = { 0xC51A76, 2, { 58, 66 } },
+    [1702] = { 0x137204, 2, { 27, 95 } },
+    [1710] = { 0xF9E195, 2, { 54, 87 } },
+    [1711] = { 0x010800, 2, { 95, 100 } },
+    [1715] = { 0x25616F, 2, { 26, 56 } },
+    [1716] = { 0xD9D449, 2, { 23, 95 } },
+    [1720] = { 0x000220, 2, { 102, 106 } },
+    [1722] = { 0x049CA1, 2, { 29, 106 } },
+    [1723] = { 0x49B87C, 2, { 25, 84 } },
+    [1730] = { 0x0F0E2F, 2, { 10, 93 } },
+    [1732] = { 0x200000, 1, { 90, -1 } },
+    [1733] = { 0xFE716E, 2, { 56, 87 } },
+    [1734] = { 0xE0CC8C, 2, { 33, 96 } },
+    [1738] = { 0x712646, 2, { 34, 95 } },
+    [1739] = { 0xF5C6CA, 2, { 47, 83 } },
+    [1741] = { 0xF51E24, 2, { 47, 85 } },
+    [1744] = { 0x018000, 2, { 95, 96 } },
+    [1746] = { 0x87274D, 2, { 30, 48 } },
+    [1751] = { 0x54F068, 2, { 55, 62 } },
+    [1764] = { 0xA0FE49, 2, { 60, 83 } },
+    [1765] = { 0x741705, 2, { 17, 89 } },
+    [1767] = { 0x8AC48D, 2, { 12, 92 } },
+    [1769] = { 0x090B40, 2, { 79, 80 } },
+    [1770] = { 0xFCFB0D, 2, { 19, 37 } },
+    [1771] = { 0x587978, 2, { 7, 100 } },
+    [1772] = { 0x010567, 2, { 56, 96 } },
+    [1773] = { 0x42C63F, 2, { 10, 25 } },
+    [1774] = { 0x000100, 1, { 103, -1 } },
+    [1775] = { 0x5BD0A0, 2, { 14, 29 } },
+    [1776] = { 0xCD3531, 2, { 35, 47 } },
+    [1777] = { 0x82F852, 2, { 65, 92 } },
+    [1780] = { 0x95776F, 2, { 4, 44 } },
+    [1782] = { 0x92CDB1, 2, { 40, 55 } },
+    [1787] = { 0xE2F746, 2, { 18, 80 } },
+    [1789] = { 0xE204AD, 2, { 64, 92 } },
+    [1793] = { 0x355104, 2, { 69, 94 } },
+    [1794] = { 0xC15F10, 2, { 67, 78 } },
+    [1795] = { 0xEAC08F, 2, { 38, 43 } },
+    [1803] = { 0x81A7EF, 2, { 58, 82 } },
+    [1804] = { 0x574C21, 2, { 14, 92 } },
+    [1805] = { 0x58F178, 2, { 7, 96 } },
+    [1807] = { 0x239E82, 2, { 70, 77 } },
+    [1811] = { 0x15B86D, 2, { 46, 105 } },
+    [1813] = { 0x657C29, 2, { 66, 90 } },
+    [1815] = { 0x956511, 2, { 13, 63 } },
+    [1816] = { 0x56E0F4, 2, { 44, 105 } },
+    [1817] = { 0x97E66F, 2, { 35, 61 } },
+    [1822] = { 0xE6FB48, 2, { 18, 55 } },
+    [1826] = { 0xF1B37E, 2, { 2, 101 } },
+    [1827] = { 0x8CEDCE, 2, { 54, 65 } },
+    [1830] = { 0x3C3600, 2, { 77, 93 } },
+    [1831] = { 0x62530E, 2, { 50, 55 } },
+    [1832] = { 0xFA7D53, 2, { 11, 105 } },
+    [1833] = { 0x100001, 2, { 91, 111 } },
+    [1836] = { 0xE45C8B, 2, { 70, 87 } },
+    [1837] = { 0x72B908, 2, { 68, 78 } },
+    [1839] = { 0xC0C4B6, 2, { 6, 34 } },
+    [1840] = { 0x0726C0, 2, { 80, 98 } },
+    [1841] = { 0x6A5DAB, 2, { 41, 67 } },
+    [1842] = { 0x6698F4, 2, { 20, 60 } },
+    [1843] = { 0x4EBC43, 2, { 22, 83 } },
+    [1844] = { 0x53FAA6, 2, { 62, 93 } },
+    [1845] = { 0x708578, 2, { 43, 67 } },
+    [1846] = { 0x683A70, 2, { 52, 76 } },
+    [1847] = { 0x00485A, 2, { 84, 85 } },
+    [1848] = { 0xBCE419, 2, { 44, 64 } },
+    [1849] = { 0x536719, 2, { 14, 53 } },
+    [1850] = { 0x0089AE, 2, { 55, 81 } },
+    [1851] = { 0x301098, 2, { 15, 33 } },
+    [1852] = { 0x72F8E3, 2, { 19, 106 } },
+    [1853] = { 0x3E4AB8, 2, { 8, 27 } },
+    [1854] = { 0x480000, 2, { 89, 92 } },
+    [1855] = { 0x6DA6E0, 2, { 6, 67 } },
+    [1856] = { 0x738FBB, 2, { 39, 61 } },
+    [1858] = { 0x0DF441, 2, { 71, 98 } },
+    [1859] = { 0x457D29, 2, { 66, 103 } },
+    [1863] = { 0xFBA436, 2, { 29, 57 } },
+    [1864] = { 0xB062F0, 2, { 6, 96 } },
+    [1865] = { 0xC12624, 2, { 72, 77 } },
+    [1867] = { 0x6EA218, 2, { 68, 107 } },
+    [1872] = { 0x1135C0, 2, { 50, 76 } },
+    [1875] = { 0x80645F, 2, { 58, 102 } },
+    [1876] = { 0x68E10D, 2, { 27, 48 } },
+    [1879] = { 0xE55733, 2, { 35, 67 } },
+    [1880] = { 0x20706C, 2, { 84, 90 } },
+    [1882] = { 0x114EB4, 2, { 1, 71 } },
+    [1883] = { 0x8E03CC, 2, { 37, 110 } },
+    [1886] = { 0xBFF409, 2, { 87, 89 } },
+    [1888] = { 0x80A43A, 2, { 32, 59 } },
+    [1892] = { 0xAAF852, 2, { 65, 90 } },
+    [1898] = { 0xB3CDB8, 2, { 0, 65 } },
+    [1905] = { 0x8336D6, 2, { 14, 39 } },
+    [1906] = { 0x12C8B9, 2, { 0, 63 } },
+    [1907] = { 0x457C09, 2, { 66, 106 } },
+    [1911] = { 0x9906DE, 2, { 39, 66 } },
+    [1917] = { 0xA10501, 2, { 63, 65 } },
+    [1918] = { 0x011A12, 2, { 44, 62 } },
+    [1919] = { 0xD33E48, 2, { 20, 46 } },
+    [1920] = { 0x0DD449, 2, { 71, 108 } },
+    [1921] = { 0x00716C, 2, { 84, 103 } },
+    [1922] = { 0x7F4C21, 2, { 14, 90 } },
+    [1923] = { 0x791024, 2, { 72, 88 } },
+    [1924] = { 0x206070, 2, { 52, 77 } },
+    [1926] = { 0x0706C8, 2, { 80, 108 } },
+    [1927] = { 0x2F705A, 2, { 45, 93 } },
+    [1932] = { 0x000002, 1, { 110, -1 } },
+    [1933] = { 0x0CC743, 2, { 12, 37 } },
+    [1934] = { 0x080200, 2, { 92, 102 } },
+    [1935] = { 0x0C9C81, 2, { 29, 92 } },
+    [1936] = { 0xE2D800, 2, { 75, 94 } },
+    [1937] = { 0x265827, 2, { 38, 50 } },
+    [1938] = { 0x0CE412, 2, { 73, 76 } },
+    [1939] = { 0x060987, 2, { 54, 86 } },
+    [1940] = { 0xEA05AD, 2, { 64, 103 } },
+    [1941] = { 0x409E2B, 2, { 31, 74 } },
+    [1942] = { 0xDC78F7, 2, { 39, 102 } },
+    [1943] = { 0x3E5409, 2, { 74, 99 } },
+    [1945] = { 0xC6C1E3, 2, { 0, 87 } },
+    [1946] = { 0x52F8C3, 2, { 19, 90 } },
+    [1947] = { 0xE65788, 2, { 26, 49 } },
+    [1948] = { 0xC397DF, 2, { 4, 109 } },
+    [1950] = { 0x640763, 2, { 37, 64 } },
+    [1951] = { 0x1C2B38, 2, { 53, 91 } },
+    [1952] = { 0x4A299A, 2, { 45, 50 } },
+    [1957] = { 0x46159C, 2, { 54, 89 } },
+    [1962] = { 0xCF9457, 2, { 51, 57 } },
+    [1966] = { 0xDF38B7, 2, { 57, 90 } },
+    [1967] = { 0x5F4D21, 2, { 14, 103 } },
+    [1974] = { 0x00704C, 2, { 84, 106 } },
+    [1976] = { 0x83D78F, 2, { 37, 71 } },
+    [1977] = { 0x2C38BC, 1, { 8, -1 } },
+    [1978] = { 0x69BEAF, 2, { 62, 74 } },
+    [1982] = { 0xFDB44C, 2, { 30, 108 } },
+    [1983] = { 0xFF8465, 2, { 84, 87 } },
+    [1984] = { 0xBC69A2, 2, { 31, 49 } },
+    [1985] = { 0x39788D, 2, { 32, 54 } },
+    [1987] = { 0x3E440D, 2, { 74, 109 } },
+    [1989] = { 0x8E03EE, 2, { 37, 106 } },
+    [1990] = { 0xEA048D, 2, { 64, 106 } },
+    [1991] = { 0x0FD441, 2, { 71, 94 } },
+    [1997] = { 0x4E5E9B, 2, { 22, 102 } },
+    [1998] = { 0x897C24, 2, { 72, 76 } },
+    [2001] = { 0x001020, 2, { 99, 106 } },
+    [2003] = { 0x748E60, 2, { 4, 41 } },
+    [2005] = { 0x728592, 2, { 73, 79 } },
+    [2006] = { 0x1C6B6C, 2, { 78, 84 } },
+    [2007] = { 0x1A319F, 2, { 11, 33 } },
+    [2015] = { 0x457C2B, 2, { 66, 110 } },
+    [2016] = { 0x1303F2, 2, { 12, 40 } },
+    [2017] = { 0xE5ED9D, 2, { 18, 86 } },
+    [2019] = { 0x5F4C01, 2, { 14, 106 } },
+    [2020] = { 0x0A2474, 2, { 27, 52 } },
+    [2021] = { 0xBA7D13, 2, { 11, 89 } },
+    [2022] = { 0xB711BB, 2, { 41, 100 } },
+    [2023] = { 0x00B836, 2, { 85, 96 } },
+    [2025] = { 0x20E0D8, 2, { 83, 90 } },
+    [2028] = { 0xC8394F, 2, { 3, 6 } },
+    [2030] = { 0xBFEBE5, 2, { 2, 22 } },
+    [2031] = { 0x7204BC, 2, { 26, 44 } },
+    [2033] = { 0xFEBDD0, 2, { 56, 57 } },
+    [2034] = { 0xB476D9, 2, { 42, 91 } },
+    [2036] = { 0x76B831, 2, { 48, 53 } },
+    [2037] = { 0xAFF54C, 1, { 61, -1 } },
+    [2038] = { 0x3EACA1, 2, { 32, 82 } },
+    [2041] = { 0x000024, 2, { 106, 109 } },
+    [2048] = { 0x69303F, 2, { 46, 73 } },
+    [2050] = { 0x01F986, 2, { 82, 85 } },
+    [2051] = { 0x41147B, 2, { 38, 54 } },
+    [2054] = { 0xFAA0A3, 2, { 35, 49 } },
+    [2056] = { 0xE04CAC, 2, { 33, 106 } },
+    [2058] = { 0xDF0D2E, 2, { 1, 4 } },
+    [2059] = { 0xD8EE00, 2, { 75, 77 } },
+    [2062] = { 0xA1DF21, 2, { 60, 82 } },
+    [2063] = { 0x7AF8C3, 2, { 19, 92 } },
+    [2064] = { 0xB8A978, 2, { 7, 75 } },
+    [2069] = { 0x010020, 2, { 95, 106 } },
+    [2071] = { 0x0B2DF8, 2, { 53, 80 } },
+    [2073] = { 0x00E1D8, 2, { 83, 103 } },
+    [2076] = { 0x732C88, 2, { 34, 55 } },
+    [2083] = { 0x0C3723, 2, { 53, 86 } },
+    [2085] = { 0x8ABEB6, 2, { 62, 67 } },
+    [2087] = { 0x00706E, 2, { 84, 110 } },
+    [2091] = { 0x9D4410, 2, { 67, 89 } },
+    [2094] = { 0x2BA08D, 2, { 21, 41 } },
+    [2097] = { 0x02DE85, 2, { 19, 34 } },
+    [2098] = { 0xEA04AF, 2, { 64, 110 } },
+    [2099] = { 0x5EBE7A, 2, { 12, 39 } },
+    [2100] = { 0x57BAA6, 2, { 62, 97 } },
+    [2101] = { 0xA06EFD, 2, { 60, 84 } },
+    [2103] = { 0xFA9309, 2, { 48, 88 } },
+    [2105] = { 0x381333, 2, { 35, 107 } },
+    [2107] = { 0x7EDAA2, 2, { 31, 104 } },
+    [2110] = { 0xAC00D8, 2, { 43, 82 } },
+    [2111] = { 0x0D22EF, 2, { 0, 17 } },
+    [2112] = { 0x1FF790, 2, { 49, 67 } },
+    [2115] = { 0x3CB278, 2, { 26, 52 } },
+    [2121] = { 0x9E21E9, 2, { 5, 99 } },
+    [2122] = { 0x6897B7, 2, { 32, 62 } },
+    [2128] = { 0xE3EF09, 2, { 78, 87 } },
+    [2129] = { 0x385195, 2, { 54, 74 } },
+    [2130] = { 0xBF9421, 2, { 14, 75 } },
+    [2131] = { 0xE5E609, 2, { 36, 54 } },
+    [2132] = { 0x127200, 2, { 27, 109 } },
+    [2133] = { 0xB83950, 2, { 38, 57 } },
+    [2137] = { 0x2A3CE3, 2, { 63, 82 } },
+    [2140] = { 0x706C01, 2, { 76, 111 } },
+    [2142] = { 0x9BE6A3, 2, { 4, 7 } },
+    [2145] = { 0xD53E2B, 2, { 12, 62 } },
+    [2149] = { 0xEDE8F0, 2, { 51, 67 } },
+    [2155] = { 0xC44EBC, 2, { 1, 23 } },
+    [2161] = { 0xE9BCE7, 2, { 1, 47 } },
+    [2165] = { 0x185670, 1, { 52, -1 } },
+    [2168] = { 0x103C67, 2, { 59, 61 } },
+    [2169] = { 0x5E64E4, 2, { 7, 54 } },
+    [2171] = { 0x484BD2, 2, { 49, 65 } },
+    [2172] = { 0x126204, 2, { 27, 99 } },
+    [2178] = { 0x383608, 2, { 77, 108 } },
+    [2186] = { 0x4E2CF7, 2, { 22, 84 } },
+    [2187] = { 0xD8C449, 2, { 23, 99 } },
+    [2188] = { 0x0B1234, 2, { 10, 86 } },
+    [2189] = { 0xF81AFC, 2, { 33, 52 } },
+    [2190] = { 0x42CC1B, 2, { 73, 74 } },
+    [2191] = { 0xEE982C, 2, { 29, 64 } },
+    [2193] = { 0x335104, 2, { 69, 93 } },
+    [2194] = { 0x4BBE50, 2, { 13, 47 } },
+    [2196] = { 0x351705, 2, { 17, 95 } },
+    [2197] = { 0x90665F, 2, { 58, 91 } },
+    [2198] = { 0x1C2336, 2, { 78, 85 } },
+    [2200] = { 0xC00000, 2, { 88, 89 } },
+    [2202] = { 0x68D75B, 2, { 40, 72 } },
+    [2203] = { 0x41E0A8, 2, { 29, 66 } },
+    [2204] = { 0x1C1B80, 2, { 78, 104 } },
+    [2206] = { 0x6E3376, 2, { 40, 87 } },
+    [2214] = { 0x081000, 2, { 92, 99 } },
+    [2215] = { 0x2575F0, 2, { 20, 36 } },
+    [2217] = { 0x6EF397, 2, { 35, 44 } },
+    [2220] = { 0x42B380, 2, { 49, 88 } },
+    [2221] = { 0xCDF9B5, 2, { 38, 65 } },
+    [2222] = { 0x3C87D8, 2, { 51, 53 } },
+    [2223] = { 0x4739D1, 2, { 38, 85 } },
+    [2231] = { 0x00E0DA, 2, { 83, 110 } },
+    [2232] = { 0x3A3600, 2, { 77, 94 } },
+    [2233] = { 0x5D6BD7, 2, { 13, 36 } },
+    [2234] = { 0x299376, 2, { 4, 64 } },
+    [2235] = { 0x4BD916, 2, { 69, 73 } },
+    [2240] = { 0x1C5ACB, 2, { 19, 68 } },
+    [2241] = { 0x273B61, 2, { 32, 52 } },
+    [2252] = { 0x080004, 2, { 92, 109 } },
+    [2253] = { 0xEE17AF, 2, { 5, 34 } },
+    [2254] = { 0x1783BA, 2, { 53, 70 } },
+    [2255] = { 0x4F2D4C, 2, { 61, 75 } },
+    [2256] = { 0x13592A, 2, { 13, 43 } },
+    [2262] = { 0x457429, 2, { 66, 100 } },
+    [2264] = { 0xE84C8C, 2, { 33, 92 } },
+    [2268] = { 0xB12340, 2, { 6, 82 } },
+    [2273] = { 0xF11024, 2, { 72, 92 } },
+    [2276] = { 0xD0C184, 2, { 27, 49 } },
+    [2277] = { 0x375184, 2, { 69, 104 } },
+    [2278] = { 0x0E10AF, 2, { 46, 70 } },
+    [2279] = { 0x090000, 2, { 92, 95 } },
+    [2280] = { 0x849C81, 2, { 29, 88 } },
+    [2281] = { 0xC4911B, 2, { 4, 80 } },
+    [2283] = { 0x5CF489, 2, { 10, 62 } },
+    [2284] = { 0x3E7C3F, 2, { 74, 85 } },
+    [2285] = { 0x88F1D3, 2, { 6, 35 } },
+    [2286] = { 0x8F54B7, 2, { 57, 76 } },
+    [2287] = { 0x800200, 2, { 88, 102 } },
+    [2290] = { 0x7AD309, 2, { 48, 97 } },
+    [2291] = { 0xD05C94, 2, { 15, 104 } },
+    [2296] = { 0x94B971, 2, { 45, 59 } },
+    [2297] = { 0xE33DAF, 2, { 28, 64 } },
+    [2303] = { 0x1FD7BA, 2, { 59, 60 } },
+    [2305] = { 0x3CA2F7, 2, { 39, 75 } },
+    [2306] = { 0x4E5C9F, 2, { 22, 109 } },
+    [2307] = { 0x37E653, 2, { 63, 78 } },
+    [2311] = { 0x8A7852, 2, { 65, 96 } },
+    [2315] = { 0xA3DE74, 2, { 53, 61 } },
+    [2316] = { 0x1DBD1E, 2, { 54, 70 } },
+    [2317] = { 0xD05C04, 2, { 15, 107 } },
+    [2319] = { 0x713B79, 2, { 37, 57 } },
+    [2320] = { 0xD10D49, 2, { 11, 45 } },
+    [2321] = { 0x6B470D, 2, { 20, 43 } },
+    [2327] = { 0xE7B958, 2, { 23, 32 } },
+    [2330] = { 0xA01E81, 2, { 60, 107 } },
+    [2334] = { 0x690BC7, 2, { 36, 65 } },
+    [2335] = { 0x4F5C9B, 2, { 22, 95 } },
+    [2337] = { 0xB49ADB, 2, { 41, 81 } },
+    [2341] = { 0x560AEB, 2, { 22, 52 } },
+    [2345] = { 0x68163C, 2, { 16, 85 } },
+    [2346] = { 0x8AF052, 2, { 65, 100 } },
+    [2350] = { 0x127244, 2, { 27, 105 } },
+    [2351] = { 0x387EFD, 2, { 1, 26 } },
+    [2352] = { 0x895DB2, 2, { 41, 74 } },
+    [2353] = { 0xE0D800, 1, { 75, -1 } },
+    [2354] = { 0x7A1138, 2, { 32, 66 } },
+    [2355] = { 0xF53612, 2, { 47, 99 } },
+    [2356] = { 0x000840, 2, { 100, 105 } },
+    [2358] = { 0xB69CDC, 2, { 41, 56 } },
+    [2360] = { 0x6B634C, 2, { 39, 41 } },
+    [2364] = { 0xDD02F4, 2, { 62, 65 } },
+    [2365] = { 0xE46289, 2, { 3, 21 } },
+    [2370] = { 0x26A41B, 2, { 45, 71 } },
+    [2373] = { 0x400400, 2, { 89, 101 } },
+    [2377] = { 0x0706C0, 1, { 80, -1 } },
+    [2378] = { 0x836C91, 2, { 55, 58 } },
+    [2379] = { 0x493902, 2, { 28, 89 } },
+    [2384] = { 0xFE9546, 2, { 20, 35 } },
+    [2385] = { 0xAB9B0C, 2, { 58, 63 } },
+    [2388] = { 0x404000, 2, { 89, 97 } },
+    [2390] = { 0xAB02BB, 2, { 41, 78 } },
+    [2395] = { 0x0DD441, 1, { 71, -1 } },
+    [2397] = { 0x939220, 2, { 24, 102 } },
+    [2402] = { 0x0DA1C9, 2, { 5, 24 } },
+    [2414] = { 0xF2F8C3, 2, { 19, 88 } },
+    [2415] = { 0xF52616, 2, { 47, 109 } },
+    [2420] = { 0x4E099F, 2, { 41, 72 } },
+    [2421] = { 0x4D1968, 2, { 43, 75 } },
+    [2422] = { 0x01C190, 2, { 82, 106 } },
+    [2424] = { 0xAECBA6, 2, { 43, 55 } },
+    [2425] = { 0xDD4411, 2, { 67, 111 } },
+    [2426] = { 0x1811DE, 2, { 9, 79 } },
+    [2427] = { 0x6129AC, 2, { 50, 84 } },
+    [2428] = { 0xAE9D09, 2, { 5, 51 } },
+    [2432] = { 0x5ACB8C, 2, { 44, 53 } },
+    [2433] = { 0x2C38B4, 2, { 8, 108 } },
+    [2435] = { 0xF91124, 2, { 72, 103 } },
+    [2436] = { 0x5EC3A4, 2, { 28, 62 } },
+    [2437] = { 0x9496E0, 2, { 24, 80 } },
+    [2438] = { 0x149AF5, 2, { 1, 92 } },
+    [2439] = { 0xFDB444, 1, { 30, -1 } },
+    [2440] = { 0x2BFC24, 2, { 46, 74 } },
+    [2441] = { 0xD8CB23, 2, { 35, 75 } },
+    [2443] = { 0x1B3F2D, 2, { 40, 65 } },
+    [2444] = { 0x10F30D, 2, { 17, 26 } },
+    [2445] = { 0xFAB502, 2, { 59, 66 } },
+    [2447] = { 0x355A6F, 2, { 34, 66 } },
+    [2448] = { 0xADF54C, 2, { 61, 94 } },
+    [2449] = { 0x354002, 2, { 25, 73 } },
+    [2454] = { 0x7A9319, 2, { 48, 107 } },
+    [2455] = { 0x093B02, 2, { 28, 102 } },
+    [2457] = { 0x371104, 2, { 69, 97 } },
+    [2458] = { 0x8DFE92, 2, { 65, 80 } },
+    [2459] = { 0x32B950, 2, { 32, 71 } },
+    [2462] = { 0x000600, 2, { 101, 102 } },
+    [2463] = { 0x2D69AF, 2, { 48, 62 } },
+    [2464] = { 0x5150CB, 2, { 42, 47 } },
+    [2475] = { 0x004200, 2, { 97, 102 } },
+    [2480] = { 0x383323, 2, { 35, 98 } },
+    [2484] = { 0x702446, 2, { 34, 102 } },
+    [2485] = { 0xF91004, 2, { 72, 106 } },
+    [2486] = { 0xD9BBB3, 2, { 41, 68 } },
+    [2490] = { 0x82C40D, 2, { 12, 104 } },
+    [2494] = { 0x91C77D, 2, { 40, 110 } },
+    [2496] = { 0x7713EA, 2, { 37, 72 } },
+    [2501] = { 0x4FB9C0, 2, { 33, 61 } },
+    [2502] = { 0x77863D, 2, { 10, 73 } },
+    [2503] = { 0xAFF544, 2, { 61, 108 } },
+    [2505] = { 0x9B282A, 2, { 3, 36 } },
+    [2506] = { 0x1B69B8, 2, { 8, 69 } },
+    [2508] = { 0xA01A91, 2, { 60, 101 } },
+    [2511] = { 0x0F92AE, 2, { 10, 29 } },
+    [2514] = { 0x304989, 2, { 74, 79 } },
+    [2515] = { 0x2C18BC, 2, { 8, 98 } },
+    [2518] = { 0xFADE14, 2, { 34, 65 } },
+    [2522] = { 0x5ED4AB, 2, { 66, 70 } },
+    [2525] = { 0x4E2809, 2, { 74, 76 } },
+    [2527] = { 0x87E308, 2, { 3, 57 } },
+    [2528] = { 0x08181C, 2, { 54, 79 } },
+    [2529] = { 0xD8EC7F, 2, { 23, 85 } },
+    [2530] = { 0x82D896, 2, { 12, 86 } },
+    [2531] = { 0x001C5B, 2, { 86, 105 } },
+    [2532] = { 0x01C1B2, 2, { 82, 110 } },
+    [2533] = { 0x807A44, 2, { 58, 86 } },
+    [2534] = { 0xBE1842, 2, { 13, 96 } },
+    [2540] = { 0x0B0E2F, 1, { 10, -1 } },
+    [2543] = { 0x3F6D13, 2, { 32, 110 } },
+    [2545] = { 0x3C9AF5, 2, { 1, 90 } },
+    [2546] = { 0x225F09, 2, { 74, 78 } },
+    [2548] = { 0x1D2398, 2, { 6, 43 } },
+    [2549] = { 0x071ADB, 2, { 80, 86 } },
+    [2551] = { 0x400010, 2, { 89, 107 } },
+    [2553] = { 0x083836, 2, { 85, 92 } },
+    [2554] = { 0x1C812F, 2, { 28, 46 } },
+    [2555] = { 0x78CAD8, 2, { 23, 60 } },
+    [2558] = { 0xA5A429, 2, { 66, 75 } },
+    [2559] = { 0xF1B75E, 2, { 2, 106 } },
+    [2560] = { 0xC9B607, 2, { 7, 40 } },
+    [2561] = { 0x38132B, 2, { 35, 108 } },
+    [2562] = { 0xBE9042, 2, { 13, 100 } },
+    [2563] = { 0x801000, 2, { 88, 99 } },
+    [2566] = { 0x1CCB22, 2, { 36, 57 } },
+    [2571] = { 0xC68E65, 2, { 20, 100 } },
+    [2576] = { 0x0F2C9E, 2, { 28, 54 } },
+    [2581] = { 0xB635CE, 2, { 37, 77 } },
+    [2582] = { 0xAFD54C, 2, { 61, 98 } },
+    [2585] = { 0xE12EB1, 2, { 1, 30 } },
+    [2589] = { 0xDF37B1, 2, { 16, 41 } },
+    [2591] = { 0x179939, 2, { 9, 56 } },
+    [2597] = { 0x59F726, 2, { 62, 79 } },
+    [2601] = { 0x0F21F6, 2, { 53, 55 } },
+    [2602] = { 0x10ACE0, 2, { 51, 90 } },
+    [2604] = { 0x808687, 2, { 58, 83 } },
+    [2606] = { 0x0E8D80, 2, { 79, 96 } },
+    [2607] = { 0xFF3CB7, 2, { 57, 101 } },
+    [2609] = { 0xEF3105, 2, { 15, 32 } },
+    [2611] = { 0x13CB53, 2, { 63, 77 } },
+    [2614] = { 0x3A1323, 2, { 35, 94 } },
+    [2618] = { 0xAFC92B, 2, { 59, 91 } },
+    [2619] = { 0x200080, 2, { 90, 104 } },
+    [2624] = { 0xFF78B7, 2, { 57, 97 } },
+    [2626] = { 0xA48F36, 2, { 21, 77 } },
+    [2627] = { 0x049C91, 2, { 29, 107 } },
+    [2628] = { 0x65F0AC, 2, { 8, 25 } },
+    [2629] = { 0x810000, 2, { 88, 95 } },
+    [2630] = { 0x341701, 2, { 17, 109 } },
+    [2632] = { 0xEBC51D, 2, { 64, 82 } },
+    [2635] = { 0x4FD9FC, 2, { 22, 56 } },
+    [2636] = { 0x5FACF9, 2, { 14, 83 } },
+    [2637] = { 0x000210, 2, { 102, 107 } },
+    [2638] = { 0x383600, 1, { 77, -1 } },
+    [2639] = { 0xFA9DCB, 2, { 11, 83 } },
+    [2645] = { 0xA6CC4E, 2, { 28, 61 } },
+    [2646] = { 0x2AE6C3, 2, { 60, 65 } },
+    [2647] = { 0x1C9AD5, 2, { 1, 106 } },
+    [2650] = { 0x68AE0A, 2, { 16, 96 } },
+    [2651] = { 0xB04B43, 2, { 19, 49 } },
+    [2652] = { 0x91C67F, 2, { 40, 103 } },
+    [2654] = { 0x7C68CA, 2, { 73, 83 } },
+    [2655] = { 0xED4AB3, 2, { 27, 57 } },
+    [2656] = { 0x16B2E3, 2, { 46, 55 } },
+    [2657] = { 0x440000, 2, { 89, 93 } },
+    [2658] = { 0x2525B8, 2, { 26, 82 } },
+    [2659] = { 0x3E4449, 2, { 74, 105 } },
+    [2661] = { 0xFD7BD3, 2, { 11, 80 } },
+    [2662] = { 0x000180, 2, { 103, 104 } },
+    [2663] = { 0x0CAE54, 2, { 34, 73 } },
+    [2673] = { 0x2BFD51, 2, { 63, 110 } },
+    [2676] = { 0x21F8C2, 2, { 5, 59 } },
+    [2679] = { 0x3EB785, 2, { 36, 67 } },
+    [2682] = { 0x201E91, 2, { 60, 88 } },
+    [2684] = { 0x58ED34, 2, { 44, 79 } },
+    [2685] = { 0x477742, 2, { 34, 69 } },
+    [2687] = { 0x78DABF, 2, { 3, 103 } },
+    [2700] = { 0x5C8812, 2, { 73, 90 } },
+    [2704] = { 0xBFB36C, 2, { 27, 43 } },
+    [2707] = { 0x6F2B24, 2, { 46, 48 } },
+    [2709] = { 0x197C2B, 2, { 10, 27 } },
+    [2711] = { 0x430ACE, 2, { 55, 89 } },
+    [2712] = { 0x6240D7, 2, { 1, 31 } },
+    [2715] = { 0x000060, 2, { 105, 106 } },
+    [2718] = { 0xE5F386, 2, { 18, 102 } },
+    [2719] = { 0xC2C3EC, 2, { 49, 84 } },
+    [2724] = { 0x5E0AB6, 2, { 21, 49 } },
+    [2730] = { 0x58DBBF, 2, { 3, 90 } },
+    [2731] = { 0xAFBCD3, 2, { 19, 67 } },
+    [2734] = { 0x1BC81F, 2, { 9, 71 } },
+    [2735] = { 0x2B705A, 1, { 45, -1 } },
+    [2739] = { 0x84963C, 2, { 4, 38 } },
+    [2742] = { 0x0141B0, 2, { 82, 96 } },
+    [2743] = { 0x69AB6D, 2, { 16, 56 } },
+    [2744] = { 0xA2CE1B, 2, { 4, 50 } },
+    [2745] = { 0x5F5797, 2, { 38, 52 } },
+    [2746] = { 0x6F207C, 2, { 7, 69 } },
+    [2747] = { 0xADC168, 1, { 43, -1 } },
+    [2748] = { 0x09DA86, 2, { 27, 70 } },
+    [2749] = { 0xC5A07B, 2, { 2, 17 } },
+    [2750] = { 0xF21E0B, 2, { 10, 72 } },
+    [2751] = { 0x9CC95A, 2, { 21, 84 } },
+    [2752] = { 0xBE3B92, 2, { 49, 73 } },
+    [2753] = { 0xAE1311, 2, { 60, 79 } },
+    [2758] = { 0x77FAA6, 2, { 62, 90 } },
+    [2762] = { 0x598899, 2, { 19, 45 } },
+    [2763] = { 0x1F743B, 2, { 33, 57 } },
+    [2773] = { 0xEE8B3C, 2, { 8, 49 } },
+    [2776] = { 0x000404, 2, { 101, 109 } },
+    [2779] = { 0x6EA208, 1, { 68, -1 } },
+    [2781] = { 0x0506C0, 2, { 80, 94 } },
+    [2782] = { 0x21F682, 2, { 37, 61 } },
+    [2783] = { 0x0C5B54, 2, { 53, 84 } },
+    [2787] = { 0xF38C7F, 2, { 42, 62 } },
+    [2791] = { 0x35E241, 2, { 71, 77 } },
+    [2792] = { 0x5F503A, 2, { 14, 86 } },
+    [2793] = { 0x3F6511, 2, { 32, 100 } },
+    [2798] = { 0x57FBA6, 2, { 62, 103 } },
+    [2801] = { 0x4E4C9B, 2, { 22, 99 } },
+    [2802] = { 0x010400, 2, { 95, 101 } },
+    [2804] = { 0x276A18, 2, { 25, 68 } },
+    [2806] = { 0x5E4042, 2, { 13, 75 } },
+    [2808] = { 0x919ABF, 2, { 57, 68 } },
+    [2809] = { 0xEA8965, 2, { 61, 66 } },
+    [2811] = { 0xFF3837, 2, { 57, 104 } },
+    [2813] = { 0x108000, 2, { 91, 96 } },
+    [2817] = { 0x014000, 2, { 95, 97 } },
+    [2818] = { 0xA00FF6, 2, { 3, 23 } },
+    [2821] = { 0x000082, 2, { 104, 110 } },
+    [2830] = { 0x548808, 2, { 26, 76 } },
+    [2834] = { 0x6D0E48, 2, { 2, 21 } },
+    [2836] = { 0xF42612, 2, { 47, 95 } },
+    [2837] = { 0x2BFC53, 2, { 63, 103 } },
+    [2841] = { 0x76DA22, 2, { 31, 92 } },
+    [2842] = { 0x903C69, 2, { 5, 79 } },
+    [2845] = { 0x0ADCAD, 2, { 64, 75 } },
+    [2847] = { 0xF2AA04, 2, { 27, 75 } },
+    [2849] = { 0x6C6429, 2, { 24, 87 } },
+    [2850] = { 0x57FA86, 2, { 62, 106 } },
+    [2852] = { 0xFFC92B, 2, { 59, 89 } },
+    [2853] = { 0xABF54C, 2, { 61, 93 } },
+    [2856] = { 0x1BA880, 2, { 70, 110 } },
+    [2857] = { 0x8BFC30, 2, { 31, 47 } },
+    [2858] = { 0xD4095A, 2, { 63, 87 } },
+    [2861] = { 0x15F0A4, 2, { 64, 87 } },
+    [2862] = { 0x587578, 2, { 7, 101 } },
+    [2864] = { 0x682E08, 2, { 16, 110 } },
+    [2870] = { 0x127205, 2, { 27, 111 } },
+    [2871] = { 0x76F8C3, 2, { 19, 93 } },
+    [2873] = { 0x443143, 2, { 17, 34 } },
+    [2875] = { 0x0BFD53, 2, { 63, 90 } },
+    [2879] = { 0x1CAC57, 2, { 63, 69 } },
+    [2881] = { 0x000801, 2, { 100, 111 } },
+    [2886] = { 0xF1377E, 2, { 2, 96 } },
+    [2887] = { 0x42D5DF, 2, { 49, 58 } },
+    [2890] = { 0x2C38AC, 2, { 8, 107 } },
+    [2893] = { 0xC2B382, 2, { 49, 110 } },
+    [2894] = { 0x027DCE, 2, { 38, 66 } },
+    [2898] = { 0x116D0E, 2, { 13, 61 } },
+    [2902] = { 0x8E03DE, 2, { 37, 107 } },
+    [2907] = { 0x803836, 2, { 85, 88 } },
+    [2914] = { 0x001010, 2, { 99, 107 } },
+    [2915] = { 0x316D50, 2, { 51, 82 } },
+    [2918] = { 0x778C19, 2, { 25, 74 } },
+    [2921] = { 0x238360, 2, { 81, 90 } },
+    [2922] = { 0xE30019, 2, { 67, 74 } },
+    [2928] = { 0x0E0DA0, 2, { 79, 106 } },
+    [2932] = { 0x87DA08, 2, { 35, 59 } },
+    [2933] = { 0x141B00, 2, { 78, 92 } },
+    [2934] = { 0x169C5E, 2, { 9, 96 } },
+    [2941] = { 0xFFCC3F, 2, { 85, 87 } },
+    [2944] = { 0x66238A, 2, { 16, 79 } },
+    [2946] = { 0x7D49A2, 2, { 73, 82 } },
+    [2947] = { 0x090E2F, 2, { 10, 94 } },
+    [2948] = { 0xD051CF, 2, { 39, 53 } },
+    [2949] = { 0x7B58DF, 2, { 3, 81 } },
+    [2951] = { 0x101C1B, 2, { 86, 91 } },
+    [2954] = { 0x000014, 2, { 107, 109 } },
+    [2960] = { 0x046E5A, 2, { 9, 27 } },
+    [2961] = { 0xD78904, 2, { 69, 75 } },
+    [2962] = { 0xC9CB4F, 2, { 5, 62 } },
+    [2964] = { 0x1BA8A2, 2, { 70, 106 } },
+    [2966] = { 0xB719BA, 2, { 41, 111 } },
+    [2968] = { 0xE04C9C, 2, { 33, 107 } },
+    [2970] = { 0xCC13F8, 2, { 0, 47 } },
+    [2972] = { 0x49CA10, 2, { 25, 102 } },
+    [2977] = { 0x8EA6F9, 2, { 6, 74 } },
+    [2978] = { 0x0E0C80, 2, { 79, 103 } },
+    [2979] = { 0x4E5CDB, 2, { 22, 105 } },
+    [2980] = { 0x010010, 2, { 95, 107 } },
+    [2992] = { 0x01F50B, 2, { 56, 84 } },
+    [2994] = { 0x7EDB22, 2, { 31, 103 } },
+    [2995] = { 0x0A075E, 2, { 9, 78 } },
+    [3000] = { 0xCB91A9, 2, { 41, 73 } },
+    [3003] = { 0x1C92F5, 2, { 1, 100 } },
+    [3006] = { 0x12BD03, 2, { 16, 48 } },
+    [3007] = { 0x400008, 2, { 89, 108 } },
+    [3009] = { 0x002200, 2, { 98, 102 } },
+    [3010] = { 0x0F88E7, 2, { 56, 79 } },
+    [3011] = { 0x038340, 2, { 81, 106 } },
+    [3014] = { 0x9DA860, 2, { 23, 66 } },
+    [3016] = { 0xC08EF0, 2, { 6, 76 } },
+    [3017] = { 0x041000, 2, { 93, 99 } },
+    [3018] = { 0x381323, 1, { 35, -1 } },
+    [3020] = { 0x04BC81, 2, { 29, 98 } },
+    [3023] = { 0x3784EA, 2, { 19, 66 } },
+    [3028] = { 0xE62A3F, 2, { 21, 48 } },
+    [3031] = { 0x0CAB38, 2, { 53, 96 } },
+    [3032] = { 0x0615DC, 2, { 54, 105 } },
+    [3034] = { 0x484907, 2, { 22, 54 } },
+    [3037] = { 0x50AE7C, 2, { 6, 33 } },
+    [3040] = { 0x2E0F7D, 2, { 9, 35 } },
+    [3041] = { 0xD397DB, 2, { 4, 91 } },
+    [3043] = { 0xF03219, 2, { 2, 56 } },
+    [3045] = { 0xEF1D5D, 2, { 31, 40 } },
+    [3046] = { 0xDE991B, 2, { 11, 26 } },
+    [3048] = { 0x3C1B00, 2, { 78, 90 } },
+    [3052] = { 0x8B6ECB, 2, { 45, 60 } },
+    [3053] = { 0x0081F5, 2, { 1, 78 } },
+    [3058] = { 0x0A8B48, 2, { 10, 56 } },
+    [3060] = { 0x420000, 2, { 89, 94 } },
+    [3062] = { 0x040004, 2, { 93, 109 } },
+    [3066] = { 0x482E0A, 2, { 16, 90 } },
+    [3070] = { 0xFBE40E, 2, { 33, 70 } },
+    [3071] = { 0xB0ACE0, 2, { 51, 88 } },
+    [3074] = { 0x031ACE, 2, { 55, 99 } },
+    [3078] = { 0x003C36, 2, { 85, 101 } },
+    [3083] = { 0xB2EB71, 2, { 35, 65 } },
+    [3085] = { 0x418567, 2, { 56, 89 } },
+    [3086] = { 0x2BCBF1, 2, { 1, 69 } },
+    [3087] = { 0x050000, 2, { 93, 95 } },
+    [3089] = { 0xBB55AA, 2, { 29, 59 } },
+    [3092] = { 0x000208, 2, { 102, 108 } },
+    [3096] = { 0x59C29D, 2, { 30, 42 } },
+    [3101] = { 0x007836, 2, { 85, 97 } },
+    [3107] = { 0xF52BFF, 2, { 2, 29 } },
+    [3108] = { 0x7FA958, 2, { 15, 61 } },
+    [3109] = { 0x659E6B, 2, { 34, 46 } },
+    [3110] = { 0x8A9A43, 2, { 39, 44 } },
+    [3111] = { 0xC23380, 2, { 49, 96 } },
+    [3113] = { 0xD4509F, 2, { 34, 42 } },
+    [3120] = { 0xA6E9FE, 2, { 39, 48 } },
+    [3121] = { 0xAFB54C, 2, { 61, 97 } },
+    [3123] = { 0x70EC00, 2, { 76, 96 } },
+    [3124] = { 0x59F30C, 2, { 68, 69 } },
+    [3125] = { 0x43D9FA, 2, { 7, 70 } },
+    [3133] = { 0x81E295, 2, { 31, 57 } },
+    [3134] = { 0x610D72, 2, { 21, 30 } },
+    [3136] = { 0x77AD07, 2, { 38, 51 } },
+    [3137] = { 0xCE8665, 2, { 20, 92 } },
+    [3138] = { 0xAFF14C, 2, { 61, 101 } },
+    [3139] = { 0xF05C14, 2, { 15, 90 } },
+    [3140] = { 0x29705A, 2, { 45, 94 } },
+    [3141] = { 0xC72B94, 2, { 35, 57 } },
+    [3142] = { 0xBF0B4E, 2, { 32, 58 } },
+    [3143] = { 0x9CB934, 2, { 21, 110 } },
+    [3145] = { 0x5A10C4, 2, { 12, 23 } },
+    [3146] = { 0x020200, 2, { 94, 102 } },
+    [3147] = { 0xFDA85F, 2, { 30, 86 } },
+    [3148] = { 0xFFB38F, 2, { 0, 20 } },
+    [3149] = { 0x9B92AA, 2, { 6, 45 } },
+    [3151] = { 0x7D42C0, 2, { 50, 78 } },
+    [3152] = { 0xC57094, 2, { 24, 44 } },
+    [3158] = { 0x028FA9, 2, { 55, 56 } },
+    [3161] = { 0xD9F968, 2, { 37, 62 } },
+    [3167] = { 0x83B0A5, 2, { 57, 73 } },
+    [3170] = { 0x577AA6, 2, { 62, 96 } },
+    [3172] = { 0xB7B62A, 2, { 33, 62 } },
+    [3175] = { 0x018767, 2, { 56, 102 } },
+    [3177] = { 0x6CA208, 2, { 68, 94 } },
+    [3178] = { 0xA8F295, 2, { 0, 40 } },
+    [3179] = { 0x7EE9E9, 2, { 5, 75 } },
+    [3180] = { 0xF0E2F0, 2, { 6, 89 } },
+    [3183] = { 0x8A883E, 2, { 65, 84 } },
+    [3186] = { 0xAA4EE2, 2, { 30, 62 } },
+    [3188] = { 0x238EFE, 2, { 39, 87 } },
+    [3189] = { 0x188781, 2, { 29, 78 } },
+    [3190] = { 0x879868, 2, { 14, 23 } },
+    [3191] = { 0x2B7052, 2, { 45, 108 } },
+    [3192] = { 0x061B1B, 2, { 48, 73 } },
+    [3199] = { 0x2B72B4, 2, { 62, 73 } },
+    [3200] = { 0x57F2A6, 2, { 62, 100 } },
+    [3201] = { 0x0D8EE0, 2, { 79, 81 } },
+    [3202] = { 0x09D441, 2, { 71, 93 } },
+    [3206] = { 0xF252DD, 2, { 52, 64 } },
+    [3208] = { 0x95DE72, 2, { 46, 58 } },
+    [3209] = { 0x31785E, 2, { 21, 43 } },
+    [3212] = { 0xC883CF, 2, { 36, 45 } },
+    [3214] = { 0x4588A2, 2, { 27, 62 } },
+    [3217] = { 0xBFD92B, 2, { 59, 99 } },
+    [3222] = { 0x72F8CB, 2, { 19, 108 } },
+    [3223] = { 0x57C290, 2, { 62, 85 } },
+    [3225] = { 0x39F7B0, 2, { 77, 82 } },
+    [3227] = { 0x5B7BB6, 2, { 7, 55 } },
+    [3232] = { 0xB7A33C, 2, { 52, 61 } },
+    [3234] = { 0x6EA200, 2, { 68, 108 } },
+    [3235] = { 0xE0E036, 2, { 75, 85 } },
+    [3236] = { 0x000021, 2, { 106, 111 } },
+    [3240] = { 0xFF38BF, 2, { 57, 108 } },
+    [3242] = { 0x806E5F, 2, { 58, 100 } },
+    [3243] = { 0x63E5EF, 2, { 26, 38 } },
+    [3245] = { 0xF9B444, 2, { 30, 93 } },
+    [3246] = { 0xFC1F10, 2, { 28, 47 } },
+    [3249] = { 0x241086, 2, { 42, 58 } },
+    [3251] = { 0x49D810, 2, { 25, 99 } },
+    [3253] = { 0x1C1B02, 2, { 78, 110 } },
+    [3256] = { 0x3135EA, 2, { 0, 92 } },
+    [3258] = { 0x185270, 2, { 52, 101 } },
+    [3263] = { 0x30ECE0, 2, { 51, 97 } },
+    [3266] = { 0xB01F7B, 2, { 41, 80 } },
+    [3271] = { 0x0EED58, 2, { 79, 83 } },
+    [3272] = { 0x359262, 2, { 17, 56 } },
+    [3273] = { 0x800040, 2, { 88, 105 } },
+    [3274] = { 0x80E65F, 2, { 58, 96 } },
+    [3275] = { 0x018527, 2, { 56, 105 } },
+    [3276] = { 0x1BB499, 2, { 70, 86 } },
+    [3277] = { 0x8E23CE, 2, { 37, 98 } },
+    [3278] = { 0x86280D, 2, { 24, 46 } },
+    [3280] = { 0x0DD4C1, 2, { 71, 104 } },
+    [3281] = { 0xEED580, 2, { 75, 79 } },
+    [3282] = { 0x5D224F, 2, { 58, 67 } },
+    [3283] = { 0x56E8B4, 2, { 44, 100 } },
+    [3284] = { 0x76D63F, 2, { 3, 79 } },
+    [3286] = { 0x71D121, 2, { 2, 58 } },
+    [3288] = { 0x35F924, 2, { 19, 38 } },
+    [3289] = { 0x5959BD, 2, { 14, 54 } },
+    [3290] = { 0x003000, 2, { 98, 99 } },
+    [3292] = { 0x49C814, 2, { 25, 109 } },
+    [3293] = { 0xA45836, 2, { 22, 64 } },
+    [3295] = { 0xEA04AC, 2, { 64, 111 } },
+    [3296] = { 0x182BE2, 2, { 70, 81 } },
+    [3297] = { 0x856FFB, 2, { 3, 30 } },
+    [3298] = { 0xAE1C5A, 2, { 26, 65 } },
+    [3299] = { 0x9CB836, 2, { 21, 103 } },
+    [3303] = { 0xF719BB, 2, { 41, 89 } },
+    [3305] = { 0x3A1A85, 2, { 17, 79 } },
+    [3308] = { 0x7E7D65, 2, { 5, 33 } },
+    [3309] = { 0x2FF54C, 2, { 61, 88 } },
+    [3314] = { 0xFDB4C4, 2, { 30, 104 } },
+    [3315] = { 0x38F3FB, 2, { 35, 83 } },
+    [3319] = { 0x1F903B, 2, { 1, 55 } },
+    [3320] = { 0xF04019, 2, { 34, 58 } },
+    [3322] = { 0x375106, 2, { 69, 110 } },
+    [3324] = { 0x72B15C, 2, { 61, 67 } },
+    [3326] = { 0x3055D1, 2, { 63, 70 } },
+    [3329] = { 0xA8C211, 2, { 57, 62 } },
+    [3330] = { 0x0165BF, 2, { 56, 83 } },
+    [3331] = { 0x002004, 2, { 98, 109 } },
+    [3332] = { 0xB8E07A, 2, { 24, 45 } },
+    [3333] = { 0x7C8C12, 2, { 73, 101 } },
+    [3334] = { 0x15801B, 2, { 46, 85 } },
+    [3335] = { 0x257DDA, 2, { 45, 79 } },
+    [3337] = { 0xABFD53, 2, { 63, 88 } },
+    [3338] = { 0x3D0DA6, 2, { 12, 59 } },
+    [3339] = { 0x17072A, 2, { 41, 60 } },
+    [3342] = { 0x86F501, 2, { 11, 73 } },
+    [3343] = { 0xFC3279, 2, { 55, 57 } },
+    [3345] = { 0x382A1B, 2, { 77, 86 } },
+    [3346] = { 0x31D9EE, 2, { 40, 60 } },
+    [3347] = { 0x180000, 2, { 91, 92 } },
+    [3348] = { 0x580114, 2, { 7, 84 } },
+    [3350] = { 0x7CC812, 2, { 73, 97 } },
+    [3354] = { 0xB21D6A, 2, { 59, 71 } },
+    [3356] = { 0x012000, 2, { 95, 98 } },
+    [3357] = { 0x50180A, 2, { 16, 77 } },
+    [3359] = { 0xDD7C26, 2, { 67, 85 } },
+    [3361] = { 0x346010, 2, { 13, 65 } },
+    [3362] = { 0x043836, 2, { 85, 93 } },
+    [3365] = { 0x7A9309, 1, { 48, -1 } },
+    [3366] = { 0x1CF72B, 2, { 26, 35 } },
+    [3367] = { 0x45A9C7, 2, { 19, 69 } },
+    [3370] = { 0x6145DB, 2, { 50, 86 } },
+    [3371] = { 0xA1615C, 2, { 7, 72 } },
+    [3372] = { 0xE8BD41, 2, { 43, 66 } },
+    [3373] = { 0xB0E2B0, 2, { 6, 105 } },
+    [3374] = { 0x09A32D, 2, { 46, 78 } },
+    [3375] = { 0xDD4C10, 2, { 67, 100 } },
+    [3379] = { 0x82C48D, 1, { 12, -1 } },
+    [3383] = { 0xD97966, 2, { 0, 33 } },
+    [3384] = { 0xC7D275, 2, { 39, 70 } },
+    [3387] = { 0x09F738, 2, { 36, 64 } },
+    [3389] = { 0xB71BBB, 2, { 41, 102 } },
+    [3391] = { 0x335B19, 2, { 25, 48 } },
+    [3398] = { 0x4BCD29, 2, { 0, 19 } },
+    [3401] = { 0x7ED222, 2, { 31, 100 } },
+    [3402] = { 0x84A846, 2, { 18, 50 } },
+    [3404] = { 0x26E408, 2, { 26, 94 } },
+    [3406] = { 0x5E5C9B, 2, { 22, 91 } },
+    [3407] = { 0x45B438, 2, { 11, 59 } },
+    [3411] = { 0x021000, 2, { 94, 99 } },
+    [3418] = { 0x0E64EE, 2, { 0, 69 } },
+    [3420] = { 0x4F4C21, 2, { 14, 91 } },
+    [3421] = { 0x83FA4C, 2, { 20, 66 } },
+    [3425] = { 0xBD4DF9, 2, { 4, 31 } },
+    [3426] = { 0x5F112B, 2, { 59, 75 } },
+    [3428] = { 0xE09800, 2, { 75, 97 } },
+    [3429] = { 0x117F86, 2, { 34, 50 } },
+    [3431] = { 0x0B0EAF, 2, { 10, 104 } },
+    [3436] = { 0xD85FAF, 2, { 33, 35 } },
+    [3439] = { 0x4AC2DE, 2, { 25, 55 } },
+    [3440] = { 0x939F95, 2, { 36, 76 } },
+    [3442] = { 0x9370F8, 2, { 24, 83 } },
+    [3443] = { 0x093942, 2, { 28, 105 } },
+    [3446] = { 0x080001, 2, { 92, 111 } },
+    [3448] = { 0x000440, 2, { 101, 105 } },
+    [3449] = { 0xCB621B, 2, { 47, 74 } },
+    [3451] = { 0x62C122, 2, { 31, 78 } },
+    [3455] = { 0x16159C, 2, { 54, 91 } },
+    [3457] = { 0x8B2477, 2, { 2, 48 } },
+    [3459] = { 0xC5B540, 2, { 49, 80 } },
+    [3460] = { 0xC11309, 2, { 31, 59 } },
+    [3462] = { 0xE4F186, 2, { 18, 95 } },
+    [3463] = { 0x8F1EF1, 2, { 34, 57 } },
+    [3464] = { 0x62E2B5, 2, { 13, 39 } },
+    [3465] = { 0x400000, 1, { 89, -1 } },
+    [3466] = { 0x342F33, 2, { 17, 85 } },
+    [3467] = { 0x004040, 2, { 97, 105 } },
+    [3468] = { 0x1E1C5E, 2, { 9, 92 } },
+    [3469] = { 0x0D9441, 2, { 71, 97 } },
+    [3472] = { 0x8BC650, 2, { 24, 52 } },
+    [3475] = { 0x3A87FF, 2, { 4, 72 } },
+    [3479] = { 0xE24C8C, 2, { 33, 94 } },
+    [3485] = { 0x496F89, 2, { 4, 65 } },
+    [3488] = { 0x030000, 2, { 94, 95 } },
+    [3489] = { 0x443A55, 2, { 33, 42 } },
+    [3490] = { 0xA7D719, 2, { 48, 67 } },
+    [3491] = { 0xA461A9, 2, { 59, 70 } },
+    [3495] = { 0x8E0D80, 2, { 79, 88 } },
+    [3500] = { 0xA9E0D0, 2, { 54, 61 } },
+    [3503] = { 0x1C1300, 2, { 78, 100 } },
+    [3506] = { 0x527939, 2, { 37, 39 } },
+    [3507] = { 0xA607E9, 2, { 5, 77 } },
+    [3509] = { 0xE3F3B5, 2, { 36, 106 } },
+    [3524] = { 0x383680, 2, { 77, 104 } },
+    [3525] = { 0xFFF429, 2, { 87, 106 } },
+    [3526] = { 0x9BA882, 2, { 70, 88 } },
+    [3529] = { 0x8476D9, 2, { 42, 90 } },
+    [3534] = { 0xE82E0A, 2, { 16, 88 } },
+    [3538] = { 0x000200, 1, { 102, -1 } },
+    [3540] = { 0xED0C41, 2, { 71, 75 } },
+    [3541] = { 0x506C00, 2, { 76, 90 } },
+    [3542] = { 0x121680, 2, { 78, 79 } },
+    [3543] = { 0xB0F2F0, 2, { 6, 99 } },
+    [3545] = { 0x858C7E, 2, { 9, 24 } },
+    [3546] = { 0xB7A140, 2, { 13, 28 } },
+    [3548] = { 0x049C81, 1, { 29, -1 } },
+    [3549] = { 0x71A321, 2, { 34, 56 } },
+    [3550] = { 0x5A7178, 2, { 7, 94 } },
+    [3551] = { 0x020ACE, 2, { 55, 95 } },
+    [3557] = { 0x39F43B, 2, { 66, 73 } },
+    [3571] = { 0xF6B943, 2, { 63, 67 } },
+    [3573] = { 0x74BAC7, 2, { 29, 34 } },
+    [3581] = { 0x158231, 2, { 52, 71 } },
+    [3583] = { 0xB0E2F4, 2, { 6, 109 } },
+    [3584] = { 0x6AA208, 2, { 68, 93 } },
+    [3595] = { 0x9061DC, 2, { 17, 42 } },
+    [3597] = { 0x2438BC, 2, { 8, 92 } },
+    [3599] = { 0x40706C, 2, { 84, 89 } },
+    [3601] = { 0xA01691, 2, { 60, 100 } },
+    [3603] = { 0x93D5D3, 2, { 34, 36 } },
+    [3604] = { 0x49D40B, 2, { 25, 86 } },
+    [3605] = { 0x55C1A7, 2, { 2, 42 } },
+    [3607] = { 0x07CA29, 2, { 27, 46 } },
+    [3609] = { 0xAE9842, 2, { 13, 91 } },
+    [3611] = { 0xB1E2F0, 2, { 6, 95 } },
+    [3614] = { 0x473D04, 2, { 69, 76 } },
+    [3619] = { 0xDFF409, 2, { 87, 90 } },
+    [3623] = { 0x2B70DA, 2, { 45, 104 } },
+    [3626] = { 0xCAF852, 2, { 65, 89 } },
+    [3627] = { 0x000050, 2, { 105, 107 } },
+    [3628] = { 0x698DA5, 2, { 32, 44 } },
+    [3629] = { 0x250265, 2, { 19, 62 } },
+    [3630] = { 0x619821, 2, { 26, 66 } },
+    [3631] = { 0x457E29, 2, { 66, 102 } },
+    [3636] = { 0xADC1E8, 2, { 43, 104 } },
+    [3648] = { 0x2B704A, 2, { 45, 107 } },
+    [3649] = { 0x1ED3CB, 2, { 4, 67 } },
+    [3652] = { 0xC4A61C, 2, { 49, 54 } },
+    [3654] = { 0x11B968, 2, { 7, 25 } },
+    [3655] = { 0x7CDBBF, 2, { 3, 93 } },
+    [3656] = { 0x786C00, 2, { 76, 92 } },
+    [3660] = { 0xA7F54C, 2, { 61, 92 } },
+    [3661] = { 0xFC1EAF, 2, { 12, 31 } },
+    [3665] = { 0x200002, 2, { 90, 110 } },
+    [3666] = { 0xAFE957, 2, { 61, 86 } },
+    [3667] = { 0xCC58D3, 2, { 16, 42 } },
+    [3668] = { 0x6EA288, 2, { 68, 104 } },
+    [3676] = { 0xC6C665, 2, { 20, 97 } },
+    [3678] = { 0x72F8C3, 1, { 19, -1 } },
+    [3679] = { 0xE57210, 2, { 67, 77 } },
+    [3680] = { 0x37311B, 2, { 2, 20 } },
+    [3681] = { 0x0E4D80, 2, { 79, 97 } },
+    [3682] = { 0x00726C, 2, { 84, 102 } },
+    [3683] = { 0xA6CE32, 2, { 13, 52 } },
+    [3684] = { 0x87DED1, 2, { 19, 47 } },
+    [3686] = { 0x0090B4, 2, { 83, 84 } },
+    [3687] = { 0xBEC92B, 2, { 59, 95 } },
+    [3689] = { 0x900000, 2, { 88, 91 } },
+    [3690] = { 0xCD31E8, 2, { 19, 59 } },
+    [3691] = { 0x872C13, 2, { 65, 71 } },
+    [3692] = { 0xE10AF0, 2, { 42, 66 } },
+    [3693] = { 0x602130, 2, { 14, 32 } },
+    [3694] = { 0xC63DD9, 2, { 40, 62 } },
+    [3695] = { 0xD074E0, 2, { 51, 75 } },
+    [3696] = { 0xFF38B7, 1, { 57, -1 } },
+    [3697] = { 0x1BAC82, 2, { 70, 101 } },
+    [3698] = { 0xDB4DC0, 2, { 5, 66 } },
+    [3699] = { 0x0683A7, 2, { 56, 80 } },
+    [3700] = { 0x9D7886, 2, { 21, 82 } },
+    [3701] = { 0x01135C, 2, { 54, 80 } },
+    [3702] = { 0x774748, 2, { 48, 71 } },
+    [3703] = { 0xC869B3, 2, { 57, 69 } },
+    [3704] = { 0x7C9570, 2, { 7, 26 } },
+    [3705] = { 0xE5F1C6, 2, { 18, 105 } },
+    [3706] = { 0xD4BB56, 2, { 40, 66 } },
+    [3707] = { 0x90EEBE, 2, { 2, 50 } },
+    [3708] = { 0xFA7C13, 2, { 11, 103 } },
+    [3709] = { 0x000102, 2, { 103, 110 } },
+    [3710] = { 0xB719BF, 2, { 41, 109 } },
+    [3711] = { 0xE1E1A3, 2, { 0, 23 } },
+    [3712] = { 0xEBF395, 2, { 36, 92 } },
+    [3713] = { 0x1BE882, 2, { 70, 97 } },
+    [3714] = { 0x245434, 2, { 67, 72 } },
+    [3715] = { 0xE71F76, 2, { 38, 60 } },
+    [3717] = { 0x8AFA52, 2, { 65, 102 } },
+    [3719] = { 0x39D293, 2, { 35, 82 } },
+    [3723] = { 0x6FE985, 2, { 35, 62 } },
+    [3726] = { 0xE1A9D7, 2, { 22, 61 } },
+    [3727] = { 0x383200, 2, { 77, 101 } },
+    [3729] = { 0xDD4430, 2, { 67, 106 } },
+    [3730] = { 0x8F6D5C, 2, { 2, 31 } },
+    [3734] = { 0x040040, 2, { 93, 105 } },
+    [3735] = { 0xB8757C, 2, { 35, 58 } },
+    [3737] = { 0xB610ED, 2, { 35, 37 } },
+    [3739] = { 0x6B395B, 2, { 8, 38 } },
+    [3746] = { 0xDDBB47, 2, { 39, 82 } },
+    [3747] = { 0x226B80, 2, { 49, 75 } },
+    [3748] = { 0x90B400, 2, { 75, 76 } },
+    [3754] = { 0xD1C21A, 2, { 26, 47 } },
+    [3756] = { 0xED026D, 2, { 64, 80 } },
+    [3759] = { 0x750C5B, 2, { 65, 87 } },
+    [3760] = { 0x2C8DC7, 2, { 0, 46 } },
+    [3761] = { 0x40E0D8, 2, { 83, 89 } },
+    [3765] = { 0x229D68, 2, { 0, 70 } },
+    [3767] = { 0x023836, 2, { 85, 94 } },
+    [3769] = { 0x789309, 2, { 48, 94 } },
+    [3779] = { 0x910B56, 2, { 19, 36 } },
+    [3780] = { 0x8F86A9, 2, { 37, 56 } },
+    [3781] = { 0x07D42C, 2, { 54, 82 } },
+    [3782] = { 0x33A077, 2, { 20, 47 } },
+    [3783] = { 0x105670, 2, { 52, 92 } },
+    [3787] = { 0xABE832, 2, { 21, 69 } },
+    [3789] = { 0x281D78, 2, { 7, 76 } },
+    [3790] = { 0xCF3614, 2, { 27, 67 } },
+    [3799] = { 0x2FFD53, 2, { 63, 93 } },
+    [3807] = { 0x7DB841, 2, { 71, 76 } },
+    [3808] = { 0x24E408, 1, { 26, -1 } },
+    [3809] = { 0x88665F, 2, { 58, 92 } },
+    [3810] = { 0x8E03CE, 1, { 37, -1 } },
+    [3814] = { 0xF3291A, 2, { 23, 63 } },
+    [3815] = { 0x8AF812, 2, { 65, 105 } },
+    [3817] = { 0x127A04, 2, { 27, 100 } },
+    [3820] = { 0x4369B5, 2, { 54, 66 } },
+    [3825] = { 0x001000, 1, { 99, -1 } },
+    [3828] = { 0x023424, 2, { 43, 61 } },
+    [3829] = { 0xE86DF2, 2, { 17, 39 } },
+    [3831] = { 0xD8DC49, 2, { 23, 100 } },
+    [3832] = { 0x8D5D8A, 2, { 1, 40 } },
+    [3834] = { 0x37B1DC, 2, { 69, 83 } },
+    [3837] = { 0xC68675, 2, { 20, 107 } },
+    [3838] = { 0x8D0CCA, 2, { 19, 87 } },
+    [3839] = { 0x2F6D11, 2, { 32, 91 } },
+    [3840] = { 0x40C0E0, 2, { 51, 76 } },
+    [3841] = { 0x5EE0B4, 2, { 44, 92 } },
+    [3842] = { 0xAA7B59, 2, { 42, 79 } },
+    [3843] = { 0x0E0D90, 2, { 79, 107 } },
+    [3844] = { 0xF22048, 2, { 71, 87 } },
+    [3845] = { 0x12F204, 2, { 27, 96 } },
+    [3846] = { 0x99D66D, 2, { 17, 43 } },
+    [3847] = { 0x00E2D8, 2, { 83, 102 } },
+    [3848] = { 0x1DB82D, 2, { 46, 92 } },
+    [3849] = { 0x7D1DE7, 2, { 44, 63 } },
+    [3850] = { 0xFE9842, 2, { 13, 89 } },
+    [3853] = { 0xA77C17, 2, { 42, 55 } },
+    [3854] = { 0xCF58E9, 2, { 51, 87 } },
+    [3855] = { 0x1558F5, 2, { 46, 83 } },
+    [3856] = { 0x028CF3, 2, { 30, 57 } },
+    [3857] = { 0xFC7769, 2, { 81, 87 } },
+    [3858] = { 0xF2E2CB, 2, { 12, 34 } },
+    [3859] = { 0x83832D, 2, { 48, 72 } },
+    [3860] = { 0x008800, 2, { 96, 100 } },
+    [3863] = { 0x44E4A3, 2, { 14, 70 } },
+    [3864] = { 0x198E86, 2, { 11, 36 } },
+    [3866] = { 0x000004, 1, { 109, -1 } },
+    [3867] = { 0x0E0D00, 2, { 79, 104 } },
+    [3869] = { 0x100400, 2, { 91, 101 } },
+    [3870] = { 0x193902, 2, { 28, 91 } },
+    [3875] = { 0x4CB04E, 2, { 37, 49 } },
+    [3877] = { 0x1BA892, 2, { 70, 107 } },
+    [3879] = { 0x19C824, 2, { 72, 75 } },
+    [3881] = { 0x813C56, 2, { 30, 73 } },
+    [3882] = { 0xE04C8C, 1, { 33, -1 } },
+    [3883] = { 0x0C130E, 2, { 53, 85 } },
+    [3885] = { 0x7CA812, 2, { 73, 98 } },
+    [3887] = { 0x104000, 2, { 91, 97 } },
+    [3888] = { 0xA5F186, 2, { 18, 89 } },
+    [3889] = { 0x0308CE, 2, { 55, 102 } },
+    [3890] = { 0x010000, 1, { 95, -1 } },
+    [3892] = { 0x0A86AB, 2, { 1, 9 } },
+    [3893] = { 0x6836B9, 2, { 6, 23 } },
+    [3894] = { 0xDA4A2D, 2, { 2, 63 } },
+    [3897] = { 0x385670, 2, { 52, 90 } },
+    [3898] = { 0xE91024, 2, { 72, 91 } },
+    [3900] = { 0x1BA802, 2, { 70, 104 } },
+    [3901] = { 0xDE13A8, 2, { 17, 64 } },
+    [3902] = { 0xB3B19D, 2, { 4, 34 } },
+    [3903] = { 0xC80EC6, 2, { 36, 63 } },
+    [3904] = { 0x8F9809, 2, { 76, 87 } },
+    [3906] = { 0x87CFA9, 2, { 49, 66 } },
+    [3907] = { 0x945334, 2, { 44, 49 } },
+    [3908] = { 0xFE4C9F, 2, { 12, 73 } },
+    [3910] = { 0xE8338D, 2, { 59, 62 } },
+    [3911] = { 0x939021, 2, { 24, 111 } },
+    [3912] = { 0x240823, 2, { 35, 78 } },
+    [3913] = { 0xA914BD, 2, { 44, 87 } },
+    [3914] = { 0x8C2B38, 2, { 53, 88 } },
+    [3915] = { 0x435899, 2, { 44, 46 } },
+    [3917] = { 0x3813A3, 2, { 35, 104 } },
+    [3921] = { 0x008567, 2, { 56, 95 } },
+    [3927] = { 0xB36FB9, 2, { 1, 61 } },
+    [3929] = { 0xBE9A42, 2, { 13, 102 } },
+    [3931] = { 0x32ACE0, 2, { 51, 94 } },
+    [3933] = { 0xBFC96B, 2, { 59, 105 } },
+    [3935] = { 0xF9FE73, 2, { 11, 81 } },
+    [3942] = { 0x185770, 2, { 52, 103 } },
+    [3943] = { 0xB0CABF, 2, { 51, 58 } },
+    [3944] = { 0x84FA99, 2, { 26, 60 } },
+    [3949] = { 0x00E098, 2, { 83, 105 } },
+    [3950] = { 0x28B72D, 2, { 49, 64 } },
+    [3952] = { 0x587178, 1, { 7, -1 } },
+    [3954] = { 0x63894A, 2, { 4, 60 } },
+    [3957] = { 0xD37D5E, 2, { 61, 73 } },
+    [3959] = { 0xB227F5, 2, { 38, 47 } },
+    [3962] = { 0xE1B77E, 2, { 2, 91 } },
+    [3964] = { 0x49C850, 2, { 25, 105 } },
+    [3966] = { 0x093903, 2, { 28, 111 } },
+    [3968] = { 0x7C881A, 2, { 73, 108 } },
+    [3969] = { 0x72F11A, 2, { 31, 53 } },
+    [3970] = { 0x18A24C, 2, { 55, 70 } },
+    [3972] = { 0x5C3FB7, 2, { 3, 26 } },
+    [3973] = { 0x2DCD89, 2, { 2, 39 } },
+    [3974] = { 0xB83DF4, 2, { 7, 33 } },
+    [3975] = { 0xEFAED1, 2, { 6, 14 } },
+    [3976] = { 0x783B67, 2, { 3, 83 } },
+    [3977] = { 0x9CBD36, 2, { 21, 101 } },
+    [3979] = { 0xAFF54E, 2, { 61, 110 } },
+    [3982] = { 0x1FA882, 2, { 70, 93 } },
+    [3983] = { 0xEC6685, 2, { 12, 68 } },
+    [3988] = { 0x004001, 2, { 97, 111 } },
+    [3989] = { 0x286202, 2, { 47, 67 } },
+    [3991] = { 0x6C2E0A, 2, { 16, 93 } },
+    [3995] = { 0xEA14AD, 2, { 64, 99 } },
+    [3997] = { 0x50E601, 2, { 68, 74 } },
+    [3999] = { 0x9CF936, 2, { 21, 97 } },
+    [4000] = { 0xE91CC0, 2, { 3, 40 } },
+    [4003] = { 0x002040, 2, { 98, 105 } },
+    [4007] = { 0xA6FEAE, 2, { 6, 9 } },
+    [4008] = { 0x38D6D8, 2, { 77, 83 } },
+    [4009] = { 0xF06C00, 2, { 76, 88 } },
+    [4011] = { 0xE50B24, 2, { 72, 78 } },
+    [4013] = { 0x4E7206, 2, { 10, 66 } },
+    [4014] = { 0x34633E, 2, { 10, 32 } },
+    [4018] = { 0xFDA7F6, 2, { 18, 52 } },
+    [4029] = { 0xC5A767, 2, { 30, 35 } },
+    [4030] = { 0x8AF856, 2, { 65, 109 } },
+    [4032] = { 0x009C1B, 2, { 86, 96 } },
+    [4033] = { 0x2607E4, 2, { 11, 39 } },
+    [4034] = { 0xBE9802, 2, { 13, 105 } },
+    [4038] = { 0x1448E8, 2, { 26, 51 } },
+    [4039] = { 0x8048BF, 2, { 41, 69 } },
+    [4040] = { 0x01706C, 2, { 84, 95 } },
+    [4043] = { 0x2A2D20, 2, { 8, 54 } },
+    [4044] = { 0x234240, 2, { 39, 57 } },
+    [4046] = { 0x6A3E89, 2, { 29, 68 } },
+    [4048] = { 0x100010, 2, { 91, 107 } },
+    [4049] = { 0xCAD1F3, 2, { 11, 51 } },
+    [4051] = { 0x0C9AF5, 2, { 1, 91 } },
+    [4052] = { 0xF999A5, 2, { 13, 38 } },
+    [4053] = { 0x15C841, 2, { 46, 84 } },
+    [4055] = { 0xC6EC92, 2, { 67, 70 } },
+    [4056] = { 0x3E7ADD, 2, { 22, 34 } },
+    [4057] = { 0x8BF852, 2, { 65, 95 } },
+    [4058] = { 0xEB04AD, 2, { 64, 95 } },
+    [4059] = { 0x7ADBBF, 2, { 3, 94 } },
+    [4060] = { 0xE40978, 2, { 25, 43 } },
+    [4062] = { 0x41C1B0, 2, { 82, 89 } },
+    [4063] = { 0x989733, 2, { 3, 33 } },
+    [4065] = { 0x7D5942, 2, { 31, 81 } },
+    [4067] = { 0xD4A291, 2, { 36, 69 } },
+    [4070] = { 0x4701E5, 2, { 38, 110 } },
+    [4072] = { 0x9BBBE3, 2, { 37, 46 } },
+    [4074] = { 0xED7062, 2, { 47, 52 } },
+    [4077] = { 0xAC1188, 2, { 49, 68 } },
+    [4078] = { 0x10A6AD, 2, { 10, 70 } },
+    [4081] = { 0x71E2BD, 2, { 3, 28 } },
+    [4082] = { 0x70F8C3, 2, { 19, 94 } },
+    [4084] = { 0xA3CCBD, 2, { 25, 64 } },
+    [4087] = { 0x000048, 2, { 105, 108 } },
+    [4091] = { 0xBE789A, 2, { 13, 83 } },
+    [4099] = { 0x702644, 2, { 34, 110 } },
+    [4100] = { 0xD2607E, 2, { 45, 72 } },
+    [4101] = { 0x03F30C, 2, { 81, 84 } },
+    [4102] = { 0x8228F6, 2, { 37, 53 } },
+    [4103] = { 0xFD38B7, 2, { 57, 94 } },
+    [4106] = { 0x96C0A6, 2, { 0, 61 } },
+    [4107] = { 0xE1AB7F, 2, { 40, 76 } },
+    [4108] = { 0x3E4C09, 2, { 74, 100 } },
+    [4109] = { 0x2706C0, 2, { 80, 90 } },
+    [4112] = { 0x62F7B1, 2, { 17, 44 } },
+    [4113] = { 0xA026A7, 2, { 60, 85 } },
+    [4114] = { 0x149042, 2, { 32, 63 } },
+    [4115] = { 0x00F0D8, 2, { 83, 99 } },
+    [4116] = { 0x553883, 2, { 47, 60 } },
+    [4117] = { 0x1110BA, 2, { 14, 22 } },
+    [4118] = { 0x668C52, 2, { 31, 52 } },
+    [4120] = { 0xDF7039, 2, { 39, 55 } },
+    [4121] = { 0x162DE3, 2, { 7, 22 } },
+    [4122] = { 0xFFBAFE, 2, { 2, 79 } },
+    [4124] = { 0xF80091, 2, { 19, 65 } },
+    [4125] = { 0xF5F186, 2, { 18, 91 } },
+    [4126] = { 0x2DD441, 2, { 71, 90 } },
+    [4127] = { 0xAF8376, 2, { 40, 74 } },
+    [4128] = { 0xE0D900, 2, { 75, 103 } },
+    [4129] = { 0xB74CBF, 2, { 22, 72 } },
+    [4131] = { 0x3D78A1, 2, { 51, 71 } },
+    [4136] = { 0xDF9BE4, 2, { 22, 40 } },
+    [4138] = { 0x020040, 2, { 94, 105 } },
+    [4141] = { 0x165BF0, 2, { 52, 79 } },
+    [4144] = { 0x2BFD5B, 2, { 63, 108 } },
+    [4145] = { 0x000011, 2, { 107, 111 } },
+    [4146] = { 0xEB81CA, 2, { 56, 64 } },
+    [4151] = { 0x01C3B0, 2, { 82, 102 } },
+    [4153] = { 0x2C30BC, 2, { 8, 100 } },
+    [4154] = { 0x140000, 2, { 91, 93 } },
+    [4155] = { 0x85996B, 2, { 5, 70 } },
+    [4156] = { 0xA5FE9D, 2, { 37, 63 } },
+    [4157] = { 0xE65910, 2, { 33, 54 } },
+    [4158] = { 0x3EC409, 2, { 74, 96 } },
+    [4159] = { 0xE45A5A, 2, { 65, 68 } },
+    [4161] = { 0x186E46, 2, { 52, 85 } },
+    [4167] = { 0x00E0DC, 2, { 83, 109 } },
+    [4170] = { 0x003836, 1, { 85, -1 } },
+    [4172] = { 0x840B8F, 2, { 7, 39 } },
+    [4173] = { 0x0DD541, 2, { 71, 103 } },
+    [4182] = { 0xFC42F5, 2, { 1, 75 } },
+    [4183] = { 0x000820, 2, { 100, 106 } },
+    [4185] = { 0x5F7417, 2, { 14, 85 } },
+    [4187] = { 0xD8D469, 2, { 23, 106 } },
+    [4191] = { 0x01E0D8, 2, { 83, 95 } },
+    [4194] = { 0x2B3E7C, 2, { 8, 80 } },
+    [4197] = { 0x7BC3D2, 2, { 40, 64 } },
+    [4198] = { 0xAF754C, 2, { 61, 96 } },
+    [4201] = { 0x75FE03, 2, { 19, 80 } },
+    [4206] = { 0x05BD0A, 2, { 18, 33 } },
+    [4207] = { 0xBD7CF4, 2, { 11, 38 } },
+    [4209] = { 0x130ACE, 2, { 55, 91 } },
+    [4210] = { 0xFDB544, 2, { 30, 103 } },
+    [4211] = { 0x702666, 2, { 34, 106 } },
+    [4215] = { 0xC6A665, 2, { 20, 98 } },
+    [4216] = { 0x008020, 2, { 96, 106 } },
+    [4217] = { 0x0E2D80, 2, { 79, 98 } },
+    [4218] = { 0xB8505F, 2, { 58, 77 } },
+    [4223] = { 0xF06B5B, 2, { 48, 65 } },
+    [4228] = { 0x3FEF20, 2, { 48, 66 } },
+    [4229] = { 0x5A2EE7, 2, { 62, 71 } },
+    [4231] = { 0xB2686D, 2, { 12, 51 } },
+    [4232] = { 0xADD429, 2, { 24, 74 } },
+    [4234] = { 0x02575F, 2, { 24, 40 } },
+    [4240] = { 0x20A9AB, 2, { 5, 13 } },
+    [4241] = { 0xD12F6E, 2, { 31, 61 } },
+    [4244] = { 0xBE11C3, 2, { 38, 72 } },
+    [4246] = { 0x28F33A, 2, { 45, 81 } },
+    [4247] = { 0x001C19, 2, { 86, 110 } },
+    [4248] = { 0x08FDF9, 2, { 3, 34 } },
+    [4249] = { 0xA5F3BE, 2, { 42, 56 } },
+    [4253] = { 0x7A9389, 2, { 48, 104 } },
+    [4254] = { 0x040001, 2, { 93, 111 } },
+    [4256] = { 0x70A32A, 2, { 53, 73 } },
+    [4261] = { 0x60DCA7, 2, { 50, 56 } },
+    [4264] = { 0x24E400, 2, { 26, 108 } },
+    [4265] = { 0x60BE5F, 2, { 58, 75 } },
+    [4266] = { 0x640532, 2, { 16, 53 } },
+    [4272] = { 0x2B0E2F, 2, { 10, 90 } },
+    [4273] = { 0x5479C6, 2, { 62, 81 } },
+    [4276] = { 0xA55ADD, 2, { 6, 46 } },
+    [4279] = { 0xC775BB, 2, { 41, 76 } },
+    [4284] = { 0xE0D802, 2, { 75, 110 } },
+    [4286] = { 0xD41AD9, 2, { 42, 76 } },
+    [4287] = { 0x3E5148, 2, { 24, 43 } },
+    [4291] = { 0x78C7A4, 2, { 3, 86 } },
+    [4307] = { 0x502646, 2, { 34, 90 } },
+    [4308] = { 0x21C46D, 2, { 23, 72 } },
+    [4309] = { 0x030ACF, 2, { 55, 111 } },
+    [4313] = { 0x341F05, 2, { 17, 100 } },
+    [4323] = { 0x1CDF69, 2, { 21, 58 } },
+    [4328] = { 0x30ACE0, 1, { 51, -1 } },
+    [4329] = { 0x0DD443, 2, { 71, 110 } },
+    [4342] = { 0x1244EB, 2, { 2, 36 } },
+    [4344] = { 0x24C408, 2, { 26, 98 } },
+    [4345] = { 0x2078CE, 2, { 58, 60 } },
+    [4346] = { 0x6159C4, 2, { 50, 109 } },
+    [4347] = { 0xBCC9C8, 2, { 6, 53 } },
+    [4349] = { 0xA3145F, 2, { 55, 60 } },
+    [4350] = { 0x9097A4, 2, { 48, 64 } },
+    [4351] = { 0x23705A, 2, { 45, 92 } },
+    [4352] = { 0x706C10, 2, { 76, 107 } },
+    [4354] = { 0x17152F, 2, { 10, 78 } },
+    [4355] = { 0x001C3B, 2, { 86, 106 } },
+    [4356] = { 0x5BF218, 2, { 7, 81 } },
+    [4363] = { 0xA5C168, 2, { 43, 92 } },
+    [4372] = { 0x2A7517, 2, { 37, 42 } },
+    [4374] = { 0x9C59EE, 2, { 21, 83 } },
+    [4376] = { 0xA47659, 2, { 42, 104 } },
+    [4377] = { 0x214015, 2, { 36, 49 } },
+    [4379] = { 0x162468, 2, { 9, 85 } },
+    [4381] = { 0x859836, 2, { 72, 73 } },
+    [4384] = { 0xC174F7, 2, { 45, 64 } },
+    [4385] = { 0xF1B73E, 2, { 2, 105 } },
+    [4387] = { 0x977CA0, 2, { 12, 46 } },
+    [4390] = { 0x0F4227, 2, { 35, 69 } },
+    [4392] = { 0x66A208, 2, { 68, 92 } },
+    [4394] = { 0x080800, 2, { 92, 100 } },
+    [4395] = { 0x6A2E0A, 2, { 16, 94 } },
+    [4397] = { 0x38466C, 2, { 77, 84 } },
+    [4398] = { 0x28CF30, 2, { 26, 53 } },
+    [4400] = { 0x982891, 2, { 60, 77 } },
+    [4404] = { 0xD1AEB6, 2, { 39, 71 } },
+    [4405] = { 0x83C150, 2, { 28, 65 } },
+    [4406] = { 0x3ECEBE, 2, { 16, 44 } },
+    [4407] = { 0xDC66EC, 2, { 39, 86 } },
+    [4408] = { 0xD1BB30, 2, { 6, 50 } },
+    [4411] = { 0x383700, 2, { 77, 103 } },
+    [4413] = { 0xD71D88, 2, { 33, 69 } },
+    [4417] = { 0x7C8812, 1, { 73, -1 } },
+    [4418] = { 0x088000, 2, { 92, 96 } },
+    [4421] = { 0x01D1B0, 2, { 82, 99 } },
+    [4425] = { 0x91C77F, 1, { 40, -1 } },
+    [4426] = { 0x102000, 2, { 91, 98 } },
+    [4427] = { 0xF0B96D, 2, { 14, 61 } },
+    [4428] = { 0x4AEBE0, 2, { 19, 35 } },
+    [4429] = { 0x34381B, 2, { 35, 53 } },
+    [4430] = { 0x4C06D9, 2, { 36, 61 } },
+    [4431] = { 0x04A4B7, 2, { 29, 85 } },
+    [4433] = { 0xA202B7, 2, { 1, 13 } },
+    [4434] = { 0xDDE72E, 2, { 34, 43 } },
+    [4438] = { 0x000280, 2, { 102, 104 } },
+    [4439] = { 0xFFF419, 2, { 87, 107 } },
+    [4443] = { 0x8E73A2, 2, { 37, 84 } },
+    [4444] = { 0x790FB0, 2, { 50, 52 } },
+    [4445] = { 0x456C29, 2, { 66, 99 } },
+    [4447] = { 0x856700, 2, { 48, 87 } },
+    [4448] = { 0xE3F315, 2, { 36, 104 } },
+    [4449] = { 0x8C43ED, 2, { 5, 27 } },
+    [4450] = { 0x9AACAA, 2, { 21, 54 } },
+    [4457] = { 0x103227, 2, { 5, 37 } },
+    [4460] = { 0x2E8E8B, 2, { 42, 65 } },
+    [4462] = { 0x01C1B4, 2, { 82, 109 } },
+    [4463] = { 0x78DBBF, 1, { 3, -1 } },
+    [4464] = { 0xBAD7AE, 2, { 12, 35 } },
+    [4465] = { 0xB4BC5B, 2, { 65, 74 } },
+    [4466] = { 0x19827F, 2, { 3, 50 } },
+    [4467] = { 0x5326EC, 2, { 3, 63 } },
+    [4468] = { 0x97B22C, 2, { 68, 72 } },
+    [4469] = { 0x746C00, 2, { 76, 93 } },
+    [4470] = { 0x82C08D, 2, { 12, 101 } },
+    [4476] = { 0xF4ECF5, 2, { 8, 23 } },
+    [4478] = { 0x7D0D75, 2, { 56, 73 } },
+    [4479] = { 0x1C9AB5, 2, { 1, 105 } },
+    [4481] = { 0x4E76C2, 2, { 31, 51 } },
+    [4482] = { 0x3E4429, 2, { 74, 106 } },
+    [4486] = { 0x4EDC9B, 2, { 22, 96 } },
+    [4488] = { 0x38B596, 2, { 18, 67 } },
+    [4490] = { 0xEA04A9, 2, { 64, 109 } },
+    [4496] = { 0xFB38B7, 2, { 57, 93 } },
+    [4498] = { 0xC396DB, 2, { 4, 103 } },
+    [4501] = { 0x061D9C, 2, { 54, 100 } },
+    [4504] = { 0x98FE7D, 2, { 28, 40 } },
+    [4505] = { 0x100008, 2, { 91, 108 } },
+    [4510] = { 0x2F0774, 2, { 52, 69 } },
+    [4511] = { 0x9E5A98, 2, { 60, 74 } },
+    [4513] = { 0xB51321, 2, { 36, 44 } },
+    [4514] = { 0x26B254, 2, { 12, 42 } },
+    [4515] = { 0x459CF1, 2, { 66, 83 } },
+    [4521] = { 0x2BC565, 2, { 63, 85 } },
+    [4526] = { 0x8AE852, 2, { 65, 99 } },
+    [4527] = { 0x126E1F, 2, { 27, 86 } },
+    [4528] = { 0xF53B1C, 2, { 53, 72 } },
+    [4531] = { 0xE0D000, 2, { 75, 100 } },
+    [4533] = { 0xB952CA, 2, { 37, 69 } },
+    [4534] = { 0x6E56B3, 2, { 4, 43 } },
+    [4539] = { 0x000040, 1, { 105, -1 } },
+    [4544] = { 0x0D5441, 2, { 71, 96 } },
+    [4545] = { 0xF8F2C9, 2, { 80, 87 } },
+    [4547] = { 0x163C5E, 2, { 9, 98 } },
+    [4549] = { 0x15B83D, 2, { 46, 107 } },
+    [4550] = { 0xA01E90, 2, { 60, 111 } },
+    [4552] = { 0x6EA308, 2, { 68, 103 } },
+    [4556] = { 0x1C215E, 2, { 45, 69 } },
+    [4557] = { 0x19A63D, 2, { 22, 62 } },
+    [4558] = { 0x120000, 2, { 91, 94 } },
+    [4562] = { 0xB9E912, 2, { 9, 61 } },
+    [4563] = { 0x7063B5, 2, { 24, 36 } },
+    [4566] = { 0x081C1B, 2, { 86, 92 } },
+    [4567] = { 0xD06422, 2, { 15, 85 } },
+    [4568] = { 0x2CF36E, 2, { 2, 67 } },
+    [4570] = { 0xAE702B, 2, { 56, 61 } },
+    [4572] = { 0x621E04, 2, { 27, 76 } },
+    [4573] = { 0x7CF87E, 2, { 73, 84 } },
+    [4574] = { 0xADC148, 2, { 43, 106 } },
+    [4575] = { 0x8E3BF8, 2, { 37, 85 } },
+    [4580] = { 0xF5A612, 2, { 47, 96 } },
+    [4581] = { 0x1E4409, 2, { 74, 90 } },
+    [4584] = { 0x118567, 2, { 56, 91 } },
+    [4585] = { 0x186C6C, 2, { 46, 71 } },
+    [4587] = { 0x531165, 2, { 6, 36 } },
+    [4588] = { 0x1C7A2D, 2, { 1, 83 } },
+    [4597] = { 0xE924E9, 2, { 9, 57 } },
+    [4599] = { 0xADCAD0, 2, { 60, 71 } },
+    [4600] = { 0x90B689, 2, { 12, 27 } },
+    [4601] = { 0x02891D, 2, { 29, 54 } },
+    [4603] = { 0xFE35B9, 2, { 82, 87 } },
+    [4604] = { 0x3FAF74, 2, { 58, 59 } },
+    [4605] = { 0x2BFD53, 1, { 63, -1 } },
+    [4607] = { 0x000009, 2, { 108, 111 } },
+    [4608] = { 0x751521, 2, { 23, 43 } },
+    [4610] = { 0xC9A45D, 2, { 2, 35 } },
+    [4611] = { 0x363B80, 2, { 77, 79 } },
+    [4615] = { 0x9CB93E, 2, { 21, 108 } },
+    [4616] = { 0xF69E58, 2, { 1, 64 } },
+    [4617] = { 0x275104, 2, { 69, 91 } },
+    [4618] = { 0x84665F, 2, { 58, 93 } },
+    [4620] = { 0x457C69, 2, { 66, 105 } },
+    [4622] = { 0x8A03CE, 2, { 37, 93 } },
+    [4627] = { 0x7945EE, 2, { 38, 74 } },
+    [4630] = { 0x6FCCA6, 2, { 62, 77 } },
+    [4631] = { 0x049881, 2, { 29, 101 } },
+    [4632] = { 0xC05C14, 2, { 15, 91 } },
+    [4633] = { 0xE276F2, 2, { 36, 56 } },
+    [4634] = { 0xA3D22B, 2, { 59, 78 } },
+    [4635] = { 0x3B7A3C, 2, { 53, 69 } },
+    [4638] = { 0x3113AF, 2, { 3, 25 } },
+    [4639] = { 0x4AA493, 2, { 50, 63 } },
+    [4642] = { 0xD68E1A, 2, { 19, 42 } },
+    [4643] = { 0x02C48D, 2, { 12, 88 } },
+    [4645] = { 0xC5E178, 2, { 19, 41 } },
+    [4659] = { 0x020001, 2, { 94, 111 } },
+    [4660] = { 0x10782A, 2, { 31, 68 } },
+    [4665] = { 0x8DCB40, 2, { 4, 22 } },
+    [4666] = { 0x341725, 2, { 17, 106 } },
+    [4669] = { 0x9EB936, 2, { 21, 94 } },
+    [4670] = { 0xD2178E, 2, { 35, 64 } },
+    [4674] = { 0x28F79D, 2, { 55, 63 } },
+    [4683] = { 0x94F482, 2, { 0, 43 } },
+    [4684] = { 0x1AD8D3, 2, { 41, 43 } },
+    [4685] = { 0x2DA737, 2, { 43, 58 } },
+    [4687] = { 0xA44EEF, 2, { 42, 85 } },
+    [4691] = { 0x7BC1C1, 2, { 19, 28 } },
+    [4694] = { 0xD02C78, 2, { 15, 84 } },
+    [4695] = { 0x24E488, 2, { 26, 104 } },
+    [4696] = { 0xCA66A9, 2, { 9, 39 } },
+    [4701] = { 0x4416B6, 2, { 8, 16 } },
+    [4703] = { 0x184A6B, 2, { 52, 86 } },
+    [4704] = { 0xD6C698, 2, { 38, 40 } },
+    [4705] = { 0x0AFF09, 2, { 48, 76 } },
+    [4706] = { 0x7B52B9, 2, { 48, 82 } },
+    [4707] = { 0xEA04ED, 2, { 64, 105 } },
+    [4708] = { 0xF42270, 2, { 31, 65 } },
+    [4709] = { 0x4B2ADF, 2, { 38, 53 } },
+    [4711] = { 0x4F4B57, 2, { 32, 34 } },
+    [4713] = { 0xF61FAD, 2, { 64, 78 } },
+    [4714] = { 0x001080, 2, { 99, 104 } },
+    [4715] = { 0x1D9AF5, 2, { 1, 95 } },
+    [4718] = { 0x8E64D3, 2, { 29, 65 } },
+    [4722] = { 0xC13117, 2, { 17, 47 } },
+    [4725] = { 0x1CEA99, 2, { 1, 84 } },
+    [4726] = { 0x0B062F, 2, { 10, 100 } },
+    [4728] = { 0x020607, 2, { 56, 81 } },
+    [4729] = { 0x3084AF, 2, { 6, 58 } },
+    [4730] = { 0xE7DEC0, 2, { 75, 80 } },
+    [4731] = { 0x43D359, 2, { 16, 63 } },
+    [4732] = { 0x866799, 2, { 5, 52 } },
+    [4733] = { 0x7BC21A, 2, { 8, 62 } },
+    [4734] = { 0x1E32B6, 2, { 25, 62 } },
+    [4736] = { 0x927204, 2, { 27, 88 } },
+    [4737] = { 0x5DEE9B, 2, { 10, 44 } },
+    [4741] = { 0xFD8CA5, 2, { 29, 72 } },
+    [4743] = { 0x4D4836, 2, { 44, 70 } },
+    [4747] = { 0x800800, 2, { 88, 100 } },
+    [4748] = { 0x080020, 2, { 92, 106 } },
+    [4749] = { 0x97D2E3, 2, { 40, 54 } },
+    [4750] = { 0x738C2B, 2, { 7, 63 } },
+    [4751] = { 0xC68665, 1, { 20, -1 } },
+    [4753] = { 0x72B8C3, 2, { 19, 97 } },
+    [4754] = { 0x0E0D80, 1, { 79, -1 } },
+    [4755] = { 0x000084, 2, { 104, 109 } },
+    [4756] = { 0x62AD11, 2, { 49, 60 } },
+    [4758] = { 0x5690D8, 2, { 44, 84 } },
+    [4765] = { 0xDED015, 2, { 20, 52 } },
+    [4766] = { 0x141705, 2, { 17, 90 } },
+    [4772] = { 0x42428B, 2, { 46, 62 } },
+    [4776] = { 0xF6D871, 2, { 3, 37 } },
+    [4777] = { 0x808000, 2, { 88, 96 } },
+    [4778] = { 0xB0E2F1, 2, { 6, 111 } },
+    [4782] = { 0x5C1B00, 2, { 78, 89 } },
+    [4783] = { 0x5AA446, 2, { 15, 65 } },
+    [4784] = { 0xC130E0, 2, { 49, 81 } },
+    [4790] = { 0x1BA882, 1, { 70, -1 } },
+    [4795] = { 0xF89543, 2, { 56, 72 } },
+    [4797] = { 0xF52610, 2, { 47, 110 } },
+    [4798] = { 0x682E0A, 1, { 16, -1 } },
+    [4801] = { 0x6FE0C1, 2, { 14, 51 } },
+    [4802] = { 0x4E5CBB, 2, { 22, 106 } },
+    [4803] = { 0x152202, 2, { 28, 78 } },
+    [4805] = { 0x904218, 2, { 40, 56 } },
+    [4806] = { 0x1B4392, 2, { 4, 23 } },
+    [4809] = { 0x057C29, 2, { 66, 89 } },
+    [4815] = { 0x503D29, 2, { 16, 35 } },
+    [4816] = { 0x706C08, 2, { 76, 108 } },
+    [4817] = { 0x129775, 2, { 1, 79 } },
+    [4819] = { 0xCEF442, 2, { 13, 76 } },
+    [4822] = { 0xF049AB, 2, { 18, 46 } },
+    [4827] = { 0x9127A7, 2, { 40, 83 } },
+    [4831] = { 0xFA9452, 2, { 65, 76 } },
+    [4832] = { 0x55885F, 2, { 11, 61 } },
+    [4839] = { 0xC4391A, 2, { 11, 74 } },
+    [4840] = { 0x038320, 2, { 81, 105 } },
+    [4841] = { 0x5871F8, 2, { 7, 104 } },
+    [4842] = { 0x6149C0, 2, { 50, 99 } },
+    [4843] = { 0x9C133E, 2, { 40, 71 } },
+    [4846] = { 0x9A32D0, 2, { 42, 74 } },
+    [4848] = { 0x775104, 2, { 69, 89 } },
+    [4849] = { 0xE18D3C, 2, { 33, 82 } },
+    [4850] = { 0xC3B380, 2, { 49, 95 } },
+    [4851] = { 0xC25358, 2, { 49, 83 } },
+    [4855] = { 0x3023BC, 2, { 8, 78 } },
+    [4858] = { 0x939820, 2, { 24, 100 } },
+    [4860] = { 0xF53A09, 2, { 47, 86 } },
+    [4864] = { 0x726C00, 2, { 76, 94 } },
+    [4865] = { 0x587168, 2, { 7, 107 } },
+    [4869] = { 0x353179, 2, { 59, 65 } },
+    [4871] = { 0xB59718, 2, { 43, 52 } },
+    [4872] = { 0x1FEA56, 2, { 17, 63 } },
+    [4873] = { 0x9FF059, 2, { 5, 82 } },
+    [4874] = { 0xB904D2, 2, { 4, 48 } },
+    [4876] = { 0xBD8748, 2, { 27, 61 } },
+    [4877] = { 0xE3F39D, 2, { 36, 108 } },
+    [4878] = { 0x9E71E9, 2, { 5, 97 } },
+    [4879] = { 0x2935EA, 2, { 0, 91 } },
+    [4880] = { 0x31CAE5, 2, { 37, 59 } },
+    [4881] = { 0x3C1705, 2, { 17, 92 } },
+    [4882] = { 0x57F848, 2, { 45, 73 } },
+    [4885] = { 0x8C262D, 2, { 8, 60 } },
+    [4886] = { 0x91C777, 2, { 40, 108 } },
+    [4887] = { 0x367E5A, 2, { 39, 64 } },
+    [4889] = { 0x21E61A, 2, { 16, 25 } },
+    [4892] = { 0x6AB4DE, 2, { 33, 65 } },
+    [4893] = { 0xAA04AD, 2, { 64, 89 } },
+    [4897] = { 0x0363B8, 2, { 81, 83 } },
+    [4900] = { 0xD64988, 2, { 15, 54 } },
+    [4902] = { 0x06149C, 2, { 54, 103 } },
+    [4903] = { 0x0E7DEC, 2, { 79, 84 } },
+    [4904] = { 0xF52632, 2, { 47, 106 } },
+    [4905] = { 0x3F07C4, 2, { 30, 49 } },
+    [4906] = { 0x6A8004, 2, { 24, 72 } },
+    [4907] = { 0x3E6D11, 2, { 32, 95 } },
+    [4908] = { 0x2DE8CF, 2, { 54, 63 } },
+    [4909] = { 0x127604, 2, { 27, 101 } },
+    [4912] = { 0x3BB560, 2, { 77, 81 } },
+    [4913] = { 0x6ED264, 2, { 68, 84 } },
+    [4914] = { 0x78DBB7, 2, { 3, 108 } },
+    [4915] = { 0x4705E7, 2, { 38, 101 } },
+    [4916] = { 0x0D7E49, 2, { 21, 40 } },
+    [4917] = { 0x801C1B, 2, { 86, 88 } },
+    [4918] = { 0x000C00, 2, { 100, 101 } },
+    [4919] = { 0x6572A0, 2, { 31, 70 } },
+    [4921] = { 0xFBA5E5, 2, { 36, 52 } },
+    [4922] = { 0x1F4C21, 2, { 14, 89 } },
+    [4923] = { 0x7F5F45, 2, { 31, 56 } },
+    [4924] = { 0xAD576A, 2, { 7, 47 } },
+    [4925] = { 0x5F2EED, 2, { 4, 21 } },
+    [4926] = { 0x6E2208, 2, { 68, 96 } },
+    [4927] = { 0x5AD35E, 2, { 47, 61 } },
+    [4928] = { 0xA2A196, 2, { 41, 46 } },
+    [4931] = { 0x004800, 2, { 97, 100 } },
+    [4933] = { 0x156A9E, 2, { 33, 47 } },
+    [4936] = { 0x790D9F, 2, { 22, 69 } },
+    [4937] = { 0x52E29E, 2, { 8, 31 } },
+    [4938] = { 0x375304, 2, { 69, 102 } },
+    [4939] = { 0xC70B5A, 2, { 4, 29 } },
+    [4942] = { 0x6C9807, 2, { 6, 39 } },
+    [4948] = { 0xE62F95, 2, { 53, 64 } },
+    [4951] = { 0x008400, 2, { 96, 101 } },
+    [4954] = { 0xD05E14, 2, { 15, 102 } },
+    [4955] = { 0x4741E7, 2, { 38, 97 } },
+    [4956] = { 0xF81024, 2, { 72, 95 } },
+    [4960] = { 0x706646, 2, { 34, 97 } },
+    [4962] = { 0x100000, 1, { 91, -1 } },
+    [4963] = { 0x7F38B7, 2, { 57, 88 } },
+    [4964] = { 0x7AE365, 2, { 48, 84 } },
+    [4967] = { 0xD7E490, 2, { 17, 36 } },
+    [4969] = { 0xE75416, 2, { 27, 47 } },
+    [4971] = { 0x00C000, 2, { 96, 97 } },
+    [4974] = { 0xE0488C, 2, { 33, 101 } },
+    [4975] = { 0x4959EA, 2, { 0, 76 } },
+    [4981] = { 0xB0D834, 2, { 25, 72 } },
+    [4986] = { 0x0485A0, 2, { 80, 81 } },
+    [4992] = { 0xEE27D4, 2, { 36, 71 } },
+    [4993] = { 0x8D519D, 2, { 36, 68 } },
+    [4995] = { 0x60AF88, 2, { 68, 79 } },
+    [4997] = { 0x039360, 2, { 81, 99 } },
+    [4998] = { 0xDBC1AB, 2, { 4, 52 } },
+    [4999] = { 0xD52612, 2, { 47, 90 } },
+    [5001] = { 0xC7542D, 2, { 72, 74 } },
+    [5003] = { 0x9F7380, 2, { 32, 60 } },
+    [5004] = { 0x395C84, 2, { 69, 79 } },
+    [5009] = { 0x4676E7, 2, { 55, 66 } },
+    [5010] = { 0x29FD53, 2, { 63, 94 } },
+    [5011] = { 0x312987, 2, { 51, 56 } },
+    [5013] = { 0xE3134D, 2, { 36, 83 } },
+    [5014] = { 0xEF0C7A, 2, { 9, 72 } },
+    [5016] = { 0x82665F, 2, { 58, 94 } },
+    [5017] = { 0xDD6410, 2, { 67, 98 } },
+    [5018] = { 0x00242D, 2, { 85, 86 } },
+    [5019] = { 0x341D38, 2, { 53, 77 } },
+    [5020] = { 0x36D370, 2, { 7, 68 } },
+    [5021] = { 0x0044D7, 2, { 56, 82 } },
+    [5022] = { 0x1F255C, 2, { 9, 28 } },
+    [5023] = { 0xF90024, 2, { 72, 99 } },
+    [5025] = { 0xD6407B, 2, { 41, 50 } },
+    [5027] = { 0x7DD21B, 2, { 30, 58 } },
+    [5028] = { 0x609312, 2, { 73, 78 } },
+    [5029] = { 0xF0B77E, 2, { 2, 95 } },
+    [5030] = { 0x583178, 2, { 7, 97 } },
+    [5031] = { 0xE86A14, 2, { 15, 77 } },
+    [5032] = { 0x089AE0, 2, { 51, 77 } },
+    [5033] = { 0xDC7AFF, 2, { 39, 108 } },
+    [5037] = { 0x08A75A, 2, { 2, 72 } },
+    [5039] = { 0xFFE812, 2, { 86, 87 } },
+    [5040] = { 0xBDA956, 2, { 65, 69 } },
+    [5043] = { 0x557C29, 2, { 66, 91 } },
+    [5044] = { 0xBE4409, 2, { 74, 88 } },
+    [5046] = { 0x9D29B7, 2, { 31, 36 } },
+    [5049] = { 0x419B6B, 2, { 15, 40 } },
+    [5051] = { 0x9C5012, 2, { 73, 75 } },
+    [5055] = { 0x699F24, 2, { 21, 47 } },
+    [5056] = { 0x103038, 2, { 53, 78 } },
+    [5057] = { 0x038364, 2, { 81, 109 } },
+    [5058] = { 0x983839, 2, { 66, 67 } },
+    [5059] = { 0x17B82D, 2, { 46, 94 } },
+    [5062] = { 0xBDFFC3, 2, { 8, 40 } },
+    [5063] = { 0x000001, 1, { 111, -1 } },
+    [5065] = { 0x0038B6, 2, { 85, 104 } },
+    [5066] = { 0x9E3169, 2, { 5, 104 } },
+    [5067] = { 0xF6013B, 2, { 25, 59 } },
+    [5069] = { 0x0E159C, 2, { 54, 92 } },
+    [5070] = { 0xE3CFEC, 2, { 33, 81 } },
+    [5072] = { 0x9CB936, 1, { 21, -1 } },
+    [5073] = { 0x2514CD, 2, { 46, 51 } },
+    [5075] = { 0xF4A375, 2, { 47, 56 } },
+    [5083] = { 0x003826, 2, { 85, 107 } },
+    [5084] = { 0x161C5E, 1, { 9, -1 } },
+    [5087] = { 0x7EDA26, 2, { 31, 109 } },
+    [5088] = { 0xB769D7, 2, { 41, 84 } },
+    [5089] = { 0x4701F7, 2, { 38, 107 } },
+    [5090] = { 0x3A4730, 2, { 5, 42 } },
+    [5093] = { 0x44BE12, 2, { 73, 77 } },
+    [5096] = { 0x3942C9, 2, { 74, 80 } },
+    [5097] = { 0x0E35B6, 2, { 79, 85 } },
+    [5098] = { 0x000810, 2, { 100, 107 } },
+    [5099] = { 0xF1A77E, 2, { 2, 99 } },
+    [5100] = { 0xD8D459, 2, { 23, 107 } },
+    [5101] = { 0xDD4418, 2, { 67, 108 } },
+    [5102] = { 0x800020, 2, { 88, 106 } },
+    [5103] = { 0xC747D5, 2, { 20, 82 } },
+    [5104] = { 0x005C1B, 2, { 86, 97 } },
+    [5105] = { 0x7935EA, 2, { 0, 89 } },
+    [5106] = { 0xF195B0, 2, { 22, 59 } },
+    [5108] = { 0xA39E32, 2, { 31, 67 } },
+    [5109] = { 0x10706C, 2, { 84, 91 } },
+    [5110] = { 0x39025E, 2, { 27, 45 } },
+    [5111] = { 0xA2C48D, 2, { 12, 90 } },
+    [5113] = { 0xC15744, 2, { 61, 68 } },
+    [5114] = { 0xAD6256, 2, { 34, 67 } },
+    [5119] = { 0xF96B73, 2, { 1, 18 } },
+    [5123] = { 0xFFD86F, 2, { 57, 83 } },
+    [5124] = { 0x399644, 2, { 35, 56 } },
+    [5125] = { 0x9AF852, 2, { 65, 91 } },
+    [5127] = { 0xFA04AD, 2, { 64, 91 } },
+    [5129] = { 0x0596FC, 2, { 54, 81 } },
+    [5130] = { 0x008010, 2, { 96, 107 } },
+    [5132] = { 0x702656, 2, { 34, 107 } },
+    [5133] = { 0xF8F253, 2, { 47, 71 } },
+    [5134] = { 0x84F5D2, 2, { 65, 79 } },
+    [5138] = { 0x455F5B, 2, { 63, 68 } },
+    [5144] = { 0x2BDD53, 2, { 63, 98 } },
+    [5145] = { 0x3F6D51, 2, { 32, 105 } },
+    [5146] = { 0x56006C, 2, { 44, 83 } },
+    [5147] = { 0x2F5F3D, 2, { 13, 40 } },
+    [5149] = { 0x95F768, 2, { 43, 77 } },
+    [5151] = { 0xDF4410, 2, { 67, 94 } },
+    [5152] = { 0x1E593C, 2, { 27, 53 } },
+    [5154] = { 0xC48665, 2, { 20, 94 } },
+    [5155] = { 0xC63C11, 2, { 8, 64 } },
+    [5160] = { 0xF43698, 2, { 10, 57 } },
+    [5161] = { 0xB05A3B, 2, { 47, 66 } },
+    [5162] = { 0x5C1CA8, 2, { 39, 58 } },
+    [5178] = { 0x0C2B38, 1, { 53, -1 } },
+    [5183] = { 0x2F3272, 2, { 8, 55 } },
+    [5184] = { 0x25DF28, 2, { 14, 48 } },
+    [5185] = { 0x1C1B04, 2, { 78, 109 } },
+    [5188] = { 0xE0A86C, 2, { 75, 84 } },
+    [5189] = { 0x774C16, 2, { 30, 65 } },
+    [5190] = { 0x7C0D7E, 2, { 34, 53 } },
+    [5191] = { 0xE76EC7, 2, { 52, 57 } },
+    [5192] = { 0x88982F, 2, { 59, 69 } },
+    [5193] = { 0xC767B8, 2, { 38, 58 } },
+    [5194] = { 0xB3EE4C, 2, { 61, 78 } },
+    [5195] = { 0x19A882, 2, { 70, 94 } },
+    [5196] = { 0x600000, 2, { 89, 90 } },
+    [5197] = { 0xC3D7DB, 2, { 4, 97 } },
+    [5199] = { 0xF91064, 2, { 72, 105 } },
+    [5200] = { 0xDE4EDE, 2, { 55, 67 } },
+    [5201] = { 0x1D1B00, 2, { 78, 95 } },
+    [5203] = { 0x040800, 2, { 93, 100 } },
+    [5206] = { 0x1E43EC, 2, { 52, 54 } },
+    [5207] = { 0x2159C0, 2, { 50, 89 } },
+    [5209] = { 0x00706D, 2, { 84, 111 } },
+    [5210] = { 0xE3CBA3, 2, { 36, 85 } },
+    [5212] = { 0x14C9BB, 2, { 5, 65 } },
+    [5213] = { 0x25EC8B, 2, { 70, 74 } },
+    [5219] = { 0x2796A6, 2, { 62, 76 } },
+    [5221] = { 0xA92793, 2, { 28, 60 } },
+    [5223] = { 0x0BC1DD, 2, { 54, 71 } },
+    [5224] = { 0x8AF853, 2, { 65, 111 } },
+    [5225] = { 0x09AC95, 2, { 14, 44 } },
+    [5228] = { 0x742646, 2, { 34, 93 } },
+    [5231] = { 0xB41705, 2, { 17, 88 } },
+    [5232] = { 0x788812, 2, { 73, 93 } },
+    [5234] = { 0x400100, 2, { 89, 103 } },
+    [5235] = { 0x048000, 2, { 93, 96 } },
+    [5240] = { 0x84081F, 2, { 61, 63 } },
+    [5245] = { 0xE0C41B, 2, { 75, 86 } },
+    [5247] = { 0x0FEBDD, 2, { 60, 61 } },
+    [5255] = { 0xD18040, 2, { 11, 63 } },
+    [5259] = { 0x10E0D8, 2, { 83, 91 } },
+    [5260] = { 0xCBE158, 2, { 7, 24 } },
+    [5262] = { 0x682E02, 2, { 16, 108 } },
+    [5263] = { 0x73DCAC, 2, { 24, 33 } },
+    [5265] = { 0xA476D9, 1, { 42, -1 } },
+    [5267] = { 0x000420, 2, { 101, 106 } },
+    [5268] = { 0x340B1E, 2, { 17, 86 } },
+    [5269] = { 0x093922, 2, { 28, 106 } },
+    [5272] = { 0x9FB3F8, 2, { 21, 55 } },
+    [5273] = { 0xBF59F2, 2, { 13, 82 } },
+    [5274] = { 0x706C00, 1, { 76, -1 } },
+    [5278] = { 0x6E817A, 2, { 63, 66 } },
+    [5279] = { 0xB6EA65, 2, { 20, 76 } },
+    [5280] = { 0x200200, 2, { 90, 102 } },
+    [5281] = { 0xA01E95, 2, { 60, 109 } },
+    [5282] = { 0x249C81, 2, { 29, 90 } },
+    [5286] = { 0xDBDE87, 2, { 23, 55 } },
+    [5288] = { 0x55CD86, 2, { 59, 64 } },
+    [5294] = { 0x3935AA, 2, { 0, 105 } },
+    [5297] = { 0xD15C14, 2, { 15, 95 } },
+    [5298] = { 0xE2B9FB, 2, { 5, 73 } },
+    [5304] = { 0x268CB4, 2, { 44, 76 } },
+    [5306] = { 0x938561, 2, { 43, 74 } },
+    [5307] = { 0xF4FA26, 2, { 10, 87 } },
+    [5308] = { 0xA11E91, 2, { 60, 95 } },
+    [5309] = { 0x5765D3, 2, { 44, 56 } },
+    [5310] = { 0xF8D194, 2, { 72, 82 } },
+    [5312] = { 0x2D65C6, 2, { 45, 54 } },
+    [5313] = { 0x880000, 2, { 88, 92 } },
+    [5314] = { 0x4A4B70, 2, { 25, 81 } },
+    [5315] = { 0xFF6577, 2, { 40, 68 } },
+    [5316] = { 0xF738B7, 2, { 57, 92 } },
+    [5317] = { 0x7D5A81, 2, { 60, 67 } },
+    [5319] = { 0x7C8892, 2, { 73, 104 } },
+    [5320] = { 0x1AA001, 2, { 26, 74 } },
+    [5321] = { 0x049D81, 2, { 29, 103 } },
+    [5322] = { 0x56FAA6, 2, { 62, 95 } },
+    [5323] = { 0xB8F5EE, 2, { 38, 87 } },
+    [5324] = { 0x195CA8, 2, { 33, 72 } },
+    [5325] = { 0x000300, 2, { 102, 103 } },
+    [5327] = { 0x1B8882, 2, { 70, 98 } },
+    [5331] = { 0x81DB7E, 2, { 2, 76 } },
+    [5334] = { 0xE3F395, 1, { 36, -1 } },
+    [5346] = { 0x27DCE0, 2, { 34, 62 } },
+    [5347] = { 0x9DEC47, 2, { 40, 53 } },
+    [5348] = { 0x4D9415, 2, { 4, 37 } },
+    [5349] = { 0x07C957, 2, { 11, 30 } },
+    [5350] = { 0x8092D1, 2, { 26, 42 } },
+    [5351] = { 0xFFF409, 1, { 87, -1 } },
+    [5353] = { 0x57FAA2, 2, { 62, 109 } },
+    [5355] = { 0x7D6F0A, 2, { 35, 66 } },
+    [5357] = { 0xCA5982, 2, { 21, 44 } },
+    [5358] = { 0x43F184, 2, { 4, 58 } },
+    [5360] = { 0x8F2EEF, 2, { 23, 62 } },
+    [5361] = { 0xB1DA68, 2, { 43, 78 } },
+    [5362] = { 0xD7E721, 2, { 16, 59 } },
+    [5363] = { 0x416C4B, 2, { 13, 87 } },
+    [5364] = { 0x00E0D9, 2, { 83, 111 } },
+    [5366] = { 0x403D22, 2, { 59, 87 } },
+    [5371] = { 0xF1B57E, 2, { 2, 102 } },
+    [5372] = { 0xCD6C64, 2, { 23, 46 } },
+    [5373] = { 0x041C1B, 2, { 86, 93 } },
+    [5374] = { 0x8EEE84, 2, { 33, 68 } },
+    [5375] = { 0x78DBAF, 2, { 3, 107 } },
+    [5384] = { 0x07964F, 2, { 29, 55 } },
+    [5385] = { 0x57EAA6, 2, { 62, 99 } },
+    [5386] = { 0xC3975B, 2, { 4, 104 } },
+    [5387] = { 0x5B1AE7, 2, { 38, 78 } },
+    [5390] = { 0xB91024, 2, { 72, 89 } },
+    [5393] = { 0xFA4525, 2, { 11, 85 } },
+    [5396] = { 0x0790FB, 2, { 54, 56 } },
+    [5397] = { 0x085670, 2, { 52, 91 } },
+    [5399] = { 0xC9BDAF, 2, { 10, 49 } },
+    [5411] = { 0x32F856, 2, { 9, 26 } },
+    [5414] = { 0x27ECFE, 2, { 23, 57 } },
+    [5416] = { 0x345705, 2, { 17, 97 } },
+    [5419] = { 0x80665F, 1, { 58, -1 } },
+    [5420] = { 0x9A68AD, 2, { 64, 76 } },
+    [5421] = { 0x86159C, 2, { 54, 88 } },
+    [5422] = { 0x536627, 2, { 29, 62 } },
+    [5423] = { 0xE5F184, 2, { 18, 110 } },
+    [5424] = { 0xC481AE, 2, { 0, 30 } },
+    [5425] = { 0x7999C7, 2, { 48, 55 } },
+    [5426] = { 0x0000C0, 2, { 104, 105 } },
+    [5427] = { 0x06572A, 2, { 35, 74 } },
+    [5428] = { 0xEF68C3, 2, { 7, 41 } },
+    [5430] = { 0x9B9020, 2, { 24, 92 } },
+    [5433] = { 0x3C67DF, 2, { 32, 55 } },
+    [5437] = { 0x2C769A, 2, { 45, 80 } },
+    [5438] = { 0x23BBA1, 2, { 35, 70 } },
+    [5439] = { 0xDE5648, 2, { 45, 47 } },
+    [5445] = { 0xBA8820, 2, { 66, 87 } },
+    [5450] = { 0xBC156C, 2, { 20, 48 } },
+    [5452] = { 0x5FD9B6, 2, { 28, 44 } },
+    [5454] = { 0x72F9C3, 2, { 19, 103 } },
+    [5455] = { 0x379592, 2, { 47, 49 } },
+    [5456] = { 0x2F055B, 2, { 22, 50 } },
+    [5461] = { 0xB1B77E, 2, { 2, 89 } },
+    [5463] = { 0x15B82D, 1, { 46, -1 } },
+    [5465] = { 0x37903E, 2, { 8, 70 } },
+    [5466] = { 0xE0AC54, 2, { 33, 83 } },
+    [5468] = { 0x04ED43, 2, { 28, 71 } },
+    [5469] = { 0xC797DB, 2, { 4, 93 } },
+    [5470] = { 0x56E0B4, 1, { 44, -1 } },
+    [5471] = { 0x4E64AD, 2, { 22, 85 } },
+    [5472] = { 0x5F1DC9, 2, { 50, 74 } },
+    [5476] = { 0xD356DA, 2, { 15, 55 } },
+    [5477] = { 0x000202, 2, { 102, 110 } },
+    [5484] = { 0x062DAA, 2, { 54, 85 } },
+    [5485] = { 0xFA7D13, 1, { 11, -1 } },
+    [5486] = { 0x028360, 2, { 81, 95 } },
+    [5488] = { 0xBEAF2E, 2, { 37, 51 } },
+    [5489] = { 0xDE40F8, 2, { 6, 68 } },
+    [5492] = { 0xDC7AF7, 1, { 39, -1 } },
+    [5493] = { 0x2BFDD3, 2, { 63, 104 } },
+    [5494] = { 0x2FA81D, 2, { 15, 87 } },
+    [5495] = { 0x9F7B87, 2, { 36, 73 } },
+    [5496] = { 0x13B50C, 2, { 26, 69 } },
+    [5497] = { 0x2F2021, 2, { 14, 76 } },
+    [5498] = { 0xFF39B7, 2, { 57, 103 } },
+    [5501] = { 0x084000, 2, { 92, 97 } },
+    [5502] = { 0xC2B3C0, 2, { 49, 105 } },
+    [5506] = { 0x9E6177, 2, { 50, 57 } },
+    [5509] = { 0xF0C4D9, 2, { 13, 22 } },
+    [5510] = { 0xEFF54C, 2, { 61, 89 } },
+    [5512] = { 0x7A1309, 2, { 48, 96 } },
+    [5518] = { 0x91C37F, 2, { 40, 101 } },
+    [5520] = { 0x2BFD43, 2, { 63, 107 } },
+    [5521] = { 0x0DD440, 2, { 71, 111 } },
+    [5522] = { 0x2C3ABC, 2, { 8, 102 } },
+    [5524] = { 0xFF3897, 2, { 57, 106 } },
+    [5525] = { 0xB31132, 2, { 18, 44 } },
+    [5526] = { 0x45FE18, 2, { 32, 48 } },
+    [5529] = { 0xF6A485, 2, { 17, 49 } },
+    [5531] = { 0xCBB1DF, 2, { 33, 63 } },
+    [5532] = { 0x82448D, 2, { 12, 96 } },
+    [5537] = { 0x789BBF, 2, { 3, 97 } },
+    [5540] = { 0x161C56, 2, { 9, 108 } },
+    [5541] = { 0x013EE7, 2, { 39, 67 } },
+    [5542] = { 0x6159C1, 2, { 50, 111 } },
+    [5547] = { 0x4701EF, 2, { 38, 108 } },
+    [5549] = { 0x08B687, 2, { 14, 62 } },
+    [5552] = { 0x000808, 2, { 100, 108 } },
+    [5553] = { 0x11C1B0, 2, { 82, 91 } },
+    [5554] = { 0x18B6A8, 2, { 52, 83 } },
+    [5555] = { 0xDD4410, 1, { 67, -1 } },
+    [5558] = { 0xC28665, 2, { 20, 93 } },
+    [5562] = { 0x43ED04, 2, { 36, 60 } },
+    [5563] = { 0x0A0D80, 2, { 79, 93 } },
+    [5566] = { 0xE0F95B, 2, { 36, 55 } },
+    [5568] = { 0x897B32, 2, { 65, 81 } },
+    [5569] = { 0x3311C5, 2, { 17, 80 } },
+    [5572] = { 0xEDFE15, 2, { 36, 79 } },
+    [5574] = { 0x9ED131, 2, { 5, 83 } },
+    [5576] = { 0x02372D, 2, { 10, 28 } },
+    [5577] = { 0x6BC482, 2, { 70, 76 } },
+    [5581] = { 0x70264E, 2, { 34, 108 } },
+    [5583] = { 0x24E508, 2, { 26, 103 } },
+    [5584] = { 0xBEA074, 2, { 13, 85 } },
+    [5590] = { 0x79F6EC, 2, { 10, 19 } },
+    [5592] = { 0xAFF74C, 2, { 61, 102 } },
+    [5593] = { 0xC1F9FE, 2, { 63, 64 } },
+    [5595] = { 0xBDFE0B, 2, { 62, 64 } },
+    [5599] = { 0x200004, 2, { 90, 109 } },
+    [5600] = { 0x001100, 2, { 99, 103 } },
+    [5602] = { 0x9C9936, 2, { 21, 98 } },
+    [5603] = { 0x4ED430, 2, { 24, 67 } },
+    [5604] = { 0x020800, 2, { 94, 100 } },
+    [5608] = { 0xA7DFA5, 2, { 20, 50 } },
+    [5612] = { 0x030AEE, 2, { 55, 106 } },
+    [5613] = { 0xBC8084, 2, { 12, 74 } },
+    [5614] = { 0x06559C, 2, { 54, 97 } },
+    [5615] = { 0xDAD449, 2, { 23, 94 } },
+    [5620] = { 0x968CBF, 2, { 64, 73 } },
+    [5624] = { 0xC5F186, 2, { 18, 90 } },
+    [5625] = { 0x0545A4, 2, { 11, 57 } },
+    [5626] = { 0x210000, 2, { 90, 95 } },
+    [5631] = { 0x585670, 2, { 52, 89 } },
+    [5632] = { 0x018D67, 2, { 56, 100 } },
+    [5633] = { 0xED7B36, 2, { 20, 63 } },
+    [5635] = { 0x95D24B, 2, { 35, 43 } },
+    [5638] = { 0xF29E9C, 2, { 19, 58 } },
+    [5639] = { 0x028000, 2, { 94, 96 } },
+    [5640] = { 0x000104, 2, { 103, 109 } },
+    [5641] = { 0x003C1B, 2, { 86, 98 } },
+    [5642] = { 0xBB3283, 2, { 41, 53 } },
+    [5644] = { 0x5DAAD5, 2, { 30, 60 } },
+    [5645] = { 0xC686E5, 2, { 20, 104 } },
+    [5647] = { 0xBFC929, 2, { 59, 110 } },
+    [5658] = { 0x2CF986, 2, { 69, 70 } },
+    [5659] = { 0xE04D8C, 2, { 33, 103 } },
+    [5661] = { 0xA91010, 2, { 25, 75 } },
+    [5664] = { 0x57F8A6, 2, { 62, 102 } },
+    [5668] = { 0x4DC955, 2, { 7, 46 } },
+    [5669] = { 0x010100, 2, { 95, 103 } },
+    [5670] = { 0xDA1C90, 2, { 1, 20 } },
+    [5671] = { 0xDF8CDB, 2, { 4, 78 } },
+    [5672] = { 0xCB2FB2, 2, { 17, 57 } },
+    [5674] = { 0xEDB444, 2, { 30, 91 } },
+    [5678] = { 0xD0BCCC, 2, { 15, 83 } },
+    [5681] = { 0x2BBD53, 2, { 63, 97 } },
+    [5682] = { 0x5BDB15, 2, { 34, 63 } },
+    [5684] = { 0x787178, 2, { 7, 90 } },
+    [5685] = { 0x45441F, 2, { 66, 85 } },
+    [5686] = { 0x82B380, 2, { 49, 89 } },
+    [5687] = { 0xAC35A9, 2, { 53, 60 } },
+    [5688] = { 0x552771, 2, { 31, 63 } },
+    [5689] = { 0x11C77F, 2, { 40, 88 } },
+    [5692] = { 0x365104, 2, { 69, 95 } },
+    [5693] = { 0x84A6A5, 2, { 64, 68 } },
+    [5694] = { 0x15B95A, 2, { 63, 74 } },
+    [5695] = { 0xE7A279, 2, { 52, 87 } },
+    [5697] = { 0xAFF50C, 2, { 61, 105 } },
+    [5698] = { 0x2BF953, 2, { 63, 101 } },
+    [5700] = { 0xEA1FFC, 2, { 2, 70 } },
+    [5701] = { 0xD8C852, 2, { 23, 86 } },
+    [5703] = { 0x22C451, 2, { 28, 63 } },
+    [5705] = { 0x2BE148, 2, { 63, 86 } },
+    [5709] = { 0x2DBDDB, 2, { 8, 56 } },
+    [5713] = { 0x375100, 2, { 69, 109 } },
+    [5720] = { 0x120843, 2, { 43, 59 } },
+    [5721] = { 0xF91025, 2, { 72, 111 } },
+    [5724] = { 0xB0EAF0, 2, { 6, 100 } },
+    [5728] = { 0xD05C10, 2, { 15, 109 } },
+    [5736] = { 0xC3B7DB, 2, { 4, 98 } },
+    [5742] = { 0x24E40A, 2, { 26, 110 } },
+    [5743] = { 0xEDF186, 2, { 18, 92 } },
+    [5747] = { 0x4E5C1B, 2, { 22, 104 } },
+    [5748] = { 0x886286, 2, { 16, 33 } },
+    [5751] = { 0x17FAA6, 2, { 62, 89 } },
+    [5754] = { 0xFDF409, 2, { 87, 94 } },
+    [5758] = { 0x7EDA62, 2, { 31, 105 } },
+    [5759] = { 0x3958AE, 2, { 62, 68 } },
+    [5761] = { 0x001002, 2, { 99, 110 } },
+    [5763] = { 0x5C703D, 2, { 25, 46 } },
+    [5764] = { 0x1E86D3, 2, { 13, 60 } },
+    [5765] = { 0x0B8395, 2, { 42, 61 } },
+    [5768] = { 0xD04C14, 2, { 15, 99 } },
+    [5769] = { 0x3E6409, 2, { 74, 98 } },
+    [5771] = { 0x0C0000, 2, { 92, 93 } },
+    [5772] = { 0xDBB58F, 2, { 18, 74 } },
+    [5773] = { 0x85ABBE, 2, { 48, 57 } },
+    [5774] = { 0x280C05, 2, { 17, 78 } },
+    [5775] = { 0x731EAE, 2, { 26, 62 } },
+    [5776] = { 0x587158, 2, { 7, 106 } },
+    [5782] = { 0xA00E91, 2, { 60, 99 } },
+    [5783] = { 0x50B0AE, 2, { 8, 73 } },
+    [5784] = { 0x6CBCB3, 2, { 1, 34 } },
+    [5787] = { 0xB47E71, 2, { 6, 29 } },
+    [5788] = { 0xBD1B22, 2, { 13, 81 } },
+    [5789] = { 0x021C1B, 2, { 86, 94 } },
+    [5790] = { 0x04FB9C, 2, { 37, 65 } },
+    [5799] = { 0x22DA1C, 2, { 12, 60 } },
+    [5801] = { 0xA456D9, 2, { 42, 98 } },
+    [5805] = { 0x073277, 2, { 1, 70 } },
+    [5806] = { 0xBFC82B, 2, { 59, 103 } },
+    [5810] = { 0x08BFC3, 2, { 35, 51 } },
+    [5811] = { 0x704C00, 2, { 76, 98 } },
+    [5812] = { 0x81F553, 2, { 13, 32 } },
+    [5814] = { 0xE987CD, 2, { 64, 81 } },
+    [5815] = { 0x4CBCCA, 2, { 19, 74 } },
+    [5821] = { 0x316091, 2, { 32, 79 } },
+    [5823] = { 0x0B0ACE, 2, { 55, 92 } },
+    [5825] = { 0x62DAA0, 2, { 50, 81 } },
+    [5826] = { 0x7278C3, 2, { 19, 96 } },
+    [5828] = { 0x002020, 2, { 98, 106 } },
+    [5834] = { 0x45E328, 2, { 25, 53 } },
+    [5837] = { 0xEF1832, 2, { 24, 73 } },
+    [5840] = { 0xBF00AD, 2, { 14, 33 } },
+    [5841] = { 0x4706C0, 2, { 80, 89 } },
+    [5844] = { 0x0E0980, 2, { 79, 101 } },
+    [5849] = { 0x9FC92B, 2, { 59, 90 } },
+    [5853] = { 0xB0929C, 2, { 6, 84 } },
+    [5855] = { 0xF5EFCB, 2, { 9, 36 } },
+    [5856] = { 0xFED1AB, 2, { 25, 41 } },
+    [5857] = { 0x4DD441, 2, { 71, 89 } },
+    [5858] = { 0x1C1B40, 2, { 78, 105 } },
+    [5859] = { 0xECD536, 2, { 21, 76 } },
+    [5861] = { 0xB9DCB7, 2, { 54, 59 } },
+    [5862] = { 0xF4C6DF, 2, { 4, 69 } },
+    [5867] = { 0x283600, 2, { 77, 91 } },
+    [5871] = { 0x2D38BC, 2, { 8, 95 } },
+    [5876] = { 0xF1BA93, 2, { 29, 47 } },
+    [5878] = { 0x98B936, 2, { 21, 93 } },
+    [5885] = { 0x58717A, 2, { 7, 110 } },
+    [5888] = { 0xCC4714, 2, { 15, 78 } },
+    [5889] = { 0xFFD409, 2, { 87, 98 } },
+    [5890] = { 0xF87D13, 2, { 11, 94 } },
+    [5891] = { 0xFF14D1, 2, { 83, 87 } },
+    [5893] = { 0x121C5E, 2, { 9, 93 } },
+    [5896] = { 0x4830EE, 2, { 18, 43 } },
+    [5898] = { 0x203836, 2, { 85, 90 } },
+    [5899] = { 0xFA9344, 2, { 72, 81 } },
+    [5901] = { 0xC10307, 2, { 35, 72 } },
+    [5902] = { 0xF6B1BE, 2, { 2, 80 } },
+    [5904] = { 0xE0DA00, 2, { 75, 102 } },
+    [5907] = { 0xCEAC8C, 2, { 50, 61 } },
+    [5909] = { 0x000028, 2, { 106, 108 } },
+    [5913] = { 0x6AAEB3, 2, { 19, 52 } },
+    [5923] = { 0x08DCB4, 2, { 8, 26 } },
+    [5926] = { 0x15B825, 2, { 46, 108 } },
+    [5927] = { 0xE95315, 2, { 17, 67 } },
+    [5932] = { 0x375144, 2, { 69, 105 } },
+    [5938] = { 0x3BA3A4, 2, { 49, 72 } },
+    [5944] = { 0x0DD641, 2, { 71, 102 } },
+    [5948] = { 0x939420, 2, { 24, 101 } },
+    [5949] = { 0x48775F, 2, { 3, 51 } },
+    [5950] = { 0x003936, 2, { 85, 103 } },
+    [5951] = { 0x000081, 2, { 104, 111 } },
+    [5953] = { 0x9E31E9, 1, { 5, -1 } },
+    [5954] = { 0x122A1A, 2, { 68, 73 } },
+    [5957] = { 0xA01ED1, 2, { 60, 105 } },
+    [5958] = { 0x9CB9B6, 2, { 21, 104 } },
+    [5959] = { 0x1C1900, 2, { 78, 102 } },
+    [5960] = { 0x80465F, 2, { 58, 98 } },
+    [5963] = { 0x020020, 2, { 94, 106 } },
+    [5965] = { 0x47B6AE, 2, { 3, 32 } },
+    [5966] = { 0x5C3ABE, 2, { 36, 59 } },
+    [5967] = { 0x93D020, 2, { 24, 97 } },
+    [5968] = { 0xCFCB29, 2, { 8, 36 } },
+    [5971] = { 0x485A00, 2, { 76, 77 } },
+    [5973] = { 0xD2ED77, 2, { 63, 72 } },
+    [5979] = { 0xCFA52B, 2, { 59, 76 } },
+    [5984] = { 0x4885AB, 2, { 20, 37 } },
+    [5985] = { 0x679B0A, 2, { 28, 68 } },
+    [5986] = { 0x03EA16, 2, { 55, 83 } },
+    [5987] = { 0x082B38, 2, { 53, 93 } },
+    [5988] = { 0xFDB644, 2, { 30, 102 } },
+    [5989] = { 0x55F419, 2, { 22, 70 } },
+    [5990] = { 0x140EBC, 2, { 8, 77 } },
+    [5999] = { 0xFEE192, 2, { 11, 29 } },
+    [6000] = { 0x127204, 1, { 27, -1 } },
+    [6001] = { 0x7436F9, 2, { 18, 40 } },
+    [6002] = { 0x468665, 2, { 20, 88 } },
+    [6003] = { 0x4701E7, 1, { 38, -1 } },
+    [6004] = { 0x093D02, 2, { 28, 101 } },
+    [6005] = { 0x8F2FBB, 2, { 41, 77 } },
+    [6007] = { 0x3925EA, 2, { 0, 99 } },
+    [6008] = { 0x46AEC5, 2, { 2, 41 } },
+    [6009] = { 0x000800, 1, { 100, -1 } },
+    [6010] = { 0x79948D, 2, { 24, 64 } },
+    [6011] = { 0xDFB511, 2, { 32, 75 } },
+    [6012] = { 0x257A06, 2, { 15, 47 } },
+    [6013] = { 0x1BD8EE, 2, { 70, 84 } },
+    [6014] = { 0x800010, 2, { 88, 107 } },
+    [6015] = { 0xD8D449, 1, { 23, -1 } },
+    [6016] = { 0xFEBC7D, 2, { 31, 58 } },
+    [6018] = { 0xE878A9, 2, { 23, 51 } },
+    [6019] = { 0xB6F0A7, 2, { 25, 57 } },
+    [6020] = { 0x1F11CE, 2, { 55, 78 } },
+    [6021] = { 0x097902, 2, { 28, 97 } },
+    [6022] = { 0xFA5D13, 2, { 11, 98 } },
+    [6024] = { 0xDC5AF7, 2, { 39, 98 } },
+    [6026] = { 0xBF1FC9, 2, { 4, 73 } },
+    [6028] = { 0x004400, 2, { 97, 101 } },
+    [6029] = { 0x070680, 2, { 80, 105 } },
+    [6030] = { 0xF3B9C4, 2, { 30, 79 } },
+    [6031] = { 0xB59543, 2, { 32, 65 } },
+    [6034] = { 0xAB69CD, 2, { 29, 61 } },
+    [6036] = { 0x702646, 1, { 34, -1 } },
+    [6037] = { 0xE7D0EC, 2, { 64, 71 } },
+    [6039] = { 0x082000, 2, { 92, 98 } },
+    [6040] = { 0x748812, 2, { 73, 92 } },
+    [6042] = { 0x018467, 2, { 56, 103 } },
+    [6043] = { 0x008000, 1, { 96, -1 } },
+    [6044] = { 0x6F09D4, 2, { 18, 65 } },
+    [6045] = { 0x0DD401, 2, { 71, 105 } },
+    [6056] = { 0xE0A1C6, 2, { 37, 68 } },
+    [6059] = { 0xA01C91, 2, { 60, 102 } },
+    [6061] = { 0x195670, 2, { 52, 95 } },
+    [6067] = { 0x0C2BB8, 2, { 53, 104 } },
+    [6069] = { 0xA15CF8, 2, { 5, 32 } },
+    [6073] = { 0x90920E, 2, { 21, 53 } },
+    [6074] = { 0x31C4A5, 2, { 5, 61 } },
+    [6077] = { 0x70DBBF, 2, { 3, 92 } },
+    [6081] = { 0x0C5126, 2, { 56, 71 } },
+    [6083] = { 0x5C1EFA, 2, { 8, 34 } },
+    [6085] = { 0x57FAA7, 2, { 62, 111 } },
+    [6090] = { 0x361705, 2, { 17, 94 } },
+    [6091] = { 0x143101, 2, { 48, 68 } },
+    [6094] = { 0x4E7C9B, 2, { 22, 98 } },
+    [6096] = { 0xB719B9, 2, { 41, 110 } },
+    [6100] = { 0x783600, 2, { 77, 89 } },
+    [6102] = { 0x273903, 2, { 11, 67 } },
+    [6104] = { 0x7ED3FB, 2, { 19, 53 } },
+    [6105] = { 0x0103EA, 2, { 0, 77 } },
+    [6112] = { 0x74B4FF, 2, { 1, 16 } },
+    [6116] = { 0xCB8A82, 2, { 28, 49 } },
+    [6117] = { 0x151690, 2, { 9, 55 } },
+    [6118] = { 0x11A120, 2, { 40, 58 } },
+    [6120] = { 0x840000, 2, { 88, 93 } },
+    [6121] = { 0x080008, 2, { 92, 108 } },
+    [6123] = { 0x637649, 2, { 68, 71 } },
+    [6127] = { 0x939030, 2, { 24, 107 } },
+    [6132] = { 0x905C14, 2, { 15, 89 } },
+    [6134] = { 0x5608C4, 2, { 50, 69 } },
+    [6135] = { 0x3DA96B, 2, { 0, 29 } },
+    [6140] = { 0x5F3C4D, 2, { 14, 84 } },
+    [6144] = { 0xE1C9EB, 2, { 33, 56 } },
+    [6147] = { 0x381322, 2, { 35, 111 } },
+    [6148] = { 0xEC67B4, 2, { 33, 53 } },
+    [6149] = { 0x9708EB, 2, { 5, 28 } },
+    [6150] = { 0xFBF409, 2, { 87, 93 } },
+    [6151] = { 0x138360, 2, { 81, 91 } },
+    [6152] = { 0xEB42A3, 2, { 10, 33 } },
+    [6153] = { 0x0A4821, 2, { 33, 64 } },
+    [6154] = { 0x334629, 2, { 32, 53 } },
+    [6155] = { 0x08885D, 2, { 15, 23 } },
+    [6156] = { 0x57C1BB, 2, { 41, 75 } },
+    [6157] = { 0x7FDD7F, 2, { 3, 80 } },
+    [6158] = { 0x00786C, 2, { 84, 100 } },
+    [6159] = { 0x4B6053, 2, { 1, 62 } },
+    [6160] = { 0x706C80, 2, { 76, 104 } },
+    [6164] = { 0x6FCDF2, 2, { 23, 41 } },
+    [6167] = { 0xEA0CAD, 2, { 64, 100 } },
+    [6169] = { 0x830ACE, 2, { 55, 88 } },
+    [6170] = { 0xB541B3, 2, { 5, 45 } },
+    [6171] = { 0x75C0E5, 2, { 57, 65 } },
+    [6172] = { 0x5797E2, 2, { 0, 68 } },
+    [6173] = { 0x0A0000, 2, { 92, 94 } },
+    [6174] = { 0x722D2D, 2, { 66, 69 } },
+    [6175] = { 0x16185E, 2, { 9, 101 } },
+    [6176] = { 0x90E2F0, 2, { 6, 90 } },
+    [6180] = { 0x001C1B, 1, { 86, -1 } },
+    [6186] = { 0x000410, 2, { 101, 107 } },
+    [6191] = { 0x00F06C, 2, { 84, 96 } },
+    [6192] = { 0x004010, 2, { 97, 107 } },
+    [6193] = { 0x159F3E, 2, { 9, 81 } },
+    [6194] = { 0x3DE1E9, 2, { 41, 65 } },
+    [6199] = { 0xB3853A, 2, { 29, 41 } },
+    [6200] = { 0x098567, 2, { 56, 92 } },
+    [6202] = { 0x0716C0, 2, { 80, 99 } },
+    [6206] = { 0xBE4C4C, 2, { 56, 59 } },
+    [6210] = { 0xEA84AD, 2, { 64, 96 } },
+    [6212] = { 0xF220D2, 2, { 47, 80 } },
+    [6216] = { 0x14799D, 2, { 46, 82 } },
+    [6217] = { 0xCB3CD6, 2, { 33, 45 } },
+    [6219] = { 0xF80FEA, 2, { 61, 62 } },
+    [6220] = { 0xFF52B0, 2, { 14, 60 } },
+    [6221] = { 0x52F9DF, 2, { 43, 57 } },
+    [6228] = { 0xD64917, 2, { 30, 63 } },
+    [6229] = { 0x320299, 2, { 17, 54 } },
+    [6232] = { 0x979020, 2, { 24, 93 } },
+    [6235] = { 0xF33B3B, 2, { 4, 51 } },
+    [6238] = { 0x1F28A4, 2, { 25, 44 } },
+    [6239] = { 0xFFF489, 2, { 87, 104 } },
+    [6240] = { 0x3C63D2, 2, { 4, 87 } },
+    [6246] = { 0xD51AD7, 2, { 3, 43 } },
+    [6247] = { 0xE1D800, 2, { 75, 95 } },
+    [6248] = { 0x281323, 2, { 35, 91 } },
+    [6249] = { 0x87B3F4, 2, { 6, 69 } },
+    [6251] = { 0xB3E618, 2, { 67, 68 } },
+    [6253] = { 0xBFB947, 2, { 59, 84 } },
+    [6255] = { 0xB718BB, 2, { 41, 103 } },
+    [6257] = { 0xAAC7A8, 2, { 43, 80 } },
+    [6262] = { 0xAEEA82, 2, { 62, 72 } },
+    [6267] = { 0xE5F586, 2, { 18, 101 } },
+    [6268] = { 0xC21AE4, 2, { 20, 29 } },
+    [6269] = { 0x30ACE2, 2, { 51, 110 } },
+    [6271] = { 0x11B82D, 2, { 46, 93 } },
+    [6272] = { 0xC397DB, 1, { 4, -1 } },
+    [6273] = { 0xE15D67, 2, { 56, 75 } },
+    [6274] = { 0x2DF90C, 2, { 8, 82 } },
+    [6275] = { 0xF5261A, 2, { 47, 108 } },
+    [6276] = { 0x52E0B4, 2, { 44, 93 } },
+    [6277] = { 0xEF5A0E, 2, { 37, 50 } },
+    [6279] = { 0xCEDA6F, 2, { 2, 32 } },
+    [6286] = { 0x575537, 2, { 33, 41 } },
+    [6287] = { 0xAC440F, 2, { 43, 56 } },
+    [6288] = { 0xA08DAF, 2, { 18, 66 } },
+    [6289] = { 0x78DB9F, 2, { 3, 106 } },
+    [6290] = { 0xB42188, 2, { 11, 22 } },
+    [6293] = { 0x040400, 2, { 93, 101 } },
+    [6294] = { 0x868B61, 2, { 13, 35 } },
+    [6295] = { 0x146798, 2, { 27, 54 } },
+    [6298] = { 0x9719BB, 2, { 41, 90 } },
+    [6299] = { 0xADC368, 2, { 43, 102 } },
+    [6300] = { 0x6B8EC4, 2, { 34, 70 } },
+    [6301] = { 0xFA8580, 2, { 49, 77 } },
+    [6303] = { 0x1F675F, 2, { 17, 45 } },
+    [6304] = { 0x00E8D8, 2, { 83, 100 } },
+    [6308] = { 0x3E4409, 1, { 74, -1 } },
+    [6309] = { 0x044000, 2, { 93, 97 } },
+    [6311] = { 0x8DFDAD, 2, { 3, 47 } },
+    [6313] = { 0x8066DF, 2, { 58, 104 } },
+    [6315] = { 0x000140, 2, { 103, 105 } },
+    [6319] = { 0xE61CC6, 2, { 30, 70 } },
+    [6324] = { 0x4D5655, 2, { 22, 55 } },
+    [6325] = { 0xAF7884, 2, { 64, 66 } },
+    [6326] = { 0x940994, 2, { 17, 60 } },
+    [6327] = { 0xF72612, 2, { 47, 94 } },
+    [6334] = { 0x051F52, 2, { 54, 55 } },
+    [6335] = { 0xECD617, 2, { 39, 51 } },
+    [6338] = { 0x80664F, 2, { 58, 107 } },
+    [6343] = { 0xAEF54C, 2, { 61, 95 } },
+    [6345] = { 0x030ECE, 2, { 55, 101 } },
+    [6350] = { 0xBBF167, 2, { 0, 12 } },
+    [6353] = { 0xA472D9, 2, { 42, 101 } },
+    [6355] = { 0xCC7430, 2, { 8, 33 } },
+    [6356] = { 0xFDD3D2, 2, { 4, 74 } },
+    [6357] = { 0xC9C810, 2, { 25, 88 } },
+    [6360] = { 0x9C31E9, 2, { 5, 94 } },
+    [6361] = { 0xE80C69, 2, { 30, 46 } },
+    [6362] = { 0x7A9D8E, 2, { 54, 73 } },
+    [6363] = { 0x706800, 2, { 76, 101 } },
+    [6364] = { 0x5CA965, 2, { 38, 70 } },
+    [6365] = { 0x000020, 1, { 106, -1 } },
+    [6366] = { 0xD94410, 2, { 67, 93 } },
+    [6369] = { 0x0B1E2F, 2, { 10, 99 } },
+    [6371] = { 0x310F02, 2, { 28, 77 } },
+    [6375] = { 0x471DFC, 2, { 38, 86 } },
+    [6377] = { 0x1679B7, 2, { 3, 68 } },
+    [6378] = { 0xB01E91, 2, { 60, 91 } },
+    [6380] = { 0x1C1B01, 2, { 78, 111 } },
+    [6382] = { 0x56E0A4, 2, { 44, 107 } },
+    [6383] = { 0xA0028A, 2, { 60, 86 } },
+    [6389] = { 0x0C3636, 2, { 47, 72 } },
+    [6390] = { 0x802000, 2, { 88, 98 } },
+    [6398] = { 0x56E568, 2, { 61, 72 } },
+    [6400] = { 0xADC128, 2, { 43, 105 } },
+    [6401] = { 0x13A882, 2, { 70, 92 } },
+    [6403] = { 0x1B1DC0, 2, { 78, 80 } },
+    [6404] = { 0x7B4F2C, 2, { 2, 65 } },
+    [6405] = { 0xDC7AE7, 2, { 39, 107 } },
+    [6406] = { 0x4501E7, 2, { 38, 94 } },
+    [6408] = { 0x9E31E1, 2, { 5, 108 } },
+    [6409] = { 0xE3B395, 2, { 36, 97 } },
+    [6411] = { 0xAFE54C, 2, { 61, 99 } },
+    [6413] = { 0x602E0A, 2, { 16, 92 } },
+    [6417] = { 0x46E5A0, 2, { 5, 23 } },
+    [6418] = { 0x083C15, 2, { 32, 69 } },
+    [6419] = { 0x62F0BC, 2, { 20, 42 } },
+    [6422] = { 0x8AF850, 2, { 65, 110 } },
+    [6424] = { 0x8F0AD5, 2, { 1, 24 } },
+    [6425] = { 0xCB7FE7, 2, { 37, 66 } },
+    [6426] = { 0xFFB409, 2, { 87, 97 } },
+    [6436] = { 0xAF8520, 2, { 61, 84 } },
+    [6439] = { 0x4A7A41, 2, { 1, 44 } },
+    [6441] = { 0xCE4120, 2, { 69, 72 } },
+    [6442] = { 0xFFF009, 2, { 87, 101 } },
+    [6443] = { 0xDD4490, 2, { 67, 104 } },
+    [6444] = { 0xE5F196, 2, { 18, 107 } },
+    [6446] = { 0x220B5B, 2, { 9, 17 } },
+    [6452] = { 0xB6F76C, 2, { 6, 54 } },
+    [6454] = { 0xDD2EE7, 2, { 20, 70 } },
+    [6460] = { 0x73EF60, 2, { 76, 81 } },
+    [6462] = { 0x0F195B, 2, { 26, 63 } },
+    [6463] = { 0x3DE10D, 2, { 9, 63 } },
+    [6468] = { 0x800008, 2, { 88, 108 } },
+    [6469] = { 0xDD4400, 2, { 67, 107 } },
+    [6470] = { 0xC7CBDE, 2, { 25, 37 } },
+    [6471] = { 0x040010, 2, { 93, 107 } },
+    [6473] = { 0x000042, 2, { 105, 110 } },
+    [6475] = { 0x2B486C, 2, { 45, 85 } },
+    [6482] = { 0x9E4461, 2, { 24, 71 } },
+    [6484] = { 0x2E0D80, 2, { 79, 90 } },
+    [6485] = { 0x2D5223, 2, { 16, 66 } },
+    [6486] = { 0x913E2E, 2, { 16, 72 } },
+    [6490] = { 0x9E11E9, 2, { 5, 98 } },
+    [6491] = { 0xBFCD2B, 2, { 59, 101 } },
+    [6493] = { 0x609870, 2, { 50, 82 } },
+    [6494] = { 0x7A9308, 2, { 48, 111 } },
+    [6495] = { 0x341705, 1, { 17, -1 } },
+    [6496] = { 0xAD2810, 2, { 67, 76 } },
+    [6497] = { 0x0A9101, 2, { 29, 79 } },
+    [6498] = { 0x48210C, 2, { 41, 57 } },
+    [6499] = { 0xFBBCA3, 2, { 11, 82 } },
+    [6500] = { 0x80265F, 2, { 58, 97 } },
+    [6502] = { 0xF3A413, 2, { 23, 45 } },
+    [6503] = { 0x93B020, 2, { 24, 98 } },
+    [6504] = { 0x383604, 2, { 77, 109 } },
+    [6507] = { 0x677A21, 2, { 14, 77 } },
+    [6510] = { 0x7D4A29, 2, { 66, 77 } },
+    [6513] = { 0xD1E5DF, 2, { 4, 27 } },
+    [6515] = { 0x621C8D, 2, { 12, 75 } },
+    [6516] = { 0x2C38FC, 2, { 8, 105 } },
+    [6517] = { 0x30A4E0, 2, { 51, 100 } },
+    [6520] = { 0x820000, 2, { 88, 94 } },
+    [6521] = { 0x70C69E, 2, { 34, 83 } },
+    [6522] = { 0x3BA882, 2, { 70, 90 } },
+    [6523] = { 0x61D9C0, 2, { 50, 96 } },
+    [6524] = { 0xC68765, 2, { 20, 103 } },
+    [6525] = { 0x49CC10, 2, { 25, 101 } },
+    [6526] = { 0xD8C52E, 2, { 3, 60 } },
+    [6527] = { 0xB16EDF, 2, { 32, 37 } },
+    [6529] = { 0x8AF872, 2, { 65, 106 } },
+    [6530] = { 0x393600, 2, { 77, 95 } },
+    [6532] = { 0x5C8269, 2, { 5, 49 } },
+    [6534] = { 0x0FF52B, 2, { 18, 64 } },
+    [6540] = { 0xA887AB, 2, { 3, 15 } },
+    [6544] = { 0x01B1DC, 2, { 82, 84 } },
+    [6545] = { 0xDCC46C, 2, { 0, 18 } },
+    [6547] = { 0x073EF6, 2, { 80, 85 } },
+    [6548] = { 0x6B24C4, 2, { 16, 55 } },
+    [6549] = { 0x1F83E2, 2, { 31, 50 } },
+    [6550] = { 0x030A4E, 2, { 55, 104 } },
+    [6551] = { 0x818567, 2, { 56, 88 } },
+    [6552] = { 0x376932, 2, { 69, 85 } },
+    [6558] = { 0x1DDAB0, 2, { 78, 82 } },
+    [6559] = { 0x56ABB5, 2, { 8, 48 } },
+    [6561] = { 0x002400, 2, { 98, 101 } },
+    [6562] = { 0x0AB54F, 2, { 34, 48 } },
+    [6563] = { 0xE9E857, 2, { 9, 87 } },
+    [6564] = { 0x29714F, 2, { 9, 32 } },
+    [6565] = { 0xBA449E, 2, { 57, 66 } },
+    [6566] = { 0x6385AD, 2, { 5, 30 } },
+    [6567] = { 0x1BA982, 2, { 70, 103 } },
+    [6568] = { 0xE3A242, 2, { 1, 57 } },
+    [6572] = { 0xADD168, 2, { 43, 99 } },
+    [6573] = { 0x682F0A, 2, { 16, 103 } },
+    [6575] = { 0x7C0812, 2, { 73, 96 } },
+    [6576] = { 0x006000, 2, { 97, 98 } },
+    [6577] = { 0x080000, 1, { 92, -1 } },
+    [6579] = { 0x6BF248, 2, { 18, 37 } },
+    [6581] = { 0xB2B37A, 2, { 13, 53 } },
+    [6583] = { 0x24ACF5, 2, { 1, 77 } },
+    [6584] = { 0x939028, 2, { 24, 108 } },
+    [6586] = { 0x91477F, 2, { 40, 96 } },
+    [6587] = { 0x0242D0, 2, { 81, 82 } },
+    [6590] = { 0xEDAC7E, 2, { 2, 78 } },
+    [6593] = { 0x3057C4, 2, { 69, 80 } },
+    [6595] = { 0x6A9309, 2, { 48, 91 } },
+    [6596] = { 0xBC6C0D, 2, { 66, 72 } },
+    [6600] = { 0x1A0E9C, 2, { 54, 78 } },
+    [6603] = { 0x01C9B0, 2, { 82, 100 } },
+    [6604] = { 0x1CAE42, 2, { 70, 80 } },
+    [6605] = { 0x6EB208, 2, { 68, 99 } },
+    [6606] = { 0x7C8012, 2, { 73, 100 } },
+    [6609] = { 0x785BBF, 2, { 3, 96 } },
+    [6610] = { 0xADBB2F, 2, { 27, 59 } },
+    [6611] = { 0x0453AD, 2, { 3, 73 } },
+    [6612] = { 0x044D70, 2, { 52, 78 } },
+    [6614] = { 0x74350A, 2, { 16, 78 } },
+    [6615] = { 0x7FF409, 2, { 87, 88 } },
+    [6618] = { 0xFCFACA, 2, { 4, 32 } },
+    [6619] = { 0x5FEA98, 2, { 60, 87 } },
+    [6623] = { 0x34CF92, 2, { 22, 48 } },
+    [6625] = { 0xCA04AD, 2, { 64, 90 } },
+    [6628] = { 0xF1C712, 2, { 2, 84 } },
+    [6630] = { 0x070ACE, 2, { 55, 93 } },
+    [6631] = { 0x71E7F6, 2, { 34, 82 } },
+    [6632] = { 0x4E5C9B, 1, { 22, -1 } },
+    [6634] = { 0x3F2076, 2, { 0, 54 } },
+    [6637] = { 0x001C13, 2, { 86, 108 } },
+    [6641] = { 0xA530A5, 2, { 33, 66 } },
+    [6642] = { 0x9A22EB, 2, { 34, 64 } },
+    [6643] = { 0xDD4010, 2, { 67, 101 } },
+    [6644] = { 0x000408, 2, { 101, 108 } },
+    [6645] = { 0xDA6F6B, 2, { 39, 54 } },
+    [6646] = { 0x6EA20C, 2, { 68, 109 } },
+    [6647] = { 0x78D3BF, 2, { 3, 100 } },
+    [6648] = { 0x60ABA2, 2, { 62, 69 } },
+    [6649] = { 0xE562B8, 2, { 60, 66 } },
+    [6651] = { 0x51CF19, 2, { 32, 68 } },
+    [6652] = { 0xCB2553, 2, { 63, 75 } },
+    [6653] = { 0x56B12B, 2, { 35, 68 } },
+    [6657] = { 0xA7F5B9, 2, { 42, 81 } },
+    [6658] = { 0x427AE9, 2, { 66, 80 } },
+    [6659] = { 0x4D7C29, 2, { 66, 92 } },
+    [6661] = { 0x02CB7E, 2, { 55, 82 } },
+    [6662] = { 0xF7E437, 2, { 60, 62 } },
+    [6663] = { 0x004008, 2, { 97, 108 } },
+    [6666] = { 0x9150D0, 2, { 65, 70 } },
+    [6667] = { 0xE74A4C, 2, { 33, 80 } },
+    [6668] = { 0x2B0036, 2, { 45, 84 } },
+    [6669] = { 0x6FA208, 2, { 68, 95 } },
+    [6670] = { 0xF91824, 2, { 72, 100 } },
+    [6673] = { 0xF59ED9, 2, { 6, 66 } },
+    [6674] = { 0x7A1B4C, 2, { 11, 58 } },
+    [6676] = { 0x4AFBB4, 2, { 44, 78 } },
+    [6677] = { 0x2E0E54, 2, { 40, 59 } },
+    [6678] = { 0xC197DB, 2, { 4, 94 } },
+    [6681] = { 0x13585F, 2, { 10, 52 } },
+    [6684] = { 0x06159C, 1, { 54, -1 } },
+    [6685] = { 0x94B936, 2, { 21, 92 } },
+    [6687] = { 0x89910F, 2, { 40, 52 } },
+    [6688] = { 0x0E0D82, 2, { 79, 110 } },
+    [6689] = { 0x63B3DC, 2, { 39, 59 } },
+    [6690] = { 0x3BA60B, 2, { 31, 66 } },
+    [6691] = { 0x705436, 2, { 76, 85 } },
+    [6692] = { 0x3E06BF, 2, { 35, 54 } },
+    [6693] = { 0x0CD441, 2, { 71, 95 } },
+    [6694] = { 0xAEFB5F, 2, { 2, 14 } },
+    [6695] = { 0x300000, 2, { 90, 91 } },
+    [6696] = { 0xC50505, 2, { 20, 81 } },
+    [6697] = { 0x020400, 2, { 94, 101 } },
+    [6698] = { 0x6F276F, 2, { 56, 68 } },
+    [6700] = { 0x12EF94, 2, { 15, 49 } },
+    [6701] = { 0xF99024, 2, { 72, 96 } },
+    [6703] = { 0xB00228, 2, { 6, 83 } },
+    [6707] = { 0xDDAD68, 2, { 43, 76 } },
+    [6708] = { 0xF7E317, 2, { 6, 38 } },
+    [6712] = { 0x3C4409, 2, { 74, 94 } },
+    [6713] = { 0x024000, 2, { 94, 97 } },
+    [6714] = { 0xA03014, 2, { 15, 76 } },
+    [6715] = { 0xE0C800, 2, { 75, 99 } },
+    [6720] = { 0xFCFEC7, 2, { 55, 87 } },
+    [6721] = { 0x873ACC, 2, { 28, 37 } },
+    [6723] = { 0x68C020, 2, { 12, 64 } },
+    [6724] = { 0x39EE56, 2, { 25, 34 } },
+    [6725] = { 0x9EADC9, 2, { 50, 87 } },
+    [6726] = { 0x1A058F, 2, { 18, 87 } },
+    [6728] = { 0x94DA39, 2, { 42, 51 } },
+    [6729] = { 0x8B538E, 2, { 18, 68 } },
+    [6730] = { 0xC397D3, 2, { 4, 108 } },
+    [6731] = { 0xF52612, 1, { 47, -1 } },
+    [6733] = { 0x08706C, 2, { 84, 92 } },
+    [6734] = { 0x3740BD, 2, { 64, 67 } },
+    [6737] = { 0x100100, 2, { 91, 103 } },
+    [6740] = { 0xF85B17, 2, { 36, 70 } },
+    [6741] = { 0xC28BB6, 2, { 49, 85 } },
+    [6746] = { 0xA57394, 2, { 37, 45 } },
+    [6748] = { 0x7A7D13, 2, { 11, 88 } },
+    [6749] = { 0x13465A, 2, { 45, 77 } },
+    [6755] = { 0x0DC441, 2, { 71, 99 } },
+    [6756] = { 0x5C7AF7, 2, { 39, 88 } },
+    [6757] = { 0x2B7D53, 2, { 63, 96 } },
+    [6760] = { 0x40EDBF, 2, { 3, 77 } },
+    [6768] = { 0x13EE70, 2, { 35, 63 } },
+    [6770] = { 0x652CC1, 2, { 22, 45 } },
+    [6779] = { 0x66B632, 2, { 24, 47 } },
+    [6789] = { 0x2BF553, 2, { 63, 100 } },
+    [6794] = { 0x042B38, 2, { 53, 92 } },
+    [6795] = { 0x837C1B, 2, { 73, 87 } },
+    [6796] = { 0x89AE00, 2, { 47, 73 } },
+    [6798] = { 0x8B6870, 2, { 10, 58 } },
+    [6800] = { 0xB3FBDB, 2, { 4, 76 } },
+    [6801] = { 0x13F67F, 2, { 24, 58 } },
+    [6802] = { 0xBCB936, 2, { 21, 90 } },
+    [6803] = { 0xFDA444, 2, { 30, 99 } },
+    [6804] = { 0xEBA192, 2, { 50, 65 } },
+    [6807] = { 0x72F8C2, 2, { 19, 111 } },
+    [6808] = { 0x032B95, 2, { 36, 75 } },
+    [6811] = { 0x4DC810, 2, { 25, 93 } },
+    [6814] = { 0x163B4D, 2, { 46, 81 } },
+    [6818] = { 0x83E53F, 2, { 58, 81 } },
+    [6820] = { 0x2FECDB, 2, { 29, 45 } },
+    [6823] = { 0x1BCAC9, 2, { 48, 50 } },
+    [6824] = { 0x1F2C09, 2, { 75, 87 } },
+    [6826] = { 0x921547, 2, { 24, 56 } },
+    [6829] = { 0x70562A, 2, { 34, 84 } },
+    [6836] = { 0x0316D5, 2, { 55, 86 } },
+    [6839] = { 0x000101, 2, { 103, 111 } },
+    [6841] = { 0x9E9842, 2, { 13, 90 } },
+    [6843] = { 0xC2C48D, 2, { 12, 89 } },
+    [6847] = { 0x042000, 2, { 93, 98 } },
+    [6853] = { 0xBE2256, 2, { 58, 74 } },
+    [6858] = { 0x161D5E, 2, { 9, 103 } },
+    [6859] = { 0x22FF0C, 2, { 33, 49 } },
+    [6866] = { 0x0B0E2B, 2, { 10, 109 } },
+    [6873] = { 0xC8D15D, 2, { 5, 44 } },
+    [6874] = { 0x08E0D8, 2, { 83, 92 } },
+    [6875] = { 0x94DE8F, 2, { 31, 64 } },
+    [6876] = { 0xCE08F3, 2, { 27, 39 } },
+    [6878] = { 0x9585BC, 2, { 24, 54 } },
+    [6879] = { 0xEB5476, 2, { 40, 48 } },
+    [6881] = { 0x44BD99, 2, { 66, 82 } },
+    [6882] = { 0x872FB6, 2, { 3, 87 } },
+    [6886] = { 0x381327, 2, { 35, 109 } },
+    [6887] = { 0x127284, 2, { 27, 104 } },
+    [6888] = { 0xF5F4A1, 2, { 33, 46 } },
+    [6891] = { 0x3CFB76, 2, { 11, 20 } },
+    [6892] = { 0xEEFFA9, 2, { 10, 18 } },
+    [6893] = { 0x60FCFF, 2, { 64, 65 } },
+    [6894] = { 0xE8F4AB, 2, { 38, 61 } },
+    [6895] = { 0x100002, 2, { 91, 110 } },
+    [6897] = { 0x000880, 2, { 100, 104 } },
+    [6899] = { 0xB10C27, 2, { 41, 54 } },
+    [6900] = { 0xC60665, 2, { 20, 96 } },
+    [6901] = { 0x018577, 2, { 56, 107 } },
+    [6908] = { 0x62F8C3, 2, { 19, 91 } },
+    [6910] = { 0x02A2D2, 2, { 12, 58 } },
+    [6911] = { 0x2C2B38, 2, { 53, 90 } },
+    [6914] = { 0x794F4E, 2, { 20, 59 } },
+    [6919] = { 0x76BD9B, 2, { 21, 64 } },
+    [6924] = { 0x167CC3, 2, { 70, 71 } },
+    [6925] = { 0x7026C6, 2, { 34, 104 } },
+    [6926] = { 0xCE81DC, 2, { 18, 45 } },
+    [6928] = { 0x800000, 1, { 88, -1 } },
+    [6929] = { 0xEF38B7, 2, { 57, 91 } },
+    [6930] = { 0x008080, 2, { 96, 104 } },
+    [6931] = { 0xCE38D2, 2, { 6, 31 } },
+    [6932] = { 0x6597D9, 2, { 18, 58 } },
+    [6934] = { 0x685E66, 2, { 16, 84 } },
+    [6935] = { 0x3C38BC, 2, { 8, 91 } },
+    [6936] = { 0x1F50B0, 2, { 52, 80 } },
+    [6937] = { 0xBE089B, 2, { 59, 82 } },
+    [6938] = { 0x1B2882, 2, { 70, 96 } },
+    [6939] = { 0xF6FE25, 2, { 44, 60 } },
+    [6941] = { 0xE23EFE, 2, { 39, 74 } },
+    [6942] = { 0xC5C56A, 2, { 12, 38 } },
+    [6943] = { 0x4159C0, 2, { 50, 90 } },
+    [6946] = { 0x750FFE, 2, { 3, 71 } },
+    [6953] = { 0xE7F186, 2, { 18, 94 } },
+    [6955] = { 0xB759BB, 2, { 41, 97 } },
+    [6963] = { 0x3F6D31, 2, { 32, 106 } },
+    [6967] = { 0xF7F409, 2, { 87, 92 } },
+    [6968] = { 0xC2BB80, 2, { 49, 100 } },
+    [6969] = { 0x92DF12, 2, { 3, 64 } },
+    [6970] = { 0xA075E0, 2, { 5, 74 } },
+    [6971] = { 0x85C24D, 2, { 12, 80 } },
+    [6977] = { 0x060000, 2, { 93, 94 } },
+    [6978] = { 0x8A5B55, 2, { 11, 34 } },
+    [6980] = { 0x68260A, 2, { 16, 100 } },
+    [6981] = { 0xD448ED, 2, { 45, 57 } },
+    [6983] = { 0x398F57, 2, { 27, 63 } },
+    [6984] = { 0x8874AA, 2, { 32, 41 } },
+    [6985] = { 0xC3E7B7, 2, { 4, 84 } },
+    [6989] = { 0x9220C3, 2, { 19, 75 } },
+    [6990] = { 0x5E8D91, 2, { 14, 82 } },
+    [6991] = { 0x285857, 2, { 9, 74 } },
+    [7001] = { 0x265E65, 2, { 20, 75 } },
+    [7002] = { 0x382600, 2, { 77, 99 } },
+    [7003] = { 0x95AB4C, 2, { 37, 70 } },
+    [7006] = { 0x058567, 2, { 56, 93 } },
+    [7007] = { 0xBFF54C, 2, { 61, 91 } },
+    [7009] = { 0xC57C29, 2, { 66, 88 } },
+    [7012] = { 0xA4F272, 2, { 36, 38 } },
+    [7013] = { 0x22F194, 2, { 26, 54 } },
+    [7016] = { 0x0704C0, 2, { 80, 102 } },
+    [7023] = { 0x58494E, 2, { 7, 85 } },
+    [7025] = { 0x766A9B, 2, { 22, 77 } },
+    [7035] = { 0x4C5C9B, 2, { 22, 94 } },
+    [7038] = { 0x2C38BD, 2, { 8, 111 } },
+    [7039] = { 0xA477D9, 2, { 42, 103 } },
+    [7041] = { 0x939020, 1, { 24, -1 } },
+    [7042] = { 0x241877, 2, { 19, 44 } },
+    [7043] = { 0x8E1FD5, 2, { 37, 86 } },
+    [7044] = { 0xBFE92B, 2, { 59, 98 } },
+    [7045] = { 0x89050E, 2, { 37, 80 } },
+    [7046] = { 0xBF29F3, 2, { 59, 83 } },
+    [7047] = { 0x82B4E1, 2, { 12, 84 } },
+    [7048] = { 0x706D00, 2, { 76, 103 } },
+    [7051] = { 0x675646, 2, { 51, 62 } },
+    [7056] = { 0xC8A50D, 2, { 69, 87 } },
+    [7060] = { 0x90B271, 2, { 51, 60 } },
+    [7065] = { 0x571A7E, 2, { 62, 83 } },
+    [7070] = { 0x001C9B, 2, { 86, 104 } },
+    [7072] = { 0x09150D, 2, { 69, 74 } },
+    [7073] = { 0x2E1D5F, 2, { 37, 60 } },
+    [7076] = { 0x23DB57, 2, { 4, 33 } },
+    [7077] = { 0x80706C, 2, { 84, 88 } },
+    [7081] = { 0xA0D800, 2, { 75, 89 } },
+    [7082] = { 0x242D00, 2, { 77, 78 } },
+    [7084] = { 0x812E2B, 2, { 31, 87 } },
+    [7085] = { 0x49E810, 2, { 25, 98 } },
+    [7088] = { 0x33CD85, 2, { 29, 69 } },
+    [7089] = { 0xFB2B92, 2, { 47, 79 } },
+    [7090] = { 0xE34642, 2, { 33, 55 } },
+    [7091] = { 0x04159C, 2, { 54, 94 } },
+    [7094] = { 0xD89449, 2, { 23, 97 } },
+    [7095] = { 0xE0EBCB, 2, { 5, 31 } },
+    [7097] = { 0x093902, 1, { 28, -1 } },
+    [7099] = { 0x7F70C9, 2, { 12, 30 } },
+    [7100] = { 0xB4E2F0, 2, { 6, 93 } },
+    [7101] = { 0x000400, 1, { 101, -1 } },
+    [7102] = { 0x049E81, 2, { 29, 102 } },
+    [7103] = { 0x0DEC77, 2, { 71, 85 } },
+    [7104] = { 0xD8D049, 2, { 23, 101 } },
+    [7110] = { 0x79DCE2, 2, { 31, 80 } },
+    [7115] = { 0x73E876, 2, { 65, 72 } },
+    [7116] = { 0xD91024, 2, { 72, 90 } },
+    [7117] = { 0x3A4409, 2, { 74, 93 } },
+    [7118] = { 0xDF4C21, 2, { 14, 88 } },
+    [7119] = { 0x004000, 1, { 97, -1 } },
+    [7125] = { 0x7050E3, 2, { 38, 69 } },
+    [7126] = { 0xFFF509, 2, { 87, 103 } },
+    [7127] = { 0xF83E77, 2, { 57, 80 } },
+    [7142] = { 0xB7193B, 2, { 41, 104 } },
+    [7145] = { 0xD4FF71, 2, { 23, 53 } },
+    [7146] = { 0x80DC4B, 2, { 13, 74 } },
+    [7147] = { 0xDEC770, 2, { 67, 81 } },
+    [7150] = { 0xE9758E, 2, { 28, 33 } },
+    [7153] = { 0x8B8051, 2, { 39, 62 } },
+    [7154] = { 0x65C541, 2, { 29, 50 } },
+    [7157] = { 0x97DA03, 2, { 16, 87 } },
+    [7158] = { 0xA0665F, 2, { 58, 90 } },
+    [7159] = { 0x49C818, 2, { 25, 108 } },
+    [7161] = { 0x08D090, 2, { 41, 59 } },
+    [7162] = { 0x2B0462, 2, { 51, 70 } },
+    [7163] = { 0x9DB289, 2, { 5, 81 } },
+    [7167] = { 0xBDB444, 2, { 30, 89 } },
+    [7169] = { 0xD54410, 2, { 67, 92 } },
+    [7170] = { 0x09C1B0, 2, { 82, 92 } },
+    [7176] = { 0x383640, 2, { 77, 105 } },
+    [7177] = { 0x37E6F9, 2, { 24, 42 } },
+    [7182] = { 0x7633DA, 2, { 34, 54 } },
+    [7183] = { 0x0B0C2F, 2, { 10, 102 } },
+    [7184] = { 0x487178, 2, { 7, 91 } },
+    [7185] = { 0xA476DB, 2, { 42, 110 } },
+    [7186] = { 0xC397CB, 2, { 4, 107 } },
+    [7187] = { 0xC51260, 2, { 52, 67 } },
+    [7190] = { 0x5F2626, 2, { 57, 60 } },
+    [7193] = { 0x0ACF9F, 2, { 10, 82 } },
+    [7194] = { 0x9E09DF, 2, { 5, 85 } },
+    [7195] = { 0xBEEF57, 2, { 17, 65 } },
+    [7198] = { 0x038B60, 2, { 81, 100 } },
+    [7203] = { 0x791069, 2, { 48, 81 } },
+    [7204] = { 0x7C07F5, 2, { 62, 63 } },
+    [7205] = { 0xE8559A, 2, { 14, 41 } },
+    [7206] = { 0x82D48D, 2, { 12, 99 } },
+    [7208] = { 0xAB834E, 2, { 1, 41 } },
+    [7209] = { 0x93A816, 2, { 24, 85 } },
+    [7212] = { 0x390DDC, 2, { 0, 85 } },
+    [7213] = { 0x80675F, 2, { 58, 103 } },
+    [7214] = { 0x4BC810, 2, { 25, 94 } },
+    [7215] = { 0x0F9452, 2, { 26, 45 } },
+    [7216] = { 0x1E31E9, 2, { 5, 88 } },
+    [7218] = { 0xF1AC2F, 2, { 64, 70 } },
+    [7224] = { 0x5563D4, 2, { 44, 81 } },
+    [7225] = { 0x80E0D8, 2, { 83, 88 } },
+    [7226] = { 0xF4C465, 2, { 71, 72 } },
+    [7227] = { 0x577541, 2, { 63, 73 } },
+    [7228] = { 0x72FAC3, 2, { 19, 102 } },
+    [7229] = { 0x8E7A08, 2, { 68, 75 } },
+    [7230] = { 0x185671, 2, { 52, 111 } },
+    [7233] = { 0x7A930D, 2, { 48, 109 } },
+    [7235] = { 0x16FC86, 2, { 9, 83 } },
+    [7243] = { 0x0A33CC, 2, { 28, 55 } },
+    [7245] = { 0x56E1B4, 2, { 44, 103 } },
+    [7247] = { 0x35C762, 2, { 35, 71 } },
+    [7248] = { 0x00746C, 2, { 84, 101 } },
+    [7249] = { 0xFF3AB7, 2, { 57, 102 } },
+    [7251] = { 0x022000, 2, { 94, 98 } },
+    [7253] = { 0x0000A0, 2, { 104, 106 } },
+    [7255] = { 0x730E63, 2, { 31, 71 } },
+    [7256] = { 0xD31B4A, 2, { 31, 43 } },
+    [7258] = { 0x4A04CA, 2, { 18, 61 } },
+    [7259] = { 0x7B9309, 2, { 48, 95 } },
+    [7260] = { 0x57BC42, 2, { 65, 67 } },
+    [7262] = { 0x8AFC52, 2, { 65, 101 } },
+    [7263] = { 0xC33042, 2, { 25, 65 } },
+    [7264] = { 0x9B24D3, 2, { 11, 50 } },
+    [7265] = { 0xD038D7, 2, { 34, 60 } },
+    [7266] = { 0x000010, 1, { 107, -1 } },
+    [7269] = { 0xE3F397, 2, { 36, 110 } },
+    [7272] = { 0x663A18, 2, { 9, 34 } },
+    [7273] = { 0x83C48D, 2, { 12, 95 } },
+    [7274] = { 0x64E408, 2, { 26, 89 } },
+    [7276] = { 0x383400, 2, { 77, 102 } },
+    [7277] = { 0x3D4EC7, 2, { 55, 74 } },
+    [7278] = { 0xB669EA, 2, { 43, 70 } },
+    [7284] = { 0x500145, 2, { 61, 87 } },
+    [7286] = { 0xFD4410, 2, { 67, 90 } },
+    [7287] = { 0xBA683F, 2, { 3, 49 } },
+    [7289] = { 0x401000, 2, { 89, 99 } },
+    [7291] = { 0xEA44AD, 2, { 64, 97 } },
+    [7296] = { 0x56E094, 2, { 44, 106 } },
+    [7297] = { 0x3DA796, 2, { 3, 66 } },
+    [7302] = { 0x301705, 2, { 17, 93 } },
+    [7310] = { 0xF9B77E, 2, { 2, 92 } },
+    [7311] = { 0x2372D0, 2, { 6, 24 } },
+    [7312] = { 0x4A1A3C, 2, { 60, 64 } },
+    [7314] = { 0xF0D800, 2, { 75, 91 } },
+    [7316] = { 0x6EA248, 2, { 68, 105 } },
+    [7317] = { 0x672090, 2, { 70, 73 } },
+    [7319] = { 0x8C4D67, 2, { 53, 58 } },
+    [7328] = { 0x400004, 2, { 89, 109 } },
+    [7330] = { 0x020008, 2, { 94, 108 } },
+    [7333] = { 0x15A436, 2, { 46, 86 } },
+    [7334] = { 0xDD4510, 2, { 67, 103 } },
+    [7337] = { 0x1706C0, 2, { 80, 91 } },
+    [7338] = { 0x489F17, 2, { 17, 73 } },
+    [7341] = { 0xB638B4, 2, { 44, 75 } },
+    [7343] = { 0x304C38, 2, { 51, 83 } },
+    [7345] = { 0x569408, 2, { 68, 77 } },
+    [7347] = { 0xDE9C09, 2, { 74, 75 } },
+    [7350] = { 0xE2B8A6, 2, { 70, 72 } },
+    [7352] = { 0x38634F, 2, { 35, 84 } },
+    [7355] = { 0x24E608, 2, { 26, 102 } },
+    [7356] = { 0x1DD441, 2, { 71, 91 } },
+    [7357] = { 0xE5F186, 1, { 18, -1 } },
+    [7358] = { 0x410000, 2, { 89, 95 } },
+    [7359] = { 0x6C6297, 2, { 4, 61 } },
+    [7360] = { 0xA48257, 2, { 26, 58 } },
+    [7361] = { 0x1C9B00, 2, { 78, 96 } },
+    [7363] = { 0x457C39, 2, { 66, 107 } },
+    [7364] = { 0xC393DB, 2, { 4, 101 } },
+    [7365] = { 0xE54F1D, 2, { 0, 39 } },
+    [7368] = { 0x6E6236, 2, { 1, 19 } },
+    [7369] = { 0x039F7B, 2, { 81, 86 } },
+    [7370] = { 0x00D8EE, 2, { 83, 85 } },
+    [7371] = { 0x0FC1F1, 2, { 32, 51 } },
+    [7377] = { 0x001200, 2, { 99, 102 } },
+    [7380] = { 0xF90C3F, 2, { 72, 86 } },
+    [7382] = { 0x341785, 2, { 17, 104 } },
+    [7383] = { 0x3E0409, 2, { 74, 97 } },
+    [7384] = { 0xC04260, 2, { 13, 31 } },
+    [7388] = { 0x38B08D, 2, { 0, 56 } },
+    [7389] = { 0x012168, 2, { 82, 83 } },
+    [7390] = { 0xD4AFDE, 2, { 9, 49 } },
+    [7391] = { 0x040000, 1, { 93, -1 } },
+    [7394] = { 0x3E4009, 2, { 74, 101 } },
+    [7397] = { 0x375904, 2, { 69, 100 } },
+    [7398] = { 0x0E5721, 2, { 71, 81 } },
+    [7399] = { 0x0D074E, 2, { 55, 79 } },
+    [7400] = { 0x0226B8, 2, { 53, 79 } },
+    [7402] = { 0x1A67C9, 2, { 23, 49 } },
+    [7403] = { 0xEE8E90, 2, { 47, 70 } },
+    [7405] = { 0xEDF63F, 2, { 20, 45 } },
+    [7406] = { 0xE159C0, 2, { 50, 88 } },
+    [7407] = { 0xE1AF44, 2, { 30, 78 } },
+    [7409] = { 0x00E4D8, 2, { 83, 101 } },
+    [7411] = { 0x038567, 2, { 56, 94 } },
+    [7412] = { 0x78E389, 2, { 3, 85 } },
+    [7413] = { 0xF92AE0, 2, { 6, 25 } },
+    [7418] = { 0x6EA008, 2, { 68, 102 } },
+    [7419] = { 0xE0D801, 2, { 75, 111 } },
+    [7422] = { 0x000204, 2, { 102, 109 } },
+    [7423] = { 0x9BCEDD, 2, { 58, 70 } },
+    [7427] = { 0xF2966D, 2, { 42, 44 } },
+    [7428] = { 0x73A526, 2, { 34, 81 } },
+    [7429] = { 0xF876A9, 2, { 27, 64 } },
+    [7430] = { 0x48A868, 2, { 66, 71 } },
+    [7431] = { 0x37D104, 2, { 69, 96 } },
+    [7432] = { 0xE04E8C, 2, { 33, 102 } },
+    [7433] = { 0xA5D07A, 2, { 17, 40 } },
+    [7434] = { 0x4A5C9B, 2, { 22, 93 } },
+    [7438] = { 0x030ACE, 1, { 55, -1 } },
+    [7440] = { 0x0706C1, 2, { 80, 111 } },
+    [7441] = { 0x0977CA, 2, { 16, 50 } },
+    [7442] = { 0x010200, 2, { 95, 102 } },
+    [7446] = { 0xDFD30A, 2, { 34, 61 } },
+    [7448] = { 0x6ED6B4, 2, { 44, 77 } },
+    [7455] = { 0x706400, 2, { 76, 100 } },
+    [7456] = { 0x439D66, 2, { 29, 38 } },
+    [7459] = { 0x90208C, 2, { 33, 76 } },
+    [7461] = { 0xE9299F, 2, { 44, 59 } },
+    [7462] = { 0xA09E91, 2, { 60, 96 } },
+    [7464] = { 0x080080, 2, { 92, 104 } },
+    [7465] = { 0xEA042D, 2, { 64, 104 } },
+    [7468] = { 0x8E038E, 2, { 37, 105 } },
+    [7470] = { 0x52B9CA, 2, { 38, 46 } },
+    [7474] = { 0xD672B6, 2, { 7, 37 } },
+    [7490] = { 0x9327DD, 2, { 42, 69 } },
+    [7492] = { 0x44D700, 2, { 48, 74 } },
+    [7493] = { 0x02159C, 2, { 54, 93 } },
+    [7498] = { 0xBED842, 2, { 13, 97 } },
+    [7508] = { 0xEA18B6, 2, { 64, 86 } },
+    [7510] = { 0x382B15, 2, { 35, 85 } },
+    [7520] = { 0x8B7D35, 2, { 56, 65 } },
+    [7522] = { 0x81C1B0, 2, { 82, 88 } },
+    [7523] = { 0x2B47EE, 2, { 0, 27 } },
+    [7531] = { 0xCAB380, 2, { 49, 92 } },
+    [7534] = { 0x75AA3B, 2, { 41, 49 } },
+    [7535] = { 0x04706C, 2, { 84, 93 } },
+    [7537] = { 0x818782, 2, { 20, 38 } },
+    [7538] = { 0xBF6D11, 2, { 32, 88 } },
+    [7539] = { 0xF12612, 2, { 47, 93 } },
+    [7541] = { 0xD75261, 2, { 43, 48 } },
+    [7543] = { 0x4397DB, 2, { 4, 88 } },
+    [7546] = { 0x8EF852, 2, { 65, 93 } },
+    [7547] = { 0xDD55A9, 2, { 64, 69 } },
+    [7549] = { 0x1E7DBB, 2, { 12, 21 } },
+    [7550] = { 0x015169, 2, { 13, 59 } },
+    [7552] = { 0xDD580B, 2, { 67, 86 } },
+    [7553] = { 0x3CA7A7, 2, { 21, 60 } },
+    [7557] = { 0x6740EE, 2, { 19, 46 } },
+    [7558] = { 0x381363, 2, { 35, 105 } },
+    [7559] = { 0x711F7F, 2, { 40, 75 } },
+    [7563] = { 0x0FA858, 2, { 53, 81 } },
+    [7564] = { 0x671C69, 2, { 7, 32 } },
+    [7566] = { 0x20ACE0, 2, { 51, 91 } },
+    [7567] = { 0x9631E9, 2, { 5, 92 } },
+    [7573] = { 0x73F8C3, 2, { 19, 95 } },
+    [7576] = { 0x615DC0, 2, { 50, 101 } },
+    [7580] = { 0x503AF0, 2, { 6, 75 } },
+    [7583] = { 0xBFC92B, 1, { 59, -1 } },
+    [7586] = { 0x341305, 2, { 17, 101 } },
+    [7597] = { 0x5FFAA6, 2, { 62, 92 } },
+    [7599] = { 0x4AD5A6, 2, { 38, 71 } },
+    [7601] = { 0x038260, 2, { 81, 103 } },
+    [7604] = { 0x2C24A7, 2, { 8, 86 } },
+    [7605] = { 0x1178CA, 2, { 27, 55 } },
+    [7610] = { 0xE40F53, 2, { 2, 46 } },
+    [7611] = { 0xA2DCB4, 2, { 47, 62 } },
+    [7614] = { 0xFB7082, 2, { 70, 75 } },
+    [7616] = { 0x49C810, 1, { 25, -1 } },
+    [7618] = { 0x448287, 2, { 38, 81 } },
+    [7621] = { 0x33AB23, 2, { 52, 63 } },
+    [7628] = { 0x2B8D3F, 2, { 63, 84 } },
+    [7629] = { 0xD0D449, 2, { 23, 92 } },
+    [7633] = { 0x24F408, 2, { 26, 99 } },
+    [7634] = { 0x403836, 2, { 85, 89 } },
+    [7640] = { 0x7D95C9, 2, { 48, 80 } },
+    [7642] = { 0xB2CE52, 2, { 65, 77 } },
+    [7644] = { 0x86D36A, 2, { 53, 65 } },
+    [7646] = { 0xE22901, 2, { 32, 67 } },
+    [7648] = { 0xC4A4C9, 2, { 22, 65 } },
+    [7650] = { 0x3CEE71, 2, { 32, 81 } },
+    [7653] = { 0x6C8812, 2, { 73, 91 } },
+    [7654] = { 0x002000, 1, { 98, -1 } },
+    [7655] = { 0x393DEA, 2, { 0, 100 } },
+    [7657] = { 0x0126C9, 2, { 0, 35 } },
+    [7660] = { 0xBE9852, 2, { 13, 107 } },
+    [7666] = { 0xFA7513, 2, { 11, 100 } },
+    [7668] = { 0x6F63B8, 2, { 68, 82 } },
+    [7670] = { 0xBD36B1, 2, { 6, 71 } },
+    [7672] = { 0xDC72F7, 2, { 39, 100 } },
+    [7674] = { 0x24E40C, 2, { 26, 109 } },
+    [7675] = { 0x046848, 2, { 42, 60 } },
+    [7677] = { 0xC2AF9B, 2, { 49, 86 } },
+    [7678] = { 0x5EDA22, 2, { 31, 90 } },
+    [7681] = { 0x04E0D8, 2, { 83, 93 } },
+    [7683] = { 0x8181C0, 2, { 50, 75 } },
+    [7684] = { 0x1C1B20, 2, { 78, 106 } },
+    [7687] = { 0x3B19ED, 2, { 35, 55 } },
+    [7689] = { 0x628930, 2, { 53, 68 } },
+    [7693] = { 0x01C5B0, 2, { 82, 101 } },
+    [7694] = { 0x2F9313, 2, { 58, 61 } },
+    [7696] = { 0x3B705A, 2, { 45, 91 } },
+    [7697] = { 0xFA3BCE, 2, { 43, 62 } },
+    [7699] = { 0xBAB725, 2, { 40, 45 } },
+    [7700] = { 0xB73624, 2, { 0, 37 } },
+    [7703] = { 0x25E408, 2, { 26, 95 } },
+    [7705] = { 0xBFF11D, 2, { 59, 85 } },
+    [7706] = { 0x742ACD, 2, { 15, 42 } },
+    [7708] = { 0x9F407F, 2, { 46, 65 } },
+    [7710] = { 0xBDC168, 2, { 43, 91 } },
+    [7711] = { 0x2AB1EA, 2, { 45, 82 } },
+    [7712] = { 0x0B7E43, 2, { 10, 84 } },
+    [7717] = { 0x0519E6, 2, { 29, 56 } },
+    [7719] = { 0x1AE3B1, 2, { 36, 72 } },
+    [7720] = { 0x003A36, 2, { 85, 102 } },
+    [7721] = { 0x2BDE21, 2, { 66, 68 } },
+    [7722] = { 0xB0FEEB, 2, { 6, 86 } },
+    [7723] = { 0xFF0081, 2, { 57, 85 } },
+    [7724] = { 0xC061F7, 2, { 39, 78 } },
+    [7725] = { 0x011000, 2, { 95, 99 } },
+    [7726] = { 0x89C946, 2, { 13, 69 } },
+    [7728] = { 0x331D0C, 2, { 10, 35 } },
+    [7729] = { 0x5B34F5, 2, { 44, 71 } },
+    [7731] = { 0x7A8309, 2, { 48, 99 } },
+    [7732] = { 0x000008, 1, { 108, -1 } },
+    [7733] = { 0x327204, 2, { 27, 90 } },
+    [7734] = { 0x1C1A00, 2, { 78, 103 } },
+    [7736] = { 0x40C691, 2, { 60, 75 } },
+    [7741] = { 0x200800, 2, { 90, 100 } },
+    [7742] = { 0x7EA208, 2, { 68, 91 } },
+    [7749] = { 0x9C9AF5, 2, { 1, 88 } },
+    [7751] = { 0x99609C, 2, { 36, 48 } },
+    [7753] = { 0x250D1E, 2, { 61, 65 } },
+    [7754] = { 0x375124, 2, { 69, 106 } },
+    [7755] = { 0x339048, 2, { 71, 74 } },
+    [7758] = { 0x8023C3, 2, { 1, 21 } },
+    [7759] = { 0xA01529, 2, { 43, 71 } },
+    [7760] = { 0x0AD21B, 2, { 47, 87 } },
+    [7761] = { 0x9CE4E8, 2, { 41, 63 } },
+    [7762] = { 0xA18808, 2, { 45, 65 } },
+    [7763] = { 0x010004, 2, { 95, 109 } },
+    [7764] = { 0xDCC177, 2, { 56, 67 } },
+    [7765] = { 0xA24740, 2, { 23, 48 } },
+    [7766] = { 0x5B1C5A, 2, { 45, 76 } },
+    [7767] = { 0x18261C, 2, { 52, 84 } },
+    [7768] = { 0x9803BF, 2, { 3, 75 } },
+    [7769] = { 0x2B4A04, 2, { 69, 78 } },
+    [7770] = { 0x715C53, 2, { 71, 73 } },
+    [7771] = { 0x45C4E2, 2, { 6, 47 } },
+    [7772] = { 0x127304, 2, { 27, 103 } },
+    [7773] = { 0x0B8360, 2, { 81, 92 } },
+    [7774] = { 0x208000, 2, { 90, 96 } },
+    [7775] = { 0xF95024, 2, { 72, 97 } },
+    [7780] = { 0x006C77, 2, { 84, 86 } },
+    [7781] = { 0xA01EB1, 2, { 60, 106 } },
+    [7785] = { 0x000900, 2, { 100, 103 } },
+    [7786] = { 0xD06D72, 2, { 5, 22 } },
+    [7787] = { 0x150D56, 2, { 0, 8 } },
+    [7788] = { 0x020000, 1, { 94, -1 } },
+    [7789] = { 0x6A57EF, 2, { 10, 50 } },
+    [7791] = { 0xD8D549, 2, { 23, 103 } },
+    [7796] = { 0xEAE475, 2, { 64, 83 } },
+    [7798] = { 0x70ACE0, 2, { 51, 89 } },
+    [7799] = { 0x70D7A2, 2, { 31, 79 } },
+    [7805] = { 0x375004, 2, { 69, 103 } },
+    [7811] = { 0x018567, 1, { 56, -1 } },
+    [7812] = { 0x702746, 2, { 34, 103 } },
+    [7813] = { 0x800080, 2, { 88, 104 } },
+    [7814] = { 0x52E83D, 2, { 18, 41 } },
+    [7815] = { 0x9FCAFF, 2, { 40, 79 } },
+    [7817] = { 0xADC169, 2, { 43, 111 } },
+    [7818] = { 0x008100, 2, { 96, 103 } },
+    [7819] = { 0x376B5A, 2, { 45, 78 } },
+    [7820] = { 0xEA24AD, 2, { 64, 98 } },
+    [7821] = { 0x04BBE5, 2, { 17, 51 } },
+    [7824] = { 0x21CEB3, 2, { 30, 39 } },
+    [7825] = { 0x481046, 2, { 34, 77 } },
+    [7827] = { 0x86B132, 2, { 43, 45 } },
+    [7828] = { 0x4701C7, 2, { 38, 106 } },
+    [7830] = { 0x295CE5, 2, { 39, 47 } },
+    [7843] = { 0x010ACE, 2, { 55, 94 } },
+    [7844] = { 0x5F6C21, 2, { 14, 98 } },
+    [7846] = { 0xE35B60, 2, { 75, 81 } },
+    [7852] = { 0xDD347C, 2, { 67, 84 } },
+    [7856] = { 0x477C29, 2, { 66, 94 } },
+    [7857] = { 0x15A3F7, 2, { 1, 28 } },
+    [7862] = { 0x6559C0, 2, { 50, 93 } },
+    [7865] = { 0x40C3C1, 2, { 21, 39 } },
+    [7867] = { 0xD18CF8, 2, { 8, 30 } },
+    [7870] = { 0x9D2A39, 2, { 3, 18 } },
+    [7876] = { 0x801E91, 2, { 60, 90 } },
+    [7886] = { 0x30AEE0, 2, { 51, 102 } },
+    [7891] = { 0xD1C77F, 2, { 40, 89 } },
+    [7892] = { 0x256AD3, 2, { 39, 72 } },
+    [7894] = { 0xE5D186, 2, { 18, 98 } },
+    [7896] = { 0x516E5A, 2, { 48, 63 } },
+    [7897] = { 0x9E31EB, 2, { 5, 110 } },
+    [7898] = { 0x01C130, 2, { 82, 104 } },
+    [7899] = { 0x08BC65, 2, { 28, 56 } },
+    [7904] = { 0xC71294, 2, { 3, 59 } },
+    [7909] = { 0xB0E2F0, 1, { 6, -1 } },
+    [7913] = { 0x201C1B, 2, { 86, 90 } },
+    [7918] = { 0x596729, 2, { 66, 78 } },
+    [7921] = { 0x1C9EF5, 2, { 1, 101 } },
+    [7922] = { 0x364409, 2, { 74, 92 } },
+    [7926] = { 0x5F4C29, 2, { 14, 108 } },
+    [7928] = { 0x9390A0, 2, { 24, 104 } },
+    [7933] = { 0x127206, 2, { 27, 110 } },
+    [7937] = { 0xF91034, 2, { 72, 107 } },
+    [7938] = { 0x02706C, 2, { 84, 94 } },
+    [7939] = { 0x981F90, 2, { 9, 37 } },
+    [7941] = { 0x314498, 2, { 54, 69 } },
+    [7943] = { 0xE5E234, 2, { 30, 52 } },
+    [7946] = { 0xD8D44B, 2, { 23, 110 } },
+    [7947] = { 0x5B9B12, 2, { 1, 38 } },
+    [7949] = { 0xB87F6E, 2, { 2, 25 } },
+    [7950] = { 0xD7FAA6, 2, { 62, 88 } },
+    [7952] = { 0x001D1B, 2, { 86, 103 } },
+    [7954] = { 0xF5567E, 2, { 47, 84 } },
+    [7955] = { 0x8BA4A4, 2, { 44, 67 } },
+    [7961] = { 0xDE90EB, 2, { 50, 59 } },
+    [7963] = { 0x884E65, 2, { 8, 42 } },
+    [7964] = { 0x3F5104, 2, { 69, 92 } },
+    [7970] = { 0x05C1B0, 2, { 82, 93 } },
+    [7973] = { 0x22E271, 2, { 7, 48 } },
+    [7974] = { 0x12868F, 2, { 62, 66 } },
+    [7976] = { 0x2D8E2D, 2, { 46, 77 } },
+    [7977] = { 0x008002, 2, { 96, 110 } },
+    [7978] = { 0x5123A0, 2, { 24, 49 } },
+    [7979] = { 0x50C404, 2, { 46, 66 } },
+    [7980] = { 0x15A502, 2, { 70, 79 } },
+    [7981] = { 0xA8B480, 2, { 6, 52 } },
+    [7982] = { 0xD85C14, 2, { 15, 92 } },
+    [7983] = { 0x093982, 2, { 28, 104 } },
+    [7985] = { 0xD6D9C9, 2, { 23, 79 } },
+    [7987] = { 0xBDC92B, 2, { 59, 94 } },
+    [7988] = { 0x000480, 2, { 101, 104 } },
+    [7990] = { 0xA1CC02, 2, { 67, 73 } },
+    [7992] = { 0xFE38B7, 2, { 57, 95 } },
+    [7993] = { 0x386BD1, 2, { 32, 80 } },
+    [7994] = { 0x8D0900, 2, { 37, 55 } },
+    [7995] = { 0xA81E91, 2, { 60, 92 } },
+    [8000] = { 0x3A58B9, 2, { 15, 64 } },
+    [8002] = { 0xE7B853, 2, { 7, 59 } },
+    [8003] = { 0x400040, 2, { 89, 105 } },
+    [8005] = { 0x004080, 2, { 97, 104 } },
+    [8006] = { 0xE90E63, 2, { 55, 64 } },
+    [8007] = { 0x1BB5AD, 2, { 46, 79 } },
+    [8018] = { 0x71ADB0, 2, { 76, 82 } },
+    [8020] = { 0x6E9A3E, 2, { 68, 85 } },
+    [8027] = { 0x9CE40C, 2, { 9, 65 } },
+    [8028] = { 0xB719BB, 1, { 41, -1 } },
+    [8029] = { 0x68C67C, 2, { 9, 31 } },
+    [8038] = { 0xBFC923, 2, { 59, 108 } },
+    [8043] = { 0x72E8C3, 2, { 19, 99 } },
+    [8054] = { 0x853568, 2, { 7, 67 } },
+    [8055] = { 0xAFFD4C, 2, { 61, 100 } },
+    [8060] = { 0x3934EA, 2, { 0, 103 } },
+    [8062] = { 0xFF28B7, 2, { 57, 99 } },
+    [8063] = { 0xA5B769, 2, { 42, 82 } },
+    [8064] = { 0x4C0FC8, 2, { 10, 38 } },
+    [8065] = { 0x013836, 2, { 85, 95 } },
+    [8066] = { 0xC2566B, 2, { 4, 82 } },
+    [8070] = { 0x6BFD53, 2, { 63, 89 } },
+    [8071] = { 0x974F95, 2, { 60, 69 } },
+    [8072] = { 0x7AAB3F, 2, { 48, 85 } },
+    [8073] = { 0x45D252, 2, { 45, 68 } },
+    [8074] = { 0xFCF789, 2, { 49, 74 } },
+    [8077] = { 0xC2F380, 2, { 49, 97 } },
+    [8080] = { 0x2891D0, 2, { 25, 50 } },
+    [8081] = { 0x545A40, 2, { 7, 53 } },
+    [8086] = { 0x02E0D8, 2, { 83, 94 } },
+    [8087] = { 0x0AD281, 2, { 71, 80 } },
+    [8090] = { 0x000240, 2, { 102, 105 } },
+    [8091] = { 0x468480, 2, { 38, 56 } },
+    [8092] = { 0xD47D12, 2, { 28, 67 } },
+    [8094] = { 0x049CC1, 2, { 29, 105 } },
+    [8096] = { 0x200020, 2, { 90, 106 } },
+    [8097] = { 0xCAAD5D, 2, { 20, 53 } },
+    [8104] = { 0x2B9082, 2, { 45, 83 } },
+    [8107] = { 0x374D1F, 2, { 69, 86 } },
+    [8108] = { 0x1935EA, 2, { 0, 90 } },
+    [8111] = { 0xFAB951, 2, { 2, 10 } },
+    [8113] = { 0x7CF5BA, 2, { 21, 33 } },
+    [8116] = { 0x838360, 2, { 81, 88 } },
+    [8118] = { 0xF5B77E, 2, { 2, 93 } },
+    [8120] = { 0xB41375, 2, { 41, 55 } },
+    [8122] = { 0x429AB4, 2, { 8, 68 } },
+    [8123] = { 0x57FEA6, 2, { 62, 101 } },
+    [8125] = { 0x1C9A75, 2, { 1, 104 } },
+    [8130] = { 0xFAB284, 2, { 30, 80 } },
+    [8132] = { 0x22E929, 2, { 46, 69 } },
+    [8134] = { 0x6179C0, 2, { 50, 98 } },
+    [8140] = { 0x8E03CA, 2, { 37, 109 } },
+    [8141] = { 0x000120, 2, { 103, 106 } },
+    [8156] = { 0x2BFF53, 2, { 63, 102 } },
+    [8157] = { 0x214D5A, 2, { 9, 69 } },
+    [8162] = { 0xD85449, 2, { 23, 96 } },
+    [8163] = { 0x30BCE0, 2, { 51, 99 } },
+    [8164] = { 0xE1F186, 2, { 18, 93 } },
+    [8165] = { 0xA9D803, 2, { 44, 57 } },
+    [8166] = { 0x000090, 2, { 104, 107 } },
+    [8174] = { 0xE3C57A, 2, { 2, 27 } },
+    [8176] = { 0x185E70, 2, { 52, 100 } },
+    [8180] = { 0xD56645, 2, { 48, 61 } },
+    [8183] = { 0xF093E1, 2, { 5, 68 } },
+    [8191] = { 0xBB7A89, 2, { 22, 47 } },
+};
+
+static const struct syndromeHash syndromeHash_2_112 = { 10, 13, 3694, syndromeHash_2_112_displacement, syndromeHash_2_112_slots };
+
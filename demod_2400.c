@@ -93,141 +93,135 @@ static void init_bitsets()
 }
 
 //
-// Given 'mlen' magnitude samples in 'm', sampled at 2.4MHz,
-// try to demodulate some Mode S messages.
+// Multithreaded demodulation
+//
+// Each buffer is demodulated in two passes. The first pass finds
+// candidates: every sample offset where there is a plausible preamble,
+// the bits demodulated at each of the five phase offsets, and the part
+// of each score that doesn't depend on the ICAO filter (the CRC and error
+// correction work, which is most of the cost). This pass only reads the
+// buffer, so it is split into contiguous slices of sample offsets, one
+// per demodulator thread; a slice reads up to one message beyond its end,
+// which the trailing overlap already allows for.
+//
+// The second pass runs on the calling thread and walks the candidates in
+// offset order exactly as a single scan would: candidates that start
+// inside an accepted message are skipped, scores are completed against
+// the ICAO filter as it stands at that point, and accepted messages are
+// decoded and passed on in timestamp order. The output does not depend
+// on the number of threads.
 //
-void demodulate2400(struct mag_buf *mag)
-{
-    static struct modesMessage zeroMessage;
-    struct modesMessage mm;
-    unsigned char msg1[MODES_LONG_MSG_BYTES], msg2[MODES_LONG_MSG_BYTES], *msg;
-    uint32_t j;
 
-    static unsigned last_message_end = 0;
+#define DEMOD_PHASES 5      // phase offsets tried per candidate (4..8)
+
+struct demod_candidate {
+    uint32_t j;                                            // sample offset of the preamble
+    unsigned rejected;                                     // bitset of phases rejected by the DF filter
+    unsigned char msg[DEMOD_PHASES][MODES_LONG_MSG_BYTES]; // demodulated bits per phase
+    struct modesScoreInfo score[DEMOD_PHASES];             // filter-independent score per phase
+};
+
+struct demod_slice {
+    pthread_t thread;
+    uint32_t start, end;                  // sample offsets to scan
+    struct demod_candidate *candidates;   // candidates found, in offset order
+    unsigned count;
+    unsigned alloc;
+    uint32_t *preambles;                  // bitmap of offsets that look like a preamble
+    unsigned preambles_alloc;             // size of preambles, in words
+    struct timespec cpu;                  // worker CPU time not yet added to stats
+};
+
+static struct {
+    unsigned nslices;                     // slice 0 runs on the calling thread
+    struct demod_slice *slices;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t work_cond;             // new work, or exiting
+    pthread_cond_t done_cond;             // busy reached 0
+    unsigned generation;                  // incremented for each buffer
+    unsigned busy;                        // worker threads still scanning
+    bool exiting;
+    const uint16_t *m;                    // buffer being scanned
+} demod;
+
+static unsigned last_message_end = 0;     // end of the last message decoded, relative to the next buffer
+
+static struct demod_candidate *demodAddCandidate(struct demod_slice *slice)
+{
+    if (slice->count == slice->alloc) {
+        unsigned alloc = slice->alloc ? slice->alloc * 2 : 1024;
+        struct demod_candidate *candidates = realloc(slice->candidates, alloc * sizeof(*candidates));
+        if (!candidates) {
+            fprintf(stderr, "demod: out of memory allocating candidates\n");
+            abort();
+        }
+        slice->candidates = candidates;
+        slice->alloc = alloc;
+    }
 
-    // initialize bitsets on first call
-    if (!valid_df_short_bitset)
-        init_bitsets();
+    return &slice->candidates[slice->count++];
+}
 
-    if (mag->flags & MAGBUF_DISCONTINUOUS) {
-        // gap, start from the very beginning
-        last_message_end = 0;
+// Offset of the first preamble at or after j, or slice->end if there are none
+static inline uint32_t demodNextPreamble(const struct demod_slice *slice, uint32_t j)
+{
+    unsigned len = slice->end - slice->start;
+    unsigned i = j - slice->start;
+
+    if (i >= len)
+        return slice->end;
+
+    unsigned w = i / 32;
+    uint32_t bits = slice->preambles[w] & (~0U << (i % 32));
+    while (!bits) {
+        if (++w >= (len + 31) / 32)
+            return slice->end;
+        bits = slice->preambles[w];
     }
 
-    unsigned char *bestmsg;
-    int bestscore, bestphase;
-
-    // maximum lookahead we use
-    assert(mag->overlap >= 19 + 1 + 269);
+    return slice->start + w * 32 + __builtin_ctz(bits);
+}
 
-    uint16_t *m = mag->data;
-    uint32_t mlen = mag->validLength - mag->overlap;
+// First pass over one slice of the buffer
+static void demodFindCandidates(struct demod_slice *slice, const uint16_t *m)
+{
+    unsigned len = slice->end - slice->start;
+    unsigned words = (len + 31) / 32;
 
-    uint64_t sum_scaled_signal_power = 0;
+    slice->count = 0;
 
-    msg = msg1;
+    if (words > slice->preambles_alloc) {
+        free(slice->preambles);
+        if (!(slice->preambles = malloc(words * sizeof(uint32_t)))) {
+            fprintf(stderr, "demod: out of memory allocating preamble bitmap\n");
+            abort();
+        }
+        slice->preambles_alloc = words;
+    }
 
-    // sanity check
-    if (last_message_end > mlen)
-        last_message_end = mlen;
+    // Look for messages starting at around sample 0 with phase offset 3..7
+    // (see preamble_u16 for the checks)
+    starch_preamble_u16(&m[slice->start], len, slice->preambles);
 
-    for (j = last_message_end; j < mlen; j++) {
-        uint16_t *preamble = &m[j];
-        int high;
-        uint32_t base_signal, base_noise;
+    for (uint32_t j = demodNextPreamble(slice, slice->start); j < slice->end; j = demodNextPreamble(slice, j + 1)) {
         int try_phase;
-        int msglen;
 
-        // Look for a message starting at around sample 0 with phase offset 3..7
+        // Demodulate at all phases
+        struct demod_candidate *cand = demodAddCandidate(slice);
+        cand->j = j;
+        cand->rejected = 0;
 
-        // Ideal sample values for preambles with different phase
-        // Xn is the first data symbol with phase offset N
-        //
-        // sample#: 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0
-        // phase 3: 2/4\0/5\1 0 0 0 0/5\1/3 3\0 0 0 0 0 0 X4
-        // phase 4: 1/5\0/4\2 0 0 0 0/4\2 2/4\0 0 0 0 0 0 0 X0
-        // phase 5: 0/5\1/3 3\0 0 0 0/3 3\1/5\0 0 0 0 0 0 0 X1
-        // phase 6: 0/4\2 2/4\0 0 0 0 2/4\0/5\1 0 0 0 0 0 0 X2
-        // phase 7: 0/3 3\1/5\0 0 0 0 1/5\0/4\2 0 0 0 0 0 0 X3
-        //
-
-        // quick check: we must have a rising edge 0->1 and a falling edge 12->13
-        if (! (preamble[0] < preamble[1] && preamble[12] > preamble[13]) )
-           continue;
-
-        if (preamble[1] > preamble[2] &&                                       // 1
-            preamble[2] < preamble[3] && preamble[3] > preamble[4] &&          // 3
-            preamble[8] < preamble[9] && preamble[9] > preamble[10] &&         // 9
-            preamble[10] < preamble[11]) {                                     // 11-12
-            // peaks at 1,3,9,11-12: phase 3
-            high = (preamble[1] + preamble[3] + preamble[9] + preamble[11] + preamble[12]) / 4;
-            base_signal = preamble[1] + preamble[3] + preamble[9];
-            base_noise = preamble[5] + preamble[6] + preamble[7];
-        } else if (preamble[1] > preamble[2] &&                                // 1
-                   preamble[2] < preamble[3] && preamble[3] > preamble[4] &&   // 3
-                   preamble[8] < preamble[9] && preamble[9] > preamble[10] &&  // 9
-                   preamble[11] < preamble[12]) {                              // 12
-            // peaks at 1,3,9,12: phase 4
-            high = (preamble[1] + preamble[3] + preamble[9] + preamble[12]) / 4;
-            base_signal = preamble[1] + preamble[3] + preamble[9] + preamble[12];
-            base_noise = preamble[5] + preamble[6] + preamble[7] + preamble[8];
-        } else if (preamble[1] > preamble[2] &&                                // 1
-                   preamble[2] < preamble[3] && preamble[4] > preamble[5] &&   // 3-4
-                   preamble[8] < preamble[9] && preamble[10] > preamble[11] && // 9-10
-                   preamble[11] < preamble[12]) {                              // 12
-            // peaks at 1,3-4,9-10,12: phase 5
-            high = (preamble[1] + preamble[3] + preamble[4] + preamble[9] + preamble[10] + preamble[12]) / 4;
-            base_signal = preamble[1] + preamble[12];
-            base_noise = preamble[6] + preamble[7];
-        } else if (preamble[1] > preamble[2] &&                                 // 1
-                   preamble[3] < preamble[4] && preamble[4] > preamble[5] &&    // 4
-                   preamble[9] < preamble[10] && preamble[10] > preamble[11] && // 10
-                   preamble[11] < preamble[12]) {                               // 12
-            // peaks at 1,4,10,12: phase 6
-            high = (preamble[1] + preamble[4] + preamble[10] + preamble[12]) / 4;
-            base_signal = preamble[1] + preamble[4] + preamble[10] + preamble[12];
-            base_noise = preamble[5] + preamble[6] + preamble[7] + preamble[8];
-        } else if (preamble[2] > preamble[3] &&                                 // 1-2
-                   preamble[3] < preamble[4] && preamble[4] > preamble[5] &&    // 4
-                   preamble[9] < preamble[10] && preamble[10] > preamble[11] && // 10
-                   preamble[11] < preamble[12]) {                               // 12
-            // peaks at 1-2,4,10,12: phase 7
-            high = (preamble[1] + preamble[2] + preamble[4] + preamble[10] + preamble[12]) / 4;
-            base_signal = preamble[4] + preamble[10] + preamble[12];
-            base_noise = preamble[6] + preamble[7] + preamble[8];
-        } else {
-            // no suitable peaks
-            continue;
-        }
-
-        // Check for enough signal
-        if (base_signal * 2 < 3 * base_noise) // about 3.5dB SNR
-            continue;
-
-        // Check that the "quiet" bits 6,7,15,16,17 are actually quiet
-        if (preamble[5] >= high ||
-            preamble[6] >= high ||
-            preamble[7] >= high ||
-            preamble[8] >= high ||
-            preamble[14] >= high ||
-            preamble[15] >= high ||
-            preamble[16] >= high ||
-            preamble[17] >= high ||
-            preamble[18] >= high) {
-            continue;
-        }
-
-        // try all phases
-        Modes.stats_current.demod_preambles++;
-        bestmsg = NULL; bestscore = SR_NOT_SET; bestphase = -1;
         for (try_phase = 4; try_phase <= 8; ++try_phase) {
+            unsigned char *msg = cand->msg[try_phase - 4];
             uint16_t *pPtr;
-            int phase, score;
+            int phase;
 
             // Decode all the next 112 bits, regardless of the actual message
-            // size. We'll check the actual message type later
+            // size, once the DF looks valid. We'll check the actual message
+            // type later
 
-            pPtr = &m[j+19] + (try_phase/5);
+            pPtr = (uint16_t *) &m[j+19] + (try_phase/5);
             phase = try_phase % 5;
 
             unsigned bytelen = 1;
@@ -318,108 +312,309 @@ void demodulate2400(struct mag_buf *mag)
                     // inspect DF field early, only continue processing
                     // messages where the DF appears valid
                     unsigned df = theByte >> 3;
-                    if (valid_df_long_bitset & (1 << df))
+                    if ((valid_df_long_bitset | valid_df_short_bitset) & (1 << df))
                         bytelen = MODES_LONG_MSG_BYTES;
-                    else if (valid_df_short_bitset & (1 << df))
-                        bytelen = MODES_SHORT_MSG_BYTES;
                 }
             }
 
             if (bytelen == 1) {
                 // rejected early by the DF filter
-                Modes.stats_current.demod_rejected_bad++;
+                cand->rejected |= 1 << (try_phase - 4);
                 continue;
             }
 
-            // Score the mode S message and see if it's any good.
-            score = scoreModesMessage(msg);
-            if (score > bestscore) {
-                // new high score!
-                bestmsg = msg;
-                bestscore = score;
-                bestphase = try_phase;
-
-                // swap to using the other buffer so we don't clobber our demodulated data
-                // (if we find a better result then we'll swap back, but that's OK because
-                // we no longer need this copy if we found a better one)
-                msg = (msg == msg1) ? msg2 : msg1;
-            }
+            // Score the mode S message, as far as we can without the ICAO filter
+            scoreModesMessagePrepare(msg, &cand->score[try_phase - 4]);
         }
+    }
+}
 
-        // Do we have a candidate?
-        if (bestscore < SR_ACCEPT_THRESHOLD) {
-            if (bestscore >= SR_UNKNOWN_THRESHOLD)
-                Modes.stats_current.demod_rejected_unknown_icao++;
-            else
-                Modes.stats_current.demod_rejected_bad++;
-            continue; // nope.
-        }
+static void *demodWorkerEntryPoint(void *arg)
+{
+    struct demod_slice *slice = arg;
+    unsigned seen = 0;
+
+    set_thread_name("dump1090-demod");
+
+    pthread_mutex_lock(&demod.mutex);
+    for (;;) {
+        while (!demod.exiting && demod.generation == seen)
+            pthread_cond_wait(&demod.work_cond, &demod.mutex);
+        if (demod.exiting)
+            break;
+
+        seen = demod.generation;
+        const uint16_t *m = demod.m;
+        pthread_mutex_unlock(&demod.mutex);
+
+        struct timespec start;
+        start_cpu_timing(&start);
+        demodFindCandidates(slice, m);
+        end_cpu_timing(&start, &slice->cpu);
+
+        pthread_mutex_lock(&demod.mutex);
+        if (--demod.busy == 0)
+            pthread_cond_signal(&demod.done_cond);
+    }
+    pthread_mutex_unlock(&demod.mutex);
+
+    return NULL;
+}
 
-        msglen = modesMessageLenByType(bestmsg[0] >> 3);
+// Stop the demodulator threads and free their state
+void demodulate2400Shutdown(void)
+{
+    unsigned s;
 
-        // Set initial mm structure details
-        mm = zeroMessage;
+    if (!demod.nslices)
+        return;
 
-        // For consistency with how the Beast / Radarcape does it,
-        // we report the timestamp at the end of bit 56 (even if
-        // the frame is a 112-bit frame)
-        mm.timestampMsg = mag->sampleTimestamp + j*5 + (8 + 56) * 12 + bestphase;
+    if (demod.nslices > 1) {
+        pthread_mutex_lock(&demod.mutex);
+        demod.exiting = true;
+        pthread_cond_broadcast(&demod.work_cond);
+        pthread_mutex_unlock(&demod.mutex);
 
-        // compute message receive time as block-start-time + difference in the 12MHz clock
-        mm.sysTimestampMsg = mag->sysTimestamp + receiveclock_ms_elapsed(mag->sampleTimestamp, mm.timestampMsg);
+        for (s = 1; s < demod.nslices; ++s)
+            pthread_join(demod.slices[s].thread, NULL);
 
-        mm.score = bestscore;
+        pthread_cond_destroy(&demod.work_cond);
+        pthread_cond_destroy(&demod.done_cond);
+        pthread_mutex_destroy(&demod.mutex);
+    }
 
-        // Decode the received message
-        if (decodeModesMessage(&mm, bestmsg) < 0) {
-            Modes.stats_current.demod_rejected_bad++;
-            continue;
-        } else {
-            Modes.stats_current.demod_accepted[mm.correctedbits]++;
+    for (s = 0; s < demod.nslices; ++s) {
+        free(demod.slices[s].candidates);
+        free(demod.slices[s].preambles);
+    }
+    free(demod.slices);
+
+    memset(&demod, 0, sizeof(demod));
+}
+
+// Set up demodulation with the given number of threads (including the
+// calling thread) and start from a clean state
+void demodulate2400Init(unsigned threads)
+{
+    unsigned s;
+
+    demodulate2400Shutdown();
+
+    if (threads < 1)
+        threads = 1;
+
+    last_message_end = 0;
+    init_bitsets();
+
+    if (!(demod.slices = calloc(threads, sizeof(*demod.slices)))) {
+        fprintf(stderr, "demod: out of memory\n");
+        abort();
+    }
+    demod.nslices = threads;
+
+    if (threads == 1)
+        return;
+
+    // resolve the starch CRC implementation now, rather than have
+    // the workers race to do it on their first message
+    static const unsigned char zeros[MODES_LONG_MSG_BYTES];
+    modesChecksum(zeros, MODES_LONG_MSG_BITS);
+
+    pthread_mutex_init(&demod.mutex, NULL);
+    pthread_cond_init(&demod.work_cond, NULL);
+    pthread_cond_init(&demod.done_cond, NULL);
+
+    for (s = 1; s < threads; ++s) {
+        if (pthread_create(&demod.slices[s].thread, NULL, demodWorkerEntryPoint, &demod.slices[s]) != 0) {
+            fprintf(stderr, "demod: failed to start thread: %s\n", strerror(errno));
+            abort();
         }
+    }
+}
+
+// Run the first pass over sample offsets [from, to) of m
+static void demodFindAllCandidates(const uint16_t *m, uint32_t from, uint32_t to)
+{
+    unsigned s;
+
+    for (s = 0; s < demod.nslices; ++s) {
+        demod.slices[s].start = from + (uint64_t) (to - from) * s / demod.nslices;
+        demod.slices[s].end = from + (uint64_t) (to - from) * (s + 1) / demod.nslices;
+    }
+
+    if (demod.nslices == 1) {
+        demodFindCandidates(&demod.slices[0], m);
+        return;
+    }
+
+    pthread_mutex_lock(&demod.mutex);
+    demod.m = m;
+    demod.busy = demod.nslices - 1;
+    ++demod.generation;
+    pthread_cond_broadcast(&demod.work_cond);
+    pthread_mutex_unlock(&demod.mutex);
+
+    demodFindCandidates(&demod.slices[0], m);
+
+    pthread_mutex_lock(&demod.mutex);
+    while (demod.busy)
+        pthread_cond_wait(&demod.done_cond, &demod.mutex);
+    pthread_mutex_unlock(&demod.mutex);
+
+    for (s = 1; s < demod.nslices; ++s) {
+        struct timespec *cpu = &Modes.stats_current.demod_cpu;
+        cpu->tv_sec += demod.slices[s].cpu.tv_sec;
+        cpu->tv_nsec += demod.slices[s].cpu.tv_nsec;
+        normalize_timespec(cpu);
+        demod.slices[s].cpu.tv_sec = demod.slices[s].cpu.tv_nsec = 0;
+    }
+}
+
+//
+// Given 'mlen' magnitude samples in 'm', sampled at 2.4MHz,
+// try to demodulate some Mode S messages.
+//
+void demodulate2400(struct mag_buf *mag)
+{
+    static struct modesMessage zeroMessage;
+    struct modesMessage mm;
+    uint32_t j, next_j;
+    unsigned s, c;
+
+    // single-threaded unless demodulate2400Init said otherwise
+    if (!demod.nslices)
+        demodulate2400Init(1);
+
+    if (mag->flags & MAGBUF_DISCONTINUOUS) {
+        // gap, start from the very beginning
+        last_message_end = 0;
+    }
+
+    unsigned char *bestmsg;
+    int bestscore, bestphase;
 
-        // measure signal power
-        {
-            double signal_power;
-            uint64_t scaled_signal_power = 0;
-            int signal_len = msglen*12/5;
-            int k;
+    // maximum lookahead we use
+    assert(mag->overlap >= 19 + 1 + 269);
+
+    uint16_t *m = mag->data;
+    uint32_t mlen = mag->validLength - mag->overlap;
+
+    uint64_t sum_scaled_signal_power = 0;
+
+    // sanity check
+    if (last_message_end > mlen)
+        last_message_end = mlen;
+
+    demodFindAllCandidates(m, last_message_end, mlen);
+
+    next_j = last_message_end;
+    for (s = 0; s < demod.nslices; ++s) {
+        for (c = 0; c < demod.slices[s].count; ++c) {
+            struct demod_candidate *cand = &demod.slices[s].candidates[c];
+            int try_phase, msglen;
+
+            // inside a message we already decoded?
+            if (cand->j < next_j)
+                continue;
+            j = cand->j;
+
+            // pick the best phase
+            Modes.stats_current.demod_preambles++;
+            bestmsg = NULL; bestscore = SR_NOT_SET; bestphase = -1;
+            for (try_phase = 4; try_phase <= 8; ++try_phase) {
+                int score;
+
+                if (cand->rejected & (1 << (try_phase - 4))) {
+                    // rejected early by the DF filter
+                    Modes.stats_current.demod_rejected_bad++;
+                    continue;
+                }
+
+                score = scoreModesMessageFinish(&cand->score[try_phase - 4]);
+                if (score > bestscore) {
+                    // new high score!
+                    bestmsg = cand->msg[try_phase - 4];
+                    bestscore = score;
+                    bestphase = try_phase;
+                }
+            }
 
-            for (k = 0; k < signal_len; ++k) {
-                uint32_t mag = m[j+19+k];
-                scaled_signal_power += mag * mag;
+            // Do we have a candidate?
+            if (bestscore < SR_ACCEPT_THRESHOLD) {
+                if (bestscore >= SR_UNKNOWN_THRESHOLD)
+                    Modes.stats_current.demod_rejected_unknown_icao++;
+                else
+                    Modes.stats_current.demod_rejected_bad++;
+                continue; // nope.
             }
 
-            signal_power = scaled_signal_power / 65535.0 / 65535.0;
-            mm.signalLevel = signal_power / signal_len;
-            Modes.stats_current.signal_power_sum += signal_power;
-            Modes.stats_current.signal_power_count += signal_len;
-            sum_scaled_signal_power += scaled_signal_power;
+            msglen = modesMessageLenByType(bestmsg[0] >> 3);
 
-            if (mm.signalLevel > Modes.stats_current.peak_signal_power)
-                Modes.stats_current.peak_signal_power = mm.signalLevel;
-            if (mm.signalLevel > 0.50119)
-                Modes.stats_current.strong_signal_count++; // signal power above -3dBFS
-        }
+            // Set initial mm structure details
+            mm = zeroMessage;
 
-        // Feed "empty" sample to adaptive gain logic
-        if (j > last_message_end)
-            adaptive_update(&m[last_message_end], j - last_message_end, NULL);
+            // For consistency with how the Beast / Radarcape does it,
+            // we report the timestamp at the end of bit 56 (even if
+            // the frame is a 112-bit frame)
+            mm.timestampMsg = mag->sampleTimestamp + j*5 + (8 + 56) * 12 + bestphase;
 
-        // Feed message samples to adaptive gain logic, update end pointer
-        last_message_end = j + (msglen + 8) * 12/5;
-        adaptive_update(&m[j], last_message_end - j, &mm);
+            // compute message receive time as block-start-time + difference in the 12MHz clock
+            mm.sysTimestampMsg = mag->sysTimestamp + receiveclock_ms_elapsed(mag->sampleTimestamp, mm.timestampMsg);
 
-        // Skip over the message:
-        // (we actually skip to 8 bits before the end of the message,
-        //  because we can often decode two messages that *almost* collide,
-        //  where the preamble of the second message clobbered the last
-        //  few bits of the first message, but the message bits didn't
-        //  overlap)
-        j = last_message_end - 8*12/5;
+            mm.score = bestscore;
 
-        // Pass data to the next layer
-        useModesMessage(&mm);
+            // Decode the received message
+            if (decodeModesMessage(&mm, bestmsg) < 0) {
+                Modes.stats_current.demod_rejected_bad++;
+                continue;
+            } else {
+                Modes.stats_current.demod_accepted[mm.correctedbits]++;
+            }
+
+            // measure signal power
+            {
+                double signal_power;
+                uint64_t scaled_signal_power = 0;
+                int signal_len = msglen*12/5;
+                int k;
+
+                for (k = 0; k < signal_len; ++k) {
+                    uint32_t mag = m[j+19+k];
+                    scaled_signal_power += mag * mag;
+                }
+
+                signal_power = scaled_signal_power / 65535.0 / 65535.0;
+                mm.signalLevel = signal_power / signal_len;
+                Modes.stats_current.signal_power_sum += signal_power;
+                Modes.stats_current.signal_power_count += signal_len;
+                sum_scaled_signal_power += scaled_signal_power;
+
+                if (mm.signalLevel > Modes.stats_current.peak_signal_power)
+                    Modes.stats_current.peak_signal_power = mm.signalLevel;
+                if (mm.signalLevel > 0.50119)
+                    Modes.stats_current.strong_signal_count++; // signal power above -3dBFS
+            }
+
+            // Feed "empty" sample to adaptive gain logic
+            if (j > last_message_end)
+                adaptive_update(&m[last_message_end], j - last_message_end, NULL);
+
+            // Feed message samples to adaptive gain logic, update end pointer
+            last_message_end = j + (msglen + 8) * 12/5;
+            adaptive_update(&m[j], last_message_end - j, &mm);
+
+            // Skip over the message; the next candidate considered
+            // is the first one at or after next_j
+            // (we actually skip to 8 bits before the end of the message,
+            //  because we can often decode two messages that *almost* collide,
+            //  where the preamble of the second message clobbered the last
+            //  few bits of the first message, but the message bits didn't
+            //  overlap)
+            next_j = last_message_end - 8*12/5 + 1;
+
+            // Pass data to the next layer
+            useModesMessage(&mm);
+        }
     }
 
     /* update noise power */
@@ -24,6 +24,8 @@
 
 struct mag_buf;
 
+void demodulate2400Init(unsigned threads);
+void demodulate2400Shutdown(void);
 void demodulate2400(struct mag_buf *mag);
 void demodulate2400AC(struct mag_buf *mag);
 
@@ -0,0 +1,422 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// demodtests.c - tests for the multithreaded 2.4MHz demodulator
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+#include "sdr_ifile.h"
+
+#include <sys/wait.h>
+
+struct _Modes Modes;
+
+// A synthetic UC8 capture (DF17 / DF11 / DF4 / DF20 traffic with noise,
+// random carrier phase and sample alignment, some overlapping messages
+// and some single-bit errors) is replayed through the ifile SDR with
+// 1, 2, 3 and 4 demodulator threads. Each replay runs in its own process
+// so it starts from the same decoder state; the raw output (with mlat
+// timestamps) and the demodulator statistics must be identical.
+//
+// The same capture is also replayed through the ifile read() path (as a
+// gzip stream), which must match the mapped-file reference, and as a
+// two-file playlist: the first file must decode exactly as before, and
+// the second at least as well (by then every aircraft is known, so
+// fewer Mode S replies are discarded for an unknown address).
+
+#define SAMPLE_RATE 2400000
+#define CAPTURE_SECONDS 2
+#define CAPTURE_SAMPLES (SAMPLE_RATE * CAPTURE_SECONDS)
+#define AIRCRAFT 100
+#define NOISE 0.02
+
+static const unsigned threadCounts[] = { 1, 2, 3, 4 };
+#define THREAD_COUNTS (sizeof(threadCounts) / sizeof(threadCounts[0]))
+
+// Normally provided by sdr.c and dump1090.c, which are not linked here
+void sdrMonitor()
+{
+}
+
+int sdrGetGain()
+{
+    return -1;
+}
+
+int sdrGetMaxGain()
+{
+    return -1;
+}
+
+int sdrSetGain(int step)
+{
+    MODES_NOTUSED(step);
+    return -1;
+}
+
+double sdrGetGainDb(int step)
+{
+    MODES_NOTUSED(step);
+    return 0.0;
+}
+
+void receiverPositionChanged(float lat, float lon, float alt)
+{
+    MODES_NOTUSED(lat);
+    MODES_NOTUSED(lon);
+    MODES_NOTUSED(alt);
+}
+
+static void setParity(unsigned char *msg, unsigned bits, uint32_t overlay)
+{
+    unsigned len = bits / 8;
+    msg[len - 3] = msg[len - 2] = msg[len - 1] = 0;
+    uint32_t crc = modesChecksum(msg, bits) ^ overlay;
+    msg[len - 3] = crc >> 16;
+    msg[len - 2] = crc >> 8;
+    msg[len - 1] = crc;
+}
+
+static double uniform(void)
+{
+    return rand() / (RAND_MAX + 1.0);
+}
+
+// Add a pulse of the given complex amplitude over [t0, t1) microseconds;
+// each sample gets the mean of the signal over its sample period
+static void addPulse(float *iq, double t0, double t1, double ai, double aq)
+{
+    double s0 = t0 * SAMPLE_RATE / 1e6, s1 = t1 * SAMPLE_RATE / 1e6;
+
+    for (unsigned k = s0; k < s1 && k < CAPTURE_SAMPLES; ++k) {
+        double lo = (k > s0 ? k : s0), hi = (k + 1 < s1 ? k + 1 : s1);
+        iq[2 * k] += ai * (hi - lo);
+        iq[2 * k + 1] += aq * (hi - lo);
+    }
+}
+
+static void addMessage(float *iq, double start, const unsigned char *msg, unsigned bits)
+{
+    double amplitude = 0.1 + 0.5 * uniform();
+    double phase = 2 * M_PI * uniform();
+    double ai = amplitude * cos(phase), aq = amplitude * sin(phase);
+
+    // preamble: pulses at 0, 1, 3.5 and 4.5us
+    static const double preamble[] = { 0, 1, 3.5, 4.5 };
+    for (unsigned i = 0; i < 4; ++i)
+        addPulse(iq, start + preamble[i], start + preamble[i] + 0.5, ai, aq);
+
+    // data: PPM, one bit per microsecond from 8us
+    for (unsigned i = 0; i < bits; ++i) {
+        unsigned bit = (msg[i / 8] >> (7 - i % 8)) & 1;
+        double t = start + 8 + i + (bit ? 0 : 0.5);
+        addPulse(iq, t, t + 0.5, ai, aq);
+    }
+}
+
+static unsigned makeCapture(const char *path)
+{
+    static const unsigned df_mix[] = { 17, 17, 17, 11, 11, 4, 20 };
+    uint32_t addrs[AIRCRAFT];
+    unsigned count = 0;
+
+    float *iq = calloc(2 * CAPTURE_SAMPLES, sizeof(float));
+    unsigned char *uc8 = malloc(2 * CAPTURE_SAMPLES);
+    if (!iq || !uc8) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+
+    for (unsigned i = 0; i < AIRCRAFT; ++i)
+        addrs[i] = 1 + rand() % 0xFFFFFE;
+
+    // gaps are sometimes shorter than a long message, so some overlap
+    for (double t = 100.0; t < CAPTURE_SECONDS * 1e6 - 200; t += 30 + 250 * uniform()) {
+        unsigned char msg[MODES_LONG_MSG_BYTES];
+        unsigned df = df_mix[rand() % (sizeof(df_mix) / sizeof(df_mix[0]))];
+        uint32_t addr = addrs[rand() % AIRCRAFT];
+        unsigned bits = (df & 16) ? MODES_LONG_MSG_BITS : MODES_SHORT_MSG_BITS;
+
+        for (unsigned j = 0; j < bits / 8; ++j)
+            msg[j] = rand() % 256;
+
+        if (df == 11 || df == 17) {
+            // address announced, parity with zero interrogator id
+            msg[0] = df << 3 | 5;
+            msg[1] = addr >> 16;
+            msg[2] = addr >> 8;
+            msg[3] = addr;
+            if (df == 17)
+                msg[4] = (1 + rand() % 22) << 3 | (msg[4] & 7);
+            setParity(msg, bits, 0);
+        } else {
+            // address/parity
+            msg[0] = df << 3 | (msg[0] & 7);
+            setParity(msg, bits, addr);
+        }
+
+        // a few single-bit errors outside the DF field
+        if (rand() % 10 == 0) {
+            unsigned bit = 5 + rand() % (bits - 5);
+            msg[bit / 8] ^= 1 << (7 - bit % 8);
+        }
+
+        addMessage(iq, t, msg, bits);
+        ++count;
+    }
+
+    for (unsigned k = 0; k < 2 * CAPTURE_SAMPLES; ++k) {
+        // sum of uniforms as cheap, roughly gaussian noise
+        double noise = NOISE * (uniform() + uniform() + uniform() - 1.5) * 2;
+        double v = 127.5 + 127.5 * (iq[k] + noise);
+        uc8[k] = (v < 0 ? 0 : v > 255 ? 255 : (unsigned char) (v + 0.5));
+    }
+
+    FILE *f = fopen(path, "wb");
+    if (!f || fwrite(uc8, 2, CAPTURE_SAMPLES, f) != CAPTURE_SAMPLES || fclose(f) != 0) {
+        fprintf(stderr, "%s: %s\n", path, strerror(errno));
+        exit(1);
+    }
+
+    free(iq);
+    free(uc8);
+    return count;
+}
+
+static atomic_bool readerDone;
+
+static void *readerEntryPoint(void *arg)
+{
+    MODES_NOTUSED(arg);
+    ifileRun();
+    atomic_store(&readerDone, true);
+    return NULL;
+}
+
+// Replay the capture the way dump1090's main loop does; runs in a child
+// process with stdout redirected to the output file
+static int replay(char **paths, unsigned npaths, unsigned threads)
+{
+    Modes.quiet = 0;
+    Modes.raw = 1;
+    Modes.mlat = 1;
+    Modes.nfix_crc = 1;
+    Modes.fix_df = 1;
+    Modes.check_crc = 1;
+    Modes.demod_threads = threads;
+    Modes.sample_rate = SAMPLE_RATE;
+    Modes.trailing_samples = (MODES_PREAMBLE_US + MODES_LONG_MSG_BITS + 16) * 1e-6 * Modes.sample_rate;
+
+    modesChecksumInit(Modes.nfix_crc);
+    icaoFilterInit();
+    modeACInit();
+
+    if (!fifo_create(MODES_MAG_BUFFERS, MODES_MAG_BUF_SAMPLES + Modes.trailing_samples, Modes.trailing_samples))
+        return 1;
+
+    ifileInitConfig();
+    for (unsigned i = 0; i < npaths; ++i) {
+        char *argv[] = { "--ifile", paths[i] };
+        int j = 0;
+        if (!ifileHandleOption(2, argv, &j))
+            return 1;
+    }
+    if (!ifileOpen())
+        return 1;
+
+    demodulate2400Init(Modes.demod_threads);
+
+    pthread_t reader;
+    pthread_create(&reader, NULL, readerEntryPoint, NULL);
+
+    for (;;) {
+        struct mag_buf *buf = fifo_dequeue(100 /* milliseconds */);
+        if (!buf) {
+            if (atomic_load(&readerDone))
+                break;
+            continue;
+        }
+
+        demodulate2400(buf);
+        Modes.stats_current.samples_processed += buf->validLength - buf->overlap;
+        fifo_release(buf);
+    }
+
+    pthread_join(reader, NULL);
+    demodulate2400Shutdown();
+    ifileClose();
+    fifo_destroy();
+
+    struct stats *st = &Modes.stats_current;
+    printf("samples %" PRIu64 " preambles %u rejected_bad %u rejected_unknown_icao %u accepted %u/%u messages %u\n",
+           st->samples_processed, st->demod_preambles, st->demod_rejected_bad, st->demod_rejected_unknown_icao,
+           st->demod_accepted[0], st->demod_accepted[1], st->messages_total);
+    printf("signal %.9g/%" PRIu64 " noise %.9g/%" PRIu64 " peak %.9g strong %u\n",
+           st->signal_power_sum, st->signal_power_count, st->noise_power_sum, st->noise_power_count,
+           st->peak_signal_power, st->strong_signal_count);
+    fflush(stdout);
+    return 0;
+}
+
+static char *runReplay(char **paths, unsigned npaths, unsigned threads, const char *outpath)
+{
+    fflush(stdout);
+    fflush(stderr);
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        perror("fork");
+        exit(1);
+    }
+
+    if (pid == 0) {
+        int fd = open(outpath, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+        if (fd < 0 || dup2(fd, STDOUT_FILENO) < 0) {
+            perror(outpath);
+            _exit(1);
+        }
+        close(fd);
+        _exit(replay(paths, npaths, threads));
+    }
+
+    int status;
+    if (waitpid(pid, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        fprintf(stderr, "%s:  FAIL: replay with %u threads did not complete\n", paths[0], threads);
+        return NULL;
+    }
+
+    FILE *f = fopen(outpath, "rb");
+    if (!f)
+        return NULL;
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char *result = calloc(len + 1, 1);
+    if (fread(result, 1, len, f) != (size_t) len) {
+        free(result);
+        result = NULL;
+    }
+    fclose(f);
+    unlink(outpath);
+    return result;
+}
+
+static unsigned countLines(const char *s, char first)
+{
+    unsigned n = 0;
+    for (const char *p = s; *p; p = strchr(p, '\n') + 1) {
+        if (*p == first)
+            ++n;
+        if (!strchr(p, '\n'))
+            break;
+    }
+    return n;
+}
+
+int main(int __attribute__ ((unused)) argc, char __attribute__ ((unused)) **argv)
+{
+    int ok = 1;
+    char dir[] = "/tmp/demodtests.XXXXXX";
+    char capture[64], outpath[64];
+
+    if (!mkdtemp(dir)) {
+        perror("mkdtemp");
+        return 1;
+    }
+    snprintf(capture, sizeof(capture), "%s/capture.uc8", dir);
+    snprintf(outpath, sizeof(outpath), "%s/output.txt", dir);
+
+    srand(1);
+    unsigned generated = makeCapture(capture);
+
+    char *reference = NULL;
+    for (unsigned i = 0; i < THREAD_COUNTS; ++i) {
+        unsigned threads = threadCounts[i];
+        char *paths[] = { capture };
+        char *output = runReplay(paths, 1, threads, outpath);
+        if (!output) {
+            ok = 0;
+            continue;
+        }
+
+        unsigned decoded = countLines(output, '@');
+        if (!reference) {
+            // the single-threaded run is the reference; make sure it
+            // actually decoded most of the traffic
+            reference = output;
+            if (decoded < generated / 2) {
+                fprintf(stderr, "%u threads:  FAIL: only %u of %u messages decoded\n", threads, decoded, generated);
+                ok = 0;
+            } else {
+                fprintf(stderr, "%u threads:  PASS (%u of %u messages decoded)\n", threads, decoded, generated);
+            }
+            continue;
+        }
+
+        if (strcmp(output, reference) != 0) {
+            fprintf(stderr, "%u threads:  FAIL: output differs from the single-threaded demodulator (%u vs %u messages)\n",
+                    threads, decoded, countLines(reference, '@'));
+            ok = 0;
+        } else {
+            fprintf(stderr, "%u threads:  PASS\n", threads);
+        }
+        free(output);
+    }
+
+    if (reference) {
+        // read() path: same data through a pipe from gzip
+        char command[160];
+        snprintf(command, sizeof(command), "gzip -c %s > %s.gz", capture, capture);
+        if (system(command) != 0) {
+            fprintf(stderr, "gzip:  FAIL: could not compress the capture\n");
+            ok = 0;
+        } else {
+            char compressed[72];
+            snprintf(compressed, sizeof(compressed), "%s.gz", capture);
+            char *paths[] = { compressed };
+            char *output = runReplay(paths, 1, 1, outpath);
+            if (!output || strcmp(output, reference) != 0) {
+                fprintf(stderr, "gzip:  FAIL: output differs from the uncompressed capture\n");
+                ok = 0;
+            } else {
+                fprintf(stderr, "gzip:  PASS\n");
+            }
+            free(output);
+            unlink(compressed);
+        }
+
+        // playlist: the second file starts a new, discontinuous stream
+        char *paths[] = { capture, capture };
+        char *output = runReplay(paths, 2, 1, outpath);
+        unsigned decoded = output ? countLines(output, '@') : 0;
+        unsigned expected = 2 * countLines(reference, '@');
+        size_t first_file = strstr(reference, "\nsamples ") - reference + 1;
+        if (!output || strncmp(output, reference, first_file) != 0) {
+            fprintf(stderr, "playlist:  FAIL: output for the first file differs from the single-file replay\n");
+            ok = 0;
+        } else if (decoded < expected) {
+            fprintf(stderr, "playlist:  FAIL: %u messages decoded, expected at least %u\n", decoded, expected);
+            ok = 0;
+        } else {
+            fprintf(stderr, "playlist:  PASS\n");
+        }
+        free(output);
+    }
+
+    free(reference);
+    unlink(capture);
+    rmdir(dir);
+
+    return ok ? 0 : 1;
+}
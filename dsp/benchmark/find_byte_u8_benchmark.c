@@ -0,0 +1,50 @@
+#include <stdlib.h>
+
+void STARCH_BENCHMARK(find_byte_u8) (void)
+{
+    uint8_t *in = NULL;
+    unsigned *pos = NULL;
+    const unsigned len = 1024; /* One network read buffer */
+
+    if (!(in = STARCH_BENCHMARK_ALLOC(len, uint8_t))) {
+        goto done;
+    }
+    if (!(pos = STARCH_BENCHMARK_ALLOC(len, unsigned))) {
+        goto done;
+    }
+
+    /* Roughly Beast-shaped: a 0x1a sync byte every 23 bytes plus
+     * whatever 0x1a bytes the random payload happens to contain */
+    srand(1);
+    for (unsigned i = 0; i < len; ++i) {
+        in[i] = (i % 23 == 0) ? 0x1a : rand() % 256;
+    }
+
+    unsigned count;
+    STARCH_BENCHMARK_RUN( find_byte_u8, in, len, 0x1a, pos, &count );
+
+ done:
+    STARCH_BENCHMARK_FREE(in);
+    STARCH_BENCHMARK_FREE(pos);
+}
+
+bool STARCH_BENCHMARK_VERIFY(find_byte_u8) (const uint8_t *in, unsigned len, uint8_t value, unsigned *out_pos, unsigned *out_count)
+{
+    unsigned expected = 0;
+    for (unsigned i = 0; i < len; ++i) {
+        if (in[i] != value)
+            continue;
+        if (expected >= *out_count || out_pos[expected] != i) {
+            fprintf(stderr, "verification failed: match %u should be at offset %u\n", expected, i);
+            return false;
+        }
+        ++expected;
+    }
+
+    if (expected != *out_count) {
+        fprintf(stderr, "verification failed: expected count %u, got count %u\n", expected, *out_count);
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,48 @@
+#include <stdlib.h>
+
+void STARCH_BENCHMARK(modes_checksum_u8) (void)
+{
+    uint8_t *in = NULL;
+    const unsigned len = 14; /* One long Mode S message */
+
+    if (!(in = STARCH_BENCHMARK_ALLOC(len, uint8_t))) {
+        goto done;
+    }
+
+    srand(1);
+    for (unsigned i = 0; i < len; ++i) {
+        in[i] = rand() % 256;
+    }
+
+    uint32_t syndrome;
+
+    fprintf(stderr, "  56-bit message:\n");
+    STARCH_BENCHMARK_RUN( modes_checksum_u8, in, 7, &syndrome );
+
+    fprintf(stderr, "  112-bit message:\n");
+    STARCH_BENCHMARK_RUN( modes_checksum_u8, in, 14, &syndrome );
+
+ done:
+    STARCH_BENCHMARK_FREE(in);
+}
+
+bool STARCH_BENCHMARK_VERIFY(modes_checksum_u8) (const uint8_t *in, unsigned len, uint32_t *out_syndrome)
+{
+    /* bit-at-a-time reference */
+    uint32_t rem = 0;
+    for (unsigned i = 0; i < (len - 3) * 8; ++i) {
+        unsigned bit = (in[i / 8] >> (7 - (i % 8))) & 1;
+        unsigned top = (rem >> 23) & 1;
+        rem = (rem << 1) & 0xffffff;
+        if (bit ^ top)
+            rem ^= 0xfff409;
+    }
+    rem ^= (in[len - 3] << 16) | (in[len - 2] << 8) | in[len - 1];
+
+    if (rem != *out_syndrome) {
+        fprintf(stderr, "verification failed: expected syndrome %06x, got %06x\n", rem, *out_syndrome);
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,115 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Ideal preamble shapes for phases 3..7 (see demod_2400.c) */
+static const uint8_t preamble_u16_shapes[5][19] = {
+    { 2, 4, 0, 5, 1, 0, 0, 0, 0, 5, 1, 3, 3, 0, 0, 0, 0, 0, 0 },
+    { 1, 5, 0, 4, 2, 0, 0, 0, 0, 4, 2, 2, 4, 0, 0, 0, 0, 0, 0 },
+    { 0, 5, 1, 3, 3, 0, 0, 0, 0, 3, 3, 1, 5, 0, 0, 0, 0, 0, 0 },
+    { 0, 4, 2, 2, 4, 0, 0, 0, 0, 2, 4, 0, 5, 1, 0, 0, 0, 0, 0 },
+    { 0, 3, 3, 1, 5, 0, 0, 0, 0, 1, 5, 0, 4, 2, 0, 0, 0, 0, 0 }
+};
+
+void STARCH_BENCHMARK(preamble_u16) (void)
+{
+    uint16_t *in = NULL;
+    uint32_t *bitmap = NULL;
+    const unsigned len = 65536;
+
+    if (!(in = STARCH_BENCHMARK_ALLOC(len + 19, uint16_t)) || !(bitmap = STARCH_BENCHMARK_ALLOC((len + 31) / 32, uint32_t))) {
+        goto done;
+    }
+
+    /* Noise with a preamble of random phase and strength about every
+     * 100 samples, some of them weak enough to fail the signal checks */
+    srand(1);
+    for (unsigned i = 0; i < len + 19; ++i) {
+        in[i] = rand() % 2048;
+    }
+    for (unsigned i = rand() % 100; i + 19 <= len + 19; i += 50 + rand() % 100) {
+        const uint8_t *shape = preamble_u16_shapes[rand() % 5];
+        unsigned scale = 200 + rand() % 6000;
+        for (unsigned k = 0; k < 19; ++k)
+            in[i + k] += shape[k] * scale;
+    }
+
+    STARCH_BENCHMARK_RUN( preamble_u16, in, len, bitmap );
+
+ done:
+    STARCH_BENCHMARK_FREE(in);
+    STARCH_BENCHMARK_FREE(bitmap);
+}
+
+/* Table-driven reference: for each phase, the (larger, smaller) sample
+ * pairs of its peak pattern, and the samples making up high, signal and
+ * noise; the first phase whose pattern matches is used */
+static const struct {
+    uint8_t peaks[6][2];
+    uint8_t high[7];
+    uint8_t signal[5];
+    uint8_t noise[5];
+} preamble_u16_phases[5] = {
+    { { {1,2}, {3,2}, {3,4}, {9,8}, {9,10}, {11,10} },  { 1, 3, 9, 11, 12, 0xff }, { 1, 3, 9, 0xff }, { 5, 6, 7, 0xff } },
+    { { {1,2}, {3,2}, {3,4}, {9,8}, {9,10}, {12,11} },  { 1, 3, 9, 12, 0xff }, { 1, 3, 9, 12, 0xff }, { 5, 6, 7, 8, 0xff } },
+    { { {1,2}, {3,2}, {4,5}, {9,8}, {10,11}, {12,11} }, { 1, 3, 4, 9, 10, 12, 0xff }, { 1, 12, 0xff }, { 6, 7, 0xff } },
+    { { {1,2}, {4,3}, {4,5}, {10,9}, {10,11}, {12,11} }, { 1, 4, 10, 12, 0xff }, { 1, 4, 10, 12, 0xff }, { 5, 6, 7, 8, 0xff } },
+    { { {2,3}, {4,3}, {4,5}, {10,9}, {10,11}, {12,11} }, { 1, 2, 4, 10, 12, 0xff }, { 4, 10, 12, 0xff }, { 6, 7, 8, 0xff } }
+};
+
+static unsigned preamble_u16_sum(const uint16_t *p, const uint8_t *indexes)
+{
+    unsigned sum = 0;
+    for (; *indexes != 0xff; ++indexes)
+        sum += p[*indexes];
+    return sum;
+}
+
+static bool preamble_u16_reference(const uint16_t *p)
+{
+    static const uint8_t quiet[] = { 5, 6, 7, 8, 14, 15, 16, 17, 18 };
+
+    if (!(p[0] < p[1] && p[12] > p[13]))
+        return false;
+
+    for (unsigned phase = 0; phase < 5; ++phase) {
+        bool match = true;
+        for (unsigned k = 0; k < 6; ++k)
+            match = match && p[preamble_u16_phases[phase].peaks[k][0]] > p[preamble_u16_phases[phase].peaks[k][1]];
+        if (!match)
+            continue;
+
+        unsigned high = preamble_u16_sum(p, preamble_u16_phases[phase].high) / 4;
+        if (preamble_u16_sum(p, preamble_u16_phases[phase].signal) * 2 < 3 * preamble_u16_sum(p, preamble_u16_phases[phase].noise))
+            return false;
+        for (unsigned k = 0; k < sizeof(quiet); ++k) {
+            if (p[quiet[k]] >= high)
+                return false;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+bool STARCH_BENCHMARK_VERIFY(preamble_u16) (const uint16_t *in, unsigned len, uint32_t *out_bitmap)
+{
+    unsigned candidates = 0;
+
+    for (unsigned i = 0; i < len; ++i) {
+        bool expected = preamble_u16_reference(&in[i]);
+        bool actual = (out_bitmap[i / 32] >> (i % 32)) & 1;
+        if (expected != actual) {
+            fprintf(stderr, "verification failed: offset %u should %sbe a candidate\n", i, expected ? "" : "not ");
+            return false;
+        }
+        candidates += expected;
+    }
+
+    if (!candidates) {
+        fprintf(stderr, "verification failed: no candidates in the test data\n");
+        return false;
+    }
+
+    return true;
+}
@@ -14,9 +14,12 @@
 #define STARCH_IMPL_REQUIRES(_function,_impl,_feature) STARCH_IMPL(_function,_impl)
 
 #include "../impl/count_above_u16.c"
+#include "../impl/find_byte_u8.c"
 #include "../impl/magnitude_power_uc8.c"
 #include "../impl/magnitude_sc16.c"
 #include "../impl/magnitude_sc16q11.c"
 #include "../impl/magnitude_uc8.c"
 #include "../impl/mean_power_u16.c"
+#include "../impl/modes_checksum_u8.c"
+#include "../impl/preamble_u16.c"
 
@@ -103,3 +103,39 @@ const uint16_t * get_sc16q11_mag_12bit_table()
     return table;
 }
 
+
+// Mode S CRC-24 slicing tables: 8 tables of 256 entries, table k at
+// [k * 256]. Table 0 is the CRC of each single byte; table k is the CRC
+// of that byte followed by k zero bytes.
+const uint32_t * get_crc_modes_tables()
+{
+    static uint32_t *table = NULL;
+
+    if (!table) {
+        table = malloc(sizeof(uint32_t) * 8 * 256);
+        if (!table) {
+            fprintf(stderr, "can't allocate Mode S CRC lookup table\n");
+            abort();
+        }
+
+        for (int b = 0; b <= 255; b++) {
+            uint32_t c = b << 16;
+            for (int j = 0; j < 8; ++j) {
+                if (c & 0x800000)
+                    c = (c << 1) ^ 0xfff409;
+                else
+                    c = (c << 1);
+            }
+            table[b] = c & 0xffffff;
+        }
+
+        for (int k = 1; k < 8; k++) {
+            for (int b = 0; b <= 255; b++) {
+                uint32_t c = table[(k - 1) * 256 + b];
+                table[k * 256 + b] = ((c << 8) ^ table[c >> 16]) & 0xffffff;
+            }
+        }
+    }
+
+    return table;
+}
@@ -0,0 +1,98 @@
+/*
+ * Find every occurrence of a byte value in a buffer.
+ * Writes the offsets of the matches, in increasing order, to out_pos
+ * (which must have room for len entries) and the number found to out_count.
+ *
+ * Used to locate all 0x1a sync/escape bytes in a block of Beast data in
+ * one pass; matches are expected to be sparse.
+ */
+
+#include <string.h>
+
+void STARCH_IMPL(find_byte_u8, branchless) (const uint8_t *in, unsigned len, uint8_t value, unsigned *out_pos, unsigned *out_count)
+{
+    unsigned count = 0;
+    for (unsigned i = 0; i < len; ++i) {
+        // always store, only advance on a match; out_pos[count] never
+        // runs ahead of i so this stays within len entries
+        out_pos[count] = i;
+        count += (in[i] == value);
+    }
+
+    *out_count = count;
+}
+
+void STARCH_IMPL(find_byte_u8, memchr) (const uint8_t *in, unsigned len, uint8_t value, unsigned *out_pos, unsigned *out_count)
+{
+    const uint8_t *p = in;
+    const uint8_t *end = in + len;
+    unsigned count = 0;
+
+    while (p < end && (p = memchr(p, value, end - p)) != NULL) {
+        out_pos[count++] = p - in;
+        ++p;
+    }
+
+    *out_count = count;
+}
+
+#ifdef STARCH_FEATURE_AVX2
+
+#include <immintrin.h>
+
+void STARCH_IMPL_REQUIRES(find_byte_u8, avx2, STARCH_FEATURE_AVX2) (const uint8_t *in, unsigned len, uint8_t value, unsigned *out_pos, unsigned *out_count)
+{
+    const __m256i value_x32 = _mm256_set1_epi8((char) value);
+    unsigned count = 0;
+    unsigned i = 0;
+
+    for (; i + 32 <= len; i += 32) {
+        __m256i block = _mm256_loadu_si256((const __m256i *) (in + i));
+        uint32_t mask = (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(block, value_x32));
+        while (mask) {
+            out_pos[count++] = i + __builtin_ctz(mask);
+            mask &= mask - 1;
+        }
+    }
+
+    for (; i < len; ++i) {
+        if (in[i] == value)
+            out_pos[count++] = i;
+    }
+
+    *out_count = count;
+}
+
+#endif /* STARCH_FEATURE_AVX2 */
+
+#ifdef STARCH_FEATURE_NEON
+
+#include <arm_neon.h>
+
+void STARCH_IMPL_REQUIRES(find_byte_u8, neon, STARCH_FEATURE_NEON) (const uint8_t *in, unsigned len, uint8_t value, unsigned *out_pos, unsigned *out_count)
+{
+    const uint8x16_t value_x16 = vdupq_n_u8(value);
+    unsigned count = 0;
+    unsigned i = 0;
+
+    for (; i + 16 <= len; i += 16) {
+        uint8x16_t compare = vceqq_u8(vld1q_u8(in + i), value_x16);
+        // narrow the 0x00/0xff lanes to one nibble per input byte
+        uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(compare), 4);
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(nibbles), 0);
+        while (mask) {
+            unsigned bit = __builtin_ctzll(mask);
+            out_pos[count++] = i + (bit >> 2);
+            mask &= ~(0xFULL << (bit & ~3U));
+        }
+    }
+
+    for (; i < len; ++i) {
+        if (in[i] == value)
+            out_pos[count++] = i;
+    }
+
+    *out_count = count;
+}
+
+#endif /* STARCH_FEATURE_NEON */
@@ -0,0 +1,154 @@
+/*
+ * Mode S CRC-24 syndrome of a len-byte message, as modesChecksum():
+ * the CRC of the first len-3 bytes XORed with the final 3 (parity) bytes,
+ * so a message with valid parity gives 0. len must be at least 3.
+ */
+
+#include <string.h>
+
+#include "dsp/helpers/tables.h"
+
+static inline uint32_t modes_checksum_load_be24(const uint8_t *p)
+{
+    return (p[0] << 16) | (p[1] << 8) | p[2];
+}
+
+static inline uint32_t modes_checksum_load_be32(const uint8_t *p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return __builtin_bswap32(v);
+}
+
+static inline uint64_t modes_checksum_load_be64(const uint8_t *p)
+{
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return __builtin_bswap64(v);
+}
+
+static inline uint32_t modes_checksum_bytewise(const uint8_t *in, unsigned len)
+{
+    const uint32_t * const crc_table = get_crc_modes_tables();
+    const uint8_t *end = in + len - 3;
+    uint32_t rem = 0;
+
+    while (in < end) {
+        rem = (rem << 8) ^ crc_table[*in++ ^ (rem >> 16)];
+        rem &= 0xffffff;
+    }
+
+    return rem ^ modes_checksum_load_be24(end);
+}
+
+void STARCH_IMPL(modes_checksum_u8, bytewise) (const uint8_t *in, unsigned len, uint32_t *out_syndrome)
+{
+    *out_syndrome = modes_checksum_bytewise(in, len);
+}
+
+/*
+ * Slicing: rem is shifted into the top of a 32- or 64-bit word of message
+ * bytes and each byte of that word is looked up in the table for its
+ * distance from the end of the word (table k = byte followed by k zero
+ * bytes), so 4 or 8 bytes cost one load and 4 or 8 independent lookups.
+ */
+
+void STARCH_IMPL(modes_checksum_u8, slice4) (const uint8_t *in, unsigned len, uint32_t *out_syndrome)
+{
+    const uint32_t * const t = get_crc_modes_tables();
+    const uint8_t *end = in + len - 3;
+    uint32_t rem = 0;
+
+    while (end - in >= 4) {
+        uint32_t w = modes_checksum_load_be32(in) ^ (rem << 8);
+        rem = t[3 * 256 + (w >> 24)] ^
+            t[2 * 256 + ((w >> 16) & 0xff)] ^
+            t[1 * 256 + ((w >> 8) & 0xff)] ^
+            t[0 * 256 + (w & 0xff)];
+        in += 4;
+    }
+
+    while (in < end) {
+        rem = (rem << 8) ^ t[*in++ ^ (rem >> 16)];
+        rem &= 0xffffff;
+    }
+
+    *out_syndrome = rem ^ modes_checksum_load_be24(end);
+}
+
+void STARCH_IMPL(modes_checksum_u8, slice8) (const uint8_t *in, unsigned len, uint32_t *out_syndrome)
+{
+    const uint32_t * const t = get_crc_modes_tables();
+    const uint8_t *end = in + len - 3;
+    uint32_t rem = 0;
+
+    while (end - in >= 8) {
+        uint64_t w = modes_checksum_load_be64(in) ^ ((uint64_t) rem << 40);
+        rem = t[7 * 256 + (w >> 56)] ^
+            t[6 * 256 + ((w >> 48) & 0xff)] ^
+            t[5 * 256 + ((w >> 40) & 0xff)] ^
+            t[4 * 256 + ((w >> 32) & 0xff)] ^
+            t[3 * 256 + ((w >> 24) & 0xff)] ^
+            t[2 * 256 + ((w >> 16) & 0xff)] ^
+            t[1 * 256 + ((w >> 8) & 0xff)] ^
+            t[0 * 256 + (w & 0xff)];
+        in += 8;
+    }
+
+    if (end - in >= 4) {
+        uint32_t w = modes_checksum_load_be32(in) ^ (rem << 8);
+        rem = t[3 * 256 + (w >> 24)] ^
+            t[2 * 256 + ((w >> 16) & 0xff)] ^
+            t[1 * 256 + ((w >> 8) & 0xff)] ^
+            t[0 * 256 + (w & 0xff)];
+        in += 4;
+    }
+
+    while (in < end) {
+        rem = (rem << 8) ^ t[*in++ ^ (rem >> 16)];
+        rem &= 0xffffff;
+    }
+
+    *out_syndrome = rem ^ modes_checksum_load_be24(end);
+}
+
+#if defined(STARCH_FEATURE_AVX2) && defined(__PCLMUL__)
+
+#include <immintrin.h>
+
+/*
+ * Carry-less multiply: the data part of a 56- or 112-bit message (at most
+ * 88 bits) is folded to a 64-bit T with T*x^24 == data*x^24 (mod P), then
+ * T*x^24 mod P comes from one Barrett reduction. Constants for
+ * P = x^24 + 0xfff409:
+ *   x^64 mod P                  = 0xf52612
+ *   floor(x^88 / P) - x^64      = 0x80090b3e028fb241
+ * Other lengths use the bytewise loop.
+ */
+
+static inline __m128i modes_checksum_clmul(uint64_t a, uint64_t b)
+{
+    return _mm_clmulepi64_si128(_mm_cvtsi64_si128((long long) a), _mm_cvtsi64_si128((long long) b), 0x00);
+}
+
+void STARCH_IMPL_REQUIRES(modes_checksum_u8, pclmul, STARCH_FEATURE_AVX2) (const uint8_t *in, unsigned len, uint32_t *out_syndrome)
+{
+    uint64_t t;
+
+    if (len == 14) {
+        uint64_t high = modes_checksum_load_be24(in);
+        t = modes_checksum_load_be64(in + 3) ^ (uint64_t) _mm_cvtsi128_si64(modes_checksum_clmul(high, 0xf52612));
+    } else if (len == 7) {
+        t = modes_checksum_load_be32(in);
+    } else {
+        *out_syndrome = modes_checksum_bytewise(in, len);
+        return;
+    }
+
+    uint64_t q = t ^ (uint64_t) _mm_extract_epi64(modes_checksum_clmul(t, 0x80090b3e028fb241ULL), 1);
+    uint32_t crc = (uint32_t) _mm_cvtsi128_si64(modes_checksum_clmul(q, 0xfff409)) & 0xffffff;
+
+    *out_syndrome = crc ^ modes_checksum_load_be24(in + len - 3);
+}
+
+#endif /* STARCH_FEATURE_AVX2 && __PCLMUL__ */
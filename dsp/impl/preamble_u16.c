@@ -0,0 +1,217 @@
+/*
+ * Mode S preamble detection over 2.4MHz magnitude samples.
+ *
+ * For each offset i in [0, len), decides whether a message could start
+ * at in[i] (the preamble checks at the top of demodulate2400: rising and
+ * falling edges, the peak pattern for one of the phases 3..7, enough
+ * signal over noise, and quiet samples where the preamble is quiet), and
+ * sets bit (i % 32) of out_bitmap[i / 32] if so. out_bitmap must have
+ * room for (len + 31) / 32 words. Reads in[0 .. len + 18].
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+static inline bool preamble_u16_check(const uint16_t *preamble)
+{
+    unsigned high;
+    uint32_t base_signal, base_noise;
+
+    // quick check: we must have a rising edge 0->1 and a falling edge 12->13
+    if (! (preamble[0] < preamble[1] && preamble[12] > preamble[13]) )
+        return false;
+
+    if (preamble[1] > preamble[2] &&                                       // 1
+        preamble[2] < preamble[3] && preamble[3] > preamble[4] &&          // 3
+        preamble[8] < preamble[9] && preamble[9] > preamble[10] &&         // 9
+        preamble[10] < preamble[11]) {                                     // 11-12
+        // peaks at 1,3,9,11-12: phase 3
+        high = (preamble[1] + preamble[3] + preamble[9] + preamble[11] + preamble[12]) / 4;
+        base_signal = preamble[1] + preamble[3] + preamble[9];
+        base_noise = preamble[5] + preamble[6] + preamble[7];
+    } else if (preamble[1] > preamble[2] &&                                // 1
+               preamble[2] < preamble[3] && preamble[3] > preamble[4] &&   // 3
+               preamble[8] < preamble[9] && preamble[9] > preamble[10] &&  // 9
+               preamble[11] < preamble[12]) {                              // 12
+        // peaks at 1,3,9,12: phase 4
+        high = (preamble[1] + preamble[3] + preamble[9] + preamble[12]) / 4;
+        base_signal = preamble[1] + preamble[3] + preamble[9] + preamble[12];
+        base_noise = preamble[5] + preamble[6] + preamble[7] + preamble[8];
+    } else if (preamble[1] > preamble[2] &&                                // 1
+               preamble[2] < preamble[3] && preamble[4] > preamble[5] &&   // 3-4
+               preamble[8] < preamble[9] && preamble[10] > preamble[11] && // 9-10
+               preamble[11] < preamble[12]) {                              // 12
+        // peaks at 1,3-4,9-10,12: phase 5
+        high = (preamble[1] + preamble[3] + preamble[4] + preamble[9] + preamble[10] + preamble[12]) / 4;
+        base_signal = preamble[1] + preamble[12];
+        base_noise = preamble[6] + preamble[7];
+    } else if (preamble[1] > preamble[2] &&                                 // 1
+               preamble[3] < preamble[4] && preamble[4] > preamble[5] &&    // 4
+               preamble[9] < preamble[10] && preamble[10] > preamble[11] && // 10
+               preamble[11] < preamble[12]) {                               // 12
+        // peaks at 1,4,10,12: phase 6
+        high = (preamble[1] + preamble[4] + preamble[10] + preamble[12]) / 4;
+        base_signal = preamble[1] + preamble[4] + preamble[10] + preamble[12];
+        base_noise = preamble[5] + preamble[6] + preamble[7] + preamble[8];
+    } else if (preamble[2] > preamble[3] &&                                 // 1-2
+               preamble[3] < preamble[4] && preamble[4] > preamble[5] &&    // 4
+               preamble[9] < preamble[10] && preamble[10] > preamble[11] && // 10
+               preamble[11] < preamble[12]) {                               // 12
+        // peaks at 1-2,4,10,12: phase 7
+        high = (preamble[1] + preamble[2] + preamble[4] + preamble[10] + preamble[12]) / 4;
+        base_signal = preamble[4] + preamble[10] + preamble[12];
+        base_noise = preamble[6] + preamble[7] + preamble[8];
+    } else {
+        // no suitable peaks
+        return false;
+    }
+
+    // Check for enough signal
+    if (base_signal * 2 < 3 * base_noise) // about 3.5dB SNR
+        return false;
+
+    // Check that the "quiet" bits 6,7,15,16,17 are actually quiet
+    if (preamble[5] >= high ||
+        preamble[6] >= high ||
+        preamble[7] >= high ||
+        preamble[8] >= high ||
+        preamble[14] >= high ||
+        preamble[15] >= high ||
+        preamble[16] >= high ||
+        preamble[17] >= high ||
+        preamble[18] >= high) {
+        return false;
+    }
+
+    return true;
+}
+
+void STARCH_IMPL(preamble_u16, generic) (const uint16_t *in, unsigned len, uint32_t *out_bitmap)
+{
+    memset(out_bitmap, 0, (len + 31) / 32 * sizeof(uint32_t));
+
+    for (unsigned i = 0; i < len; ++i) {
+        if (preamble_u16_check(&in[i]))
+            out_bitmap[i / 32] |= 1U << (i % 32);
+    }
+}
+
+/*
+ * The vector versions test the edges and the peak patterns (comparisons
+ * only) for 16 (AVX2) or 8 (NEON) consecutive offsets at once. In real
+ * data only a few percent of offsets get that far; those are finished
+ * with the scalar check, so the result is exactly the generic one.
+ */
+
+#ifdef STARCH_FEATURE_AVX2
+
+#include <immintrin.h>
+
+void STARCH_IMPL_REQUIRES(preamble_u16, avx2, STARCH_FEATURE_AVX2) (const uint16_t *in, unsigned len, uint32_t *out_bitmap)
+{
+    // unsigned 16-bit compares, as signed compares with the top bit flipped
+    const __m256i flip = _mm256_set1_epi16((short) 0x8000);
+
+    memset(out_bitmap, 0, (len + 31) / 32 * sizeof(uint32_t));
+
+    unsigned i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m256i v[14];
+        for (unsigned k = 0; k < 14; ++k)
+            v[k] = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *) (in + i + k)), flip);
+
+#define GT(a, b) _mm256_cmpgt_epi16(v[a], v[b])
+#define AND(a, b) _mm256_and_si256((a), (b))
+#define OR(a, b) _mm256_or_si256((a), (b))
+
+        __m256i quick = AND(GT(1, 0), GT(12, 13));
+        if (_mm256_testz_si256(quick, quick))
+            continue;
+
+        // peak patterns for phases 3..7
+        __m256i m3 = AND(AND(AND(GT(1, 2), GT(3, 2)), AND(GT(3, 4), GT(9, 8))), AND(GT(9, 10), GT(11, 10)));
+        __m256i m4 = AND(AND(AND(GT(1, 2), GT(3, 2)), AND(GT(3, 4), GT(9, 8))), AND(GT(9, 10), GT(12, 11)));
+        __m256i m5 = AND(AND(AND(GT(1, 2), GT(3, 2)), AND(GT(4, 5), GT(9, 8))), AND(GT(10, 11), GT(12, 11)));
+        __m256i m6 = AND(AND(AND(GT(1, 2), GT(4, 3)), AND(GT(4, 5), GT(10, 9))), AND(GT(10, 11), GT(12, 11)));
+        __m256i m7 = AND(AND(AND(GT(2, 3), GT(4, 3)), AND(GT(4, 5), GT(10, 9))), AND(GT(10, 11), GT(12, 11)));
+
+        __m256i any = AND(quick, OR(OR(OR(m3, m4), OR(m5, m6)), m7));
+
+#undef GT
+#undef AND
+#undef OR
+
+        // two mask bits per 16-bit lane; keep the low one of each
+        uint32_t mask = (uint32_t) _mm256_movemask_epi8(any) & 0x55555555;
+        while (mask) {
+            unsigned lane = __builtin_ctz(mask) / 2;
+            mask &= mask - 1;
+            if (preamble_u16_check(&in[i + lane]))
+                out_bitmap[(i + lane) / 32] |= 1U << ((i + lane) % 32);
+        }
+    }
+
+    for (; i < len; ++i) {
+        if (preamble_u16_check(&in[i]))
+            out_bitmap[i / 32] |= 1U << (i % 32);
+    }
+}
+
+#endif /* STARCH_FEATURE_AVX2 */
+
+#ifdef STARCH_FEATURE_NEON
+
+#include <arm_neon.h>
+
+void STARCH_IMPL_REQUIRES(preamble_u16, neon, STARCH_FEATURE_NEON) (const uint16_t *in, unsigned len, uint32_t *out_bitmap)
+{
+    static const uint16_t lane_bits[8] = { 1, 2, 4, 8, 16, 32, 64, 128 };
+    const uint16x8_t lane_bits_x8 = vld1q_u16(lane_bits);
+
+    memset(out_bitmap, 0, (len + 31) / 32 * sizeof(uint32_t));
+
+    unsigned i = 0;
+    for (; i + 8 <= len; i += 8) {
+        uint16x8_t v[14];
+        for (unsigned k = 0; k < 14; ++k)
+            v[k] = vld1q_u16(in + i + k);
+
+#define GT(a, b) vcgtq_u16(v[a], v[b])
+#define AND(a, b) vandq_u16((a), (b))
+#define OR(a, b) vorrq_u16((a), (b))
+
+        uint16x8_t quick = AND(GT(1, 0), GT(12, 13));
+
+        // peak patterns for phases 3..7
+        uint16x8_t m3 = AND(AND(AND(GT(1, 2), GT(3, 2)), AND(GT(3, 4), GT(9, 8))), AND(GT(9, 10), GT(11, 10)));
+        uint16x8_t m4 = AND(AND(AND(GT(1, 2), GT(3, 2)), AND(GT(3, 4), GT(9, 8))), AND(GT(9, 10), GT(12, 11)));
+        uint16x8_t m5 = AND(AND(AND(GT(1, 2), GT(3, 2)), AND(GT(4, 5), GT(9, 8))), AND(GT(10, 11), GT(12, 11)));
+        uint16x8_t m6 = AND(AND(AND(GT(1, 2), GT(4, 3)), AND(GT(4, 5), GT(10, 9))), AND(GT(10, 11), GT(12, 11)));
+        uint16x8_t m7 = AND(AND(AND(GT(2, 3), GT(4, 3)), AND(GT(4, 5), GT(10, 9))), AND(GT(10, 11), GT(12, 11)));
+
+        uint16x8_t any = AND(quick, OR(OR(OR(m3, m4), OR(m5, m6)), m7));
+
+#undef GT
+#undef AND
+#undef OR
+
+        // one bit per lane: mask the lane bits, then add across lanes
+        uint16x8_t bits = vandq_u16(any, lane_bits_x8);
+        uint32x4_t sum4 = vpaddlq_u16(bits);
+        uint64x2_t sum2 = vpaddlq_u32(sum4);
+        unsigned mask = (unsigned) (vgetq_lane_u64(sum2, 0) + vgetq_lane_u64(sum2, 1));
+        while (mask) {
+            unsigned lane = __builtin_ctz(mask);
+            mask &= mask - 1;
+            if (preamble_u16_check(&in[i + lane]))
+                out_bitmap[(i + lane) / 32] |= 1U << ((i + lane) % 32);
+        }
+    }
+
+    for (; i < len; ++i) {
+        if (preamble_u16_check(&in[i]))
+            out_bitmap[i / 32] |= 1U << (i % 32);
+    }
+}
+
+#endif /* STARCH_FEATURE_NEON */
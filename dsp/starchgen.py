@@ -21,8 +21,12 @@ gen.add_function(name = 'magnitude_sc16', argtypes = ['const sc16_t *', 'uint16_
 gen.add_function(name = 'magnitude_sc16q11', argtypes = ['const sc16_t *', 'uint16_t *', 'unsigned'], aligned = True)
 gen.add_function(name = 'mean_power_u16', argtypes = ['const uint16_t *', 'unsigned', 'double *', 'double *'], aligned = True)
 gen.add_function(name = 'count_above_u16', argtypes = ['const uint16_t *', 'unsigned', 'uint16_t', 'unsigned *'], aligned = True)
+gen.add_function(name = 'find_byte_u8', argtypes = ['const uint8_t *', 'unsigned', 'uint8_t', 'unsigned *', 'unsigned *'])
+gen.add_function(name = 'modes_checksum_u8', argtypes = ['const uint8_t *', 'unsigned', 'uint32_t *'])
+gen.add_function(name = 'preamble_u16', argtypes = ['const uint16_t *', 'unsigned', 'uint32_t *'])
 
 gen.add_feature(name='neon', description='ARM NEON')
+gen.add_feature(name='avx2', description='x86 AVX2')
 
 gen.add_flavor(name = 'generic',
                description = 'Generic build, default compiler options',
@@ -40,9 +44,10 @@ gen.add_flavor(name = 'armv8_neon_simd',
                test_function = 'cpu_supports_armv8_simd',
                alignment = 32)
 gen.add_flavor(name = 'x86_avx2',
-               description = 'x86 with AVX2',
-               compile_flags = ['-mavx2', '-ffast-math'],
-               test_function = 'cpu_supports_avx2',
+               description = 'x86 with AVX2 and PCLMULQDQ',
+               compile_flags = ['-mavx2', '-mpclmul', '-ffast-math'],
+               features = ['avx2'],
+               test_function = 'cpu_supports_avx2_pclmul',
                alignment = 32)
 
 gen.add_mix(name = 'generic',
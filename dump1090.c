@@ -114,6 +114,7 @@ static void modesInitConfig(void) {
     Modes.freq                    = MODES_DEFAULT_FREQ;
     Modes.check_crc               = 1;
     Modes.fix_df                  = 1;
+    Modes.demod_threads           = 1;
     Modes.interactive_display_ttl = MODES_INTERACTIVE_DISPLAY_TTL;
     Modes.json_interval           = 1000;
     Modes.json_stats_interval     = 60000;
@@ -314,6 +315,10 @@ static void showDSP()
 
 #undef SHOW
 
+    printf("    %-40s %s\n", "find_byte_u8", starch_find_byte_u8_select()->name);
+    printf("    %-40s %s\n", "modes_checksum_u8", starch_modes_checksum_u8_select()->name);
+    printf("    %-40s %s\n", "preamble_u16", starch_preamble_u16_select()->name);
+
     printf("\n");
 }
 
@@ -350,6 +355,7 @@ static void showHelp(void)
 "                          (reduces CPU requirements)\n"
 "--no-crc-check           Disable messages with broken CRC (discouraged)\n"
 "--enable-df24            Enable decoding of DF24 Comm-D ELM messages\n"
+"--demod-threads <n>      Number of threads used to demodulate (default: 1)\n"
 "--lat <latitude>         Reference/receiver latitude for surface positions\n"
 "--lon <longitude>        Reference/receiver longitude for surface positions\n"
 "--max-range <distance>   Absolute maximum range for position decoding (in NM)\n"
@@ -626,6 +632,10 @@ int main(int argc, char **argv) {
             Modes.nfix_crc = 0;
         } else if (!strcmp(argv[j],"--no-fix-df")) {
             Modes.fix_df = 0;
+        } else if (!strcmp(argv[j],"--demod-threads") && more) {
+            Modes.demod_threads = atoi(argv[++j]);
+            if (Modes.demod_threads < 1)
+                Modes.demod_threads = 1;
         } else if (!strcmp(argv[j],"--no-crc-check")) {
             Modes.check_crc = 0;
         } else if (!strcmp(argv[j],"--phase-enhance")) {
@@ -845,6 +855,7 @@ int main(int argc, char **argv) {
         Modes.stats_1min[j].start = Modes.stats_1min[j].end = Modes.stats_current.start;
 
     adaptive_init();
+    demodulate2400Init(Modes.demod_threads);
 
     // write initial json files so they're not missing
     writeJsonToFile("receiver.json", generateReceiverJson);
@@ -931,6 +942,7 @@ int main(int argc, char **argv) {
 
     sdrClose();
     fifo_destroy();
+    demodulate2400Shutdown();
 
     if (Modes.exit == 1) {
         log_with_timestamp("Normal exit.");
@@ -348,6 +348,7 @@ struct _Modes {                             // Internal state
     int   check_crc;                 // Only display messages with good CRC
     int   fix_df;                    // Try to correct damage to the DF field, as well as the main message body
     int   enable_df24;               // Enable decoding of DF24..DF31 (Comm-D ELM)
+    int   demod_threads;             // Number of threads used by the demodulator
     int   raw;                       // Raw output format
     int   mode_ac;                   // Enable decoding of SSR Modes A & C
     int   mode_ac_auto;              // allow toggling of A/C by Beast commands
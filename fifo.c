@@ -24,21 +24,178 @@
 #include <stdio.h>
 #include <errno.h>
 #include <string.h>
+#include <limits.h>
 #include <pthread.h>
+#include <stdatomic.h>
 #include <assert.h>
+#include <time.h>
 
-static pthread_mutex_t fifo_mutex = PTHREAD_MUTEX_INITIALIZER;        // mutex protecting the queues
-static pthread_cond_t fifo_notempty_cond = PTHREAD_COND_INITIALIZER;  // condition used to signal FIFO-not-empty
-static pthread_cond_t fifo_empty_cond = PTHREAD_COND_INITIALIZER;     // condition used to signal FIFO-empty
-static pthread_cond_t fifo_free_cond = PTHREAD_COND_INITIALIZER;      // condition used to signal freelist-not-empty
-static struct mag_buf *fifo_head;          // head of queued buffers awaiting demodulation
-static struct mag_buf *fifo_tail;          // tail of queued buffers awaiting demodulation
-static struct mag_buf *fifo_freelist;      // freelist of preallocated buffers
-static bool fifo_halted;                   // true if queue has been halted
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+//
+// There is one producer thread (the SDR reader, which calls fifo_acquire,
+// fifo_enqueue and fifo_drain) and one consumer thread (the demodulator,
+// which calls fifo_dequeue and fifo_release). Buffers move between them
+// through two single-producer/single-consumer rings: "queue" carries
+// filled buffers from the reader to the demodulator, and "freelist"
+// carries them back. Neither side takes a lock; a thread only sleeps
+// (on a futex, where available) when the ring it needs is empty, and the
+// other side only makes a system call to wake it if someone is asleep.
+//
+
+struct fifo_ring {
+    _Atomic unsigned head;          // next slot to write, written only by the ring's producer
+    _Atomic unsigned tail;          // next slot to read, written only by the ring's consumer
+    _Atomic uint32_t seq;           // bumped on every change, futex word for waiters
+    _Atomic unsigned waiters;       // number of threads waiting on seq
+    unsigned mask;                  // ring size - 1; the size is a power of two
+    struct mag_buf **slots;
+};
+
+static struct fifo_ring fifo_queue;        // buffers awaiting demodulation
+static struct fifo_ring fifo_freelist;     // buffers available to the reader
+static atomic_bool fifo_halted;            // true if queue has been halted
+
+static struct mag_buf **fifo_buffers;      // every buffer allocated, for fifo_destroy
+static unsigned fifo_buffer_count;
 
 static unsigned overlap_length;     // desired overlap size in samples (size of overlap_buffer)
 static uint16_t *overlap_buffer;    // buffer used to save overlapping data
 
+//
+// Sleeping and waking
+//
+
+#ifdef __linux__
+
+static void futex_wait(_Atomic uint32_t *addr, uint32_t expected, const struct timespec *timeout)
+{
+    syscall(SYS_futex, (uint32_t *) addr, FUTEX_WAIT_PRIVATE, expected, timeout, NULL, 0);
+}
+
+static void futex_wake(_Atomic uint32_t *addr)
+{
+    syscall(SYS_futex, (uint32_t *) addr, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+}
+
+#else
+
+// No futexes: fall back to a condition variable, only used on the slow path
+static pthread_mutex_t futex_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t futex_cond = PTHREAD_COND_INITIALIZER;
+
+static void futex_wait(_Atomic uint32_t *addr, uint32_t expected, const struct timespec *timeout)
+{
+    struct timespec deadline;
+    if (timeout) {
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_sec += timeout->tv_sec;
+        deadline.tv_nsec += timeout->tv_nsec;
+        normalize_timespec(&deadline);
+    }
+
+    pthread_mutex_lock(&futex_mutex);
+    if (atomic_load(addr) == expected) {
+        if (timeout)
+            pthread_cond_timedwait(&futex_cond, &futex_mutex, &deadline);
+        else
+            pthread_cond_wait(&futex_cond, &futex_mutex);
+    }
+    pthread_mutex_unlock(&futex_mutex);
+}
+
+static void futex_wake(_Atomic uint32_t *addr)
+{
+    MODES_NOTUSED(addr);
+    pthread_mutex_lock(&futex_mutex);
+    pthread_cond_broadcast(&futex_cond);
+    pthread_mutex_unlock(&futex_mutex);
+}
+
+#endif
+
+// Tell any waiters that ring (or the halted flag) changed
+static void ring_notify(struct fifo_ring *ring)
+{
+    atomic_fetch_add(&ring->seq, 1);
+    if (atomic_load(&ring->waiters))
+        futex_wake(&ring->seq);
+}
+
+// Wait until ring is non-empty (want_empty = false) or empty (want_empty = true),
+// the FIFO is halted, or timeout_ms passes (0 = wait forever). Returns true
+// if the condition holds.
+static bool ring_wait(struct fifo_ring *ring, bool want_empty, uint32_t timeout_ms)
+{
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec += timeout_ms / 1000;
+    deadline.tv_nsec += (timeout_ms % 1000) * 1000000;
+    normalize_timespec(&deadline);
+
+    for (;;) {
+        uint32_t seq = atomic_load(&ring->seq);
+        bool empty = (atomic_load(&ring->head) == atomic_load(&ring->tail));
+        if (atomic_load(&fifo_halted) || empty == want_empty)
+            return !atomic_load(&fifo_halted);
+
+        struct timespec now, remaining;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        remaining.tv_sec = deadline.tv_sec - now.tv_sec;
+        remaining.tv_nsec = deadline.tv_nsec - now.tv_nsec;
+        normalize_timespec(&remaining);
+        if (timeout_ms && remaining.tv_sec < 0)
+            return false;
+
+        // The waiter count is raised before the condition is re-checked
+        // (via seq) so a notifier either sees it or we see its change
+        atomic_fetch_add(&ring->waiters, 1);
+        futex_wait(&ring->seq, seq, timeout_ms ? &remaining : NULL);
+        atomic_fetch_sub(&ring->waiters, 1);
+    }
+}
+
+static void ring_push(struct fifo_ring *ring, struct mag_buf *buf)
+{
+    unsigned head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    assert(head - atomic_load_explicit(&ring->tail, memory_order_acquire) <= ring->mask);
+
+    ring->slots[head & ring->mask] = buf;
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+    ring_notify(ring);
+}
+
+static struct mag_buf *ring_pop(struct fifo_ring *ring)
+{
+    unsigned tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    if (tail == atomic_load_explicit(&ring->head, memory_order_acquire))
+        return NULL;
+
+    struct mag_buf *buf = ring->slots[tail & ring->mask];
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+    ring_notify(ring);
+    return buf;
+}
+
+static bool ring_init(struct fifo_ring *ring, unsigned capacity)
+{
+    unsigned size = 1;
+    while (size < capacity)
+        size <<= 1;
+
+    if (!(ring->slots = calloc(size, sizeof(ring->slots[0]))))
+        return false;
+
+    ring->mask = size - 1;
+    atomic_store(&ring->head, 0);
+    atomic_store(&ring->tail, 0);
+    return true;
+}
+
 // Create the queue structures. Not threadsafe.
 bool fifo_create(unsigned buffer_count, unsigned buffer_size, unsigned overlap)
 {
@@ -47,6 +204,12 @@ bool fifo_create(unsigned buffer_count, unsigned buffer_size, unsigned overlap)
 
     overlap_length = overlap;
 
+    if (!ring_init(&fifo_queue, buffer_count) || !ring_init(&fifo_freelist, buffer_count))
+        goto nomem;
+
+    if (!(fifo_buffers = calloc(buffer_count, sizeof(fifo_buffers[0]))))
+        goto nomem;
+
     for (unsigned i = 0; i < buffer_count; ++i) {
         struct mag_buf *newbuf;
         if (!(newbuf = calloc(1, sizeof(*newbuf)))) {
@@ -59,10 +222,11 @@ bool fifo_create(unsigned buffer_count, unsigned buffer_size, unsigned overlap)
         }
 
         newbuf->totalLength = buffer_size;
-        newbuf->next = fifo_freelist;
-        fifo_freelist = newbuf;
+        fifo_buffers[fifo_buffer_count++] = newbuf;
+        ring_push(&fifo_freelist, newbuf);
     }
 
+    atomic_store(&fifo_halted, false);
     return true;
 
  nomem:
@@ -70,23 +234,20 @@ bool fifo_create(unsigned buffer_count, unsigned buffer_size, unsigned overlap)
     return false;
 }
 
-static void free_buffer_list(struct mag_buf *head)
-{
-    while (head) {
-        struct mag_buf *next = head->next;
-        free(head->data);
-        free(head);
-        head = next;
-    }
-}
-
 void fifo_destroy()
 {
-    free_buffer_list(fifo_head);
-    fifo_head = fifo_tail = NULL;
+    for (unsigned i = 0; i < fifo_buffer_count; ++i) {
+        free(fifo_buffers[i]->data);
+        free(fifo_buffers[i]);
+    }
+    free(fifo_buffers);
+    fifo_buffers = NULL;
+    fifo_buffer_count = 0;
 
-    free_buffer_list(fifo_freelist);
-    fifo_freelist = NULL;
+    free(fifo_queue.slots);
+    fifo_queue.slots = NULL;
+    free(fifo_freelist.slots);
+    fifo_freelist.slots = NULL;
 
     free(overlap_buffer);
     overlap_buffer = NULL;
@@ -94,66 +255,28 @@ void fifo_destroy()
 
 void fifo_drain()
 {
-    pthread_mutex_lock(&fifo_mutex);
-    while (fifo_head && !fifo_halted) {
-        pthread_cond_wait(&fifo_empty_cond, &fifo_mutex);
-    }
-    pthread_mutex_unlock(&fifo_mutex);
+    ring_wait(&fifo_queue, true, 0 /* no timeout */);
 }
 
 void fifo_halt()
 {
-    pthread_mutex_lock(&fifo_mutex);
-
-    // Drain all enqueued buffers to the freelist
-    while (fifo_head) {
-        struct mag_buf *freebuf = fifo_head;
-        fifo_head = freebuf->next;
-
-        freebuf->next = fifo_freelist;
-        fifo_freelist = freebuf;
-    }
-
-    fifo_tail = NULL;
-    fifo_halted = true;
+    atomic_store(&fifo_halted, true);
 
     // wake all waiters
-    pthread_cond_broadcast(&fifo_notempty_cond);
-    pthread_cond_broadcast(&fifo_empty_cond);
-    pthread_cond_broadcast(&fifo_free_cond);
-    pthread_mutex_unlock(&fifo_mutex);
+    ring_notify(&fifo_queue);
+    ring_notify(&fifo_freelist);
 }
 
 struct mag_buf *fifo_acquire(uint32_t timeout_ms)
 {
-    struct timespec deadline;
-    if (timeout_ms)
-        get_deadline(timeout_ms, &deadline);
+    if (atomic_load(&fifo_halted))
+        return NULL;
 
-    pthread_mutex_lock(&fifo_mutex);
-
-    struct mag_buf *result = NULL;
-    while (!fifo_halted && !fifo_freelist) {
-        if (!timeout_ms) {
-            // Non-blocking
-            goto done;
-        }
-
-        // No free buffers, wait for one
-        int err = pthread_cond_timedwait(&fifo_free_cond, &fifo_mutex, &deadline);
-        if (err) {
-            if (err != ETIMEDOUT) {
-                fprintf(stderr, "fifo_acquire: pthread_cond_timedwait unexpectedly returned %s\n", strerror(err));
-            }
-
-            goto done; // done waiting
-        }
-    }
-
-    if (!fifo_halted) {
-        result = fifo_freelist;
-        fifo_freelist = result->next;
+    struct mag_buf *result = ring_pop(&fifo_freelist);
+    if (!result && timeout_ms && ring_wait(&fifo_freelist, false, timeout_ms))
+        result = ring_pop(&fifo_freelist);
 
+    if (result) {
         result->overlap = overlap_length;
         result->validLength = result->overlap;
         result->sampleTimestamp = 0;
@@ -162,8 +285,6 @@ struct mag_buf *fifo_acquire(uint32_t timeout_ms)
         result->next = NULL;
     }
 
- done:
-    pthread_mutex_unlock(&fifo_mutex);
     return result;
 }
 
@@ -172,13 +293,10 @@ void fifo_enqueue(struct mag_buf *buf)
     assert(buf->validLength <= buf->totalLength);
     assert(buf->validLength >= overlap_length);
 
-    pthread_mutex_lock(&fifo_mutex);
-
-    if (fifo_halted) {
-        // Shutting down, just return the buffer to the freelist.
-        buf->next = fifo_freelist;
-        fifo_freelist = buf;
-        goto done;
+    if (atomic_load(&fifo_halted)) {
+        // Shutting down, nothing will read this buffer again;
+        // fifo_destroy frees it
+        return;
     }
 
     // Populate the overlap region
@@ -194,65 +312,22 @@ void fifo_enqueue(struct mag_buf *buf)
 
     // enqueue and tell the main thread
     buf->next = NULL;
-    if (!fifo_head) {
-        fifo_head = fifo_tail = buf;
-        pthread_cond_signal(&fifo_notempty_cond);
-    } else {
-        fifo_tail->next = buf;
-        fifo_tail = buf;
-    }
-
- done:
-    pthread_mutex_unlock(&fifo_mutex);
+    ring_push(&fifo_queue, buf);
 }
 
 struct mag_buf *fifo_dequeue(uint32_t timeout_ms)
 {
-    struct timespec deadline;
-    if (timeout_ms)
-        get_deadline(timeout_ms, &deadline);
+    if (atomic_load(&fifo_halted))
+        return NULL;
 
-    pthread_mutex_lock(&fifo_mutex);
-
-    struct mag_buf *result = NULL;
-    while (!fifo_head && !fifo_halted) {
-        if (!timeout_ms) {
-            // Non-blocking
-            goto done;
-        }
-
-        // No data pending, wait for some
-        int err = pthread_cond_timedwait(&fifo_notempty_cond, &fifo_mutex, &deadline);
-        if (err) {
-            if (err != ETIMEDOUT) {
-                fprintf(stderr, "fifo_dequeue: pthread_cond_timedwait unexpectedly returned %s\n", strerror(err));
-            }
-
-            goto done; // done waiting
-        }
-    }
-
-    if (!fifo_halted) {
-        result = fifo_head;
-        fifo_head = result->next;
-        result->next = NULL;
-        if (!fifo_head) {
-            fifo_tail = NULL;
-            pthread_cond_broadcast(&fifo_empty_cond);
-        }
-    }
+    struct mag_buf *result = ring_pop(&fifo_queue);
+    if (!result && timeout_ms && ring_wait(&fifo_queue, false, timeout_ms))
+        result = ring_pop(&fifo_queue);
 
- done:
-    pthread_mutex_unlock(&fifo_mutex);
     return result;
 }
 
 void fifo_release(struct mag_buf *buf)
 {
-    pthread_mutex_lock(&fifo_mutex);
-    if (!fifo_freelist)
-        pthread_cond_signal(&fifo_free_cond);
-    buf->next = fifo_freelist;
-    fifo_freelist = buf;
-    pthread_mutex_unlock(&fifo_mutex);
+    ring_push(&fifo_freelist, buf);
 }
@@ -69,6 +69,10 @@ struct mag_buf {
     struct mag_buf *next;            // linked list forward link
 };
 
+// The FIFO is lock-free with one producer thread, which calls fifo_acquire(),
+// fifo_enqueue() and fifo_drain(), and one consumer thread, which calls
+// fifo_dequeue() and fifo_release().
+
 // Create the queue structures. Not threadsafe. Returns true on success.
 //
 //   buffer_count - the number of buffers to preallocate
@@ -83,11 +87,12 @@ void fifo_destroy();
 // Block until the FIFO is empty.
 void fifo_drain();
 
-// Mark the FIFO as halted. Move any buffers in FIFO to the freelist immediately.
-// Future calls to magbuf_acquire() will immediately return NULL.
-// Future calls to magbuf_produce() will immediately put the produced buffer on the freelist.
-// Future alls to magbuf_consume() will immediately return NULL; if there are
+// Mark the FIFO as halted. Buffers still in the FIFO are abandoned (fifo_destroy frees them).
+// Future calls to fifo_acquire() will immediately return NULL.
+// Future calls to fifo_enqueue() will immediately abandon the produced buffer.
+// Future calls to fifo_dequeue() will immediately return NULL; if there are
 //   existing calls waiting on data, they will be immediately awoken and return NULL.
+// May be called from any thread.
 void fifo_halt();
 
 // Get an unused buffer from the freelist and return it.
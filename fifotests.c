@@ -0,0 +1,215 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// fifotests.c - stress tests for the SDR to demodulator FIFO
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// A producer thread pushes a numbered sample stream through a small FIFO,
+// with random buffer lengths, discontinuities and pauses on both sides so
+// that the reader and the demodulator both end up waiting on each other.
+// The consumer checks that every buffer arrives once, in order, with the
+// right samples and the right overlap region. Then fifo_halt() must wake
+// a blocked fifo_dequeue().
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "fifo.h"
+
+#define BUFFERS 4
+#define MAX_SAMPLES 64
+#define OVERLAP 16
+#define ROUNDS 200000
+
+static atomic_bool producer_done;
+
+static void maybe_pause(unsigned *seed)
+{
+    unsigned r = rand_r(seed) % 1000;
+    if (r == 0) {
+        struct timespec ts = { 0, 200000 };
+        nanosleep(&ts, NULL);
+    } else if (r < 20) {
+        sched_yield();
+    }
+}
+
+static void *producerEntryPoint(void *arg)
+{
+    (void) arg;
+    unsigned seed = 1;
+    uint64_t counter = 0;
+
+    for (unsigned n = 0; n < ROUNDS; ++n) {
+        struct mag_buf *buf;
+        while (!(buf = fifo_acquire(100 /* milliseconds */)))
+            ;
+
+        if (rand_r(&seed) % 20 == 0) {
+            buf->flags = MAGBUF_DISCONTINUOUS;
+            buf->dropped = 1000;
+            counter += 1000;
+        }
+
+        unsigned samples = 1 + rand_r(&seed) % MAX_SAMPLES;
+        buf->sampleTimestamp = counter;
+        buf->validLength = buf->overlap + samples;
+        for (unsigned i = 0; i < samples; ++i)
+            buf->data[buf->overlap + i] = (uint16_t) (counter + i);
+        counter += samples;
+
+        fifo_enqueue(buf);
+        maybe_pause(&seed);
+    }
+
+    fifo_drain();
+    atomic_store(&producer_done, true);
+    return NULL;
+}
+
+static bool testStream(void)
+{
+    unsigned seed = 2;
+    uint16_t previous_tail[OVERLAP];
+    uint64_t expected = 0;
+    unsigned received = 0;
+    unsigned errors = 0;
+
+    // the first overlap region is zeros
+    memset(previous_tail, 0, sizeof(previous_tail));
+
+    if (!fifo_create(BUFFERS, MAX_SAMPLES + OVERLAP, OVERLAP)) {
+        fprintf(stderr, "stream:  FAIL: fifo_create failed\n");
+        return false;
+    }
+
+    pthread_t producer;
+    pthread_create(&producer, NULL, producerEntryPoint, NULL);
+
+    for (;;) {
+        struct mag_buf *buf = fifo_dequeue(100 /* milliseconds */);
+        if (!buf) {
+            if (atomic_load(&producer_done))
+                break;
+            continue;
+        }
+
+        if (buf->flags & MAGBUF_DISCONTINUOUS)
+            expected += 1000;
+
+        if (buf->sampleTimestamp != expected && errors++ < 10)
+            fprintf(stderr, "stream:  FAIL: buffer %u has timestamp %llu, expected %llu\n",
+                    received, (unsigned long long) buf->sampleTimestamp, (unsigned long long) expected);
+
+        // the overlap is the end of the previous buffer, or zeros after a gap
+        for (unsigned i = 0; i < OVERLAP; ++i) {
+            uint16_t want = (buf->flags & MAGBUF_DISCONTINUOUS) ? 0 : previous_tail[i];
+            if (buf->data[i] != want && errors++ < 10)
+                fprintf(stderr, "stream:  FAIL: buffer %u overlap sample %u is %u, expected %u\n", received, i, buf->data[i], want);
+        }
+
+        for (unsigned i = buf->overlap; i < buf->validLength; ++i) {
+            uint16_t want = (uint16_t) (expected + i - buf->overlap);
+            if (buf->data[i] != want && errors++ < 10)
+                fprintf(stderr, "stream:  FAIL: buffer %u sample %u is %u, expected %u\n", received, i, buf->data[i], want);
+        }
+
+        expected += buf->validLength - buf->overlap;
+        memcpy(previous_tail, &buf->data[buf->validLength - OVERLAP], sizeof(previous_tail));
+        ++received;
+
+        fifo_release(buf);
+        maybe_pause(&seed);
+    }
+
+    pthread_join(producer, NULL);
+    fifo_destroy();
+
+    if (received != ROUNDS) {
+        fprintf(stderr, "stream:  FAIL: received %u buffers, expected %u\n", received, ROUNDS);
+        ++errors;
+    }
+
+    if (errors)
+        return false;
+
+    fprintf(stderr, "stream:  PASS (%u buffers)\n", received);
+    return true;
+}
+
+static void *blockedConsumerEntryPoint(void *arg)
+{
+    struct mag_buf **result = arg;
+    *result = fifo_dequeue(5000 /* milliseconds */);
+    return NULL;
+}
+
+static bool testHalt(void)
+{
+    bool ok = true;
+
+    if (!fifo_create(BUFFERS, MAX_SAMPLES + OVERLAP, OVERLAP)) {
+        fprintf(stderr, "halt:  FAIL: fifo_create failed\n");
+        return false;
+    }
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    struct mag_buf *result = (struct mag_buf *) &result; // anything but NULL
+    pthread_t consumer;
+    pthread_create(&consumer, NULL, blockedConsumerEntryPoint, &result);
+
+    struct timespec ts = { 0, 50000000 };
+    nanosleep(&ts, NULL);
+    fifo_halt();
+    pthread_join(consumer, NULL);
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double elapsed = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+    if (result != NULL) {
+        fprintf(stderr, "halt:  FAIL: fifo_dequeue returned a buffer after halt\n");
+        ok = false;
+    }
+    if (elapsed > 1.0) {
+        fprintf(stderr, "halt:  FAIL: fifo_dequeue took %.3f seconds to wake up after halt\n", elapsed);
+        ok = false;
+    }
+    if (fifo_acquire(10) != NULL) {
+        fprintf(stderr, "halt:  FAIL: fifo_acquire returned a buffer after halt\n");
+        ok = false;
+    }
+
+    fifo_destroy();
+
+    if (ok)
+        fprintf(stderr, "halt:  PASS\n");
+    return ok;
+}
+
+int main(int __attribute__ ((unused)) argc, char __attribute__ ((unused)) **argv)
+{
+    int ok = 1;
+
+    ok = testStream() && ok;
+    ok = testHalt() && ok;
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,532 @@
+/*
+ * Copyright (c) 2020 - AirNav Systems
+ *
+ * https://www.radarbox.com
+ *
+ * More info: https://github.com/AirNav-Systems/rbfeeder
+ *
+ */
+
+// flightenctests.c - test for the FlightPacket encoder (airnav_flightenc.c)
+//
+// Flights with every field rbfeeder sends set (position, speeds, nav,
+// weather, quality, altitude_geo, ias and the mlat / 978 flags), with only
+// the address, and with every value at the limit of its p_data type are
+// encoded and compared byte for byte with what protoc produces for the
+// same FlightPacket. The output is also walked as protobuf wire format
+// and every field is checked against p_data and the field numbers and
+// types in rbfeeder.proto, and, when built with protobuf-c
+// (HAVE_PROTOBUF_C), unpacked with rbfeeder.pb-c and compared field by
+// field too.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "airnav_flightenc.h"
+#ifdef HAVE_PROTOBUF_C
+#include "rbfeeder.pb-c.h"
+#endif
+
+static int failures = 0;
+
+#define CHECK(cond, ...) do {                             \
+        if (!(cond)) {                                   \
+            fprintf(stderr, "FAIL: " __VA_ARGS__);       \
+            fprintf(stderr, "\n");                       \
+            ++failures;                                  \
+        }                                                \
+    } while (0)
+
+// Golden packets, one flight each, from
+//
+//   protoc --encode=FlightPacket rbfeeder.proto < flight.txt
+//
+// with the text format FlightPacket given above each of them.
+
+// fdata { addr: 5024470 callsign: "DLH400AB" altitude: 37025
+//   latitude: 51.4775 longitude: -0.461389 heading: 274 gnd_speed: 452
+//   ias: 280 vert_rate: -1984 squawk: 4660 airborne: true is_mlat: true
+//   is_978: true nav_altitude_fms: 37000 nav_altitude_mcp: 36992
+//   nav_qnh: 10132 wind_dir: 285 wind_speed: 64 temperature: -56
+//   pos_nic: 8 nic_baro: true nac_p: 10 nac_v: 2 sil: 3
+//   sil_type: SIL_PER_SAMPLE altitude_geo: 37650 }
+static const uint8_t golden_all[] = {
+    0x0a, 0x69, 0x08, 0xd6, 0xd5, 0xb2, 0x02, 0x1a, 0x08, 0x44, 0x4c, 0x48,
+    0x34, 0x30, 0x30, 0x41, 0x42, 0x20, 0xa1, 0xa1, 0x02, 0x31, 0x85, 0xeb,
+    0x51, 0xb8, 0x1e, 0xbd, 0x49, 0x40, 0x39, 0x37, 0xfc, 0x6e, 0xba, 0x65,
+    0x87, 0xdd, 0xbf, 0x40, 0x92, 0x02, 0x48, 0xc4, 0x03, 0x50, 0x98, 0x02,
+    0x58, 0xff, 0x1e, 0x60, 0xb4, 0x24, 0x68, 0x01, 0x70, 0x01, 0x78, 0x01,
+    0x80, 0x01, 0x88, 0xa1, 0x02, 0x88, 0x01, 0x80, 0xa1, 0x02, 0x90, 0x01,
+    0x94, 0x4f, 0xd8, 0x01, 0x9d, 0x02, 0xe0, 0x01, 0x40, 0xe8, 0x01, 0x6f,
+    0x98, 0x02, 0x08, 0xa0, 0x02, 0x01, 0xa8, 0x02, 0x0a, 0xb0, 0x02, 0x02,
+    0xb8, 0x02, 0x03, 0xc0, 0x02, 0x02, 0xc8, 0x02, 0x92, 0xa6, 0x02
+};
+
+// fdata { addr: 0 }
+static const uint8_t golden_addr_only[] = {
+    0x0a, 0x02, 0x08, 0x00
+};
+
+// fdata { addr: 33554431 callsign: "ZZZZZZZZ" altitude: -2147483648
+//   latitude: -90 longitude: 180 heading: -32768 gnd_speed: 32767
+//   ias: -32768 vert_rate: -32768 squawk: -1 airborne: false
+//   is_mlat: true is_978: true nav_altitude_fms: -1
+//   nav_altitude_mcp: -2147483648 nav_qnh: 2147483647 wind_dir: -32768
+//   wind_speed: 32767 temperature: -32768 pos_nic: 255 nic_baro: false
+//   nac_p: 255 nac_v: 255 sil: 255 sil_type: SIL_PER_HOUR
+//   altitude_geo: -2147483648 }
+//
+// The body is over 127 bytes, so its length takes two bytes.
+static const uint8_t golden_limits[] = {
+    0x0a, 0xb2, 0x01, 0x08, 0xff, 0xff, 0xff, 0x0f, 0x1a, 0x08, 0x5a, 0x5a,
+    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x20, 0x80, 0x80, 0x80, 0x80, 0xf8,
+    0xff, 0xff, 0xff, 0xff, 0x01, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x56, 0xc0, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x66, 0x40, 0x40,
+    0x80, 0x80, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x48, 0xff,
+    0xff, 0x01, 0x50, 0x80, 0x80, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x01, 0x58, 0xff, 0xff, 0x03, 0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x01, 0x68, 0x00, 0x70, 0x01, 0x78, 0x01, 0x80, 0x01,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x88, 0x01,
+    0x80, 0x80, 0x80, 0x80, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x90, 0x01,
+    0xff, 0xff, 0xff, 0xff, 0x07, 0xd8, 0x01, 0x80, 0x80, 0xfe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x01, 0xe0, 0x01, 0xff, 0xff, 0x01, 0xe8, 0x01,
+    0xff, 0xff, 0x03, 0x98, 0x02, 0xff, 0x01, 0xa0, 0x02, 0x00, 0xa8, 0x02,
+    0xff, 0x01, 0xb0, 0x02, 0xff, 0x01, 0xb8, 0x02, 0xff, 0x01, 0xc0, 0x02,
+    0x03, 0xc8, 0x02, 0x80, 0x80, 0x80, 0x80, 0xf8, 0xff, 0xff, 0xff, 0xff,
+    0x01
+};
+
+// The values the golden packets were made from
+
+static void make_all(struct p_data *p) {
+    memset(p, 0, sizeof (*p));
+    p->modes_addr = 0x4CAAD6;
+    strcpy(p->callsign, "DLH400AB");
+    p->altitude = 37025;
+    p->lat = 51.4775;
+    p->lon = -0.461389;
+    p->heading = 274;
+    p->gnd_speed = 452;
+    p->ias = 280;
+    p->vert_rate = -1984;
+    p->squawk = 0x1234;
+    p->airborne = 1;
+    p->nav_altitude_fms = 37000;
+    p->nav_altitude_mcp = 36992;
+    p->nav_qnh = 10132;
+    p->wind_dir = 285;
+    p->wind_speed = 64;
+    p->temperature = -56;
+    p->pos_nic = 8;
+    p->nic_baro = 1;
+    p->nac_p = 10;
+    p->nac_v = 2;
+    p->sil = 3;
+    p->sil_type = 2;
+    p->altitude_geo = 37650;
+
+    // Kept in p_data but never sent, as before the encoder: they must
+    // not turn up in the packet
+    p->nav_heading = 270;
+    p->nav_altitude_src = 2;
+    p->nav_modes = 0x3F;
+    p->extra_flags = 1;
+
+    p->fields = ~0U;
+}
+
+static void make_addr_only(struct p_data *p) {
+    // Everything else holds values, but only the address is flagged
+    make_all(p);
+    p->modes_addr = 0;
+    p->fields = PDATA_MODES_ADDR;
+}
+
+static void make_limits(struct p_data *p) {
+    memset(p, 0, sizeof (*p));
+    p->modes_addr = 0x1FFFFFF;
+    strcpy(p->callsign, "ZZZZZZZZ");
+    p->altitude = INT32_MIN;
+    p->lat = -90.0;
+    p->lon = 180.0;
+    p->heading = INT16_MIN;
+    p->gnd_speed = INT16_MAX;
+    p->ias = INT16_MIN;
+    p->vert_rate = INT16_MIN;
+    p->squawk = -1;
+    p->airborne = 0;
+    p->nav_altitude_fms = UINT32_MAX;
+    p->nav_altitude_mcp = 0x80000000U;
+    p->nav_qnh = INT32_MAX;
+    p->wind_dir = INT16_MIN;
+    p->wind_speed = INT16_MAX;
+    p->temperature = INT16_MIN;
+    p->pos_nic = UINT8_MAX;
+    p->nic_baro = 0;
+    p->nac_p = UINT8_MAX;
+    p->nac_v = UINT8_MAX;
+    p->sil = UINT8_MAX;
+    p->sil_type = 3;
+    p->altitude_geo = INT32_MIN;
+    p->fields = ~0U;
+}
+
+//
+// A minimal protobuf reader, independent of the encoder
+//
+
+#define MAX_FIELD 41
+
+enum kind {
+    K_NONE = 0, // not in FlightData, or reserved
+    K_INT32,
+    K_SINT32,
+    K_UINT32,
+    K_BOOL,
+    K_ENUM,
+    K_DOUBLE,
+    K_STRING
+};
+
+// FlightData in rbfeeder.proto
+static const enum kind flightdata_kind[MAX_FIELD + 1] = {
+    [1] = K_INT32, // addr
+    [2] = K_ENUM, // addr_type
+    [3] = K_STRING, // callsign
+    [4] = K_INT32, // altitude
+    [5] = K_INT32, // altitude_source
+    [6] = K_DOUBLE, // latitude
+    [7] = K_DOUBLE, // longitude
+    [8] = K_INT32, // heading
+    [9] = K_INT32, // gnd_speed
+    [10] = K_INT32, // ias
+    [11] = K_SINT32, // vert_rate
+    [12] = K_INT32, // squawk
+    [13] = K_BOOL, // airborne
+    [14] = K_BOOL, // is_mlat
+    [15] = K_BOOL, // is_978
+    [16] = K_INT32, // nav_altitude_fms
+    [17] = K_INT32, // nav_altitude_mcp
+    [18] = K_INT32, // nav_qnh
+    [19] = K_INT32, // nav_heading
+    [20] = K_INT32, // nav_altitude_src
+    [21] = K_BOOL, // nav_modes_autopilot
+    [22] = K_BOOL, // nav_modes_vnav
+    [23] = K_BOOL, // nav_modes_alt_hold
+    [24] = K_BOOL, // nav_modes_approach
+    [25] = K_BOOL, // nav_modes_lnav
+    [26] = K_BOOL, // nav_modes_tcas
+    [27] = K_INT32, // wind_dir
+    [28] = K_INT32, // wind_speed
+    [29] = K_SINT32, // temperature
+    [35] = K_UINT32, // pos_nic
+    [36] = K_BOOL, // nic_baro
+    [37] = K_UINT32, // nac_p
+    [38] = K_UINT32, // nac_v
+    [39] = K_UINT32, // sil
+    [40] = K_ENUM, // sil_type
+    [41] = K_INT32, // altitude_geo
+};
+
+struct decoded {
+    uint64_t seen; // bit n set: field n present
+    int64_t value[MAX_FIELD + 1]; // doubles as their bit pattern
+    char callsign[16];
+    int bad;
+};
+
+static int get_varint(const uint8_t **p, const uint8_t *end, uint64_t *v) {
+    *v = 0;
+    for (unsigned shift = 0; shift < 70 && *p < end; shift += 7) {
+        uint8_t b = *(*p)++;
+        *v |= (uint64_t) (b & 0x7F) << shift;
+        if (!(b & 0x80))
+            return 1;
+    }
+    return 0;
+}
+
+// Decode one FlightData body. Fields must be known, of the right wire
+// type, present once, and in field number order (as protobuf-c packs
+// them); int32 values must be sign extended varints as protobuf requires.
+static void decode_flight(const char *name, const uint8_t *p, const uint8_t *end, struct decoded *d) {
+    unsigned last = 0;
+
+    memset(d, 0, sizeof (*d));
+    while (p < end) {
+        uint64_t key, v = 0;
+        if (!get_varint(&p, end, &key)) {
+            CHECK(0, "%s: truncated key", name);
+            d->bad = 1;
+            return;
+        }
+
+        unsigned field = (unsigned) (key >> 3);
+        unsigned wt = (unsigned) (key & 7);
+        enum kind k = field <= MAX_FIELD ? flightdata_kind[field] : K_NONE;
+        unsigned want_wt = k == K_DOUBLE ? 1 : (k == K_STRING ? 2 : 0);
+
+        if (k == K_NONE || wt != want_wt || field <= last) {
+            CHECK(0, "%s: field %u (wire type %u) unknown, mistyped or out of order", name, field, wt);
+            d->bad = 1;
+            return;
+        }
+        last = field;
+
+        if (wt == 1) {
+            if (end - p < 8) {
+                CHECK(0, "%s: field %u truncated", name, field);
+                d->bad = 1;
+                return;
+            }
+            for (int i = 7; i >= 0; i--)
+                v = (v << 8) | p[i];
+            p += 8;
+        } else if (!get_varint(&p, end, &v) || (wt == 2 && v > (uint64_t) (end - p))) {
+            CHECK(0, "%s: field %u truncated", name, field);
+            d->bad = 1;
+            return;
+        }
+
+        d->seen |= (uint64_t) 1 << field;
+        switch (k) {
+            case K_INT32:
+            case K_ENUM:
+                CHECK(v == (uint64_t) (int64_t) (int32_t) v, "%s: field %u is not a sign extended int32", name, field);
+                d->value[field] = (int32_t) v;
+                break;
+            case K_SINT32:
+                d->value[field] = (int32_t) ((uint32_t) (v >> 1) ^ -(uint32_t) (v & 1));
+                break;
+            case K_BOOL:
+                CHECK(v <= 1, "%s: field %u is not a bool", name, field);
+                d->value[field] = (int64_t) v;
+                break;
+            case K_STRING:
+                CHECK(v < sizeof (d->callsign), "%s: field %u is too long", name, field);
+                if (v < sizeof (d->callsign))
+                    memcpy(d->callsign, p, v);
+                p += v;
+                break;
+            default:
+                d->value[field] = (int64_t) v;
+                break;
+        }
+    }
+}
+
+static int64_t double_bits(double v) {
+    int64_t bits;
+    memcpy(&bits, &v, sizeof (bits));
+    return bits;
+}
+
+// What rbfeeder has always sent for a p_data (see sendMultipleFlights):
+// nav_heading, nav_altitude_src and the nav modes are not
+static void expected_fields(const struct p_data *pac, uint64_t *seen, int64_t *value) {
+    uint32_t f = pac->fields;
+
+    *seen = 0;
+#define EXPECT(bit, field, v) do {                        \
+        if (f & (bit)) {                                 \
+            *seen |= (uint64_t) 1 << (field);            \
+            value[field] = (v);                          \
+        }                                                \
+    } while (0)
+    EXPECT(~0U, 1, pac->modes_addr);
+    EXPECT(PDATA_CALLSIGN, 3, 0);
+    EXPECT(PDATA_ALTITUDE, 4, pac->altitude);
+    EXPECT(PDATA_POSITION, 6, double_bits(pac->lat));
+    EXPECT(PDATA_POSITION, 7, double_bits(pac->lon));
+    EXPECT(PDATA_HEADING, 8, pac->heading);
+    EXPECT(PDATA_GND_SPEED, 9, pac->gnd_speed);
+    EXPECT(PDATA_IAS, 10, pac->ias);
+    EXPECT(PDATA_VERT_RATE, 11, pac->vert_rate);
+    EXPECT(PDATA_SQUAWK, 12, pac->squawk);
+    EXPECT(PDATA_AIRBORNE, 13, pac->airborne ? 1 : 0);
+    EXPECT(PDATA_IS_MLAT, 14, 1);
+    EXPECT(PDATA_IS_978, 15, 1);
+    EXPECT(PDATA_NAV_ALTITUDE_FMS, 16, (int32_t) pac->nav_altitude_fms);
+    EXPECT(PDATA_NAV_ALTITUDE_MCP, 17, (int32_t) pac->nav_altitude_mcp);
+    EXPECT(PDATA_NAV_QNH, 18, pac->nav_qnh);
+    EXPECT(PDATA_WIND_DIR, 27, pac->wind_dir);
+    EXPECT(PDATA_WIND_SPEED, 28, pac->wind_speed);
+    EXPECT(PDATA_TEMPERATURE, 29, pac->temperature);
+    EXPECT(PDATA_POS_NIC, 35, pac->pos_nic);
+    EXPECT(PDATA_NIC_BARO, 36, pac->nic_baro ? 1 : 0);
+    EXPECT(PDATA_NAC_P, 37, pac->nac_p);
+    EXPECT(PDATA_NAC_V, 38, pac->nac_v);
+    EXPECT(PDATA_SIL, 39, pac->sil);
+    EXPECT(PDATA_SIL_TYPE, 40, pac->sil_type);
+    EXPECT(PDATA_ALTITUDE_GEO, 41, pac->altitude_geo);
+#undef EXPECT
+}
+
+// Walk a FlightPacket and check each FlightData against flights[],
+// cycling through them. Returns the number of flights found.
+static unsigned check_packet(const char *name, const uint8_t *buf, size_t len, const struct p_data *flights, unsigned nflights) {
+    const uint8_t *p = buf, *end = buf + len;
+    unsigned n = 0;
+
+    while (p < end) {
+        const struct p_data *pac = &flights[n % nflights];
+        struct decoded d;
+        uint64_t key, body, want_seen;
+        int64_t want[MAX_FIELD + 1] = { 0 };
+
+        if (!get_varint(&p, end, &key) || key != ((1 << 3) | 2) || !get_varint(&p, end, &body) || body > (uint64_t) (end - p)) {
+            CHECK(0, "%s: flight %u is not a well formed fdata", name, n);
+            break;
+        }
+        decode_flight(name, p, p + body, &d);
+        p += body;
+        n++;
+        if (d.bad)
+            break;
+
+        expected_fields(pac, &want_seen, want);
+        for (unsigned field = 1; field <= MAX_FIELD; field++) {
+            uint64_t bit = (uint64_t) 1 << field;
+            if (!(want_seen & bit)) {
+                CHECK(!(d.seen & bit), "%s: flight %u: field %u sent but not set", name, n, field);
+            } else if (!(d.seen & bit)) {
+                CHECK(0, "%s: flight %u: field %u set but not sent", name, n, field);
+            } else if (field != 3) {
+                CHECK(d.value[field] == want[field], "%s: flight %u: field %u is %lld, expected %lld",
+                        name, n, field, (long long) d.value[field], (long long) want[field]);
+            }
+        }
+        if (want_seen & (1 << 3))
+            CHECK(!strcmp(d.callsign, pac->callsign), "%s: flight %u: callsign is '%s', expected '%s'", name, n, d.callsign, pac->callsign);
+    }
+
+    return n;
+}
+
+#ifdef HAVE_PROTOBUF_C
+// The same comparison, with the decoder the server side uses
+static void check_protobuf_c(const char *name, const uint8_t *buf, size_t len, const struct p_data *pac) {
+    FlightPacket *fp = flight_packet__unpack(NULL, len, buf);
+    uint32_t f = pac->fields;
+
+    if (fp == NULL) {
+        CHECK(0, "%s: protobuf-c could not unpack the packet", name);
+        return;
+    }
+    CHECK(fp->n_fdata == 1, "%s: protobuf-c found %zu flights", name, fp->n_fdata);
+    if (fp->n_fdata < 1) {
+        flight_packet__free_unpacked(fp, NULL);
+        return;
+    }
+
+    FlightData *fd = fp->fdata[0];
+#define CHECK_PB(member, bit, v)                                                      \
+    CHECK(fd->has_##member == !!(f & (bit)) && (!fd->has_##member || fd->member == (v)), \
+          "%s: protobuf-c " #member " does not match", name)
+    CHECK(fd->addr == pac->modes_addr, "%s: protobuf-c addr does not match", name);
+    CHECK((fd->callsign != NULL) == !!(f & PDATA_CALLSIGN) && (fd->callsign == NULL || !strcmp(fd->callsign, pac->callsign)),
+          "%s: protobuf-c callsign does not match", name);
+    CHECK_PB(altitude, PDATA_ALTITUDE, pac->altitude);
+    CHECK_PB(latitude, PDATA_POSITION, pac->lat);
+    CHECK_PB(longitude, PDATA_POSITION, pac->lon);
+    CHECK_PB(heading, PDATA_HEADING, pac->heading);
+    CHECK_PB(gnd_speed, PDATA_GND_SPEED, pac->gnd_speed);
+    CHECK_PB(ias, PDATA_IAS, pac->ias);
+    CHECK_PB(vert_rate, PDATA_VERT_RATE, pac->vert_rate);
+    CHECK_PB(squawk, PDATA_SQUAWK, pac->squawk);
+    CHECK_PB(airborne, PDATA_AIRBORNE, !!pac->airborne);
+    CHECK_PB(is_mlat, PDATA_IS_MLAT, 1);
+    CHECK_PB(is_978, PDATA_IS_978, 1);
+    CHECK_PB(nav_altitude_fms, PDATA_NAV_ALTITUDE_FMS, (int32_t) pac->nav_altitude_fms);
+    CHECK_PB(nav_altitude_mcp, PDATA_NAV_ALTITUDE_MCP, (int32_t) pac->nav_altitude_mcp);
+    CHECK_PB(nav_qnh, PDATA_NAV_QNH, pac->nav_qnh);
+    CHECK_PB(wind_dir, PDATA_WIND_DIR, pac->wind_dir);
+    CHECK_PB(wind_speed, PDATA_WIND_SPEED, pac->wind_speed);
+    CHECK_PB(temperature, PDATA_TEMPERATURE, pac->temperature);
+    CHECK_PB(pos_nic, PDATA_POS_NIC, pac->pos_nic);
+    CHECK_PB(nic_baro, PDATA_NIC_BARO, !!pac->nic_baro);
+    CHECK_PB(nac_p, PDATA_NAC_P, pac->nac_p);
+    CHECK_PB(nac_v, PDATA_NAC_V, pac->nac_v);
+    CHECK_PB(sil, PDATA_SIL, pac->sil);
+    CHECK_PB(sil_type, PDATA_SIL_TYPE, (SilType) pac->sil_type);
+    CHECK_PB(altitude_geo, PDATA_ALTITUDE_GEO, pac->altitude_geo);
+#undef CHECK_PB
+    CHECK(!fd->has_addr_type && !fd->has_altitude_source && !fd->has_nav_heading && !fd->has_nav_altitude_src &&
+          !fd->has_nav_modes_autopilot && !fd->has_nav_modes_vnav && !fd->has_nav_modes_alt_hold &&
+          !fd->has_nav_modes_approach && !fd->has_nav_modes_lnav && !fd->has_nav_modes_tcas,
+          "%s: protobuf-c found fields that are never sent", name);
+
+    flight_packet__free_unpacked(fp, NULL);
+}
+#endif
+
+static void test_flight(const char *name, void (*make)(struct p_data *), const uint8_t *golden, size_t golden_len) {
+    struct flightenc enc = { 0 };
+    struct p_data pac;
+    int failures_before = failures;
+
+    make(&pac);
+    CHECK(flightenc_addFlight(&enc, &pac), "%s: flightenc_addFlight failed", name);
+    CHECK(enc.flights == 1, "%s: %u flights counted", name, enc.flights);
+    CHECK(enc.len == golden_len && !memcmp(enc.buf, golden, golden_len), "%s: %zu bytes differ from the %zu golden bytes", name, enc.len, golden_len);
+    CHECK(check_packet(name, enc.buf, enc.len, &pac, 1) == 1, "%s: wrong number of flights in the packet", name);
+#ifdef HAVE_PROTOBUF_C
+    check_protobuf_c(name, enc.buf, enc.len, &pac);
+#endif
+
+    if (failures == failures_before)
+        fprintf(stderr, "%s:  PASS (%zu bytes)\n", name, enc.len);
+    flightenc_destroy(&enc);
+}
+
+// Many flights in one packet, so the buffer has to grow, and then the
+// encoder is reused for a new packet
+static void test_packet(void) {
+    const char *name = "many flights";
+    const unsigned count = 1000;
+    struct flightenc enc = { 0 };
+    struct p_data flights[3];
+    const uint8_t *golden[3] = { golden_all, golden_addr_only, golden_limits };
+    const size_t golden_len[3] = { sizeof (golden_all), sizeof (golden_addr_only), sizeof (golden_limits) };
+    int failures_before = failures;
+
+    make_all(&flights[0]);
+    make_addr_only(&flights[1]);
+    make_limits(&flights[2]);
+
+    size_t len = 0;
+    for (unsigned i = 0; i < count; i++) {
+        if (!flightenc_addFlight(&enc, &flights[i % 3])) {
+            CHECK(0, "%s: flightenc_addFlight failed at flight %u", name, i);
+            break;
+        }
+        CHECK(!memcmp(enc.buf + len, golden[i % 3], golden_len[i % 3]), "%s: flight %u differs from its golden bytes", name, i);
+        len += golden_len[i % 3];
+    }
+    CHECK(enc.flights == count && enc.len == len, "%s: %u flights, %zu bytes, expected %u, %zu", name, enc.flights, enc.len, count, len);
+    CHECK(check_packet(name, enc.buf, enc.len, flights, 3) == count, "%s: wrong number of flights in the packet", name);
+    size_t size = enc.size;
+
+    flightenc_reset(&enc);
+    CHECK(enc.len == 0 && enc.flights == 0 && enc.size == size, "%s: reset did not keep the buffer", name);
+    CHECK(flightenc_addFlight(&enc, &flights[0]) && enc.len == sizeof (golden_all) && !memcmp(enc.buf, golden_all, sizeof (golden_all)),
+          "%s: packet after reset differs from the golden bytes", name);
+
+    if (failures == failures_before)
+        fprintf(stderr, "%s:  PASS (%u flights, %zu bytes, %zu byte buffer)\n", name, count, len, size);
+    flightenc_destroy(&enc);
+}
+
+int main(int argc, char **argv) {
+    (void) argc;
+    (void) argv;
+
+    test_flight("all fields", make_all, golden_all, sizeof (golden_all));
+    test_flight("address only", make_addr_only, golden_addr_only, sizeof (golden_addr_only));
+    test_flight("limits, two byte length", make_limits, golden_limits, sizeof (golden_limits));
+    test_packet();
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) 2020 - AirNav Systems
+ *
+ * https://www.radarbox.com
+ *
+ * More info: https://github.com/AirNav-Systems/rbfeeder
+ *
+ */
+
+// framebuftests.c - fuzz/replay test for the server command framing
+// (airnav_framebuf.c)
+//
+// A random stream of frames from the AirNav server, with garbage between
+// some of them (including stray start-of-TX bytes) and some headers with
+// an invalid size, is written to a pipe in chunks that split frames and
+// coalesce several of them: one byte at a time, random sizes, and all of
+// it at once. The reading side runs the same read/next loop as
+// net_thread_WaitCmds() and must dispatch exactly the frames the old
+// byte-at-a-time receiver did (kept below as the reference).
+// A frame too big for the buffer must be skipped without losing the
+// frame after it.
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "airnav_framebuf.h"
+
+#define BUFFLEN 4096 // as rbfeeder.h
+#define FRAMES 20000
+
+static const char txstart[2] = {'~', '#'};
+
+static int failures = 0;
+
+#define CHECK(cond, ...) do {                             \
+        if (!(cond)) {                                   \
+            fprintf(stderr, "FAIL: " __VA_ARGS__);       \
+            fprintf(stderr, "\n");                       \
+            ++failures;                                  \
+        }                                                \
+    } while (0)
+
+// A dispatched frame: offset into the stream of its start of TX, and length
+struct dispatch {
+    size_t offset;
+    unsigned len;
+};
+
+struct dispatch_list {
+    struct dispatch *d;
+    unsigned count;
+    unsigned alloc;
+};
+
+static void add_dispatch(struct dispatch_list *l, size_t offset, unsigned len) {
+    if (l->count == l->alloc) {
+        l->alloc = l->alloc ? l->alloc * 2 : 1024;
+        l->d = realloc(l->d, l->alloc * sizeof (*l->d));
+    }
+    l->d[l->count].offset = offset;
+    l->d[l->count].len = len;
+    l->count++;
+}
+
+static char *stream;
+static size_t stream_len;
+static size_t stream_alloc;
+
+static void put(const void *p, size_t n) {
+    if (stream_len + n > stream_alloc) {
+        stream_alloc = (stream_len + n) * 2;
+        stream = realloc(stream, stream_alloc);
+    }
+    memcpy(stream + stream_len, p, n);
+    stream_len += n;
+}
+
+static void put_frame(unsigned size, int type) {
+    char hdr[5] = {txstart[0], txstart[1], (char) (size >> 8), (char) size, (char) type};
+    put(hdr, size > 0 ? 5 : 4);
+    for (unsigned i = 1; i < size; ++i) {
+        // the bytes after an invalid header are scanned as garbage
+        char c = size > 2 ? (char) rand() : 'x';
+        put(&c, 1);
+    }
+}
+
+static void make_stream(void) {
+    for (unsigned n = 0; n < FRAMES; ++n) {
+        unsigned r = rand() % 100;
+
+        if (r < 10) {
+            // garbage, sometimes containing a lone '~' or '#'; a whole
+            // start of TX in garbage is a false frame, and what happens
+            // to the bytes after it is covered by test_oversized()
+            unsigned len = 1 + rand() % 40;
+            char prev = 0;
+            for (unsigned i = 0; i < len; ++i) {
+                char c = (char) (rand() % 4 == 0 ? txstart[rand() % 2] : 'a' + rand() % 26);
+                if (prev == txstart[0] && c == txstart[1])
+                    c = 'a';
+                put(&c, 1);
+                prev = c;
+            }
+        } else if (r < 13) {
+            // header with an invalid size
+            put_frame(rand() % 3, 2);
+            continue;
+        }
+
+        // mostly small replies/commands, some up to the buffer size
+        unsigned size = rand() % 10 == 0 ? 3 + rand() % (BUFFLEN - 4 - 3 + 1) : 3 + rand() % 200;
+        put_frame(size, 1 + rand() % 8);
+    }
+}
+
+// The receiver as it was in net_thread_WaitCmds, byte by byte
+static void reference_parse(struct dispatch_list *out) {
+    char buf[BUFFLEN] = {0};
+    int buf_idx = 0;
+    unsigned short temp_size = 0;
+    unsigned short packet_size = 0;
+    size_t pos = 0;
+
+    while (pos < stream_len) {
+        if (buf_idx >= BUFFLEN) {
+            // buffer full: start over (never happens with frames that fit)
+            buf_idx = 0;
+            packet_size = 0;
+            continue;
+        }
+
+        buf[buf_idx++] = stream[pos++];
+        if (buf_idx < 2)
+            continue;
+
+        if (buf[0] == txstart[0] && buf[1] == txstart[1]) {
+            if (buf_idx == 4) {
+                temp_size = (((unsigned short) (unsigned char) buf[2]) << 8) | (0x00ff & buf[3]);
+                if (temp_size <= 2) {
+                    buf_idx = 0;
+                } else {
+                    packet_size = temp_size;
+                }
+            }
+            if (buf_idx > 6 && packet_size == (buf_idx - 4)) {
+                add_dispatch(out, pos - buf_idx, packet_size + 4);
+                buf_idx = 0;
+                packet_size = 0;
+            }
+        } else if (buf[buf_idx - 1] == txstart[1] && buf[buf_idx - 2] == txstart[0]) {
+            buf_idx = 2;
+            buf[0] = txstart[0];
+            buf[1] = txstart[1];
+        }
+    }
+}
+
+// Feed the stream through a pipe in chunks chosen by chunk(), dispatching
+// frames after every read; each frame is located in the stream by content
+// and position, so a frame returned from the wrong place is caught too.
+static void replay(const char *name, size_t (*chunk)(void), const struct dispatch_list *expected) {
+    int fds[2];
+    struct framebuf fb;
+    size_t written = 0;
+    size_t consumed = 0; // stream offset just past the last dispatched frame
+    unsigned next = 0;
+    int failures_before = failures;
+
+    if (pipe(fds) < 0 || !framebuf_init(&fb, BUFFLEN)) {
+        CHECK(0, "%s: setup failed", name);
+        return;
+    }
+    fcntl(fds[0], F_SETFL, O_NONBLOCK);
+    fcntl(fds[1], F_SETFL, O_NONBLOCK);
+
+    for (;;) {
+        if (written < stream_len) {
+            size_t n = chunk();
+            if (n > stream_len - written)
+                n = stream_len - written;
+            ssize_t w = write(fds[1], stream + written, n);
+            if (w > 0)
+                written += w;
+            if (written == stream_len)
+                close(fds[1]);
+        }
+
+        ssize_t r;
+        while ((r = framebuf_read(&fb, fds[0])) > 0) {
+            const char *frame;
+            unsigned len;
+            while ((frame = framebuf_next(&fb, &len)) != NULL) {
+                if (next >= expected->count) {
+                    CHECK(0, "%s: more frames dispatched than expected", name);
+                    goto done;
+                }
+                const struct dispatch *d = &expected->d[next++];
+                if (len != d->len || d->offset < consumed || memcmp(frame, stream + d->offset, len) != 0) {
+                    CHECK(0, "%s: frame %u differs (length %u, expected %u at offset %zu)", name, next - 1, len, d->len, d->offset);
+                    goto done;
+                }
+                consumed = d->offset + len;
+            }
+        }
+
+        if (r == 0)
+            break; // EOF: everything has been read
+        if (errno != EAGAIN) {
+            CHECK(0, "%s: read: %s", name, strerror(errno));
+            goto done;
+        }
+    }
+
+    CHECK(next == expected->count, "%s: %u frames dispatched, expected %u", name, next, expected->count);
+
+ done:
+    if (failures == failures_before)
+        fprintf(stderr, "%s:  PASS (%lu frames, %llu garbage bytes, %lu invalid)\n", name, fb.frames, fb.garbage, fb.invalid);
+    framebuf_destroy(&fb);
+    close(fds[0]);
+    if (written < stream_len)
+        close(fds[1]);
+}
+
+static size_t chunk_single(void) {
+    return 1;
+}
+
+static size_t chunk_random(void) {
+    return 1 + rand() % (rand() % 4 == 0 ? 20000 : 300);
+}
+
+static size_t chunk_all(void) {
+    return 65536; // as much as the pipe takes
+}
+
+// A frame bigger than the buffer is dropped and counted, and the frame
+// after it, split across reads, still arrives intact.
+static void test_oversized(void) {
+    struct framebuf fb;
+    int fds[2];
+    const char *frame;
+    unsigned len;
+
+    stream_len = 0;
+    put_frame(BUFFLEN + 100, 8);
+    put_frame(10, 2);
+
+    if (pipe(fds) < 0 || !framebuf_init(&fb, BUFFLEN)) {
+        CHECK(0, "oversized: setup failed");
+        return;
+    }
+
+    unsigned got = 0;
+    for (size_t off = 0; off < stream_len; off += 1000) {
+        size_t n = stream_len - off < 1000 ? stream_len - off : 1000;
+        CHECK(write(fds[1], stream + off, n) == (ssize_t) n, "oversized: write failed");
+        CHECK(framebuf_read(&fb, fds[0]) == (ssize_t) n, "oversized: short read");
+        while ((frame = framebuf_next(&fb, &len)) != NULL) {
+            CHECK(len == 14 && frame[4] == 2 && !memcmp(frame, stream + stream_len - 14, 14), "oversized: wrong frame dispatched");
+            got++;
+        }
+    }
+
+    CHECK(got == 1, "oversized: %u frames dispatched, expected 1", got);
+    CHECK(fb.oversized == 1, "oversized: %lu oversized frames counted, expected 1", fb.oversized);
+    if (got == 1 && fb.oversized == 1)
+        fprintf(stderr, "oversized:  PASS\n");
+
+    framebuf_destroy(&fb);
+    close(fds[0]);
+    close(fds[1]);
+}
+
+int main(int argc, char **argv) {
+    (void) argc;
+    (void) argv;
+
+    srand(1);
+    make_stream();
+
+    struct dispatch_list expected = {0};
+    reference_parse(&expected);
+    CHECK(expected.count > FRAMES / 2, "reference: only %u frames in the stream", expected.count);
+
+    replay("single bytes", chunk_single, &expected);
+    replay("random chunks", chunk_random, &expected);
+    replay("coalesced", chunk_all, &expected);
+
+    test_oversized();
+
+    free(expected.d);
+    free(stream);
+    return failures ? 1 : 0;
+}
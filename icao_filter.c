@@ -37,30 +37,6 @@ static uint32_t *icao_filter_active;
 
 #define EMPTY 0xFFFFFFFF
 
-static uint32_t icaoHash(uint32_t a)
-{
-    // Jenkins one-at-a-time hash, unrolled for 3 bytes
-    uint32_t hash = 0;
-
-    hash += a & 0xff;
-    hash += hash << 10;
-    hash ^= hash >> 6;
-
-    hash += (a >> 8) & 0xff;
-    hash += (hash << 10);
-    hash ^= (hash >> 6);
-
-    hash += (a >> 16) & 0xff;
-    hash += (hash << 10);
-    hash ^= (hash >> 6);
-
-    hash += (hash << 3);
-    hash ^= (hash >> 11);
-    hash += (hash << 15);
-
-    return hash & (ICAO_FILTER_SIZE-1);
-}
-
 void icaoFilterInit()
 {
     memset(icao_filter_a, 0xFF, sizeof(icao_filter_a));
@@ -71,7 +47,7 @@ void icaoFilterInit()
 void icaoFilterAdd(uint32_t addr)
 {
     uint32_t h, h0;
-    h0 = h = icaoHash(addr);
+    h0 = h = icaoHash(addr) & (ICAO_FILTER_SIZE-1);
     while (icao_filter_active[h] != EMPTY && icao_filter_active[h] != addr) {
         h = (h+1) & (ICAO_FILTER_SIZE-1);
         if (h == h0) {
@@ -87,7 +63,7 @@ int icaoFilterTest(uint32_t addr)
 {
     uint32_t h, h0;
 
-    h0 = h = icaoHash(addr);
+    h0 = h = icaoHash(addr) & (ICAO_FILTER_SIZE-1);
     while (icao_filter_a[h] != EMPTY && icao_filter_a[h] != addr) {
         h = (h+1) & (ICAO_FILTER_SIZE-1);
         if (h == h0)
@@ -23,6 +23,32 @@
 // Special address bit used to mark ADS-B (NT) emitters
 #define ICAO_FILTER_ADSB_NT (1 << 25)
 
+// Jenkins one-at-a-time hash, unrolled for 3 bytes.
+// Returns the full 32-bit hash; callers mask it down to
+// their own (power of two) table size.
+static inline uint32_t icaoHash(uint32_t a)
+{
+    uint32_t hash = 0;
+
+    hash += a & 0xff;
+    hash += hash << 10;
+    hash ^= hash >> 6;
+
+    hash += (a >> 8) & 0xff;
+    hash += (hash << 10);
+    hash ^= (hash >> 6);
+
+    hash += (a >> 16) & 0xff;
+    hash += (hash << 10);
+    hash ^= (hash >> 6);
+
+    hash += (hash << 3);
+    hash ^= (hash >> 11);
+    hash += (hash << 15);
+
+    return hash;
+}
+
 // Call once:
 void icaoFilterInit();
 
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020 - AirNav Systems
+ *
+ * https://www.radarbox.com
+ *
+ * More info: https://github.com/AirNav-Systems/rbfeeder
+ *
+ */
+
+// maggridtests.c - accuracy test for the magnetic declination grid
+// (airnav_maggrid.c)
+//
+// Grids are built around receivers in different parts of the world
+// (including one straddling the antimeridian and one in the Arctic where
+// declination changes fast), and random positions and altitudes within
+// range are looked up and compared with the full World Magnetic Model
+// (geomag_geomg1), which is what airnav_prepareData() used to call for
+// every aircraft. Positions outside the grid must be refused.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "airnav_geomag.h"
+#include "airnav_maggrid.h"
+
+#define RANGE (1852 * 360) // as rbfeeder.c
+#define YEAR 2022.5
+#define POINTS 20000
+
+static int failures = 0;
+
+#define CHECK(cond, ...) do {                             \
+        if (!(cond)) {                                   \
+            fprintf(stderr, "FAIL: " __VA_ARGS__);       \
+            fprintf(stderr, "\n");                       \
+            ++failures;                                  \
+        }                                                \
+    } while (0)
+
+static double frand(double lo, double hi) {
+    return lo + (hi - lo) * (rand() / (double) RAND_MAX);
+}
+
+static double angle_diff(double a, double b) {
+    double d = fmod(a - b, 360.0);
+    if (d > 180.0)
+        d -= 360.0;
+    else if (d < -180.0)
+        d += 360.0;
+    return fabs(d);
+}
+
+// max_dec_err is in degrees; for scale, ADS-B magnetic heading comes in
+// steps of 360/1024 (0.35) degrees
+static void test_receiver(const char *name, double lat, double lon, double max_dec_err) {
+    struct maggrid grid;
+    double worst_dec = 0, worst_dip = 0, sum_dec = 0;
+    int failures_before = failures;
+
+    if (!maggrid_init(&grid, lat, lon, RANGE, MAGGRID_STEP, YEAR)) {
+        CHECK(0, "%s: maggrid_init failed", name);
+        return;
+    }
+
+    double range_deg = RANGE / 111320.0;
+    for (unsigned i = 0; i < POINTS; ++i) {
+        double plat = lat + frand(-range_deg, range_deg);
+        double plon = lon + frand(-range_deg, range_deg) / cos(fmin(fabs(plat), 89.0) * M_PI / 180.0);
+        double alt = frand(-0.5, 16.0);
+        double dec, dip, ref_dec, ref_dip, ti, gv;
+
+        plat = fmax(fmin(plat, 90.0), -90.0);
+        if (plon >= 180.0)
+            plon -= 360.0;
+        else if (plon < -180.0)
+            plon += 360.0;
+
+        if (!maggrid_lookup(&grid, alt, plat, plon, &dec, &dip)) {
+            CHECK(0, "%s: %.4f,%.4f is in range but not in the grid", name, plat, plon);
+            break;
+        }
+        geomag_geomg1(alt, plat, plon, YEAR, &ref_dec, &ref_dip, &ti, &gv);
+
+        double e = angle_diff(dec, ref_dec);
+        sum_dec += e;
+        if (e > worst_dec)
+            worst_dec = e;
+        if (fabs(dip - ref_dip) > worst_dip)
+            worst_dip = fabs(dip - ref_dip);
+        CHECK(e <= max_dec_err, "%s: declination at %.4f,%.4f,%.1f km is %.4f, model says %.4f", name, plat, plon, alt, dec, ref_dec);
+        CHECK(fabs(dip - ref_dip) <= 0.01, "%s: dip at %.4f,%.4f,%.1f km is %.4f, model says %.4f", name, plat, plon, alt, dip, ref_dip);
+        if (failures - failures_before > 10)
+            break;
+    }
+
+    // Beyond the range, on the far side of the globe, and not a number
+    double dec, dip;
+    CHECK(!maggrid_lookup(&grid, 0, lat + range_deg + 2 * MAGGRID_STEP + 1, lon, &dec, &dip) || lat + range_deg >= 89.0, "%s: north of the grid found", name);
+    CHECK(!maggrid_lookup(&grid, 0, -lat, lon + 180.0 > 180.0 ? lon - 180.0 : lon + 180.0, &dec, &dip) || fabs(lat) < range_deg, "%s: antipode found", name);
+    CHECK(!maggrid_lookup(&grid, 0, NAN, lon, &dec, &dip), "%s: NaN latitude found", name);
+    CHECK(!maggrid_lookup(&grid, 0, lat, NAN, &dec, &dip), "%s: NaN longitude found", name);
+
+    if (failures == failures_before)
+        fprintf(stderr, "%s:  PASS (%ux%u grid, declination error max %.4f mean %.5f, dip error max %.4f degrees)\n",
+                name, grid.rows, grid.cols, worst_dec, sum_dec / POINTS, worst_dip);
+    maggrid_destroy(&grid);
+}
+
+int main(int argc, char **argv) {
+    (void) argc;
+    (void) argv;
+
+    srand(1);
+
+    test_receiver("Sao Paulo", -23.55, -46.63, 0.01);
+    test_receiver("London", 51.47, -0.45, 0.01);
+    test_receiver("Fiji, across the antimeridian", -17.76, 177.44, 0.01);
+    test_receiver("Anchorage", 61.17, -149.99, 0.01);
+    test_receiver("Longyearbyen", 78.25, 15.47, 0.1);
+
+    return failures ? 1 : 0;
+}
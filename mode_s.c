@@ -345,14 +345,24 @@ static int correctMessage(const unsigned char *in, unsigned char *out, uint32_t
     return -1;
 }
 
-// Score how plausible this ModeS message looks.
-// The more positive, the more reliable the message is.
-score_rank scoreModesMessage(const unsigned char *uncorrected)
+// Score how plausible this ModeS message looks, without the ICAO filter
+// lookup: fills in either the final score, or the filter key and the
+// scores to use depending on whether the key is in the filter.
+// This touches no shared state, so it is safe to call from the
+// demodulator's worker threads.
+void scoreModesMessagePrepare(const unsigned char *uncorrected, struct modesScoreInfo *info)
 {
     // This is a "valid" DF0 message, but it's not useful; we discard these messages
     static const unsigned char all_zeros[MODES_SHORT_MSG_BYTES] = { 0, 0, 0, 0, 0, 0, 0 };
-    if (!memcmp(all_zeros, uncorrected, sizeof(all_zeros)))
-        return SR_ALL_ZEROS;
+
+    info->fixed = SR_NOT_SET;
+    info->filter_key = 0;
+    info->known = info->unknown = SR_NOT_SET;
+
+    if (!memcmp(all_zeros, uncorrected, sizeof(all_zeros))) {
+        info->fixed = SR_ALL_ZEROS;
+        return;
+    }
 
     // try to produce a corrected DF11/17/18, including correcting the DF bits
     unsigned char corrected[14];
@@ -364,22 +374,22 @@ score_rank scoreModesMessage(const unsigned char *uncorrected)
     case 0:  // short air-air surveillance
     case 4:  // surveillance, altitude reply
     case 5:  // surveillance, altitude reply
-        {
-            if (short_syndrome == UNCHECKED_SYNDROME)
-                short_syndrome = modesChecksum(corrected, MODES_SHORT_MSG_BITS);
-            bool recent = icaoFilterTest(short_syndrome);
-            return recent ? SR_UNRELIABLE_KNOWN : SR_UNRELIABLE_UNKNOWN;
-        }
+        if (short_syndrome == UNCHECKED_SYNDROME)
+            short_syndrome = modesChecksum(corrected, MODES_SHORT_MSG_BITS);
+        info->filter_key = short_syndrome;
+        info->known = SR_UNRELIABLE_KNOWN;
+        info->unknown = SR_UNRELIABLE_UNKNOWN;
+        return;
 
     case 16: // long air-air surveillance
     case 20: // Comm-B, altitude reply
     case 21: // Comm-B, identity reply
-        {
-            if (long_syndrome == UNCHECKED_SYNDROME)
-                long_syndrome = modesChecksum(corrected, MODES_LONG_MSG_BITS);
-            bool recent = icaoFilterTest(long_syndrome);
-            return recent ? SR_UNRELIABLE_KNOWN : SR_UNRELIABLE_UNKNOWN;
-        }
+        if (long_syndrome == UNCHECKED_SYNDROME)
+            long_syndrome = modesChecksum(corrected, MODES_LONG_MSG_BITS);
+        info->filter_key = long_syndrome;
+        info->known = SR_UNRELIABLE_KNOWN;
+        info->unknown = SR_UNRELIABLE_UNKNOWN;
+        return;
 
     case 24: // Comm-D (ELM)
     case 25: // Comm-D (ELM)
@@ -389,82 +399,117 @@ score_rank scoreModesMessage(const unsigned char *uncorrected)
     case 29: // Comm-D (ELM)
     case 30: // Comm-D (ELM)
     case 31: // Comm-D (ELM)
-        {
-            if (!Modes.enable_df24)
-                return SR_UNCORRECTABLE;
-            if (long_syndrome == UNCHECKED_SYNDROME)
-                long_syndrome = modesChecksum(corrected, MODES_LONG_MSG_BITS);
-            bool recent = icaoFilterTest(long_syndrome);
-            return recent ? SR_UNRELIABLE_KNOWN : SR_UNRELIABLE_UNKNOWN;
+        if (!Modes.enable_df24) {
+            info->fixed = SR_UNCORRECTABLE;
+            return;
         }
+        if (long_syndrome == UNCHECKED_SYNDROME)
+            long_syndrome = modesChecksum(corrected, MODES_LONG_MSG_BITS);
+        info->filter_key = long_syndrome;
+        info->known = SR_UNRELIABLE_KNOWN;
+        info->unknown = SR_UNRELIABLE_UNKNOWN;
+        return;
 
     case 11:
         {
             // DF11 All-call reply
-            uint32_t addr = getbits(corrected, 9, 32);
             if (short_syndrome == UNCHECKED_SYNDROME)
                 short_syndrome = modesChecksum(corrected, MODES_SHORT_MSG_BITS);
             uint32_t iid = short_syndrome & 0x7F;
-            bool recent = icaoFilterTest(addr);
+            info->filter_key = getbits(corrected, 9, 32);
 
             switch (corrections) {
             case 0:
-                if (iid == 0)
-                    return recent ? SR_DF11_ACQ_KNOWN : SR_DF11_ACQ_UNKNOWN;
-                else
-                    return recent ? SR_DF11_IID_KNOWN : SR_DF11_IID_UNKNOWN;
+                if (iid == 0) {
+                    info->known = SR_DF11_ACQ_KNOWN;
+                    info->unknown = SR_DF11_ACQ_UNKNOWN;
+                } else {
+                    info->known = SR_DF11_IID_KNOWN;
+                    info->unknown = SR_DF11_IID_UNKNOWN;
+                }
+                return;
             case 1:
-                if (iid == 0)
-                    return recent ? SR_DF11_ACQ_1ERROR_KNOWN : SR_DF11_ACQ_1ERROR_UNKNOWN;
-                else
-                    return recent ? SR_DF11_IID_1ERROR_KNOWN : SR_DF11_IID_1ERROR_UNKNOWN;
+                if (iid == 0) {
+                    info->known = SR_DF11_ACQ_1ERROR_KNOWN;
+                    info->unknown = SR_DF11_ACQ_1ERROR_UNKNOWN;
+                } else {
+                    info->known = SR_DF11_IID_1ERROR_KNOWN;
+                    info->unknown = SR_DF11_IID_1ERROR_UNKNOWN;
+                }
+                return;
             default:
-                return SR_UNCORRECTABLE;
+                info->fixed = SR_UNCORRECTABLE;
+                return;
             }
         }
 
     case 17:   // Extended squitter
-        {
-            uint32_t addr = getbits(corrected, 9, 32);
-            bool recent = icaoFilterTest(addr);
+        info->filter_key = getbits(corrected, 9, 32);
 
-            switch (corrections) {
-            case 0:
-                return recent ? SR_DF17_KNOWN : SR_DF17_UNKNOWN;
-            case 1:
-                return recent ? SR_DF17_1ERROR_KNOWN : SR_DF17_1ERROR_UNKNOWN;
-            case 2:
-                return recent ? SR_DF17_2ERROR_KNOWN : SR_DF17_2ERROR_UNKNOWN;
-            default:
-                return SR_UNCORRECTABLE;
-            }
+        switch (corrections) {
+        case 0:
+            info->known = SR_DF17_KNOWN;
+            info->unknown = SR_DF17_UNKNOWN;
+            return;
+        case 1:
+            info->known = SR_DF17_1ERROR_KNOWN;
+            info->unknown = SR_DF17_1ERROR_UNKNOWN;
+            return;
+        case 2:
+            info->known = SR_DF17_2ERROR_KNOWN;
+            info->unknown = SR_DF17_2ERROR_UNKNOWN;
+            return;
+        default:
+            info->fixed = SR_UNCORRECTABLE;
+            return;
         }
 
     case 18:   // Extended squitter/non-transponder
-        {
-            uint32_t addr = getbits(corrected, 9, 32);
-            bool recent = icaoFilterTest(addr | ICAO_FILTER_ADSB_NT); // only look for previous DF18 activity
+        info->filter_key = getbits(corrected, 9, 32) | ICAO_FILTER_ADSB_NT; // only look for previous DF18 activity
 
-            switch (corrections) {
-            case 0:
-                return recent ? SR_DF18_KNOWN : SR_DF18_UNKNOWN;
-            case 1:
-                return recent ? SR_DF18_1ERROR_KNOWN : SR_DF18_1ERROR_UNKNOWN;
-            case 2:
-                return recent ? SR_DF18_2ERROR_KNOWN : SR_DF18_2ERROR_UNKNOWN;
-            default:
-                return SR_UNCORRECTABLE;
-            }
+        switch (corrections) {
+        case 0:
+            info->known = SR_DF18_KNOWN;
+            info->unknown = SR_DF18_UNKNOWN;
+            return;
+        case 1:
+            info->known = SR_DF18_1ERROR_KNOWN;
+            info->unknown = SR_DF18_1ERROR_UNKNOWN;
+            return;
+        case 2:
+            info->known = SR_DF18_2ERROR_KNOWN;
+            info->unknown = SR_DF18_2ERROR_UNKNOWN;
+            return;
+        default:
+            info->fixed = SR_UNCORRECTABLE;
+            return;
         }
 
-
-
     default:
         // unknown message type
-        return SR_UNKNOWN_DF;
+        info->fixed = SR_UNKNOWN_DF;
+        return;
     }
 }
 
+// Complete a score prepared by scoreModesMessagePrepare against the current ICAO filter
+score_rank scoreModesMessageFinish(const struct modesScoreInfo *info)
+{
+    if (info->fixed != SR_NOT_SET)
+        return info->fixed;
+
+    return icaoFilterTest(info->filter_key) ? info->known : info->unknown;
+}
+
+// Score how plausible this ModeS message looks.
+// The more positive, the more reliable the message is.
+score_rank scoreModesMessage(const unsigned char *uncorrected)
+{
+    struct modesScoreInfo info;
+    scoreModesMessagePrepare(uncorrected, &info);
+    return scoreModesMessageFinish(&info);
+}
+
 static const char *score_to_string(score_rank score)
 {
     switch (score) {
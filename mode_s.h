@@ -81,6 +81,19 @@ typedef enum {
 
 int modesMessageLenByType(int type);
 score_rank scoreModesMessage(const unsigned char *msg);
+
+// scoreModesMessage() in two steps: the CRC / error correction work, which
+// only depends on the message, and the ICAO filter lookup
+struct modesScoreInfo {
+    score_rank fixed;       // final score if no filter lookup is needed, otherwise SR_NOT_SET
+    uint32_t   filter_key;  // address or syndrome to look up in the ICAO filter
+    score_rank known;       // score if filter_key is in the filter
+    score_rank unknown;     // score if it is not
+};
+
+void scoreModesMessagePrepare(const unsigned char *msg, struct modesScoreInfo *info);
+score_rank scoreModesMessageFinish(const struct modesScoreInfo *info);
+
 int decodeModesMessage (struct modesMessage *mm, const unsigned char *msg);
 void displayModesMessage(struct modesMessage *mm);
 void useModesMessage    (struct modesMessage *mm);
@@ -55,6 +55,11 @@
 #include <assert.h>
 #include <stdarg.h>
 
+#ifndef _WIN32
+/* for SO_TIMESTAMPNS */
+#include <sys/socket.h>
+#endif
+
 //
 // ============================= Networking =============================
 //
@@ -138,8 +143,20 @@ struct net_service *serviceInit(const char *descr, struct net_writer *writer, he
 // Create a client attached to the given service using the provided socket FD
 struct client *createSocketClient(struct net_service *service, int fd)
 {
+    struct client *c;
+
     anetSetSendBuffer(Modes.aneterr, fd, (MODES_NET_SNDBUF_SIZE << Modes.net_sndbuf_size));
-    return createGenericClient(service, fd);
+    c = createGenericClient(service, fd);
+
+#ifdef SO_TIMESTAMPNS
+    // Ask for kernel receive timestamps so the latency stats include
+    // the time data sat in the socket before we got round to reading it
+    int on = 1;
+    if (setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPNS, &on, sizeof(on)) == 0)
+        c->rx_timestamps = 1;
+#endif
+
+    return c;
 }
 
 // Create a client attached to the given service using the provided FD (might not be a socket!)
@@ -159,6 +176,8 @@ struct client *createGenericClient(struct net_service *service, int fd)
     c->fd         = fd;
     c->buflen     = 0;
     c->modeac_requested = 0;
+    c->rx_timestamps = 0;
+    c->arrival_us = 0;
     Modes.clients = c;
 
     moveNetClient(c, service);
@@ -1192,6 +1211,9 @@ static int handleBeastCommand(struct client *c, char *p) {
 //
 // This function decodes a Beast binary format message
 //
+// p points at the message type byte; modesReadFromClient has already
+// removed any 0x1a escaping, so the rest of the frame is read as-is.
+//
 // The message is passed to the higher level layers, so it feeds
 // the selected screen output, the network output and so forth.
 //
@@ -1222,10 +1244,7 @@ static int decodeBinMessage(struct client *c, char *p) {
         // Special case for Radarcape position messages.
         float lat, lon, alt;
 
-        for (j = 0; j < 21; j++) { // and the data
-            msg[j] = ch = *p++;
-            if (0x1A == ch) {p++;}
-        }
+        memcpy(msg, p, 21);
 
         lat = ieee754_binary32_le_to_float(msg + 4);
         lon = ieee754_binary32_le_to_float(msg + 8);
@@ -1249,7 +1268,6 @@ static int decodeBinMessage(struct client *c, char *p) {
         for (j = 0; j < 6; j++) {
             ch = *p++;
             mm.timestampMsg = mm.timestampMsg << 8 | (ch & 255);
-            if (0x1A == ch) {p++;}
         }
 
         // record reception time as the time we read it.
@@ -1258,12 +1276,8 @@ static int decodeBinMessage(struct client *c, char *p) {
         ch = *p++;  // Grab the signal level
         mm.signalLevel = ((unsigned char)ch / 255.0);
         mm.signalLevel = mm.signalLevel * mm.signalLevel;
-        if (0x1A == ch) {p++;}
 
-        for (j = 0; j < msgLen; j++) { // and the data
-            msg[j] = ch = *p++;
-            if (0x1A == ch) {p++;}
-        }
+        memcpy(msg, p, msgLen); // and the data
 
         if (msgLen == MODEAC_MSG_BYTES) { // ModeA or ModeC
             Modes.stats_current.remote_received_modeac++;
@@ -1284,6 +1298,8 @@ static int decodeBinMessage(struct client *c, char *p) {
             }
         }
 
+        if (c->arrival_us)
+            add_latency(&Modes.stats_current, ustime() - c->arrival_us);
         useModesMessage(&mm);
     }
     return (0);
@@ -1402,6 +1418,8 @@ static int decodeHexMessage(struct client *c, char *hex) {
         }
     }
 
+    if (c->arrival_us)
+        add_latency(&Modes.stats_current, ustime() - c->arrival_us);
     useModesMessage(&mm);
     return (0);
 }
@@ -1844,6 +1862,16 @@ static char * appendStatsJson(char *p,
             else p = safe_snprintf(p, end, ",%u", st->remote_accepted[i]);
         }
 
+        // latency histogram: counts below each bound, the last entry is everything slower
+        for (i = 0; i < LATENCY_BUCKET_COUNT - 1; ++i) {
+            if (i == 0) p = safe_snprintf(p, end, "],\"latency_bounds_us\":[%u", latency_bucket_us[i]);
+            else p = safe_snprintf(p, end, ",%u", latency_bucket_us[i]);
+        }
+        for (i = 0; i < LATENCY_BUCKET_COUNT; ++i) {
+            if (i == 0) p = safe_snprintf(p, end, "],\"latency\":[%u", st->remote_latency[i]);
+            else p = safe_snprintf(p, end, ",%u", st->remote_latency[i]);
+        }
+
         p = safe_snprintf(p, end, "]}");
     }
 
@@ -2136,6 +2164,56 @@ void writeJsonToFile(const char *file, char * (*generator) (const char *,int*))
 // The handler returns 0 on success, or 1 to signal this function we should
 // close the connection with the client in case of non-recoverable errors.
 //
+#ifndef _WIN32
+//
+// read() that also notes when the data arrived: the kernel receive
+// timestamp if the socket provides one, otherwise now
+//
+static int readClientData(struct client *c, char *buf, int len)
+{
+    int nread;
+
+#ifdef SO_TIMESTAMPNS
+    if (c->rx_timestamps) {
+        char control[CMSG_SPACE(sizeof(struct timespec))];
+        struct iovec iov = { buf, len };
+        struct msghdr msg;
+        struct cmsghdr *cmsg;
+
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+
+        nread = recvmsg(c->fd, &msg, 0);
+        if (nread <= 0)
+            return nread;
+
+        // For TCP this is the stamp of the newest segment in the read,
+        // so messages that arrived earlier in the same read are slightly
+        // under-reported
+        for (cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+            if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPNS) {
+                struct timespec ts;
+                memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+                c->arrival_us = (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+                return nread;
+            }
+        }
+
+        c->arrival_us = ustime();
+        return nread;
+    }
+#endif
+
+    nread = read(c->fd, buf, len);
+    if (nread > 0)
+        c->arrival_us = ustime();
+    return nread;
+}
+#endif
+
 static void modesReadFromClient(struct client *c) {
     int left;
     int nread;
@@ -2151,7 +2229,7 @@ static void modesReadFromClient(struct client *c) {
             // If there is garbage, read more to discard it ASAP
         }
 #ifndef _WIN32
-        nread = read(c->fd, c->buf+c->buflen, left);
+        nread = readClientData(c, c->buf+c->buflen, left);
 #else
         nread = recv(c->fd, c->buf+c->buflen, left, 0);
         if (nread < 0) {errno = WSAGetLastError();}
@@ -2195,55 +2273,89 @@ static void modesReadFromClient(struct client *c) {
 
         case READ_MODE_BEAST:
             // This is the Beast Binary scanning case.
-            // If there is a complete message still in the buffer, there must be the separator 'sep'
-            // in the buffer, note that we full-scan the buffer at every read for simplicity.
+            // Every 0x1a in the buffer is located in one vectorized pass up front.
+            // A frame with no 0x1a between its type byte and its nominal end (the
+            // usual case) is then delimited without looking at its bytes again and
+            // is passed to the handler in place; only frames that carry escapes are
+            // walked and unescaped into a bounce buffer. Either way the handler sees
+            // a plain, unescaped frame.
+            {
+                unsigned esc[MODES_CLIENT_BUF_SIZE];
+                unsigned nesc, k = 0;
+                char *base = som;
+                char frame[MODES_LONG_MSG_BYTES + 9]; // type, timestamp, signal, longest message
+
+                starch_find_byte_u8((const uint8_t *) som, eod - som, 0x1a, esc, &nesc);
+
+                while (k < nesc) { // The first byte of buffer 'should' be 0x1a
+                    som = base + esc[k++]; // consume garbage up to the 0x1a; k is now the next 0x1a
+                    p = som + 1; // skip 0x1a
+
+                    if (p >= eod) {
+                        // Incomplete message in buffer, retry later
+                        break;
+                    }
 
-            while (som < eod && ((p = memchr(som, (char) 0x1a, eod - som)) != NULL)) { // The first byte of buffer 'should' be 0x1a
-                som = p; // consume garbage up to the 0x1a
-                ++p; // skip 0x1a
+                    char *eom; // one byte past end of message
+                    if        (*p == '1') {
+                        eom = p + MODEAC_MSG_BYTES      + 8;         // point past remainder of message
+                    } else if (*p == '2') {
+                        eom = p + MODES_SHORT_MSG_BYTES + 8;
+                    } else if (*p == '3') {
+                        eom = p + MODES_LONG_MSG_BYTES  + 8;
+                    } else if (*p == '4') {
+                        eom = p + MODES_LONG_MSG_BYTES  + 8;
+                    } else if (*p == '5') {
+                        eom = p + MODES_LONG_MSG_BYTES  + 8;
+                    } else {
+                        // Not a valid beast message, skip 0x1a and try again
+                        ++som;
+                        continue;
+                    }
 
-                if (p >= eod) {
-                    // Incomplete message in buffer, retry later
-                    break;
-                }
+                    // we need to be careful of double escape characters in the message body:
+                    // each 0x1a inside the frame swallows the byte after it and pushes the end
+                    // out by one
+                    int escaped = 0;
+                    char *next = p;
+                    while (k < nesc && base + esc[k] < eom) {
+                        char *q = base + esc[k++];
+                        if (q < next)
+                            continue; // this 0x1a was itself escaped
+                        next = q + 2;
+                        eom++;
+                        escaped = 1;
+                    }
 
-                char *eom; // one byte past end of message
-                if        (*p == '1') {
-                    eom = p + MODEAC_MSG_BYTES      + 8;         // point past remainder of message
-                } else if (*p == '2') {
-                    eom = p + MODES_SHORT_MSG_BYTES + 8;
-                } else if (*p == '3') {
-                    eom = p + MODES_LONG_MSG_BYTES  + 8;
-                } else if (*p == '4') {
-                    eom = p + MODES_LONG_MSG_BYTES  + 8;
-                } else if (*p == '5') {
-                    eom = p + MODES_LONG_MSG_BYTES  + 8;
-                } else {
-                    // Not a valid beast message, skip 0x1a and try again
-                    ++som;
-                    continue;
-                }
+                    if (eom > eod) { // Incomplete message in buffer, retry later
+                        break;
+                    }
 
-                // we need to be careful of double escape characters in the message body
-                for (p = som + 1; p < eod && p < eom; p++) {
-                    if (0x1A == *p) {
-                        p++;
-                        eom++;
+                    char *msg = p;
+                    if (escaped) {
+                        char *out = frame;
+                        for (char *q = p; q < eom; q++) {
+                            *out++ = *q;
+                            if (0x1A == *q)
+                                q++;
+                        }
+                        msg = frame;
                     }
-                }
 
-                if (eom > eod) { // Incomplete message in buffer, retry later
-                    break;
-                }
+                    // Have a 0x1a followed by 1/2/3/4/5 - pass message to handler.
+                    if (c->service->read_handler(c, msg)) {
+                        modesCloseClient(c);
+                        return;
+                    }
 
-                // Have a 0x1a followed by 1/2/3/4/5 - pass message to handler.
-                if (c->service->read_handler(c, som + 1)) {
-                    modesCloseClient(c);
-                    return;
+                    // advance to next message; k already points at the first 0x1a past it
+                    som = eom;
                 }
 
-                // advance to next message
-                som = eom;
+                if (k >= nesc && som < eod && *som != 0x1a) {
+                    // no sync byte left: everything remaining is garbage
+                    som = eod;
+                }
             }
             break;
 
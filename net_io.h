@@ -60,6 +60,8 @@ struct client {
     int    buflen;                       // Amount of data on buffer
     char   buf[MODES_CLIENT_BUF_SIZE+1]; // Read buffer
     int    modeac_requested;             // 1 if this Beast output connection has asked for A/C
+    int    rx_timestamps;                // 1 if the kernel stamps data arriving on fd
+    uint64_t arrival_us;                 // When the last data read arrived (system time, us)
 };
 
 // Common writer state for all output sockets of one type
@@ -0,0 +1,258 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// beast_benchmark.c: benchmark for Beast input framing in modesReadFromClient
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "../dump1090.h"
+
+#include <sys/socket.h>
+
+struct _Modes Modes;
+
+// Normally provided by sdr.c and dump1090.c, which are not linked here
+int sdrGetGain()
+{
+    return -1;
+}
+
+double sdrGetGainDb(int step)
+{
+    MODES_NOTUSED(step);
+    return 0.0;
+}
+
+void receiverPositionChanged(float lat, float lon, float alt)
+{
+    MODES_NOTUSED(lat);
+    MODES_NOTUSED(lon);
+    MODES_NOTUSED(alt);
+}
+
+// Pushes a Beast stream through a socketpair into a Beast input client
+// and reports frames per second, first with a handler that only counts
+// (and checksums) the frames it is given, then with the normal
+// decodeBinMessage handler. The stream is either synthetic (DF17/DF11
+// with valid CRCs and naturally occurring 0x1a escapes) or a raw Beast
+// capture given on the command line, e.g. one recorded from port 30005
+// for replay-beast style testing.
+
+// Sample results, x86-64 @ ~3GHz, synthetic stream (a 1024-byte read
+// buffer means read() calls are a fixed share of the framing cost):
+//
+//                         memchr + rescan    find_byte_u8 (avx2)
+//   framing only:          14.2M frames/s        17.6M frames/s
+//   framing + decode:       1.9M frames/s         2.0M frames/s
+
+#define SYNTHETIC_FRAMES 200000
+#define AIRCRAFT 300
+#define WRITE_CHUNK 4096
+
+static unsigned char *stream;
+static size_t stream_len;
+static unsigned expected_frames;
+static uint64_t expected_sum;
+
+static unsigned seen_frames;
+static uint64_t seen_sum;
+
+static void put_escaped(unsigned char **out, unsigned char byte)
+{
+    *(*out)++ = byte;
+    if (byte == 0x1a)
+        *(*out)++ = byte;
+}
+
+static void make_synthetic(void)
+{
+    stream = malloc((size_t) SYNTHETIC_FRAMES * 2 * (2 + 8 + MODES_LONG_MSG_BYTES));
+    unsigned char *out = stream;
+    uint64_t timestamp = 0;
+    uint32_t addrs[AIRCRAFT];
+
+    for (unsigned i = 0; i < AIRCRAFT; ++i)
+        addrs[i] = 1 + rand() % 0xFFFFFE;
+
+    for (unsigned i = 0; i < SYNTHETIC_FRAMES; ++i) {
+        unsigned char frame[1 + 7 + MODES_LONG_MSG_BYTES];
+        unsigned len, bits;
+
+        if (rand() % 4) {
+            frame[0] = '3';
+            len = MODES_LONG_MSG_BYTES;
+            frame[8] = 17 << 3 | 5;
+        } else {
+            frame[0] = '2';
+            len = MODES_SHORT_MSG_BYTES;
+            frame[8] = 11 << 3 | 5;
+        }
+        bits = len * 8;
+
+        timestamp += 12000 + rand() % 1000;
+        for (unsigned j = 0; j < 6; ++j)
+            frame[1 + j] = timestamp >> (40 - 8 * j);
+        frame[7] = rand() % 256; // signal
+
+        // a fixed population of addresses, random payload, parity
+        // computed with a zero interrogator id
+        uint32_t addr = addrs[rand() % AIRCRAFT];
+        frame[9] = addr >> 16;
+        frame[10] = addr >> 8;
+        frame[11] = addr;
+        for (unsigned j = 4; j < len; ++j)
+            frame[8 + j] = (j < len - 3) ? rand() % 256 : 0;
+        uint32_t crc = modesChecksum(frame + 8, bits);
+        frame[8 + len - 3] = crc >> 16;
+        frame[8 + len - 2] = crc >> 8;
+        frame[8 + len - 1] = crc;
+
+        *out++ = 0x1a;
+        for (unsigned j = 0; j < 8 + len; ++j) {
+            put_escaped(&out, frame[j]);
+            expected_sum += frame[j];
+        }
+        ++expected_frames;
+    }
+
+    stream_len = out - stream;
+}
+
+static int load_capture(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        fprintf(stderr, "%s: %s\n", path, strerror(errno));
+        return -1;
+    }
+
+    size_t alloc = 1 << 20;
+    stream = malloc(alloc);
+    stream_len = 0;
+    size_t n;
+    while ((n = fread(stream + stream_len, 1, alloc - stream_len, f)) > 0) {
+        stream_len += n;
+        if (stream_len == alloc)
+            stream = realloc(stream, alloc *= 2);
+    }
+    fclose(f);
+
+    // frame count and checksum are unknown for a capture
+    expected_frames = 0;
+    return 0;
+}
+
+static int count_frame(struct client *c, char *p)
+{
+    MODES_NOTUSED(c);
+
+    unsigned len;
+    switch (p[0]) {
+    case '1': len = MODEAC_MSG_BYTES; break;
+    case '2': len = MODES_SHORT_MSG_BYTES; break;
+    default:  len = MODES_LONG_MSG_BYTES; break;
+    }
+
+    for (unsigned j = 0; j < 8 + len; ++j)
+        seen_sum += (unsigned char) p[j];
+    ++seen_frames;
+    return 0;
+}
+
+static void run(const char *what, struct net_service *service)
+{
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) < 0) {
+        perror("socketpair");
+        exit(1);
+    }
+    anetNonBlock(Modes.aneterr, fds[1]);
+    createGenericClient(service, fds[0]);
+
+    fprintf(stderr, "Benchmarking: %s ", what);
+
+    struct timespec total = { 0, 0 };
+    unsigned rounds = 0;
+
+    while (total.tv_sec < 2) {
+        fprintf(stderr, ".");
+
+        seen_frames = 0;
+        seen_sum = 0;
+
+        struct timespec start;
+        start_cpu_timing(&start);
+
+        size_t offset = 0;
+        while (offset < stream_len) {
+            size_t len = stream_len - offset;
+            if (len > WRITE_CHUNK)
+                len = WRITE_CHUNK;
+            ssize_t n = write(fds[1], stream + offset, len);
+            if (n > 0)
+                offset += n;
+            modesNetPeriodicWork();
+        }
+
+        end_cpu_timing(&start, &total);
+        rounds++;
+    }
+
+    fprintf(stderr, "\n");
+
+    if (expected_frames && seen_frames && seen_frames != expected_frames)
+        fprintf(stderr, "  FAIL: %u frames seen, expected %u\n", seen_frames, expected_frames);
+    if (expected_frames && seen_frames && seen_sum != expected_sum)
+        fprintf(stderr, "  FAIL: frame contents differ after unescaping\n");
+
+    double frames = (double) rounds * (expected_frames ? expected_frames : seen_frames);
+    double nanos = total.tv_sec * 1e9 + total.tv_nsec;
+    if (frames > 0) {
+        fprintf(stderr, "  %.2fM frames in %.6f seconds\n", frames / 1e6, nanos / 1e9);
+        fprintf(stderr, "  %.2fM frames/second, %.1f ns/frame\n", frames / nanos * 1e3, nanos / frames);
+    }
+
+    close(fds[1]);
+    modesNetPeriodicWork(); // reads EOF, closes and frees the client
+}
+
+int main(int argc, char **argv)
+{
+    srand(1);
+
+    Modes.quiet = 1;
+    Modes.nfix_crc = 1;
+    modesChecksumInit(Modes.nfix_crc);
+    icaoFilterInit();
+    modeACInit();
+
+    if (argc > 1) {
+        if (load_capture(argv[1]) < 0)
+            return 1;
+    } else {
+        make_synthetic();
+    }
+
+    run("framing only", serviceInit("Beast framing benchmark", NULL, NULL, READ_MODE_BEAST, NULL, count_frame));
+
+    // a capture's frame count comes from the first run
+    if (!expected_frames) {
+        expected_frames = seen_frames;
+        expected_sum = seen_sum;
+    }
+
+    run("framing + decode", makeBeastInputService());
+
+    free(stream);
+    return 0;
+}
@@ -0,0 +1,523 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// cat21_benchmark.c: benchmark for ASTERIX CAT021 encoding
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// we want sendmmsg
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include "../airnav_cat21.h"
+
+// Encodes target reports with the items the feeder sets (SAC/SIC, address,
+// callsign, heights, position, heading, TAS) the way airnav_asterix.c used
+// to (a malloc'd packet per aircraft and per item, item lookup by id
+// string, a malloc'd datagram per aircraft) and with airnav_cat21.c (one
+// reused record, records packed into 1400 byte datagrams), checks that
+// both produce the same records, then sends them both ways to a UDP
+// socket on the loopback interface: a sendto() per datagram, and the
+// whole sweep's datagrams with one sendmmsg() as airnav_asterix.c does.
+
+// Sample results, x86-64, 1 CPU, 1000 aircraft per sweep:
+//
+//                                 old encoder     airnav_cat21.c
+//   encode only, records/second:     0.9M              7.5M
+//   encode + send, records/second:   0.25M             5.4M
+//   encode + sendmmsg, records/second:                 5.8M
+//   datagrams per sweep:             1000                16
+//   send syscalls per sweep:         1000                16 (1 with sendmmsg)
+//   bytes per sweep:                24547             21595
+//
+// With records already packed into datagrams there are few syscalls left
+// to save: sendmmsg() is within run-to-run noise of sendto() here.
+
+#define AIRCRAFT 1000
+#define ROUNDS 200
+#define DATAGRAM 1400
+#define BATCH 64 // ASTERIX_MAX_BATCH
+
+// CAT021 edition 2.4 FRNs of the items the feeder sends
+static const struct {
+    unsigned frn;
+    const char *id;
+    unsigned length;
+} spec[] = {
+    {1, "I021/010", 2}, {4, "I021/015", 1}, {7, "I021/131", 8}, {10, "I021/151", 2},
+    {11, "I021/080", 3}, {16, "I021/140", 2}, {21, "I021/145", 2}, {22, "I021/152", 2},
+    {29, "I021/170", 6},
+};
+
+struct aircraft {
+    unsigned char addr[3];
+    char callsign[9];
+    int has_callsign, has_height, has_position, has_heading, has_tas;
+    short height;
+    int flevel;
+    double lat, lon;
+    float heading;
+    short tas;
+};
+
+/*
+ * The old encoder, as it was in airnav_asterix.c (less logging, and with
+ * the per-item buffers freed: the original leaked them)
+ */
+
+#define MAX_CAT21_ITEMS 100
+#define MAX_CAT21_FSPEC_BYTES 10
+
+struct asterixItemDef {
+    char id[10];
+    unsigned int size;
+    unsigned short in_use;
+    unsigned char *data;
+};
+
+struct fspecByteDef {
+    unsigned char fspec_byte;
+    unsigned char fspec_byte_inuse;
+};
+
+struct asterixPacketDef_cat21 {
+    unsigned int p_size;
+    struct fspecByteDef fspec_byte[MAX_CAT21_FSPEC_BYTES];
+    struct asterixItemDef fields[MAX_CAT21_ITEMS];
+};
+
+static struct asterixItemDef cat21items[MAX_CAT21_ITEMS];
+
+static void old_set_bit(unsigned char *number, unsigned int position)
+{
+    *number |= (char) 1 << position;
+}
+
+static int old_get_bit(char bit, char byte)
+{
+    return ((byte >> bit) & 0x01);
+}
+
+static int old_getItemIdx(struct asterixItemDef *toc, const char *item_id, int max_items)
+{
+    for (int i = 0; i < max_items; i++) {
+        if (strcmp(item_id, toc[i].id) == 0)
+            return i;
+    }
+    return -1;
+}
+
+static struct asterixPacketDef_cat21 *old_prepare(int max_fspec_bytes, int max_items)
+{
+    struct asterixPacketDef_cat21 *res = malloc(sizeof(struct asterixPacketDef_cat21));
+
+    res->p_size = 0;
+    for (int i = 0; i < max_fspec_bytes; i++) {
+        res->fspec_byte[i].fspec_byte = 0;
+        res->fspec_byte[i].fspec_byte_inuse = 0;
+    }
+    for (int i = 0; i < max_items; i++) {
+        res->fields[i].in_use = 0;
+        res->fields[i].size = 0;
+        res->fields[i].data = NULL;
+    }
+    return res;
+}
+
+static unsigned int old_map2bit(unsigned int item)
+{
+    return item >= 1 && item <= 8 ? 8 - item : 0;
+}
+
+static void old_set_frn_inuse(struct asterixPacketDef_cat21 *packet, unsigned int frn)
+{
+    int b_number = frn / 7;
+    if ((frn % 7) > 0)
+        b_number++;
+
+    old_set_bit(&packet->fspec_byte[b_number - 1].fspec_byte, old_map2bit(frn - ((b_number - 1) * 7)));
+    packet->fspec_byte[b_number - 1].fspec_byte_inuse = 1;
+    for (int i = 0; i < b_number - 1; i++) {
+        old_set_bit(&packet->fspec_byte[i].fspec_byte, 0);
+        packet->fspec_byte[i].fspec_byte_inuse = 1;
+    }
+}
+
+static unsigned char *old_item(struct asterixPacketDef_cat21 *packet, const char *id)
+{
+    int idx = old_getItemIdx(cat21items, id, MAX_CAT21_ITEMS);
+    if (idx < 0)
+        return NULL;
+    old_set_frn_inuse(packet, idx);
+    packet->fields[idx].in_use = 1;
+    packet->fields[idx].size = cat21items[idx].size;
+    packet->fields[idx].data = malloc(cat21items[idx].size);
+    return packet->fields[idx].data;
+}
+
+static void old_fill(struct asterixPacketDef_cat21 *packet, const struct aircraft *a)
+{
+    unsigned char *d;
+
+    d = old_item(packet, "I021/010");
+    d[0] = 1;
+    d[1] = 2;
+    d = old_item(packet, "I021/015");
+    d[0] = 3;
+
+    d = old_item(packet, "I021/080");
+    memcpy(d, a->addr, 3);
+
+    if (a->has_callsign) {
+        d = old_item(packet, "I021/170");
+        memset(d, 0, 6);
+        int idx_byte = 0, idx_bit = 7;
+        for (int i = 0; i < 8; i++) {
+            for (int b = 5; b >= 0; b--) {
+                if (old_get_bit(b, a->callsign[i]) == 1)
+                    old_set_bit(&d[idx_byte], idx_bit);
+                if (idx_bit == 0) {
+                    idx_bit = 7;
+                    idx_byte++;
+                } else {
+                    idx_bit--;
+                }
+            }
+        }
+    }
+    if (a->has_height) {
+        d = old_item(packet, "I021/140");
+        short temp = (a->height / 6.25);
+        d[1] = temp & 0xff;
+        d[0] = (temp >> 8) & 0xff;
+
+        d = old_item(packet, "I021/145");
+        short temp2 = (short) ((float) a->flevel / 0.25);
+        d[1] = temp2 & 0xff;
+        d[0] = (temp2 >> 8) & 0xff;
+    }
+    if (a->has_position) {
+        d = old_item(packet, "I021/131");
+        const float weight = 180. / (1 << 30);
+        long fp_lat = (int) (0.5f + a->lat / weight);
+        long fp_lon = (int) (0.5f + a->lon / weight);
+        d[0] = (fp_lat >> 24) & 0xff;
+        d[1] = (fp_lat >> 16) & 0xff;
+        d[2] = (fp_lat >> 8) & 0xff;
+        d[3] = (fp_lat) & 0xff;
+        d[4] = (fp_lon >> 24) & 0xff;
+        d[5] = (fp_lon >> 16) & 0xff;
+        d[6] = (fp_lon >> 8) & 0xff;
+        d[7] = (fp_lon) & 0xff;
+    }
+    if (a->has_heading) {
+        d = old_item(packet, "I021/152");
+        int temp = (a->heading * (float) 65536.0) / (float) 360.0;
+        d[1] = temp & 0xff;
+        d[0] = (temp >> 8) & 0xff;
+    }
+    if (a->has_tas) {
+        d = old_item(packet, "I021/151");
+        d[1] = a->tas & 0xff;
+        d[0] = (a->tas >> 8) & 0x7f;
+    }
+}
+
+// Returns the datagram; *len is its length
+static char *old_send(struct asterixPacketDef_cat21 *packet, int *len)
+{
+    unsigned int data_size = 0;
+    unsigned int fspec_size = 0;
+
+    for (int i = 0; i < MAX_CAT21_ITEMS; i++) {
+        if (packet->fields[i].in_use == 1)
+            data_size = data_size + packet->fields[i].size;
+    }
+    for (int i = 0; i < MAX_CAT21_FSPEC_BYTES; i++) {
+        if (packet->fspec_byte[i].fspec_byte_inuse == 1)
+            fspec_size++;
+    }
+
+    int datalen = 3 + (data_size + fspec_size);
+    char *data_out = malloc(datalen);
+    data_out[0] = 21;
+    data_out[1] = 0;
+    data_out[2] = datalen;
+
+    int cur_idx = 3;
+    for (int i = 0; i < MAX_CAT21_FSPEC_BYTES; i++) {
+        if (packet->fspec_byte[i].fspec_byte_inuse == 1)
+            data_out[cur_idx++] = packet->fspec_byte[i].fspec_byte;
+    }
+    for (int i = 0; i < MAX_CAT21_ITEMS; i++) {
+        if (packet->fields[i].in_use == 1) {
+            for (unsigned int x = 0; x < packet->fields[i].size; x++)
+                data_out[cur_idx++] = packet->fields[i].data[x];
+            free(packet->fields[i].data);
+        }
+    }
+
+    free(packet);
+    *len = datalen;
+    return data_out;
+}
+
+/*
+ * The new encoder
+ */
+
+static void new_fill(struct cat21_record *rec, const struct aircraft *a)
+{
+    cat021_setDataSourceSACSIC(rec, 1, 2);
+    cat021_setServiceId(rec, 3);
+    cat021_setTargetAddress(rec, a->addr);
+    if (a->has_callsign)
+        cat021_setTargetId(rec, a->callsign);
+    if (a->has_height) {
+        cat021_setGeometricHeight(rec, a->height);
+        cat021_setFlightLevel(rec, a->flevel);
+    }
+    if (a->has_position)
+        cat021_setPosWGS84Precision(rec, a->lat, a->lon);
+    if (a->has_heading)
+        cat021_setMagneticHeading(rec, a->heading);
+    if (a->has_tas)
+        cat021_setTrueAirSpeed(rec, 0, a->tas);
+}
+
+static double now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void make_aircraft(struct aircraft *aircraft)
+{
+    static const char chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+
+    for (unsigned i = 0; i < AIRCRAFT; ++i) {
+        struct aircraft *a = &aircraft[i];
+        memset(a, 0, sizeof(*a));
+        for (int k = 0; k < 3; ++k)
+            a->addr[k] = rand();
+        for (int k = 0; k < 8; ++k)
+            a->callsign[k] = k < 3 ? 'A' + rand() % 26 : chars[rand() % 36];
+        // Most aircraft have something new in every sweep, some everything
+        a->has_callsign = rand() % 4 == 0;
+        a->has_height = rand() % 4 != 0;
+        a->has_position = rand() % 4 != 0;
+        a->has_heading = rand() % 3 == 0;
+        a->has_tas = rand() % 3 == 0;
+        a->height = rand() % 400;
+        a->flevel = 1 + rand() % 400;
+        a->lat = 40.0 + (rand() % 20000) / 1000.0;
+        a->lon = -10.0 + (rand() % 20000) / 1000.0;
+        a->heading = (rand() % 3600) / 10.0f;
+        a->tas = rand() % 500;
+    }
+}
+
+// Both encoders must write the same record for every aircraft
+static int verify(const struct aircraft *aircraft, const struct cat21_uap *uap)
+{
+    for (unsigned i = 0; i < AIRCRAFT; ++i) {
+        struct cat21_record rec;
+        uint8_t out[CAT21_MAX_RECORD_SIZE];
+        int old_len;
+
+        cat21_recordInit(&rec, uap);
+        new_fill(&rec, &aircraft[i]);
+        size_t len = cat21_recordEncode(&rec, out);
+
+        struct asterixPacketDef_cat21 *packet = old_prepare(MAX_CAT21_FSPEC_BYTES, MAX_CAT21_ITEMS);
+        old_fill(packet, &aircraft[i]);
+        char *old = old_send(packet, &old_len);
+        int same = (size_t) old_len == len + 3 && !memcmp(old + 3, out, len);
+        free(old);
+
+        if (!same) {
+            fprintf(stderr, "aircraft %u: the encoders disagree\n", i);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void run(const char *name, const struct aircraft *aircraft, const struct cat21_uap *uap, int old, int fd, const struct sockaddr_in *to)
+{
+    struct cat21_block blk;
+    unsigned datagrams = 0;
+    unsigned long bytes = 0;
+
+    cat21_blockInit(&blk, DATAGRAM);
+
+    double start = now_s();
+    for (unsigned round = 0; round < ROUNDS; ++round) {
+        for (unsigned i = 0; i < AIRCRAFT; ++i) {
+            if (old) {
+                struct asterixPacketDef_cat21 *packet = old_prepare(MAX_CAT21_FSPEC_BYTES, MAX_CAT21_ITEMS);
+                int len;
+                old_fill(packet, &aircraft[i]);
+                char *out = old_send(packet, &len);
+                if (fd >= 0)
+                    sendto(fd, out, len, 0, (const struct sockaddr *) to, sizeof(*to));
+                free(out);
+                ++datagrams;
+                bytes += len;
+            } else {
+                struct cat21_record rec;
+                cat21_recordInit(&rec, uap);
+                new_fill(&rec, &aircraft[i]);
+                if (!cat21_blockAdd(&blk, &rec)) {
+                    size_t len = cat21_blockFinish(&blk);
+                    if (fd >= 0)
+                        sendto(fd, blk.buf, len, 0, (const struct sockaddr *) to, sizeof(*to));
+                    ++datagrams;
+                    bytes += len;
+                    cat21_blockReset(&blk);
+                    cat21_blockAdd(&blk, &rec);
+                }
+            }
+        }
+
+        // End of the sweep
+        if (!old) {
+            size_t len = cat21_blockFinish(&blk);
+            if (fd >= 0)
+                sendto(fd, blk.buf, len, 0, (const struct sockaddr *) to, sizeof(*to));
+            ++datagrams;
+            bytes += len;
+            cat21_blockReset(&blk);
+        }
+    }
+    double elapsed = now_s() - start;
+
+    fprintf(stderr, "  %-32s %6.2fM records/second, %u datagrams per sweep, %lu bytes per sweep\n",
+            name, (double) AIRCRAFT * ROUNDS / elapsed / 1e6, datagrams / ROUNDS, bytes / ROUNDS);
+    cat21_blockDestroy(&blk);
+}
+
+// As airnav_asterix.c: fill a batch of datagrams over the sweep, then
+// hand them all to the kernel at once
+static void run_batched(const char *name, const struct aircraft *aircraft, const struct cat21_uap *uap, int fd, const struct sockaddr_in *to)
+{
+    struct cat21_block blk[BATCH];
+    struct mmsghdr msgs[BATCH];
+    struct iovec iov[BATCH];
+    unsigned datagrams = 0, calls = 0;
+    unsigned long bytes = 0;
+
+    for (unsigned i = 0; i < BATCH; ++i)
+        cat21_blockInit(&blk[i], DATAGRAM);
+
+    double start = now_s();
+    for (unsigned round = 0; round < ROUNDS; ++round) {
+        unsigned cur = 0;
+        for (unsigned i = 0; i < AIRCRAFT; ++i) {
+            struct cat21_record rec;
+            cat21_recordInit(&rec, uap);
+            new_fill(&rec, &aircraft[i]);
+            if (!cat21_blockAdd(&blk[cur], &rec)) {
+                if (++cur == BATCH) {
+                    fprintf(stderr, "batch too small\n");
+                    exit(1);
+                }
+                cat21_blockAdd(&blk[cur], &rec);
+            }
+        }
+
+        // End of the sweep
+        memset(msgs, 0, sizeof(msgs));
+        for (unsigned i = 0; i <= cur; ++i) {
+            iov[i].iov_base = blk[i].buf;
+            iov[i].iov_len = cat21_blockFinish(&blk[i]);
+            msgs[i].msg_hdr.msg_name = (void *) to;
+            msgs[i].msg_hdr.msg_namelen = sizeof(*to);
+            msgs[i].msg_hdr.msg_iov = &iov[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+            bytes += iov[i].iov_len;
+            cat21_blockReset(&blk[i]);
+        }
+        datagrams += cur + 1;
+        for (unsigned sent = 0; sent <= cur; ) {
+            int n = sendmmsg(fd, msgs + sent, cur + 1 - sent, 0);
+            ++calls;
+            if (n <= 0) {
+                perror("sendmmsg");
+                exit(1);
+            }
+            sent += n;
+        }
+    }
+    double elapsed = now_s() - start;
+
+    fprintf(stderr, "  %-32s %6.2fM records/second, %u datagrams per sweep, %lu bytes per sweep, %u syscalls per sweep\n",
+            name, (double) AIRCRAFT * ROUNDS / elapsed / 1e6, datagrams / ROUNDS, bytes / ROUNDS, calls / ROUNDS);
+    for (unsigned i = 0; i < BATCH; ++i)
+        cat21_blockDestroy(&blk[i]);
+}
+
+int main(void)
+{
+    struct aircraft *aircraft = malloc(AIRCRAFT * sizeof(*aircraft));
+    struct cat21_uap uap;
+
+    srand(1);
+    make_aircraft(aircraft);
+
+    // The old item table was indexed by FRN
+    cat21_uapReset(&uap);
+    for (unsigned i = 0; i < sizeof(spec) / sizeof(spec[0]); ++i) {
+        cat21_uapAddItem(&uap, spec[i].id, spec[i].frn, spec[i].length);
+        snprintf(cat21items[spec[i].frn].id, sizeof(cat21items[spec[i].frn].id), "%s", spec[i].id);
+        cat21items[spec[i].frn].size = spec[i].length;
+    }
+    cat21_uapCompile(&uap);
+
+    if (!verify(aircraft, &uap))
+        return 1;
+
+    // A receiver that never reads: the kernel drops what does not fit
+    int rx = socket(AF_INET, SOCK_DGRAM, 0);
+    int tx = socket(AF_INET, SOCK_DGRAM, 0);
+    struct sockaddr_in to;
+    socklen_t to_len = sizeof(to);
+    memset(&to, 0, sizeof(to));
+    to.sin_family = AF_INET;
+    to.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (rx < 0 || tx < 0 || bind(rx, (struct sockaddr *) &to, sizeof(to)) < 0 || getsockname(rx, (struct sockaddr *) &to, &to_len) < 0) {
+        perror("socket");
+        return 1;
+    }
+
+    fprintf(stderr, "Benchmarking: CAT021, %u aircraft per sweep ...\n", AIRCRAFT);
+    run("old encoder, encode only", aircraft, &uap, 1, -1, NULL);
+    run("airnav_cat21.c, encode only", aircraft, &uap, 0, -1, NULL);
+    run("old encoder, encode + send", aircraft, &uap, 1, tx, &to);
+    run("airnav_cat21.c, encode + send", aircraft, &uap, 0, tx, &to);
+    run_batched("airnav_cat21.c, encode + sendmmsg", aircraft, &uap, tx, &to);
+
+    close(rx);
+    close(tx);
+    free(aircraft);
+    return 0;
+}
@@ -0,0 +1,152 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// fifo_benchmark.c: benchmark for the SDR to demodulator FIFO
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "../fifo.h"
+#include "../util.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <stdatomic.h>
+#include <time.h>
+
+// A reader thread pushes buffers through the FIFO as fast as the
+// demodulator thread takes them, the way an SDR callback does at a high
+// sample rate (small buffers, so FIFO overhead is a large share of the
+// work). Reports buffers per second and how long the reader thread spends
+// inside fifo_acquire + fifo_enqueue per buffer: the reader must never
+// stall, or the SDR drops samples.
+
+// Sample results, x86-64, 1 CPU (so the reader and demodulator threads
+// share a core and every handoff goes through a wakeup), 12 buffers of
+// 4096 samples:
+//
+//                          mutex/condvar    lock-free SPSC
+//   buffers/second:           0.10M             0.23M
+//   reader ns/buffer, mean:   5600              2700
+//   reader ns/buffer, p99:    8500              4700
+//
+// The max is not listed: on one core it is whatever scheduler timeslice
+// the reader was preempted for (a few ms either way).
+
+#define BUFFERS 12
+#define BUFFER_SAMPLES 4096
+#define OVERLAP 326
+#define RUN_SECONDS 2
+
+static atomic_bool done;
+static unsigned dropped;
+static uint64_t *latencies;
+static unsigned latency_count;
+static unsigned latency_alloc;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void *readerEntryPoint(void *arg)
+{
+    (void) arg;
+    uint64_t sampleCounter = 0;
+
+    while (!atomic_load(&done)) {
+        uint64_t start = now_ns();
+        struct mag_buf *buf = fifo_acquire(0 /* don't wait, like the SDR callbacks */);
+        if (!buf) {
+            ++dropped; // the SDR would drop this block
+            continue;
+        }
+
+        buf->sampleTimestamp = sampleCounter * 5;
+        buf->validLength = buf->overlap + BUFFER_SAMPLES;
+        buf->data[buf->overlap] = (uint16_t) sampleCounter;
+        fifo_enqueue(buf);
+        uint64_t end = now_ns();
+
+        if (latency_count < latency_alloc)
+            latencies[latency_count++] = end - start;
+        sampleCounter += BUFFER_SAMPLES;
+    }
+
+    fifo_halt();
+    return NULL;
+}
+
+static int compare_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *) a, y = *(const uint64_t *) b;
+    return (x > y) - (x < y);
+}
+
+int main(void)
+{
+    if (!fifo_create(BUFFERS, BUFFER_SAMPLES + OVERLAP, OVERLAP)) {
+        fprintf(stderr, "fifo_create failed\n");
+        return 1;
+    }
+
+    latency_alloc = 50000000;
+    if (!(latencies = malloc(latency_alloc * sizeof(*latencies)))) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    fprintf(stderr, "Benchmarking: fifo, %u buffers of %u samples ...\n", BUFFERS, BUFFER_SAMPLES);
+
+    pthread_t reader;
+    pthread_create(&reader, NULL, readerEntryPoint, NULL);
+
+    uint64_t start = now_ns();
+    unsigned buffers = 0;
+    uint32_t check = 0;
+    while (now_ns() - start < RUN_SECONDS * 1000000000ULL) {
+        struct mag_buf *buf = fifo_dequeue(100 /* milliseconds */);
+        if (!buf)
+            continue;
+        check += buf->data[buf->overlap];
+        fifo_release(buf);
+        ++buffers;
+    }
+    uint64_t elapsed = now_ns() - start;
+
+    atomic_store(&done, true);
+    // keep consuming until the reader notices, so it is never stuck
+    struct mag_buf *buf;
+    while ((buf = fifo_dequeue(10)) != NULL)
+        fifo_release(buf);
+    pthread_join(reader, NULL);
+    fifo_destroy();
+
+    qsort(latencies, latency_count, sizeof(*latencies), compare_u64);
+    uint64_t sum = 0;
+    for (unsigned i = 0; i < latency_count; ++i)
+        sum += latencies[i];
+
+    fprintf(stderr, "  %u buffers in %.3f seconds (check %08x)\n", buffers, elapsed / 1e9, check);
+    fprintf(stderr, "  %.2fM buffers/second, %u failed acquires\n", buffers / (elapsed / 1e9) / 1e6, dropped);
+    if (latency_count) {
+        fprintf(stderr, "  reader ns/buffer: mean %.0f, p99 %" PRIu64 ", max %" PRIu64 "\n",
+                (double) sum / latency_count, latencies[latency_count * 99 / 100], latencies[latency_count - 1]);
+    }
+
+    free(latencies);
+    return 0;
+}
@@ -0,0 +1,229 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// flightpacket_benchmark.c: benchmark for FlightPacket encoding
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "../dump1090.h"
+#include "../rbfeeder.pb-c.h"
+#include "../airnav_flightenc.h"
+
+// Encodes batches of flights the way sendMultipleFlights() used to (a
+// malloc'd FlightData per flight, strdup'd callsigns, get_packed_size,
+// malloc'd output, pack) and with the airnav_flightenc.c encoder, and
+// checks that both produce the same bytes.
+
+#define FLIGHTS_PER_ROUND 1000000
+
+static struct p_data *make_flights(unsigned count)
+{
+    struct p_data *flights = calloc(count, sizeof(struct p_data));
+
+    for (unsigned i = 0; i < count; ++i) {
+        struct p_data *p = &flights[i];
+
+        p->modes_addr = rand() & 0xFFFFFF;
+        p->fields = PDATA_MODES_ADDR;
+
+        // A typical mix: most flights have a position and kinematics,
+        // some have a callsign / squawk / quality fields this time round
+        if (rand() % 4) {
+            p->lat = 40.0 + (rand() % 20000) / 1000.0;
+            p->lon = -10.0 + (rand() % 20000) / 1000.0;
+            p->altitude = rand() % 40000;
+            p->heading = rand() % 36;
+            p->gnd_speed = rand() % 60;
+            p->vert_rate = (rand() % 80) - 40;
+            p->airborne = 1;
+            p->fields |= PDATA_POSITION | PDATA_ALTITUDE | PDATA_HEADING | PDATA_GND_SPEED | PDATA_VERT_RATE | PDATA_AIRBORNE;
+        }
+        if (rand() % 3 == 0) {
+            snprintf(p->callsign, sizeof(p->callsign), "ABC%04d", rand() % 10000);
+            p->squawk = rand() & 0x7777;
+            p->fields |= PDATA_CALLSIGN | PDATA_SQUAWK;
+        }
+        if (rand() % 5 == 0) {
+            p->pos_nic = 8;
+            p->nic_baro = 1;
+            p->nac_p = 9;
+            p->nac_v = 1;
+            p->sil = 3;
+            p->sil_type = 2;
+            p->fields |= PDATA_POS_NIC | PDATA_NIC_BARO | PDATA_NAC_P | PDATA_NAC_V | PDATA_SIL | PDATA_SIL_TYPE;
+        }
+    }
+
+    return flights;
+}
+
+// The old path, minus the network send
+static uint8_t *encode_protobuf_c(const struct p_data *flights, unsigned count, size_t *len)
+{
+    FlightPacket fpacket = FLIGHT_PACKET__INIT;
+    FlightData **subs = malloc(sizeof(FlightData *) * count);
+
+    for (unsigned i = 0; i < count; ++i) {
+        const struct p_data *p = &flights[i];
+
+        subs[i] = malloc(sizeof(FlightData));
+        flight_data__init(subs[i]);
+        subs[i]->addr = p->modes_addr;
+        if (p->fields & PDATA_CALLSIGN)
+            subs[i]->callsign = strdup(p->callsign);
+        if (p->fields & PDATA_ALTITUDE) {
+            subs[i]->altitude = p->altitude;
+            subs[i]->has_altitude = 1;
+        }
+        if (p->fields & PDATA_POSITION) {
+            subs[i]->latitude = p->lat;
+            subs[i]->longitude = p->lon;
+            subs[i]->has_latitude = 1;
+            subs[i]->has_longitude = 1;
+        }
+        if (p->fields & PDATA_HEADING) {
+            subs[i]->heading = p->heading;
+            subs[i]->has_heading = 1;
+        }
+        if (p->fields & PDATA_GND_SPEED) {
+            subs[i]->gnd_speed = p->gnd_speed;
+            subs[i]->has_gnd_speed = 1;
+        }
+        if (p->fields & PDATA_VERT_RATE) {
+            subs[i]->vert_rate = p->vert_rate;
+            subs[i]->has_vert_rate = 1;
+        }
+        if (p->fields & PDATA_SQUAWK) {
+            subs[i]->squawk = p->squawk;
+            subs[i]->has_squawk = 1;
+        }
+        if (p->fields & PDATA_AIRBORNE) {
+            subs[i]->airborne = p->airborne;
+            subs[i]->has_airborne = 1;
+        }
+        if (p->fields & PDATA_POS_NIC) {
+            subs[i]->pos_nic = p->pos_nic;
+            subs[i]->has_pos_nic = 1;
+        }
+        if (p->fields & PDATA_NIC_BARO) {
+            subs[i]->nic_baro = p->nic_baro;
+            subs[i]->has_nic_baro = 1;
+        }
+        if (p->fields & PDATA_NAC_P) {
+            subs[i]->nac_p = p->nac_p;
+            subs[i]->has_nac_p = 1;
+        }
+        if (p->fields & PDATA_NAC_V) {
+            subs[i]->nac_v = p->nac_v;
+            subs[i]->has_nac_v = 1;
+        }
+        if (p->fields & PDATA_SIL) {
+            subs[i]->sil = p->sil;
+            subs[i]->has_sil = 1;
+        }
+        if (p->fields & PDATA_SIL_TYPE) {
+            subs[i]->sil_type = p->sil_type;
+            subs[i]->has_sil_type = 1;
+        }
+    }
+
+    fpacket.n_fdata = count;
+    fpacket.fdata = subs;
+
+    *len = flight_packet__get_packed_size(&fpacket);
+    uint8_t *buf = malloc(*len);
+    flight_packet__pack(&fpacket, buf);
+
+    for (unsigned i = 0; i < count; ++i) {
+        free(subs[i]->callsign);
+        free(subs[i]);
+    }
+    free(subs);
+
+    return buf;
+}
+
+static void test(unsigned count)
+{
+    struct p_data *flights = make_flights(count);
+    struct flightenc enc;
+    size_t len;
+
+    memset(&enc, 0, sizeof(enc));
+
+    // Check both encoders agree before timing them
+    uint8_t *expected = encode_protobuf_c(flights, count, &len);
+    flightenc_reset(&enc);
+    for (unsigned i = 0; i < count; ++i)
+        flightenc_addFlight(&enc, &flights[i]);
+    if (enc.len != len || memcmp(enc.buf, expected, len))
+        fprintf(stderr, "  FAIL: encoders disagree for %u flights (%zu vs %zu bytes)\n", count, enc.len, len);
+    free(expected);
+
+    fprintf(stderr, "Benchmarking: %u flights per batch, %zu bytes\n", count, len);
+
+    unsigned batches = FLIGHTS_PER_ROUND / count;
+    struct timespec total;
+    double nanos;
+    int rounds;
+
+    fprintf(stderr, "  protobuf-c ");
+    total.tv_sec = total.tv_nsec = 0;
+    rounds = 0;
+    while (total.tv_sec < 2) {
+        fprintf(stderr, ".");
+        struct timespec start;
+        start_cpu_timing(&start);
+        for (unsigned b = 0; b < batches; ++b)
+            free(encode_protobuf_c(flights, count, &len));
+        end_cpu_timing(&start, &total);
+        rounds++;
+    }
+    nanos = total.tv_sec * 1e9 + total.tv_nsec;
+    fprintf(stderr, " %.1f ns/flight\n", nanos / ((double) rounds * batches * count));
+
+    fprintf(stderr, "  flightenc  ");
+    total.tv_sec = total.tv_nsec = 0;
+    rounds = 0;
+    while (total.tv_sec < 2) {
+        fprintf(stderr, ".");
+        struct timespec start;
+        start_cpu_timing(&start);
+        for (unsigned b = 0; b < batches; ++b) {
+            flightenc_reset(&enc);
+            for (unsigned i = 0; i < count; ++i)
+                flightenc_addFlight(&enc, &flights[i]);
+        }
+        end_cpu_timing(&start, &total);
+        rounds++;
+    }
+    nanos = total.tv_sec * 1e9 + total.tv_nsec;
+    fprintf(stderr, " %.1f ns/flight\n", nanos / ((double) rounds * batches * count));
+
+    flightenc_destroy(&enc);
+    free(flights);
+}
+
+int main(int argc, char **argv)
+{
+    MODES_NOTUSED(argc);
+    MODES_NOTUSED(argv);
+
+    srand(1);
+
+    test(50);
+    test(500);
+    test(2000);
+
+    return 0;
+}
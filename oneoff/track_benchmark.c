@@ -0,0 +1,139 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// track_benchmark.c: benchmark for aircraft lookup in trackUpdateFromMessage
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "../dump1090.h"
+
+struct _Modes Modes;
+
+// Feeds DF11 messages for a fixed population of aircraft through
+// trackUpdateFromMessage() and reports the cost per message. With the
+// address index this should stay flat as the population grows; with a
+// linear scan of Modes.aircrafts it grows with the number of tracks.
+// (What growth remains comes from the aircraft structures themselves
+// falling out of cache.)
+
+// Sample results, x86-64 @ ~3GHz:
+//
+//                  linear scan     address index
+//   10 aircraft:      39.6 ns          36.0 ns
+//   100 aircraft:    134.2 ns          41.8 ns
+//   1000 aircraft:  2063.3 ns          56.8 ns
+//   5000 aircraft: 17201.0 ns          77.0 ns
+
+#define MESSAGES_PER_ROUND 1000000
+
+static uint32_t *make_addresses(unsigned count)
+{
+    uint32_t *addrs = calloc(count, sizeof(uint32_t));
+    for (unsigned i = 0; i < count; ++i) {
+        uint32_t addr;
+        unsigned j;
+        do {
+            addr = (uint32_t) rand() & 0xFFFFFF;
+            for (j = 0; j < i && addrs[j] != addr; ++j)
+                ;
+        } while (addr == 0 || j < i);
+        addrs[i] = addr;
+    }
+    return addrs;
+}
+
+static unsigned count_aircraft()
+{
+    unsigned n = 0;
+    for (struct aircraft *a = Modes.aircrafts; a; a = a->next)
+        ++n;
+    return n;
+}
+
+static void test(unsigned count)
+{
+    fprintf(stderr, "Benchmarking: %u aircraft ", count);
+
+    uint32_t *addrs = make_addresses(count);
+    struct modesMessage mm;
+
+    memset(&mm, 0, sizeof(mm));
+    mm.msgtype = 11;
+    mm.addrtype = ADDR_ADSB_ICAO;
+    mm.source = SOURCE_MODE_S_CHECKED;
+    mm.reliable = 1;
+
+    // Create the population
+    for (unsigned i = 0; i < count; ++i) {
+        mm.addr = addrs[i];
+        mm.sysTimestampMsg = 1;
+        trackUpdateFromMessage(&mm);
+    }
+
+    struct timespec total = { 0, 0 };
+    int rounds = 0;
+    unsigned next = 0;
+
+    while (total.tv_sec < 2) {
+        fprintf(stderr, ".");
+
+        struct timespec start;
+        start_cpu_timing(&start);
+
+        for (unsigned i = 0; i < MESSAGES_PER_ROUND; ++i) {
+            next = (next + 7919) % count;
+            mm.addr = addrs[next];
+            mm.sysTimestampMsg = 2;
+            trackUpdateFromMessage(&mm);
+        }
+
+        end_cpu_timing(&start, &total);
+        rounds++;
+    }
+
+    fprintf(stderr, "\n");
+
+    unsigned tracked = count_aircraft();
+    if (tracked != count)
+        fprintf(stderr, "  FAIL: %u aircraft tracked, expected %u\n", tracked, count);
+
+    double messages = (double) rounds * MESSAGES_PER_ROUND;
+    double nanos = total.tv_sec * 1e9 + total.tv_nsec;
+    fprintf(stderr, "  %.2fM messages in %.6f seconds\n", messages / 1e6, nanos / 1e9);
+    fprintf(stderr, "  %.1f ns/message\n", nanos / messages);
+
+    // Expire everything (message timestamps are far in the past relative
+    // to mstime()) so the next population starts from empty; this also
+    // exercises removal from the index.
+    trackPeriodicUpdate();
+    tracked = count_aircraft();
+    if (tracked != 0)
+        fprintf(stderr, "  FAIL: %u aircraft left after expiry\n", tracked);
+
+    free(addrs);
+}
+
+int main(int argc, char **argv)
+{
+    MODES_NOTUSED(argc);
+    MODES_NOTUSED(argv);
+
+    srand(1);
+
+    test(10);
+    test(100);
+    test(1000);
+    test(5000);
+
+    return 0;
+}
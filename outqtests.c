@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2020 - AirNav Systems
+ * 
+ * https://www.radarbox.com
+ * 
+ * More info: https://github.com/AirNav-Systems/rbfeeder
+ * 
+ */
+
+// outqtests.c - tests for the framed output queue (airnav_outq.c)
+//
+// The "server" end of a socketpair with a small send buffer is read
+// slowly, in odd-sized chunks, while frames keep being sent. Whatever
+// the sender reports as sent must arrive complete and in order; whatever
+// it reports as dropped must not appear at all. The same goes for
+// self-framed messages (ANRB lines) sent with outq_send().
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+#include "airnav_outq.h"
+
+#define FRAMES 5000
+#define QUEUE_SIZE (128 * 1024)
+
+static const char start[2] = {'~', '#'};
+
+static int failures = 0;
+
+#define CHECK(cond, ...) do {                             \
+        if (!(cond)) {                                   \
+            fprintf(stderr, "FAIL: " __VA_ARGS__);       \
+            fprintf(stderr, "\n");                       \
+            ++failures;                                  \
+        }                                                \
+    } while (0)
+
+// Payload for frame n: length and contents both derived from n
+static size_t make_payload(unsigned n, unsigned char *buf) {
+    size_t len = (n * 7919u) % 3000;
+    for (size_t i = 0; i < len; ++i)
+        buf[i] = (unsigned char) (n + i);
+    return len;
+}
+
+// Receiving side: reassembles the stream and checks each frame against
+// the list of frames the sender accepted.
+struct receiver {
+    unsigned char buf[OUTQ_HEADER_SIZE + OUTQ_MAX_PAYLOAD];
+    size_t have;
+    unsigned next; // index into accepted[]
+};
+
+static unsigned accepted[FRAMES];
+static unsigned accepted_count;
+
+static void parse(struct receiver *r) {
+    unsigned char expect[OUTQ_MAX_PAYLOAD];
+
+    for (;;) {
+        if (r->have < OUTQ_HEADER_SIZE)
+            return;
+
+        size_t size = ((size_t) r->buf[2] << 8) | r->buf[3];
+        size_t frame = 4 + size;
+        if (r->have < frame)
+            return;
+
+        CHECK(r->buf[0] == (unsigned char) start[0] && r->buf[1] == (unsigned char) start[1], "bad start of TX at frame %u", r->next);
+        CHECK(r->next < accepted_count, "more frames received than sent");
+        if (failures)
+            exit(1);
+
+        unsigned n = accepted[r->next++];
+        size_t len = make_payload(n, expect);
+        CHECK(size == len + 1, "frame %u: size %zu, expected %zu", n, size - 1, len);
+        CHECK(r->buf[4] == (unsigned char) (n & 0x7f), "frame %u: wrong type", n);
+        CHECK(size != len + 1 || !memcmp(r->buf + 5, expect, len), "frame %u: payload corrupted", n);
+        if (failures)
+            exit(1);
+
+        memmove(r->buf, r->buf + frame, r->have - frame);
+        r->have -= frame;
+    }
+}
+
+// Read at most max bytes, like a server that is falling behind
+static void slow_read(int fd, struct receiver *r, size_t max) {
+    ssize_t n = read(fd, r->buf + r->have, max);
+    if (n > 0) {
+        r->have += n;
+        parse(r);
+    }
+}
+
+static void test_slow_server(void) {
+    int sv[2];
+    struct outq q;
+    struct receiver *r = calloc(1, sizeof(*r));
+    unsigned char payload[OUTQ_MAX_PAYLOAD];
+    unsigned dropped = 0;
+
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) < 0) {
+        perror("socketpair");
+        exit(1);
+    }
+
+    int sndbuf = 4096;
+    setsockopt(sv[0], SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf));
+    fcntl(sv[1], F_SETFL, O_NONBLOCK);
+
+    CHECK(outq_init(&q, QUEUE_SIZE), "outq_init failed");
+
+    for (unsigned n = 0; n < FRAMES; ++n) {
+        size_t len = make_payload(n, payload);
+        int ret = outq_sendFrame(&q, sv[0], start, (char) (n & 0x7f), payload, len);
+
+        CHECK(ret >= 0, "frame %u: socket error", n);
+        if (ret == 1)
+            accepted[accepted_count++] = n;
+        else
+            ++dropped;
+
+        // The server only keeps up some of the time
+        if (n % 3 == 0)
+            slow_read(sv[1], r, 1 + (n * 31) % 5000);
+        if (n % 50 == 0)
+            outq_flush(&q, sv[0]);
+    }
+
+    // Let the server catch up and drain everything that is left
+    while (q.len > 0 || r->next < accepted_count) {
+        int ret = outq_flush(&q, sv[0]);
+        CHECK(ret >= 0, "flush: socket error");
+        if (ret < 0)
+            break;
+        slow_read(sv[1], r, 8192);
+    }
+
+    CHECK(r->next == accepted_count, "received %u frames, expected %u", r->next, accepted_count);
+    CHECK(r->have == 0, "%zu trailing bytes after the last frame", r->have);
+    CHECK(q.frames_sent == accepted_count, "frames_sent %lu, expected %u", q.frames_sent, accepted_count);
+    CHECK(q.frames_dropped == dropped, "frames_dropped %lu, expected %u", q.frames_dropped, dropped);
+    CHECK(q.bytes_queued > 0, "backpressure never happened; test is not exercising the queue");
+
+    fprintf(stderr, "slow server: %u frames sent, %u dropped, %lu bytes went through the queue\n",
+            accepted_count, dropped, q.bytes_queued);
+
+    outq_destroy(&q);
+    close(sv[0]);
+    close(sv[1]);
+    free(r);
+}
+
+// Self-framed messages: the stream that arrives must be exactly the
+// accepted messages back to back, with no partial ones.
+static void test_messages(void) {
+    int sv[2];
+    struct outq q;
+    char msg[600];
+    char *expected = malloc(FRAMES * sizeof(msg));
+    char *got = malloc(FRAMES * sizeof(msg));
+    size_t expected_len = 0, got_len = 0;
+    unsigned sent = 0, dropped = 0;
+
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) < 0) {
+        perror("socketpair");
+        exit(1);
+    }
+
+    int sndbuf = 4096;
+    setsockopt(sv[0], SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf));
+    fcntl(sv[1], F_SETFL, O_NONBLOCK);
+
+    // smallest queue outq_init() allows, so it fills up often
+    CHECK(outq_init(&q, 0), "outq_init failed");
+
+    for (unsigned n = 0; n < FRAMES; ++n) {
+        size_t len = (size_t) snprintf(msg, sizeof(msg), "$PTA,%06X,", n);
+        size_t fill = (n * 7919u) % 500;
+        memset(msg + len, 'a' + n % 26, fill);
+        len += fill;
+        msg[len++] = '~';
+        msg[len++] = '*';
+
+        int ret = outq_send(&q, sv[0], msg, len);
+        CHECK(ret >= 0, "message %u: socket error", n);
+        if (ret == 1) {
+            memcpy(expected + expected_len, msg, len);
+            expected_len += len;
+            ++sent;
+        } else {
+            ++dropped;
+        }
+
+        // The client only takes about half of what it is sent
+        if (n % 8 == 0) {
+            ssize_t r = read(sv[1], got + got_len, 1 + (n * 31) % 2000);
+            if (r > 0)
+                got_len += r;
+        }
+    }
+
+    for (;;) {
+        int ret = outq_flush(&q, sv[0]);
+        CHECK(ret >= 0, "flush: socket error");
+        ssize_t r = read(sv[1], got + got_len, 65536);
+        if (r > 0)
+            got_len += r;
+        else if (ret != 0)
+            break;
+    }
+
+    CHECK(got_len == expected_len && !memcmp(got, expected, got_len),
+          "received stream differs from the accepted messages (%zu vs %zu bytes)", got_len, expected_len);
+    CHECK(dropped > 0, "no message was ever dropped; test is not exercising a full queue");
+    CHECK(q.frames_sent == sent && q.frames_dropped == dropped, "counters do not match");
+
+    fprintf(stderr, "messages: %u sent, %u dropped\n", sent, dropped);
+
+    outq_destroy(&q);
+    close(sv[0]);
+    close(sv[1]);
+    free(expected);
+    free(got);
+}
+
+static void test_closed_server(void) {
+    int sv[2];
+    struct outq q;
+    char payload[16] = {0};
+
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) < 0) {
+        perror("socketpair");
+        exit(1);
+    }
+    CHECK(outq_init(&q, QUEUE_SIZE), "outq_init failed");
+
+    close(sv[1]);
+    CHECK(outq_sendFrame(&q, sv[0], start, 1, payload, sizeof(payload)) < 0, "send to a closed peer did not fail");
+
+    outq_destroy(&q);
+    close(sv[0]);
+}
+
+int main(int argc, char **argv) {
+    (void) argc;
+    (void) argv;
+
+    test_slow_server();
+    test_messages();
+    test_closed_server();
+
+    if (failures) {
+        fprintf(stderr, "%d failures\n", failures);
+        return 1;
+    }
+    fprintf(stderr, "all tests passed\n");
+    return 0;
+}
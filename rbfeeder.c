@@ -51,6 +51,7 @@
 
 #include "rbfeeder.h"
 #include "dump1090.h"
+#include <sys/epoll.h>
 
 struct _Modes Modes;
 char *pidfile;
@@ -90,16 +91,15 @@ ClientType c_type = CLIENT_TYPE__OTHER;
 
 
 pthread_mutex_t m_copy; // Mutex copy
-pthread_t t_monitor;
-pthread_t t_statistics;
-pthread_t t_stats;
-pthread_t t_send_data;
+pthread_t t_feeder;
+pthread_t t_anrb;
 pthread_t t_prepareData;
 
 void rbfeederSigintHandler(int dummy) {
     MODES_NOTUSED(dummy);
     signal(SIGINT, SIG_DFL); // reset signal handler - bit extra safety
     Modes.exit = 1; // Signal to threads that we are done
+    airnav_stopFeeder();
 
 #ifdef RBCSRBLC
     led_off(LED_ADSB);
@@ -124,6 +124,7 @@ void rbfeederSigtermHandler(int dummy) {
     MODES_NOTUSED(dummy);
     signal(SIGTERM, SIG_DFL); // reset signal handler - bit extra safety
     Modes.exit = 1; // Signal to threads that we are done
+    airnav_stopFeeder();
 #ifdef RBCSRBLC
     led_off(LED_ADSB);
     led_off(LED_STATUS);
@@ -257,7 +258,150 @@ static void backgroundTasks(void) {
 
 }
 
- 
+/*
+ * Main loop: input sockets are read as soon as epoll reports them
+ * readable instead of on a fixed tick. The rest of backgroundTasks()
+ * runs off a once a second timer, and a one-shot timer flushes output
+ * that is waiting for Modes.net_output_flush_interval.
+ */
+static struct evloop main_loop;
+static int main_flush_timer = -1;
+static int main_flush_armed;
+static int main_net_ready;
+
+// A watched client socket, or a listener (client == NULL)
+struct main_watch {
+    struct client *client;
+    int fd;
+    int id; // evloop source id
+};
+static struct main_watch main_watches[EVLOOP_MAX_SOURCES];
+static int main_nwatches;
+
+static void mainNetReady(void *arg) {
+    MODES_NOTUSED(arg);
+    main_net_ready = 1;
+}
+
+static void mainFlush(void *arg) {
+    MODES_NOTUSED(arg);
+    main_flush_armed = 0;
+    main_net_ready = 1;
+}
+
+static void mainHousekeeping(void *arg) {
+    MODES_NOTUSED(arg);
+    backgroundTasks();
+}
+
+static int mainWatchValid(const struct main_watch *w) {
+    struct net_service *s;
+    struct client *cl;
+    int j;
+
+    if (w->client == NULL) {
+        for (s = Modes.services; s; s = s->next) {
+            for (j = 0; j < s->listener_count; ++j) {
+                if (s->listener_fds[j] == w->fd)
+                    return 1;
+            }
+        }
+        return 0;
+    }
+
+    for (cl = Modes.clients; cl; cl = cl->next) {
+        if (cl == w->client)
+            return (cl->fd == w->fd);
+    }
+    return 0;
+}
+
+static void mainWatch(struct client *cl, int fd) {
+    int i, id;
+
+    for (i = 0; i < main_nwatches; ++i) {
+        if (main_watches[i].client == cl && main_watches[i].fd == fd)
+            return;
+    }
+
+    if (main_nwatches >= EVLOOP_MAX_SOURCES ||
+        (id = evloop_addFd(&main_loop, fd, EPOLLIN, mainNetReady, NULL)) < 0) {
+        // Still served by the once a second housekeeping
+        airnav_log_level(2, "Could not watch fd %d: %s\n", fd, strerror(errno));
+        return;
+    }
+
+    main_watches[main_nwatches].client = cl;
+    main_watches[main_nwatches].fd = fd;
+    main_watches[main_nwatches].id = id;
+    main_nwatches++;
+}
+
+/*
+ * Bring the epoll set in line with Modes.services/Modes.clients. Must run
+ * after anything that can close or open a client, before a closed fd
+ * number can be handed out again
+ */
+static void mainSyncWatches(void) {
+    struct net_service *s;
+    struct client *cl;
+    int i, j;
+
+    for (i = 0; i < main_nwatches; ) {
+        if (!mainWatchValid(&main_watches[i])) {
+            evloop_removeFd(&main_loop, main_watches[i].id);
+            main_watches[i] = main_watches[--main_nwatches];
+        } else {
+            ++i;
+        }
+    }
+
+    for (s = Modes.services; s; s = s->next) {
+        for (j = 0; j < s->listener_count; ++j)
+            mainWatch(NULL, s->listener_fds[j]);
+    }
+
+    // Same clients modesNetPeriodicWork() reads from
+    for (cl = Modes.clients; cl; cl = cl->next) {
+        if (cl->fd >= 0 && cl->service && cl->service->read_handler)
+            mainWatch(cl, cl->fd);
+    }
+}
+
+static void mainLoopInit(void) {
+    if (!evloop_init(&main_loop) ||
+        evloop_addTimer(&main_loop, 1000, mainHousekeeping, NULL) < 0 ||
+        (main_flush_timer = evloop_addTimer(&main_loop, 0, mainFlush, NULL)) < 0) {
+        airnav_log("Could not create main event loop: %s\n", strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+}
+
+/*
+ * Sleep until there is input or a timer is due, then handle it
+ */
+static void mainLoopWait(void) {
+    struct net_service *s;
+
+    mainSyncWatches();
+    evloop_runOnce(&main_loop, -1);
+
+    if (main_net_ready) {
+        main_net_ready = 0;
+        modesNetPeriodicWork();
+    }
+    mainSyncWatches();
+
+    if (!main_flush_armed) {
+        for (s = Modes.services; s; s = s->next) {
+            if (s->writer && s->writer->dataUsed) {
+                main_flush_armed = evloop_setTimer(&main_loop, main_flush_timer, Modes.net_output_flush_interval);
+                break;
+            }
+        }
+    }
+}
+
 static int connectLocalDump(void) {
    char *bo_connect_ipaddr = "127.0.0.1";
    int bo_connect_port = (external_port + 100);
@@ -433,19 +577,18 @@ int main(int argc, char **argv) {
 
     // Initialization
     airnav_loadConfig(argc, argv);
+    airnav_logStart();
 
     rbfeeder_init();
     modesInitNet();
+    mainLoopInit();
     airnav_main();    
     connectData();
     
     // Run
     while (!Modes.exit) {
-        
-        struct timespec r = {0, 100 * 1000 * 1000};
 
-        backgroundTasks();
-        nanosleep(&r, NULL);
+        mainLoopWait();
 
         if (rfsurvey_execute == 1) {
 
@@ -494,13 +637,10 @@ int main(int argc, char **argv) {
 
     
     pthread_join(t_waitcmd, NULL);
-    pthread_join(t_monitor, NULL);
-    pthread_join(t_statistics, NULL);
-    pthread_join(t_stats, NULL);
-    pthread_join(t_send_data, NULL);
-    pthread_join(t_prepareData, NULL);
+    pthread_join(t_feeder, NULL);
     pthread_join(t_anrb, NULL);
-    pthread_join(t_anrb_send, NULL); 
+    pthread_join(t_prepareData, NULL);
+    evloop_destroy(&main_loop);
     
     if (dump978_enabled) {
         pthread_join(t_dump978, NULL);
@@ -523,19 +663,13 @@ int main(int argc, char **argv) {
     }
 
     // Clear flist
-    struct packet_list *tmp;
-    while (flist != NULL) {
-        if (flist->packet != NULL) {
-            free(flist->packet);
-        }
-        tmp = flist;                
-        flist = flist->next;
-        free(tmp);
-    }
+    pool_putPacketList(flist);
+    flist = NULL;
 
     removePidFile();
 
     airnav_log("Exit success!\n");
+    airnav_logStop();
     return EXIT_SUCCESS;
 }
 //
@@ -37,6 +37,9 @@
 #include "net_io.h"
 #include "airnav_anrb.h"
 #include "airnav_geomag.h"
+#include "airnav_maggrid.h"
+#include "airnav_pool.h"
+#include "airnav_evloop.h"
 
 
 #ifdef __cplusplus
@@ -125,10 +128,8 @@ extern "C" {
     extern int packet_list_count;
     extern int currently_tracked_flights;
     extern pthread_mutex_t m_copy; // Mutex copy
-    extern pthread_t t_monitor;
-    extern pthread_t t_statistics;
-    extern pthread_t t_stats;
-    extern pthread_t t_send_data;
+    extern pthread_t t_feeder;
+    extern pthread_t t_anrb;
     extern pthread_t t_prepareData;
     extern double max_cpu_temp;
     extern ClientType c_type;
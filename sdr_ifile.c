@@ -51,12 +51,24 @@
 #include "dump1090.h"
 #include "sdr_ifile.h"
 
+#include <sys/mman.h>
+#include <sys/wait.h>
+
 static struct {
-    const char *filename;
+    char **filenames;
+    unsigned filename_count;
     input_format_t input_format;
     bool throttle;
+    bool benchmark;
 
+    unsigned current;           // index into filenames of the open file
     int fd;
+    pid_t decompressor;         // gzip/xz child feeding fd, or -1
+    const char *map;            // whole file mapped, or NULL if reading from fd
+    size_t map_length;
+    size_t map_offset;          // next byte to convert
+    size_t map_released;        // pages below this have been released
+
     unsigned bytes_per_sample;
     unsigned bufsize;
     char *readbuf;
@@ -66,10 +78,18 @@ static struct {
 
 void ifileInitConfig(void)
 {
-    ifile.filename = NULL;
+    ifile.filenames = NULL;
+    ifile.filename_count = 0;
     ifile.input_format = INPUT_UC8;
     ifile.throttle = false;
+    ifile.benchmark = false;
+    ifile.current = 0;
     ifile.fd = -1;
+    ifile.decompressor = -1;
+    ifile.map = NULL;
+    ifile.map_length = 0;
+    ifile.map_offset = 0;
+    ifile.map_released = 0;
     ifile.bytes_per_sample = 0;
     ifile.bufsize = 0;
     ifile.readbuf = NULL;
@@ -81,12 +101,58 @@ void ifileShowHelp()
 {
     printf("      ifile-specific options (use with --ifile)\n");
     printf("\n");
-    printf("--ifile <path>           read samples from given file ('-' for stdin)\n");
+    printf("--ifile <path>           read samples from given file ('-' for stdin);\n");
+    printf("                         repeat to play several files in order;\n");
+    printf("                         .gz and .xz files are decompressed on the fly\n");
+    printf("--ifile-playlist <path>  read samples from each file listed in <path>\n");
+    printf("                         (one per line, blank lines and #comments ignored)\n");
     printf("--iformat <type>         set sample format (UC8, SC16, SC16Q11)\n");
     printf("--throttle               process samples at the original capture speed\n");
+    printf("--ifile-benchmark        process samples as fast as possible and report\n");
+    printf("                         samples/second when the input is exhausted\n");
     printf("\n");
 }
 
+static bool ifileAddFile(const char *path)
+{
+    char **newlist = realloc(ifile.filenames, (ifile.filename_count + 1) * sizeof(*newlist));
+    if (!newlist)
+        return false;
+    ifile.filenames = newlist;
+    if (!(ifile.filenames[ifile.filename_count] = strdup(path)))
+        return false;
+    ++ifile.filename_count;
+    return true;
+}
+
+static bool ifileReadPlaylist(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "ifile: could not open playlist %s: %s\n", path, strerror(errno));
+        return false;
+    }
+
+    char line[PATH_MAX + 2];
+    bool ok = true;
+    while (ok && fgets(line, sizeof(line), f)) {
+        char *p = line;
+        while (isspace((unsigned char) *p))
+            ++p;
+        char *end = p + strlen(p);
+        while (end > p && isspace((unsigned char) end[-1]))
+            --end;
+        *end = 0;
+
+        if (!*p || *p == '#')
+            continue;
+        ok = ifileAddFile(p);
+    }
+
+    fclose(f);
+    return ok;
+}
+
 bool ifileHandleOption(int argc, char **argv, int *jptr)
 {
     int j = *jptr;
@@ -94,7 +160,13 @@ bool ifileHandleOption(int argc, char **argv, int *jptr)
 
     if (!strcmp(argv[j], "--ifile") && more) {
         // implies --device-type ifile
-        ifile.filename = strdup(argv[++j]);
+        if (!ifileAddFile(argv[++j]))
+            return false;
+        Modes.sdr_type = SDR_IFILE;
+    } else if (!strcmp(argv[j], "--ifile-playlist") && more) {
+        // implies --device-type ifile
+        if (!ifileReadPlaylist(argv[++j]))
+            return false;
         Modes.sdr_type = SDR_IFILE;
     } else if (!strcmp(argv[j],"--iformat") && more) {
         ++j;
@@ -111,6 +183,8 @@ bool ifileHandleOption(int argc, char **argv, int *jptr)
         }
     } else if (!strcmp(argv[j],"--throttle")) {
         ifile.throttle = true;
+    } else if (!strcmp(argv[j],"--ifile-benchmark")) {
+        ifile.benchmark = true;
     } else {
         return false;
     }
@@ -119,6 +193,102 @@ bool ifileHandleOption(int argc, char **argv, int *jptr)
     return true;
 }
 
+static bool hasSuffix(const char *s, const char *suffix)
+{
+    size_t len = strlen(s), suffix_len = strlen(suffix);
+    return len >= suffix_len && !strcmp(s + len - suffix_len, suffix);
+}
+
+// Start "<program> -dc -- <path>" with its stdout connected to ifile.fd
+static bool ifileStartDecompressor(const char *program, const char *path)
+{
+    int pipefd[2];
+    if (pipe(pipefd) < 0) {
+        fprintf(stderr, "ifile: pipe: %s\n", strerror(errno));
+        return false;
+    }
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        fprintf(stderr, "ifile: fork: %s\n", strerror(errno));
+        close(pipefd[0]);
+        close(pipefd[1]);
+        return false;
+    }
+
+    if (pid == 0) {
+        // child
+        close(pipefd[0]);
+        if (dup2(pipefd[1], STDOUT_FILENO) < 0)
+            _exit(127);
+        close(pipefd[1]);
+        execlp(program, program, "-dc", "--", path, (char *) NULL);
+        _exit(127); // reported by ifileCloseFile
+    }
+
+    close(pipefd[1]);
+    ifile.fd = pipefd[0];
+    ifile.decompressor = pid;
+    return true;
+}
+
+// Open ifile.filenames[ifile.current]. Regular files are mapped and
+// converted in place; everything else (stdin, pipes, compressed files)
+// goes through read() into ifile.readbuf.
+static bool ifileOpenFile(void)
+{
+    const char *path = ifile.filenames[ifile.current];
+
+    if (!strcmp(path, "-")) {
+        ifile.fd = STDIN_FILENO;
+    } else if (hasSuffix(path, ".gz")) {
+        return ifileStartDecompressor("gzip", path);
+    } else if (hasSuffix(path, ".xz")) {
+        return ifileStartDecompressor("xz", path);
+    } else if ((ifile.fd = open(path, O_RDONLY)) < 0) {
+        fprintf(stderr, "ifile: could not open %s: %s\n",
+                path, strerror(errno));
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(ifile.fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0 && (uintmax_t) st.st_size <= SIZE_MAX) {
+        // If this fails (e.g. a huge file on a 32-bit system), just fall back to read()
+        void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, ifile.fd, 0);
+        if (map != MAP_FAILED) {
+            madvise(map, st.st_size, MADV_SEQUENTIAL);
+            ifile.map = map;
+            ifile.map_length = st.st_size;
+            ifile.map_offset = 0;
+            ifile.map_released = 0;
+        }
+    }
+
+    return true;
+}
+
+static void ifileCloseFile(void)
+{
+    if (ifile.map) {
+        munmap((void *) ifile.map, ifile.map_length);
+        ifile.map = NULL;
+    }
+
+    if (ifile.fd >= 0 && ifile.fd != STDIN_FILENO)
+        close(ifile.fd);
+    ifile.fd = -1;
+
+    if (ifile.decompressor > 0) {
+        // if we stopped early, the child gets SIGPIPE and exits
+        int status;
+        if (waitpid(ifile.decompressor, &status, 0) == ifile.decompressor && WIFEXITED(status) && WEXITSTATUS(status) != 0) {
+            fprintf(stderr, "ifile: decompressing %s failed (exit status %d)\n",
+                    ifile.filenames[ifile.current], WEXITSTATUS(status));
+        }
+        ifile.decompressor = -1;
+    }
+}
+
 //
 //=========================================================================
 //
@@ -127,19 +297,11 @@ bool ifileHandleOption(int argc, char **argv, int *jptr)
 //
 bool ifileOpen(void)
 {
-    if (!ifile.filename) {
+    if (!ifile.filename_count) {
         fprintf(stderr, "SDR type 'ifile' requires an --ifile argument\n");
         return false;
     }
 
-    if (!strcmp(ifile.filename, "-")) {
-        ifile.fd = STDIN_FILENO;
-    } else if ((ifile.fd = open(ifile.filename, O_RDONLY)) < 0) {
-        fprintf(stderr, "ifile: could not open %s: %s\n",
-                ifile.filename, strerror(errno));
-        return false;
-    }
-
     switch (ifile.input_format) {
     case INPUT_UC8:
         ifile.bytes_per_sample = 2;
@@ -172,9 +334,71 @@ bool ifileOpen(void)
         return false;
     }
 
+    ifile.current = 0;
+    if (!ifileOpenFile()) {
+        ifileClose();
+        return false;
+    }
+
     return true;
 }
 
+// Convert up to samples_wanted samples from the current file into outbuf;
+// returns the number converted and sets *eof at the end of the file
+static unsigned ifileConvert(struct mag_buf *outbuf, unsigned samples_wanted, bool *eof)
+{
+    const char *in;
+    unsigned samples_read;
+
+    if (ifile.map) {
+        size_t samples_left = (ifile.map_length - ifile.map_offset) / ifile.bytes_per_sample;
+        samples_read = samples_left < samples_wanted ? samples_left : samples_wanted;
+        in = ifile.map + ifile.map_offset;
+        ifile.map_offset += (size_t) samples_read * ifile.bytes_per_sample;
+        if (samples_read == samples_left)
+            *eof = true;
+    } else {
+        unsigned bytes_wanted = samples_wanted * ifile.bytes_per_sample;
+        if (bytes_wanted > ifile.bufsize)
+            bytes_wanted = ifile.bufsize;
+
+        unsigned bytes_read = 0;
+        while (bytes_read < bytes_wanted) {
+            ssize_t nread = read(ifile.fd, ifile.readbuf + bytes_read, bytes_wanted - bytes_read);
+            if (nread <= 0) {
+                if (nread < 0) {
+                    if (errno == EINTR)
+                        continue;
+                    fprintf(stderr, "ifile: error reading input file: %s\n", strerror(errno));
+                }
+                // Done.
+                *eof = true;
+                break;
+            }
+            bytes_read += nread;
+        }
+
+        samples_read = bytes_read / ifile.bytes_per_sample;
+        in = ifile.readbuf;
+    }
+
+    // (the converters only read their input, so passing the read-only mapping is fine)
+    ifile.converter((void *) in, &outbuf->data[outbuf->overlap], samples_read, ifile.converter_state, &outbuf->mean_level, &outbuf->mean_power);
+
+    if (ifile.map) {
+        // We won't look at the converted pages again; drop them so a long
+        // capture doesn't end up entirely resident
+        size_t page_size = (size_t) sysconf(_SC_PAGESIZE);
+        size_t release_to = ifile.map_offset / page_size * page_size;
+        if (release_to - ifile.map_released >= 64 * page_size) {
+            madvise((void *) (ifile.map + ifile.map_released), release_to - ifile.map_released, MADV_DONTNEED);
+            ifile.map_released = release_to;
+        }
+    }
+
+    return samples_read;
+}
+
 void ifileRun()
 {
     if (ifile.fd < 0)
@@ -182,16 +406,28 @@ void ifileRun()
 
     struct timespec next_buffer_delivery;
     clock_gettime(CLOCK_MONOTONIC, &next_buffer_delivery);
+    struct timespec start = next_buffer_delivery;
 
+    bool throttle = (ifile.throttle || Modes.interactive) && !ifile.benchmark;
     bool eof = false;
+    bool discontinuous = false;
     uint64_t sampleCounter = 0;
+    struct mag_buf *outbuf = NULL;
+
+    while (!Modes.exit) {
+        if (eof) {
+            // move on to the next file in the playlist, if any
+            ifileCloseFile();
+            if (++ifile.current >= ifile.filename_count || !ifileOpenFile())
+                break;
+            eof = false;
+            discontinuous = true;
+        }
 
-    while (!Modes.exit && !eof) {
         sdrMonitor();
 
         /* wait for up to 1000ms for a buffer */
-        struct mag_buf *outbuf = fifo_acquire(100 /* milliseconds */);
-        if (!outbuf) {
+        if (!outbuf && !(outbuf = fifo_acquire(100 /* milliseconds */))) {
             // maybe we're slow, maybe we halted
             continue;
         }
@@ -200,32 +436,19 @@ void ifileRun()
         outbuf->sampleTimestamp = sampleCounter * 12e6 / Modes.sample_rate;
         outbuf->sysTimestamp = mstime();
 
-        unsigned bytes_wanted = (outbuf->totalLength - outbuf->overlap) * ifile.bytes_per_sample;
-        if (bytes_wanted > ifile.bufsize)
-            bytes_wanted = ifile.bufsize;
-
-        unsigned bytes_read = 0;
-        while (bytes_read < bytes_wanted) {
-            ssize_t nread = read(ifile.fd, ifile.readbuf + bytes_read, bytes_wanted - bytes_read);
-            if (nread <= 0) {
-                if (nread < 0) {
-                    fprintf(stderr, "ifile: error reading input file: %s\n", strerror(errno));
-                }
-                // Done.
-                eof = true;
-                break;
-            }
-            bytes_read += nread;
+        // Convert the new data
+        unsigned samples_read = ifileConvert(outbuf, outbuf->totalLength - outbuf->overlap, &eof);
+        if (!samples_read) {
+            // nothing left in this file; keep the buffer for the next one
+            continue;
         }
 
-        unsigned samples_read = bytes_read / ifile.bytes_per_sample;
-
-        // Convert the new data
-        ifile.converter(ifile.readbuf, &outbuf->data[outbuf->overlap], samples_read, ifile.converter_state, &outbuf->mean_level, &outbuf->mean_power);
         outbuf->validLength = outbuf->overlap + samples_read;
-        outbuf->flags = 0;
+        // samples don't carry over between files
+        outbuf->flags = discontinuous ? MAGBUF_DISCONTINUOUS : 0;
+        discontinuous = false;
 
-        if (ifile.throttle || Modes.interactive) {
+        if (throttle) {
             // Wait until we are allowed to release this buffer to the FIFO
             while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next_buffer_delivery, NULL) == EINTR)
                 ;
@@ -237,11 +460,22 @@ void ifileRun()
 
         // Push the new data to the FIFO
         fifo_enqueue(outbuf);
+        outbuf = NULL;
         sampleCounter += samples_read;
     }
 
     // Wait for the FIFO to drain so we don't throw away trailing data
     fifo_drain();
+
+    if (ifile.benchmark) {
+        struct timespec end;
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        double elapsed = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+        double seconds_of_samples = sampleCounter / Modes.sample_rate;
+        fprintf(stderr, "ifile: %" PRIu64 " samples (%.1f seconds at %.1f MHz) in %.3f seconds: %.2f Msamples/second, %.1fx real time\n",
+                sampleCounter, seconds_of_samples, Modes.sample_rate / 1e6, elapsed,
+                sampleCounter / elapsed / 1e6, seconds_of_samples / elapsed);
+    }
 }
 
 void ifileClose()
@@ -257,8 +491,11 @@ void ifileClose()
         ifile.readbuf = NULL;
     }
 
-    if (ifile.fd >= 0 && ifile.fd != STDIN_FILENO) {
-        close(ifile.fd);
-        ifile.fd = -1;
-    }
+    ifileCloseFile();
+
+    for (unsigned i = 0; i < ifile.filename_count; ++i)
+        free(ifile.filenames[i]);
+    free(ifile.filenames);
+    ifile.filenames = NULL;
+    ifile.filename_count = 0;
 }
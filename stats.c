@@ -298,6 +298,19 @@ static void display_range_histogram(struct stats *st)
     printf("km\n");
 }
 
+const uint32_t latency_bucket_us[LATENCY_BUCKET_COUNT - 1] = {
+    100, 250, 500, 1000, 2000, 5000, 10000, 20000, 50000, 100000, 200000
+};
+
+void add_latency(struct stats *st, uint64_t usecs) {
+    int i;
+
+    for (i = 0; i < LATENCY_BUCKET_COUNT - 1; ++i)
+        if (usecs < latency_bucket_us[i])
+            break;
+    st->remote_latency[i]++;
+}
+
 void reset_stats(struct stats *st) {
     static struct stats st_zero;
     *st = st_zero;
@@ -362,6 +375,8 @@ void add_stats(const struct stats *st1, const struct stats *st2, struct stats *t
     target->remote_rejected_unknown_icao = st1->remote_rejected_unknown_icao + st2->remote_rejected_unknown_icao;
     for (i = 0; i < MODES_MAX_BITERRORS+1; ++i)
         target->remote_accepted[i]  = st1->remote_accepted[i] + st2->remote_accepted[i];
+    for (i = 0; i < LATENCY_BUCKET_COUNT; ++i)
+        target->remote_latency[i] = st1->remote_latency[i] + st2->remote_latency[i];
 
     // total messages:
     target->messages_total = st1->messages_total + st2->messages_total;
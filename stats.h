@@ -92,6 +92,9 @@ struct stats {
     uint32_t remote_rejected_bad;
     uint32_t remote_rejected_unknown_icao;
     uint32_t remote_accepted[MODES_MAX_BITERRORS+1];
+    // time from a remote message reaching the socket to useModesMessage()
+#define LATENCY_BUCKET_COUNT 12
+    uint32_t remote_latency[LATENCY_BUCKET_COUNT];
 
     // total messages:
     uint32_t messages_total;
@@ -142,7 +145,11 @@ struct stats {
     int adaptive_range_gain_limit;                      // Current adaptive-dynamic-range gain step limit
 };
 
+// upper bounds (microseconds) of all but the last latency bucket
+extern const uint32_t latency_bucket_us[LATENCY_BUCKET_COUNT - 1];
+
 void add_stats(const struct stats *st1, const struct stats *st2, struct stats *target);
+void add_latency(struct stats *st, uint64_t usecs);
 void display_stats(struct stats *st);
 void reset_stats(struct stats *st);
 
@@ -49,6 +49,7 @@
 
 #include "dump1090.h"
 #include <inttypes.h>
+#include <sched.h>
 
 /* #define DEBUG_CPR_CHECKS */
 
@@ -57,6 +58,225 @@ uint32_t modeAC_lastcount[4096];
 uint32_t modeAC_match[4096];
 uint32_t modeAC_age[4096];
 
+//
+// Address index over Modes.aircrafts.
+//
+// Open-addressed hash table with linear probing, keyed on addr and
+// hashed with icaoHash(). The linked list is still the canonical
+// store (everything else walks it); the index just makes
+// trackFindAircraft() independent of the number of tracked aircraft.
+// The table is grown to keep the load factor at or below 1/2.
+//
+
+// initial index size, must be a power of two:
+#define AIRCRAFT_INDEX_MIN_SIZE 1024
+
+static struct aircraft **aircraft_index;
+static uint32_t aircraft_index_size;
+static uint32_t aircraft_index_count;
+
+static void aircraftIndexPut(struct aircraft **table, uint32_t size, struct aircraft *a)
+{
+    uint32_t h = icaoHash(a->addr) & (size-1);
+    while (table[h])
+        h = (h+1) & (size-1);
+    table[h] = a;
+}
+
+static void aircraftIndexAdd(struct aircraft *a)
+{
+    if ((aircraft_index_count + 1) * 2 > aircraft_index_size) {
+        uint32_t newsize = aircraft_index_size ? aircraft_index_size * 2 : AIRCRAFT_INDEX_MIN_SIZE;
+        struct aircraft **newtable = calloc(newsize, sizeof(*newtable));
+        if (!newtable) {
+            fprintf(stderr, "failed to grow aircraft index to %u entries\n", newsize);
+            abort();
+        }
+
+        for (uint32_t i = 0; i < aircraft_index_size; ++i) {
+            if (aircraft_index[i])
+                aircraftIndexPut(newtable, newsize, aircraft_index[i]);
+        }
+
+        free(aircraft_index);
+        aircraft_index = newtable;
+        aircraft_index_size = newsize;
+    }
+
+    aircraftIndexPut(aircraft_index, aircraft_index_size, a);
+    ++aircraft_index_count;
+}
+
+static void aircraftIndexRemove(struct aircraft *a)
+{
+    uint32_t mask = aircraft_index_size - 1;
+    uint32_t h = icaoHash(a->addr) & mask;
+
+    while (aircraft_index[h] != a) {
+        if (!aircraft_index[h])
+            return; // not indexed
+        h = (h+1) & mask;
+    }
+
+    // Backward-shift deletion: pull later members of the probe run
+    // into the hole so lookups never need tombstones.
+    uint32_t hole = h;
+    for (;;) {
+        h = (h+1) & mask;
+        struct aircraft *b = aircraft_index[h];
+        if (!b)
+            break;
+
+        uint32_t home = icaoHash(b->addr) & mask;
+        // move b if its home slot is not cyclically within (hole, h]
+        if (((h - home) & mask) >= ((h - hole) & mask)) {
+            aircraft_index[hole] = b;
+            hole = h;
+        }
+    }
+
+    aircraft_index[hole] = NULL;
+    --aircraft_index_count;
+}
+
+//
+// Sharing Modes.aircrafts with other threads.
+//
+// Epoch-based reclamation: an aircraft unlinked by trackRemoveStaleAircraft()
+// goes on a limbo list stamped with the current epoch, and the epoch is
+// then advanced. A reader announces the epoch it started in; a retired
+// aircraft is freed once no reader is still in an epoch at or before the
+// one it was retired in. Readers never block the decoder, they only delay
+// the free().
+//
+// Field updates are covered by a per-aircraft sequence counter (seqlock):
+// a writer makes it odd for the duration of an update, and readers retry
+// a copy that overlapped one. Besides the decoder, the feeder writes back
+// its own state (a->an) through trackSetAirnavState(), so making the
+// counter odd is a compare-and-swap that waits out the other writer.
+//
+
+static atomic_uint_fast64_t track_epoch = 1;
+static atomic_uint_fast64_t reader_epoch[TRACK_MAX_READERS]; // 0 = not reading
+static atomic_int reader_count;
+static struct aircraft *retired_aircraft;
+
+int trackRegisterReader(void)
+{
+    int reader = atomic_fetch_add(&reader_count, 1);
+    if (reader >= TRACK_MAX_READERS) {
+        fprintf(stderr, "too many aircraft list readers\n");
+        abort();
+    }
+    return reader;
+}
+
+void trackReadBegin(int reader)
+{
+    // The fence keeps our reads of the list from moving ahead of the
+    // announcement (a store-release alone doesn't, on ARM): the decoder
+    // either sees it before it frees anything, or we see the list after
+    // it unlinked the aircraft. Pairs with the fence in
+    // trackReclaimAircraft().
+    atomic_store(&reader_epoch[reader], atomic_load(&track_epoch));
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+void trackReadEnd(int reader)
+{
+    atomic_store_explicit(&reader_epoch[reader], 0, memory_order_release);
+}
+
+void trackSnapshotAircraft(const struct aircraft *a, struct aircraft *copy)
+{
+    unsigned s1, s2;
+
+    for (;;) {
+        s1 = atomic_load_explicit(&((struct aircraft *) a)->seq, memory_order_acquire);
+        if (s1 & 1) {
+            sched_yield();
+            continue;
+        }
+
+        memcpy(copy, a, sizeof(*copy));
+
+        atomic_thread_fence(memory_order_acquire);
+        s2 = atomic_load_explicit(&((struct aircraft *) a)->seq, memory_order_relaxed);
+        if (s1 == s2)
+            return;
+    }
+}
+
+static inline void trackWriteBegin(struct aircraft *a)
+{
+    unsigned s = atomic_load_explicit(&a->seq, memory_order_relaxed);
+
+    for (;;) {
+        if (s & 1) {
+            // the other writer is half way through
+            sched_yield();
+            s = atomic_load_explicit(&a->seq, memory_order_relaxed);
+            continue;
+        }
+        if (atomic_compare_exchange_weak_explicit(&a->seq, &s, s + 1, memory_order_acquire, memory_order_relaxed))
+            break;
+    }
+    atomic_thread_fence(memory_order_release);
+}
+
+static inline void trackWriteEnd(struct aircraft *a)
+{
+    atomic_fetch_add_explicit(&a->seq, 1, memory_order_release);
+}
+
+void trackSetAirnavState(struct aircraft *a, const struct aircraft *from)
+{
+    trackWriteBegin(a);
+    a->an = from->an;
+    trackWriteEnd(a);
+}
+
+// Called with a already unlinked from Modes.aircrafts; a->next is left
+// alone so a reader standing on a can still move on
+static void trackRetireAircraft(struct aircraft *a)
+{
+    a->retired_epoch = atomic_load_explicit(&track_epoch, memory_order_relaxed);
+    a->retired_next = retired_aircraft;
+    retired_aircraft = a;
+}
+
+static void trackReclaimAircraft(void)
+{
+    uint64_t oldest = UINT64_MAX;
+    int readers;
+
+    if (!retired_aircraft)
+        return;
+
+    // Readers that start after this only ever see the list without the
+    // aircraft retired so far
+    atomic_fetch_add(&track_epoch, 1);
+    atomic_thread_fence(memory_order_seq_cst); // see trackReadBegin()
+
+    readers = atomic_load(&reader_count);
+    for (int i = 0; i < readers && i < TRACK_MAX_READERS; ++i) {
+        uint64_t e = atomic_load(&reader_epoch[i]);
+        if (e && e < oldest)
+            oldest = e;
+    }
+
+    struct aircraft **prev = &retired_aircraft;
+    while (*prev) {
+        struct aircraft *a = *prev;
+        if (a->retired_epoch < oldest) {
+            *prev = a->retired_next;
+            free(a);
+        } else {
+            prev = &a->retired_next;
+        }
+    }
+}
+
 //
 // Return a new aircraft structure for the linked list of tracked
 // aircraft
@@ -140,6 +360,8 @@ static struct aircraft *trackCreateAircraft(struct modesMessage *mm) {
 
     Modes.stats_current.unique_aircraft++;
 
+    aircraftIndexAdd(a);
+
     return (a);
 }
 
@@ -150,11 +372,16 @@ static struct aircraft *trackCreateAircraft(struct modesMessage *mm) {
 // exists with this address.
 //
 static struct aircraft *trackFindAircraft(uint32_t addr) {
-    struct aircraft *a = Modes.aircrafts;
+    if (!aircraft_index)
+        return (NULL);
 
-    while(a) {
+    uint32_t mask = aircraft_index_size - 1;
+    uint32_t h = icaoHash(addr) & mask;
+    struct aircraft *a;
+
+    while ((a = aircraft_index[h])) {
         if (a->addr == addr) return (a);
-        a = a->next;
+        h = (h+1) & mask;
     }
     return (NULL);
 }
@@ -941,9 +1168,12 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm)
     if (!a) {                              // If it's a currently unknown aircraft....
         a = trackCreateAircraft(mm);       // ., create a new record for it,
         a->next = Modes.aircrafts;         // .. and put it at the head of the list
+        atomic_thread_fence(memory_order_release); // (fully built before other threads can see it)
         Modes.aircrafts = a;
     }
 
+    trackWriteBegin(a);
+
     if (mm->signalLevel > 0) {
         a->signalLevel[a->signalNext] = mm->signalLevel;
         a->signalNext = (a->signalNext + 1) & 7;
@@ -968,9 +1198,13 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm)
     if (!mm->reliable && !a->reliable) {
         // no further update from this message as we don't trust it
         ++a->discarded;
+        trackWriteEnd(a);
         return a;
     }
 
+    // let the feeder know this track has something new to look at
+    atomic_store_explicit(&a->rpisrv_dirty, 1, memory_order_relaxed);
+
     // update addrtype, we only ever go towards "more direct" types
     if (mm->addrtype < a->addrtype)
         a->addrtype = mm->addrtype;
@@ -1283,6 +1517,7 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm)
         updatePosition(a, mm);
     }
 
+    trackWriteEnd(a);
     return (a);
 }
 
@@ -1386,14 +1621,17 @@ static void trackRemoveStaleAircraft(uint64_t now)
             if (!a->reliable)
                 Modes.stats_current.unreliable_aircraft++;
 
+            aircraftIndexRemove(a);
+
             // Remove the element from the linked list, with care
             // if we are removing the first element
             if (!prev) {
-                Modes.aircrafts = a->next; free(a); a = Modes.aircrafts;
+                Modes.aircrafts = a->next; trackRetireAircraft(a); a = Modes.aircrafts;
             } else {
-                prev->next = a->next; free(a); a = prev->next;
+                prev->next = a->next; trackRetireAircraft(a); a = prev->next;
             }
         } else {
+            trackWriteBegin(a);
 
 #define EXPIRE(_f) do { if (a->_f##_valid.source != SOURCE_INVALID && now >= a->_f##_valid.expires) { a->_f##_valid.source = SOURCE_INVALID; } } while (0)
             EXPIRE(callsign);
@@ -1438,6 +1676,7 @@ static void trackRemoveStaleAircraft(uint64_t now)
             EXPIRE(turbulence);
             EXPIRE(humidity);
 #undef EXPIRE
+            trackWriteEnd(a);
             prev = a; a = a->next;
         }
     }
@@ -1457,6 +1696,7 @@ void trackPeriodicUpdate()
     if (now >= next_update) {
         next_update = now + 1000;
         trackRemoveStaleAircraft(now);
+        trackReclaimAircraft();
         trackMatchAC(now);
     }
 }
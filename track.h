@@ -94,6 +94,12 @@ typedef struct {
 /* Structure used to describe the state of one tracked aircraft */
 struct aircraft {
     uint32_t addr; // ICAO address
+
+    // For threads other than the decoder (see trackReadBegin()):
+    atomic_uint seq; // odd while a writer (decoder, or feeder state write-back) is updating this aircraft
+    atomic_int rpisrv_dirty; // set when a message updates the track, cleared when prepareData sweeps it
+    struct aircraft *retired_next; // limbo list link once unlinked from Modes.aircrafts
+    uint64_t retired_epoch; // track epoch at which it was unlinked
     addrtype_t addrtype; // highest priority address type seen for this aircraft
 
     uint64_t seen; // Time (millis) at which the last packet was received
@@ -374,6 +380,8 @@ struct aircraft {
 
         uint64_t rpisrv_last_emitted; // time (millis) aircraft was last emitted
         uint64_t rpisrv_last_force_emit; // time (millis) we last emitted only-on-change data
+
+        long rpisrv_next_due; // earliest time (secs) a resend rule needs this aircraft swept while clean
     } an;
 
     struct aircraft *next; // Next aircraft in our linked list
@@ -415,6 +423,22 @@ struct aircraft *trackUpdateFromMessage(struct modesMessage *mm);
 /* Call periodically */
 void trackPeriodicUpdate();
 
+/* Other threads may walk Modes.aircrafts between trackReadBegin() and
+ * trackReadEnd(): aircraft unlinked by the decoder meanwhile are only
+ * freed once every reader has left the section it was in when they were
+ * unlinked. Fields can still change underneath a reader, so take a
+ * consistent copy with trackSnapshotAircraft() before looking at one.
+ * The decoder never waits for a reader.
+ */
+#define TRACK_MAX_READERS 4
+
+int trackRegisterReader(void);
+void trackReadBegin(int reader);
+void trackReadEnd(int reader);
+void trackSnapshotAircraft(const struct aircraft *a, struct aircraft *copy);
+/* Write back a->an (the feeder's own state) from a copy, as an update */
+void trackSetAirnavState(struct aircraft *a, const struct aircraft *from);
+
 /* Convert from a (hex) mode A value to a 0-4095 index */
 static inline unsigned modeAToIndex(unsigned modeA) {
     return (modeA & 0x0007) | ((modeA & 0x0070) >> 1) | ((modeA & 0x0700) >> 2) | ((modeA & 0x7000) >> 3);
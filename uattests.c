@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2020 - AirNav Systems
+ * 
+ * https://www.radarbox.com
+ * 
+ * More info: https://github.com/AirNav-Systems/rbfeeder
+ * 
+ */
+
+// uattests.c - replay test for the dump978 input framing (airnav_linebuf.c)
+//
+// Replays a dump978 JSON stream over a socketpair at 10x real time, using
+// metadata.received_at to pace it, and cut into chunks that split objects
+// and coalesce several of them the way TCP does. The reading side runs
+// the same poll/linebuf loop as uat_airnav_ext978() and must get back
+// every object exactly as sent.
+//
+// Usage: uattests [recorded-dump978-stream.json]
+// Without an argument a synthetic stream in dump978-fa format is used.
+
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+#include "airnav_linebuf.h"
+
+#define SPEEDUP 10
+#define LINEBUF_SIZE 16384 // as UAT_LINEBUF_SIZE
+
+struct stream {
+    char **lines;
+    double *when; // received_at, seconds
+    unsigned count;
+};
+
+static struct stream stream;
+
+static void add_line(const char *line, double when) {
+    static unsigned alloc = 0;
+
+    if (stream.count == alloc) {
+        alloc = alloc ? alloc * 2 : 1024;
+        stream.lines = realloc(stream.lines, alloc * sizeof(char *));
+        stream.when = realloc(stream.when, alloc * sizeof(double));
+    }
+    stream.lines[stream.count] = strdup(line);
+    stream.when[stream.count] = when;
+    stream.count++;
+}
+
+static void load_file(const char *path) {
+    FILE *f = fopen(path, "r");
+    char *line = NULL;
+    size_t cap = 0;
+    ssize_t n;
+    double last = 0;
+
+    if (!f) {
+        perror(path);
+        exit(1);
+    }
+
+    while ((n = getline(&line, &cap, f)) > 0) {
+        const char *p;
+        double when = last;
+
+        while (n > 0 && (line[n - 1] == '\n' || line[n - 1] == '\r'))
+            line[--n] = 0;
+        if (n == 0)
+            continue;
+
+        if ((p = strstr(line, "\"received_at\":")) != NULL)
+            when = strtod(p + strlen("\"received_at\":"), NULL);
+        add_line(line, when);
+        last = when;
+    }
+
+    free(line);
+    fclose(f);
+}
+
+// About 20 seconds of traffic from a busy 978 receiver, including bursts
+// where several reports share a timestamp
+static void make_synthetic(void) {
+    char line[1024];
+    double when = 1600000000.0;
+
+    srand(1);
+    for (unsigned i = 0; i < 4000; ++i) {
+        unsigned addr = 0xa00000 + (rand() % 200);
+
+        if (rand() % 4)
+            when += (rand() % 10) / 1000.0;
+
+        snprintf(line, sizeof(line),
+                 "{\"address\":\"%06x\",\"address_qualifier\":\"adsb_icao\",\"airground_state\":\"airborne\","
+                 "\"geometric_altitude\":%d,\"ground_speed\":%d,\"metadata\":{\"errors\":%d,\"received_at\":%.3f,\"rssi\":%.1f},"
+                 "\"position\":{\"lat\":%.5f,\"lon\":%.5f},\"true_track\":%.1f,\"vertical_velocity_geometric\":%d}",
+                 addr, 1000 + rand() % 30000, rand() % 400, rand() % 3, when, -30.0 + (rand() % 200) / 10.0,
+                 30.0 + (rand() % 10000) / 1000.0, -100.0 + (rand() % 10000) / 1000.0,
+                 (rand() % 3600) / 10.0, (rand() % 4000) - 2000);
+        add_line(line, when);
+    }
+}
+
+static int sv[2];
+
+static void sleep_until(const struct timespec *start, double offset) {
+    struct timespec t = *start;
+
+    t.tv_sec += (time_t) offset;
+    t.tv_nsec += (long) ((offset - (time_t) offset) * 1e9);
+    if (t.tv_nsec >= 1000000000) {
+        t.tv_sec++;
+        t.tv_nsec -= 1000000000;
+    }
+    clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &t, NULL);
+}
+
+static void write_all(const char *p, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(sv[0], p, len);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            perror("write");
+            exit(1);
+        }
+        p += n;
+        len -= n;
+    }
+}
+
+// dump978 side: send each line at its (sped-up) time, in odd-sized chunks
+static void *writer(void *arg) {
+    struct timespec start;
+    char *pending = NULL;
+    size_t pending_len = 0, pending_cap = 0;
+
+    (void) arg;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    for (unsigned i = 0; i < stream.count; ++i) {
+        size_t n = strlen(stream.lines[i]);
+
+        if (pending_len + n + 1 > pending_cap) {
+            pending_cap = (pending_len + n + 1) * 2;
+            pending = realloc(pending, pending_cap);
+        }
+        memcpy(pending + pending_len, stream.lines[i], n);
+        pending[pending_len + n] = '\n';
+        pending_len += n + 1;
+
+        // Reports with the same timestamp go out together
+        if (i + 1 < stream.count && stream.when[i + 1] == stream.when[i])
+            continue;
+
+        sleep_until(&start, (stream.when[i] - stream.when[0]) / SPEEDUP);
+
+        // Cut into pieces that don't line up with the objects
+        size_t off = 0;
+        while (off < pending_len) {
+            size_t chunk = 1 + rand() % 700;
+            if (chunk > pending_len - off)
+                chunk = pending_len - off;
+            write_all(pending + off, chunk);
+            off += chunk;
+        }
+        pending_len = 0;
+    }
+
+    free(pending);
+    shutdown(sv[0], SHUT_WR);
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    struct linebuf lb;
+    pthread_t thread;
+    unsigned received = 0;
+    int failures = 0;
+
+    if (argc > 1)
+        load_file(argv[1]);
+    else
+        make_synthetic();
+
+    if (stream.count == 0) {
+        fprintf(stderr, "FAIL: empty stream\n");
+        return 1;
+    }
+
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) < 0) {
+        perror("socketpair");
+        return 1;
+    }
+    if (!linebuf_init(&lb, LINEBUF_SIZE)) {
+        fprintf(stderr, "FAIL: linebuf_init\n");
+        return 1;
+    }
+
+    fprintf(stderr, "Replaying %u dump978 messages (%.1f s of traffic) at %dx\n",
+            stream.count, stream.when[stream.count - 1] - stream.when[0], SPEEDUP);
+
+    pthread_create(&thread, NULL, writer, NULL);
+
+    // Same loop shape as uat_airnav_ext978()
+    for (;;) {
+        struct pollfd pfd;
+        ssize_t r;
+        char *line;
+
+        pfd.fd = sv[1];
+        pfd.events = POLLIN;
+        if (poll(&pfd, 1, 1000) <= 0)
+            continue;
+
+        r = linebuf_read(&lb, sv[1]);
+        if (r == 0)
+            break;
+        if (r < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                continue;
+            perror("read");
+            return 1;
+        }
+
+        while ((line = linebuf_next(&lb)) != NULL) {
+            if (received >= stream.count) {
+                fprintf(stderr, "FAIL: more messages received than sent\n");
+                return 1;
+            }
+            if (strcmp(line, stream.lines[received]) != 0) {
+                if (failures++ < 10)
+                    fprintf(stderr, "FAIL: message %u differs\n", received);
+            }
+            received++;
+        }
+    }
+
+    pthread_join(thread, NULL);
+
+    if (received != stream.count) {
+        fprintf(stderr, "FAIL: %u of %u messages received\n", received, stream.count);
+        failures++;
+    }
+    if (lb.overflows != 0) {
+        fprintf(stderr, "FAIL: %lu overlong lines\n", lb.overflows);
+        failures++;
+    }
+
+    linebuf_destroy(&lb);
+    close(sv[0]);
+    close(sv[1]);
+
+    if (failures) {
+        fprintf(stderr, "%d failures\n", failures);
+        return 1;
+    }
+    fprintf(stderr, "all %u messages received intact\n", received);
+    return 0;
+}
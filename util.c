@@ -68,6 +68,14 @@ uint64_t mstime(void)
     return mst;
 }
 
+uint64_t ustime(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return ((uint64_t)tv.tv_sec)*1000000 + tv.tv_usec;
+}
+
 int64_t receiveclock_ns_elapsed(uint64_t t1, uint64_t t2)
 {
     return (t2 - t1) * 1000U / 12U;
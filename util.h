@@ -26,6 +26,9 @@
 /* Returns system time in milliseconds */
 uint64_t mstime(void);
 
+/* Returns system time in microseconds */
+uint64_t ustime(void);
+
 /* Returns the time for the current message we're dealing with */
 extern uint64_t _messageNow;
 static inline uint64_t messageNow() {